@@ -21,8 +21,11 @@
 #define _FASTDDS_TYPELOOKUP_SERVICE_MANAGER_HPP
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
-#include <vector>
+#include <chrono>
+#include <map>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include <fastdds/dds/builtin/typelookup/TypeLookupRequestListener.hpp>
 #include <fastdds/dds/builtin/typelookup/TypeLookupReplyListener.hpp>
@@ -42,6 +45,7 @@ class RTPSParticipantImpl;
 class StatefulReader;
 class StatefulWriter;
 class ParticipantProxyData;
+class TimedEvent;
 class WriterHistory;
 
 } // namespace rtps
@@ -168,6 +172,15 @@ public:
     fastrtps::rtps::SampleIdentity get_type_dependencies(
             const fastrtps::types::TypeIdentifierSeq& in) const;
 
+    /**
+     * Request the TypeObjects of a list of types.
+     *
+     * The request is not sent immediately. Types found in the process wide TypeLookupCache are notified without
+     * being requested, and the rest are joined with those of other calls in the same batch period into a single
+     * getTypes request. Replies are notified with the identity returned here.
+     * @param in TypeIdentifiers of the types.
+     * @return Identity of the request, INVALID_SAMPLE_IDENTITY if the TypeLookup client is disabled.
+     */
     fastrtps::rtps::SampleIdentity get_types(
             const fastrtps::types::TypeIdentifierSeq& in) const;
 
@@ -191,10 +204,49 @@ private:
     //! Get out instanceName as defined in 7.6.2.3.4 of the XTypes 1.2 document
     std::string get_instanceName() const;
 
+    //! getTypes request made through get_types()
+    struct TypesRequest
+    {
+        fastrtps::rtps::SampleIdentity id;
+        //! Types not notified yet
+        fastrtps::types::TypeIdentifierSeq type_ids;
+    };
+
+    //! getTypes request sent, waiting for a reply
+    struct SentTypesRequest
+    {
+        //! Time after which the request is dropped if not replied
+        std::chrono::steady_clock::time_point expiration;
+        //! Requests made through get_types() joined on the one sent
+        std::vector<TypesRequest> waiting;
+    };
+
+    //! Aux method to get the identity of a new request
+    fastrtps::rtps::SampleIdentity next_request_id() const;
+
     //! Aux method to send requests
     bool send_request(
             TypeLookup_Request& req) const;
 
+    //! Answer the queued getTypes requests from the cache and send a single request with the missing types
+    void send_types_requests();
+
+    //! Cache the verified types of a reply to one of our getTypes requests and notify the requests waiting for them
+    void on_types_reply(
+            const fastrtps::rtps::SampleIdentity& request_id,
+            const TypeLookup_getTypes_Out& out);
+
+    /**
+     * Drop the getTypes requests sent which were not replied in time.
+     * @return true if there are requests left waiting for a reply.
+     */
+    bool expire_types_requests();
+
+    //! Aux method to notify a type received for a request
+    void notify_type_discovery(
+            const fastrtps::rtps::SampleIdentity& request_id,
+            const fastrtps::types::TypeIdentifierTypeObjectPair& pair);
+
     //! Aux method to send replies
     bool send_reply(
             TypeLookup_Reply& rep) const;
@@ -251,8 +303,32 @@ private:
     fastrtps::rtps::ReaderProxyData temp_reader_proxy_data_;
     fastrtps::rtps::WriterProxyData temp_writer_proxy_data_;
 
+    //! Protects request_seq_number_
+    mutable std::mutex request_seq_mutex_;
+
     mutable fastrtps::rtps::SequenceNumber_t request_seq_number_;
 
+    //! Protects the getTypes requests. Held while sending, so replies are not processed before registering them.
+    mutable std::mutex types_requests_mutex_;
+
+    //! getTypes requests waiting for the batch period to elapse
+    mutable std::vector<TypesRequest> queued_types_requests_;
+
+    //! getTypes requests waiting for a reply, by the identity of the request sent
+    std::map<fastrtps::rtps::SampleIdentity, SentTypesRequest> sent_types_requests_;
+
+    //! Event sending the queued getTypes requests
+    fastrtps::rtps::TimedEvent* types_request_event_;
+
+    //! Event dropping the getTypes requests not replied in time
+    fastrtps::rtps::TimedEvent* types_reply_event_;
+
+    //! Time to wait for the reply of a getTypes request
+    std::chrono::steady_clock::duration types_reply_timeout_;
+
+    //! File where the TypeLookupCache is loaded from and saved to, empty if not persisted
+    std::string cache_file_;
+
     mutable TypeLookup_RequestTypeSupport request_type_;
 
     mutable TypeLookup_ReplyTypeSupport reply_type_;
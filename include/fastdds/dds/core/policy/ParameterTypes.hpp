@@ -160,6 +160,7 @@ enum ParameterId_t : uint16_t
     PID_DISABLE_POSITIVE_ACKS               = 0x8005,
     PID_DATASHARING                         = 0x8006,
     PID_NETWORK_CONFIGURATION_SET           = 0x8007,
+    PID_ANNOUNCEMENT_HASH                   = 0x8008,
 };
 
 /*!
@@ -1101,6 +1102,13 @@ const std::string parameter_property_ds_version = "DS_VERSION";
  */
 const std::string parameter_property_current_ds_version = "2.0";
 
+/**
+ * Parameter property ID announcing that compact participant announcements can be resolved
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const std::string parameter_property_compact_announcements = "COMPACT_ANNOUNCEMENTS";
+
 /**
  * Parameter property value for Host physical data
  *
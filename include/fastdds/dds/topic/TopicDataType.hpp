@@ -19,6 +19,7 @@
 #ifndef _FASTDDS_TOPICDATATYPE_HPP_
 #define _FASTDDS_TOPICDATATYPE_HPP_
 
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <string>
@@ -386,6 +387,42 @@ public:
 
 protected:
 
+    /**
+     * Fill an instance handle from the serialized key of a sample.
+     *
+     * As stated by the RTPS specification, keys whose maximum serialized size fits in the handle are copied into it,
+     * zero padded, so no hash is computed for them. Otherwise, or when forced, the MD5 digest of the key is used.
+     *
+     * @param key_buffer Key members of the sample, serialized as big endian CDR.
+     * @param key_length Number of bytes serialized into key_buffer.
+     * @param max_key_length Maximum serialized size of the key members of the type.
+     * @param force_md5 Use the MD5 digest even if the key fits in the handle.
+     * @param md5 Object used to compute the digest.
+     * @param [out] handle Handle to fill.
+     */
+    static inline void compute_key_hash(
+            const unsigned char* key_buffer,
+            size_t key_length,
+            size_t max_key_length,
+            bool force_md5,
+            MD5& md5,
+            fastrtps::rtps::InstanceHandle_t* handle)
+    {
+        fastrtps::rtps::octet* dst = handle->value;
+        if (force_md5 || max_key_length > 16)
+        {
+            md5.init();
+            md5.update(key_buffer, static_cast<MD5::size_type>(key_length));
+            md5.finalize();
+            memcpy(dst, md5.digest, 16);
+        }
+        else
+        {
+            memcpy(dst, key_buffer, key_length);
+            memset(&dst[key_length], 0, 16 - key_length);
+        }
+    }
+
     //!Type Identifier XTYPES 1.1
     std::shared_ptr<TypeIdV1> type_identifier_;
     //!Type Object XTYPES 1.1
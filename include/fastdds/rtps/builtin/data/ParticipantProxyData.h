@@ -119,6 +119,8 @@ public:
     ProxyHashTable<ReaderProxyData>* m_readers = nullptr;
     //!
     ProxyHashTable<WriterProxyData>* m_writers = nullptr;
+    //! Hash of the serialized announcement this data was last read from (0 when not set)
+    uint64_t m_announcement_hash = 0;
 
     /**
      * Update the data.
@@ -154,6 +156,41 @@ public:
             const NetworkFactory& network,
             bool is_shm_transport_available);
 
+    /**
+     * Get the size in bytes of the CDR serialization of the compact announcement of this object.
+     * @param include_encapsulation Whether to include the size of the encapsulation info.
+     * @return size in bytes of the CDR serialization.
+     */
+    uint32_t get_compact_serialized_size(
+            bool include_encapsulation) const;
+
+    /**
+     * Write a compact announcement as a parameter list on a CDRMessage_t.
+     * A compact announcement only identifies the participant and the full announcement it stands for,
+     * so it can only be resolved by receivers that already hold the full announcement.
+     * @param msg Pointer to the message.
+     * @param write_encapsulation Whether to write the encapsulation info.
+     * @param announcement_hash Hash of the full announcement, as computed by ParameterList::hash_parameter_list.
+     * @return True on success
+     */
+    bool writeCompactToCDRMessage(
+            CDRMessage_t* msg,
+            bool write_encapsulation,
+            uint64_t announcement_hash) const;
+
+    /**
+     * Check whether a received CDRMessage_t holds a compact announcement.
+     * Neither the contents nor the pos of the message are modified.
+     * @param msg Reference to the message.
+     * @param use_encapsulation Whether encapsulation field should be read.
+     * @param[out] announcement_hash Hash of the full announcement the compact one stands for.
+     * @return True if the message holds a compact announcement.
+     */
+    static bool readCompactAnnouncementHash(
+            const CDRMessage_t& msg,
+            bool use_encapsulation,
+            uint64_t& announcement_hash);
+
     //! Clear the data (restore to default state).
     void clear();
 
@@ -177,6 +214,17 @@ public:
      */
     GUID_t get_persistence_guid() const;
 
+    /**
+     * Announce that compact announcements from other participants can be resolved.
+     */
+    void set_compact_announcements_support();
+
+    /**
+     * Check whether the participant announced that it can resolve compact announcements.
+     * @return true when compact announcements can be sent to the participant.
+     */
+    bool supports_compact_announcements() const;
+
     /**
      * Set participant client server sample identity
      * @param sid valid SampleIdentity
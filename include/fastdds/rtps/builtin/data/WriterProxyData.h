@@ -386,6 +386,25 @@ public:
         return m_type_information != nullptr;
     }
 
+    /**
+     * Get the hash of the serialized announcement this object was last read from.
+     * @return Hash of the announcement, or 0 when it was not set.
+     */
+    RTPS_DllAPI uint64_t announcement_hash() const
+    {
+        return announcement_hash_;
+    }
+
+    /**
+     * Set the hash of the serialized announcement this object was read from.
+     * @param hash Hash of the announcement, as computed by ParameterList::hash_parameter_list.
+     */
+    RTPS_DllAPI void announcement_hash(
+            uint64_t hash)
+    {
+        announcement_hash_ = hash;
+    }
+
     //!WriterQOS
     WriterQos m_qos;
 
@@ -503,6 +522,9 @@ private:
 
     //!
     ParameterPropertyList_t m_properties;
+
+    //!Hash of the serialized announcement this object was last read from
+    uint64_t announcement_hash_ = 0;
 };
 
 } /* namespace rtps */
@@ -189,6 +189,16 @@ public:
     bool has_reader_proxy_data(
             const GUID_t& reader);
 
+    /**
+     * This method returns whether the last announcement processed for a remote reader had a specific hash.
+     * @param [in] reader GUID_t of the reader we are looking for.
+     * @param [in] announcement_hash Hash of the received announcement, as computed by ParameterList::hash_parameter_list.
+     * @return True if the reader is known and its information was read from an identical announcement.
+     */
+    bool is_reader_announcement_known(
+            const GUID_t& reader,
+            uint64_t announcement_hash);
+
     /**
      * This method gets a copy of a ReaderProxyData object if it is found among the registered RTPSParticipants
      * (including the local RTPSParticipant).
@@ -209,6 +219,16 @@ public:
     bool has_writer_proxy_data(
             const GUID_t& writer);
 
+    /**
+     * This method returns whether the last announcement processed for a remote writer had a specific hash.
+     * @param [in] writer GUID_t of the writer we are looking for.
+     * @param [in] announcement_hash Hash of the received announcement, as computed by ParameterList::hash_parameter_list.
+     * @return True if the writer is known and its information was read from an identical announcement.
+     */
+    bool is_writer_announcement_known(
+            const GUID_t& writer,
+            uint64_t announcement_hash);
+
     /**
      * This method gets a copy of a WriterProxyData object if it is found among the registered RTPSParticipants
      * (including the local RTPSParticipant).
@@ -470,6 +490,21 @@ protected:
     std::mutex callback_mtx_;
     //!Tell if object is enabled
     std::atomic<bool> enabled_ {false};
+    //!Number of periodic announcements between two full announcements. 0 disables compact announcements.
+    uint32_t compact_announcements_full_period_ = 0;
+    //!Number of periodic announcements since the last full announcement
+    uint32_t periodic_announcements_since_full_ = 0;
+    //!Whether the last change on the announcements history is a compact announcement, sent after the full one
+    bool compact_announcement_in_history_ = false;
+    //!Hash of the last full announcement, carried by compact announcements
+    uint64_t full_announcement_hash_ = 0;
+
+    /**
+     * Check whether compact announcements can be sent, which requires all the discovered participants to support them.
+     * Should be called with the PDP mutex locked.
+     * @return true when at least one remote participant is known and all of them support compact announcements.
+     */
+    bool remote_participants_support_compact_announcements_nts() const;
 
     /**
      * Adds an entry to the collection of participant proxy information.
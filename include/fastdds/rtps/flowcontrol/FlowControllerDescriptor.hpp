@@ -50,6 +50,39 @@ struct FlowControllerDescriptor
     //! Period of time on which the flow controller is allowed to send max_bytes_per_period.
     //! Default value: 100ms.
     uint64_t period_ms = 100;
+
+    //! Maximum number of bytes sent at once to a single destination.
+    //!
+    //! When not 0, max_bytes_per_period is not enforced on the flow controller as a whole, but on each destination
+    //! locator with a token bucket, refilled continuously at max_bytes_per_period every period_ms and holding
+    //! at most max_burst_bytes. Writers whose destinations run out of tokens are skipped, so the rest of writers of
+    //! the flow controller keep sending. A writer sends each sample to all its destinations at once, so it is paced
+    //! by the slowest of them. Only used when max_bytes_per_period is not 0.
+    //! Default value: 0
+    uint32_t max_burst_bytes = 0;
+
+    //! Number of threads sending the samples of the flow controller.
+    //!
+    //! Each writer is assigned to one of them, which sends its samples in order. Threads without pending samples of
+    //! their own writers send the samples of writers not being served by another thread.
+    //! Only used when max_bytes_per_period is 0.
+    //! Default value: 1
+    uint32_t sender_threads = 1;
+
+    //! Maximum time in microseconds a sent sample waits for later ones to be sent in the same message.
+    //!
+    //! When not 0, the messages of the sender threads are not sent as soon as there are no more samples to send, but
+    //! when the first sample added to them has waited this time, or when max_coalescing_bytes are pending.
+    //! Meanwhile, new samples of the same writer are added to the same message.
+    //! Only used when max_bytes_per_period is 0.
+    //! Default value: 0
+    uint32_t max_coalescing_delay_us = 0;
+
+    //! Number of pending bytes making a sender thread send its message when max_coalescing_delay_us is not 0.
+    //!
+    //! 0 value means no limit, apart from the maximum message size.
+    //! Default value: 0
+    uint32_t max_coalescing_bytes = 0;
 };
 
 } // namespace rtps
@@ -37,7 +37,10 @@ enum class FlowControllerSchedulerPolicy : int32_t
     HIGH_PRIORITY,
     //! Priority with reservation scheduler policy: guarantee each DataWriter's minimum reservation of throughput.
     //! Samples not fitting the reservation are scheduled by priority.
-    PRIORITY_WITH_RESERVATION
+    PRIORITY_WITH_RESERVATION,
+    //! Earliest deadline first scheduler policy: samples whose deadline, given by the DataWriter's deadline and
+    //! lifespan, comes first are scheduled first. Samples whose lifespan expired are not sent.
+    EARLIEST_DEADLINE_FIRST
 };
 
 } // namespace rtps
@@ -79,6 +79,11 @@ inline bool readUInt32(
         CDRMessage_t* msg,
         uint32_t* ulo);
 
+inline bool readUInt32Array(
+        CDRMessage_t* msg,
+        uint32_t* ulo,
+        uint32_t count);
+
 inline bool readInt64(
         CDRMessage_t* msg,
         int64_t* lolo);
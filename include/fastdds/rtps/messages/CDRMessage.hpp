@@ -25,11 +25,80 @@
 #include <limits>
 #include <vector>
 
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif // if defined(_MSC_VER)
+
 #include <fastdds/dds/core/policy/ParameterTypes.hpp>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
+namespace CDRMessage {
+namespace detail {
+
+inline uint32_t byte_swap(
+        uint32_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#else
+    return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) |
+           ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
+#endif // if defined(_MSC_VER)
+}
+
+inline uint64_t byte_swap(
+        uint64_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+    return (static_cast<uint64_t>(byte_swap(static_cast<uint32_t>(value))) << 32) |
+           byte_swap(static_cast<uint32_t>(value >> 32));
+#endif // if defined(_MSC_VER)
+}
+
+// Values are copied at once and swapped in registers, instead of copying their bytes one by one
+template<typename T, typename U>
+inline void read_swapped(
+        CDRMessage_t* msg,
+        U* value)
+{
+    static_assert(sizeof(T) == sizeof(U), "Sizes must match");
+    T raw;
+    memcpy(&raw, &msg->buffer[msg->pos], sizeof(T));
+    if (msg->msg_endian != DEFAULT_ENDIAN)
+    {
+        raw = byte_swap(raw);
+    }
+    memcpy(value, &raw, sizeof(T));
+    msg->pos += sizeof(T);
+}
+
+template<typename T, typename U>
+inline void add_swapped(
+        CDRMessage_t* msg,
+        U value)
+{
+    static_assert(sizeof(T) == sizeof(U), "Sizes must match");
+    T raw;
+    memcpy(&raw, &value, sizeof(T));
+    if (msg->msg_endian != DEFAULT_ENDIAN)
+    {
+        raw = byte_swap(raw);
+    }
+    memcpy(&msg->buffer[msg->pos], &raw, sizeof(T));
+    msg->pos += sizeof(T);
+    msg->length += sizeof(T);
+}
+
+} // namespace detail
+} // namespace CDRMessage
 
 inline bool CDRMessage::initCDRMsg(
         CDRMessage_t* msg,
@@ -149,19 +218,7 @@ inline bool CDRMessage::readInt32(
     {
         return false;
     }
-    octet* dest = (octet*)lo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-        msg->pos += 4;
-    }
-    else
-    {
-        readDataReversed(msg, dest, 4);
-    }
+    detail::read_swapped<uint32_t>(msg, lo);
     return true;
 }
 
@@ -173,19 +230,28 @@ inline bool CDRMessage::readUInt32(
     {
         return false;
     }
-    octet* dest = (octet*)ulo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
+    detail::read_swapped<uint32_t>(msg, ulo);
+    return true;
+}
+
+inline bool CDRMessage::readUInt32Array(
+        CDRMessage_t* msg,
+        uint32_t* ulo,
+        uint32_t count)
+{
+    if (msg->pos + 4ull * count > msg->length)
     {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-        msg->pos += 4;
+        return false;
     }
-    else
+    memcpy(ulo, &msg->buffer[msg->pos], 4ull * count);
+    if (msg->msg_endian != DEFAULT_ENDIAN)
     {
-        readDataReversed(msg, dest, 4);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ulo[i] = detail::byte_swap(ulo[i]);
+        }
     }
+    msg->pos += 4 * count;
     return true;
 }
 
@@ -197,22 +263,7 @@ inline bool CDRMessage::readInt64(
     {
         return false;
     }
-
-    octet* dest = (octet*)lolo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 8; ++i)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-
-        msg->pos += 8;
-    }
-    else
-    {
-        readDataReversed(msg, dest, 8);
-    }
-
+    detail::read_swapped<uint64_t>(msg, lolo);
     return true;
 }
 
@@ -224,22 +275,7 @@ inline bool CDRMessage::readUInt64(
     {
         return false;
     }
-
-    octet* dest = (octet*)ulolo;
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 8; ++i)
-        {
-            dest[i] = msg->buffer[msg->pos + i];
-        }
-
-        msg->pos += 8;
-    }
-    else
-    {
-        readDataReversed(msg, dest, 8);
-    }
-
+    detail::read_swapped<uint64_t>(msg, ulolo);
     return true;
 }
 
@@ -274,10 +310,7 @@ inline SequenceNumberSet_t CDRMessage::readSequenceNumberSet(
 
     uint32_t n_longs = (numBits + 31u) / 32u;
     uint32_t bitmap[8];
-    for (uint32_t i = 0; valid && (i < n_longs); ++i)
-    {
-        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
-    }
+    valid = valid && CDRMessage::readUInt32Array(msg, bitmap, n_longs);
 
     if (valid)
     {
@@ -303,10 +336,7 @@ inline bool CDRMessage::readFragmentNumberSet(
 
     uint32_t n_longs = (numBits + 31u) / 32u;
     uint32_t bitmap[8];
-    for (uint32_t i = 0; valid && (i < n_longs); ++i)
-    {
-        valid &= CDRMessage::readUInt32(msg, &bitmap[i]);
-    }
+    valid = valid && CDRMessage::readUInt32Array(msg, bitmap, n_longs);
 
     if (valid)
     {
@@ -557,27 +587,11 @@ inline bool CDRMessage::addInt32(
         CDRMessage_t* msg,
         int32_t lo)
 {
-    octet* o = (octet*)&lo;
     if (msg->pos + 4 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 3 - i);
-        }
-    }
-    msg->pos += 4;
-    msg->length += 4;
+    detail::add_swapped<uint32_t>(msg, lo);
     return true;
 }
 
@@ -585,27 +599,11 @@ inline bool CDRMessage::addUInt32(
         CDRMessage_t* msg,
         uint32_t ulo)
 {
-    octet* o = (octet*)&ulo;
     if (msg->pos + 4 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 3 - i);
-        }
-    }
-    msg->pos += 4;
-    msg->length += 4;
+    detail::add_swapped<uint32_t>(msg, ulo);
     return true;
 }
 
@@ -613,27 +611,11 @@ inline bool CDRMessage::addInt64(
         CDRMessage_t* msg,
         int64_t lolo)
 {
-    octet* o = (octet*)&lolo;
     if (msg->pos + 8 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 7 - i);
-        }
-    }
-    msg->pos += 8;
-    msg->length += 8;
+    detail::add_swapped<uint64_t>(msg, lolo);
     return true;
 }
 
@@ -641,27 +623,11 @@ inline bool CDRMessage::addUInt64(
         CDRMessage_t* msg,
         uint64_t ulolo)
 {
-    octet* o = (octet*)&ulolo;
     if (msg->pos + 8 > msg->max_size)
     {
         return false;
     }
-    if (msg->msg_endian == DEFAULT_ENDIAN)
-    {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + i);
-        }
-    }
-    else
-    {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            msg->buffer[msg->pos + i] = *(o + 7 - i);
-        }
-    }
-    msg->pos += 8;
-    msg->length += 8;
+    detail::add_swapped<uint64_t>(msg, ulolo);
     return true;
 }
 
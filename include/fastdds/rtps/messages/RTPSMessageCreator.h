@@ -113,6 +113,11 @@ public:
      * @param[in] guidPrefix Guid Prefix of the RTPSParticipant.
      * @param[in] param Different parameters depending on the message.
      * @return True if correct.
+     *
+     * When @c payload_position is given, addSubmessageData and addSubmessageDataFrag do not copy the serialized
+     * payload, which is then sent from its own buffer. The submessage is written as if it contained the payload, and
+     * @c payload_position receives the position of @c msg where the payload should be inserted (0 when the
+     * submessage carries no payload).
      */
 
     /// @{
@@ -133,7 +138,8 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos,
-            bool* is_big_submessage);
+            bool* is_big_submessage,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageDataFrag(
             CDRMessage_t* msg,
@@ -152,7 +158,8 @@ public:
             TopicKind_t topicKind,
             const EntityId_t& readerId,
             bool expectsInlineQos,
-            InlineQosWriter* inlineQos);
+            InlineQosWriter* inlineQos,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageGap(
             CDRMessage_t* msg,
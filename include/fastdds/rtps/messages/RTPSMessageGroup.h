@@ -232,6 +232,20 @@ public:
         sender_ = msg_sender;
     }
 
+    /*!
+     * Change the endpoint adding the next RTPS submessages, keeping the submessages already added.
+     * Only valid when the destinations of the sender do not depend on the endpoint, and RTPS protection is not used.
+     *
+     * @param endpoint Pointer to next Endpoint sender.
+     * @pre A sender has already been set.
+     */
+    void endpoint(
+            Endpoint* endpoint)
+    {
+        assert(endpoint != nullptr && sender_ != nullptr);
+        endpoint_ = endpoint;
+    }
+
     //! Maximum fragment size minus the headers
     static inline constexpr uint32_t get_max_fragment_payload_size()
     {
@@ -252,13 +266,21 @@ public:
 
     inline uint32_t get_current_bytes_processed() const
     {
-        return current_sent_bytes_ + full_msg_->length;
+        return current_sent_bytes_ + full_msg_->length + gathered_bytes_;
+    }
+
+    //! Number of bytes of the submessages added since the last message was sent.
+    inline uint32_t get_pending_bytes() const
+    {
+        return full_msg_->length - RTPSMESSAGE_HEADER_SIZE + gathered_bytes_;
     }
 
 private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
+    //! Smaller payloads are cheaper to copy into the message than to send from their own buffer
+    static constexpr uint32_t min_gathered_payload_size_ = 1024;
 
     void reset_to_header();
 
@@ -284,6 +306,20 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    bool append_submessage();
+
+    /**
+     * Check whether a payload can be sent from the buffer where it is stored, instead of being copied into the
+     * message.
+     * @param change Change owning the payload.
+     * @param length Number of bytes of the payload to send.
+     */
+    bool can_gather_payload(
+            const CacheChange_t& change,
+            uint32_t length) const;
+
+    void release_gathered_payloads();
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -323,6 +359,21 @@ private:
     uint32_t sent_bytes_limitation_ = 0;
 
     uint32_t current_sent_bytes_ = 0;
+
+    //! Bytes of the payloads of the message not copied into full_msg_
+    uint32_t gathered_bytes_ = 0;
+
+    //! Change whose payload is left out of submessage_msg_, or nullptr
+    const CacheChange_t* pending_payload_change_ = nullptr;
+
+    //! First byte of the payload left out of submessage_msg_
+    const octet* pending_payload_data_ = nullptr;
+
+    //! Number of bytes of the payload left out of submessage_msg_
+    uint32_t pending_payload_length_ = 0;
+
+    //! Position of submessage_msg_ where the payload left out of it is inserted
+    uint32_t pending_payload_position_ = 0;
 };
 
 }        /* namespace rtps */
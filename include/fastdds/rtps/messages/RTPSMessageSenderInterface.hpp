@@ -24,7 +24,9 @@
 
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 
+#include <chrono>
 #include <vector>
 
 namespace eprosima {
@@ -81,6 +83,25 @@ public:
             CDRMessage_t* message,
             std::chrono::steady_clock::time_point max_blocking_time_point) const = 0;
 
+    /**
+     * Send a message made of several slices through this interface.
+     *
+     * The default implementation copies the slices into a single buffer.
+     *
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const
+    {
+        CDRMessage_t message(total_bytes);
+        message.length = fastdds::rtps::copy_network_buffers(buffers, message.buffer);
+        return send(&message, max_blocking_time_point);
+    }
+
     /*!
      * Lock the object.
      */
@@ -28,6 +28,8 @@
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/statistics/IListeners.hpp>
+#include <fastdds/statistics/rtps/ReliabilityTuning.hpp>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastrtps/qos/WriterQos.h>
 
@@ -333,6 +335,25 @@ public:
     void set_enabled_statistics_writers_mask(
             uint32_t enabled_writers);
 
+    /**
+     * @brief Retrieve the discovery startup timeline recorded by this participant
+     *
+     * @param [out] profile Timeline of the participant
+     */
+    void get_startup_profile(
+            fastdds::statistics::StartupProfile& profile) const;
+
+    /**
+     * @brief Retrieve the heartbeat period and NACK response delay in use by a reliable writer of this participant
+     *
+     * @param writer_guid GUID of the writer
+     * @param [out] tuning Times in use by the writer
+     * @return false if the writer is not a reliable writer of this participant, true otherwise
+     */
+    bool get_reliability_tuning(
+            const GUID_t& writer_guid,
+            fastdds::statistics::ReliabilityTuning& tuning) const;
+
 #endif // FASTDDS_STATISTICS
 
 private:
@@ -32,6 +32,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ControlMessageGroup;
 class WriterProxy;
 class RTPSMessageSenderInterface;
 
@@ -269,6 +270,21 @@ public:
             RTPSMessageSenderInterface* sender,
             bool heartbeat_was_final);
 
+    /**
+     * Adds the acknack message responding to a heartbeat to the control messages of the participant.
+     * @param writer Pointer to the proxy representing the writer to send the acknack to.
+     * @param sender Message sender interface.
+     * @param heartbeat_was_final Final flag of the last received heartbeat.
+     * @param group Control messages of the participant.
+     * @param destinations Destination locators of the writer, updated with its current ones.
+     */
+    void send_acknack(
+            const WriterProxy* writer,
+            RTPSMessageSenderInterface* sender,
+            bool heartbeat_was_final,
+            ControlMessageGroup& group,
+            std::vector<Locator_t>& destinations);
+
     /**
      * Use the participant of this reader to send a message to certain locator.
      * @param message Message to be sent.
@@ -349,6 +365,16 @@ private:
             const GUID_t& writerGUID,
             bool is_payload_pool_lost = false);
 
+    /*!
+     * Adds the acknack and nackfrag messages responding to a heartbeat.
+     * @remarks Non thread-safe.
+     */
+    void add_heartbeat_response_nts(
+            const WriterProxy* writer,
+            RTPSMessageSenderInterface* sender,
+            bool heartbeat_was_final,
+            RTPSMessageGroup& group);
+
     //! Acknack Count
     uint32_t acknack_count_;
     //! NACKFRAG Count
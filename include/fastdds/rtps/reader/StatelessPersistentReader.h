@@ -28,6 +28,7 @@ namespace fastrtps {
 namespace rtps {
 
 class IPersistenceService;
+class ReaderSequenceStorage;
 
 /**
  * Class StatelessPersistentReader, specialization of StatelessReader that manages sequence number persistence.
@@ -85,6 +86,7 @@ private:
 
     IPersistenceService* persistence_;
     std::string persistence_guid_;
+    ReaderSequenceStorage* sequence_storage_;
 };
 
 } // namespace rtps
@@ -0,0 +1,75 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_NETWORKBUFFER_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_NETWORKBUFFER_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fastdds/rtps/common/Types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * A slice of a message to be sent. A message may be split in several slices, so parts of it (i.e. the serialized
+ * payloads) can be sent from where they are stored instead of being copied into a single buffer.
+ * @ingroup TRANSPORT_MODULE
+ */
+struct NetworkBuffer
+{
+    //! Pointer to the first byte of the slice.
+    const void* buffer = nullptr;
+    //! Number of bytes of the slice.
+    uint32_t size = 0;
+
+    NetworkBuffer() = default;
+
+    NetworkBuffer(
+            const void* ptr,
+            uint32_t length)
+        : buffer(ptr)
+        , size(length)
+    {
+    }
+
+};
+
+/**
+ * Copy a list of slices into a single buffer.
+ * @param buffers Slices to copy, in order.
+ * @param [out] data Buffer where the slices are copied. Must have room for all of them.
+ * @return Number of bytes copied.
+ */
+inline uint32_t copy_network_buffers(
+        const std::vector<NetworkBuffer>& buffers,
+        fastrtps::rtps::octet* data)
+{
+    uint32_t length = 0;
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        memcpy(data + length, buffer.buffer, buffer.size);
+        length += buffer.size;
+    }
+    return length;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_NETWORKBUFFER_HPP_
@@ -22,6 +22,7 @@
 #include <chrono>
 
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -69,6 +70,35 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends a message made of several slices to a destination locator, through the channel managed by this resource.
+     * Transports which cannot send the slices directly receive a copy of the whole message.
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        if (send_buffers_lambda_)
+        {
+            return send_buffers_lambda_(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                           max_blocking_time_point);
+        }
+
+        std::vector<octet> data(total_bytes);
+        fastdds::rtps::copy_network_buffers(buffers, data.data());
+        return send(data.data(), total_bytes, destination_locators_begin, destination_locators_end,
+                       max_blocking_time_point);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -78,6 +108,7 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
     }
 
     virtual ~SenderResource() = default;
@@ -115,6 +146,13 @@ protected:
                 LocatorsIterator* destination_locators_begin,
                 LocatorsIterator* destination_locators_end,
                 const std::chrono::steady_clock::time_point&)> send_lambda_;
+    //! Optional. When not set, messages made of several slices are copied into a single buffer.
+    std::function<bool(
+                const std::vector<fastdds::rtps::NetworkBuffer>&,
+                uint32_t,
+                LocatorsIterator* destination_locators_begin,
+                LocatorsIterator* destination_locators_end,
+                const std::chrono::steady_clock::time_point&)> send_buffers_lambda_;
 
 private:
 
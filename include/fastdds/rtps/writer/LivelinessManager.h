@@ -23,7 +23,10 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastrtps/utils/shared_mutex.hpp>
 
+#include <limits>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -129,17 +132,90 @@ public:
 
 private:
 
+    //! Index used to mark the absence of a writer in the lease lists
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    //! Position of a writer in the list of alive writers of its lease bucket. Parallel to writers_.
+    struct LeaseNode
+    {
+        //! Index of the lease bucket of the writer
+        size_t bucket = npos;
+        //! Previous alive writer in the bucket, i.e. the one losing liveliness right before
+        size_t prev = npos;
+        //! Next alive writer in the bucket, i.e. the one losing liveliness right after
+        size_t next = npos;
+    };
+
+    /**
+     * @brief Alive writers sharing a lease duration.
+     * @details As writers are appended when asserted, they are sorted by the time they lose liveliness,
+     * so the head of the list is always the next one to expire.
+     */
+    struct LeaseBucket
+    {
+        //! The lease duration shared by the writers of the bucket
+        Duration_t lease_duration;
+        //! First alive writer of the bucket
+        size_t head = npos;
+        //! Last alive writer of the bucket
+        size_t tail = npos;
+    };
+
+    //! Hash functor for GUID_t
+    struct GuidHash
+    {
+        size_t operator ()(
+                const GUID_t& guid) const;
+    };
+
+    /**
+     * @brief Looks for a writer in the set
+     * @pre The collection shared_mutex must be taken
+     * @return The index of the writer in writers_, npos if not found
+     */
+    size_t find_writer(
+            const GUID_t& guid,
+            LivelinessQosPolicyKind kind,
+            const Duration_t& lease_duration) const;
+
+    /**
+     * @brief Returns the lease bucket for a lease duration, creating it if needed
+     * @pre std::mutex_ must be taken
+     */
+    size_t bucket_for(
+            const Duration_t& lease_duration);
+
+    /**
+     * @brief Appends a writer to the tail of the alive list of its lease bucket
+     * @pre std::mutex_ must be taken and the writer must not be in the list
+     */
+    void link_alive(
+            size_t index);
+
+    /**
+     * @brief Removes a writer from the alive list of its lease bucket
+     * @pre std::mutex_ must be taken
+     */
+    void unlink_alive(
+            size_t index);
+
+    /**
+     * @brief Rebuilds the GUID index and the lease buckets after removing writers
+     * @pre The collection shared_mutex must be taken exclusively, and std::mutex_ must be taken
+     */
+    void rebuild_index();
+
     /**
      * @brief A method responsible for invoking the callback when liveliness is asserted
-     * @param writer The liveliness data of the writer asserting liveliness
+     * @param index The index of the writer asserting liveliness
      * @pre The collection shared_mutex must be taken for reading
      */
     void assert_writer_liveliness(
-            LivelinessData& writer);
+            size_t index);
 
     /**
      * @brief A method to calculate the time when the next writer is going to lose liveliness
-     * @details This method is public for testing purposes but it should not be used from outside this class
+     * @details Only the head of each lease bucket needs to be checked.
      * @pre std::mutex_ should not be taken on calling this method to avoid deadlock.
      * @return True if at least one writer is alive
      */
@@ -158,6 +234,18 @@ private:
     //! A vector of liveliness data
     ResourceLimitedVector<LivelinessData> writers_;
 
+    //! Lease list position of each element of writers_
+    std::vector<LeaseNode> nodes_;
+
+    //! The lease buckets, one per distinct lease duration
+    std::vector<LeaseBucket> buckets_;
+
+    //! Index of the elements of writers_ by GUID
+    std::unordered_multimap<GUID_t, size_t, GuidHash> index_;
+
+    //! Number of alive writers of each liveliness kind
+    uint32_t alive_count_[3] = {0, 0, 0};
+
     //! A mutex to protect the liveliness data included LivelinessData objects
     std::mutex mutex_;
 
@@ -64,12 +64,26 @@ public:
     void remove_persistent_change(
             CacheChange_t* change);
 
+    /**
+     * Read from storage the payload of a change loaded lazily.
+     * Does nothing when the change already has its payload.
+     * Only the first failure is logged as an error.
+     * @param change Pointer to the change.
+     * @return True if the change has its payload.
+     */
+    bool load_persistent_payload(
+            CacheChange_t* change);
+
 private:
 
     //!Persistence service
     IPersistenceService* persistence_;
     //!Persistence GUID
     std::string persistence_guid_;
+    //!Pool where the payloads of the changes loaded lazily are obtained from
+    std::shared_ptr<IPayloadPool> persistence_payload_pool_;
+    //!Whether a payload which could not be loaded from storage has already been reported as an error
+    bool payload_error_printed_ = false;
 };
 
 } // namespace rtps
@@ -487,6 +487,18 @@ public:
             LocatorSelectorSender& locator_selector,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) = 0;
 
+    /*!
+     * Tells writer the sample will not be sent, although it is kept on the history.
+     * Matched readers are informed as if the sample had been removed, so reliable ones receive a GAP for it.
+     * This function should be used by a fastdds::rtps::FlowController, once the sample has been removed from its
+     * queue.
+     *
+     * @param cache_change Pointer to the CacheChange_t that represents the sample which will not be sent.
+     * @note Must be non-thread safe.
+     */
+    virtual void discard_change_nts(
+            CacheChange_t* cache_change) = 0;
+
     virtual LocatorSelectorSender& get_general_locator_selector() = 0;
 
     virtual LocatorSelectorSender& get_async_locator_selector() = 0;
@@ -504,6 +516,21 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const;
 
+    /**
+     * Send a message made of several slices through this interface.
+     *
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param locator_selector RTPSMessageSenderInterface reference uses for selecting locators. The reference has to
+     * be a member of this RTPSWriter object.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send_nts(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const;
+
 protected:
 
     //!Is the data sent directly or announced by HB and THEN sent to the ones who ask for it?.
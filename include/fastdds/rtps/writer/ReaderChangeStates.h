@@ -0,0 +1,446 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderChangeStates.h
+ */
+
+#ifndef _FASTDDS_RTPS_WRITER_READERCHANGESTATES_H_
+#define _FASTDDS_RTPS_WRITER_READERCHANGESTATES_H_
+
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/writer/ChangeForReader.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+/**
+ * Status of the changes of a writer with respect to a reader, kept as one byte per sequence number relative to the
+ * first change tracked. Sequence numbers between tracked changes (irrelevant or removed changes) are kept as
+ * absent, so the cost of a sequence number does not depend on the size of the change or on the number of readers
+ * sharing it, and the change itself is kept only once, on the writer history.
+ * @ingroup WRITER_MODULE
+ */
+class ReaderChangeStates
+{
+public:
+
+    /**
+     * Constructor.
+     * @param initial_size Number of sequence numbers to reserve space for.
+     */
+    explicit ReaderChangeStates(
+            size_t initial_size = 0)
+    {
+        states_.reserve(initial_size);
+    }
+
+    /**
+     * Check whether no change is tracked.
+     * @return true when no change is tracked.
+     */
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    /**
+     * Get the number of changes tracked.
+     * @return Number of changes tracked.
+     */
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * Get the number of changes tracked with a given status.
+     * @param status Status to count.
+     * @return Number of changes with the given status.
+     */
+    size_t count(
+            ChangeForReaderStatus_t status) const
+    {
+        return counts_[status];
+    }
+
+    /**
+     * Get the bytes reserved to keep the status of the changes.
+     * @return Bytes reserved.
+     */
+    size_t capacity() const
+    {
+        return states_.capacity();
+    }
+
+    /**
+     * Get the lowest sequence number tracked.
+     * @return Lowest sequence number tracked, SequenceNumber_t::unknown() when empty.
+     */
+    SequenceNumber_t first() const
+    {
+        return empty() ? SequenceNumber_t::unknown() : SequenceNumber_t(base_);
+    }
+
+    /**
+     * Get the status of a change.
+     * @param[in]  seq_num Sequence number of the change.
+     * @param[out] status Status of the change, when tracked.
+     * @return true when the change is tracked, false otherwise.
+     */
+    bool find(
+            const SequenceNumber_t& seq_num,
+            ChangeForReaderStatus_t& status) const
+    {
+        const uint8_t* state = get(seq_num);
+        if (nullptr == state)
+        {
+            return false;
+        }
+
+        status = static_cast<ChangeForReaderStatus_t>(*state & STATUS_MASK);
+        return true;
+    }
+
+    /**
+     * Check whether a change is tracked.
+     * @param seq_num Sequence number of the change.
+     * @return true when the change is tracked, false otherwise.
+     */
+    bool contains(
+            const SequenceNumber_t& seq_num) const
+    {
+        return nullptr != get(seq_num);
+    }
+
+    /**
+     * Check whether a tracked change has been delivered at least once.
+     * @param seq_num Sequence number of the change, which should be tracked.
+     * @return true when the change has been delivered.
+     */
+    bool is_delivered(
+            const SequenceNumber_t& seq_num) const
+    {
+        const uint8_t* state = get(seq_num);
+        return nullptr != state && 0 != (*state & DELIVERED);
+    }
+
+    /**
+     * Get the closest tracked change below a sequence number.
+     * @param seq_num Sequence number to start from.
+     * @return Sequence number of the previous tracked change, SequenceNumber_t::unknown() when there is none.
+     */
+    SequenceNumber_t previous(
+            const SequenceNumber_t& seq_num) const
+    {
+        uint64_t seq = seq_num.to64long();
+        if (empty() || seq <= base_)
+        {
+            return SequenceNumber_t::unknown();
+        }
+
+        size_t index = std::min(static_cast<size_t>(seq - base_), states_.size() - head_);
+        while (0 < index)
+        {
+            --index;
+            if (ABSENT != states_[head_ + index])
+            {
+                return SequenceNumber_t(base_ + index);
+            }
+        }
+
+        return SequenceNumber_t::unknown();
+    }
+
+    /**
+     * Track a change with a sequence number higher than all the tracked ones.
+     * @param seq_num Sequence number of the change.
+     * @param status Status of the change.
+     * @param delivered Whether the change has been delivered at least once.
+     */
+    void push_back(
+            const SequenceNumber_t& seq_num,
+            ChangeForReaderStatus_t status,
+            bool delivered = false)
+    {
+        uint64_t seq = seq_num.to64long();
+        if (empty())
+        {
+            states_.clear();
+            head_ = 0;
+            base_ = seq;
+        }
+
+        assert(seq >= base_ + (states_.size() - head_));
+        states_.resize(head_ + static_cast<size_t>(seq - base_), uint8_t(ABSENT));
+        states_.push_back(encode(status, delivered));
+        ++counts_[status];
+        ++size_;
+    }
+
+    /**
+     * Track a change with any sequence number, not already tracked.
+     * @param seq_num Sequence number of the change.
+     * @param status Status of the change.
+     */
+    void insert(
+            const SequenceNumber_t& seq_num,
+            ChangeForReaderStatus_t status)
+    {
+        uint64_t seq = seq_num.to64long();
+        if (empty() || seq >= base_ + (states_.size() - head_))
+        {
+            push_back(seq_num, status);
+            return;
+        }
+
+        if (seq < base_)
+        {
+            // Reuse the released bytes at the front, which may hold stale states
+            size_t gap = static_cast<size_t>(base_ - seq);
+            if (head_ < gap)
+            {
+                states_.insert(states_.begin(), gap - head_, uint8_t(ABSENT));
+                head_ = gap;
+            }
+            std::fill(states_.begin() + (head_ - gap), states_.begin() + head_, uint8_t(ABSENT));
+            head_ -= gap;
+            base_ = seq;
+        }
+
+        uint8_t& state = states_[head_ + static_cast<size_t>(seq - base_)];
+        assert(ABSENT == state);
+        state = encode(status, false);
+        ++counts_[status];
+        ++size_;
+    }
+
+    /**
+     * Change the status of a tracked change.
+     * @param seq_num Sequence number of the change, which should be tracked.
+     * @param status New status of the change.
+     */
+    void set_status(
+            const SequenceNumber_t& seq_num,
+            ChangeForReaderStatus_t status)
+    {
+        uint8_t* state = get(seq_num);
+        assert(nullptr != state);
+        --counts_[*state & STATUS_MASK];
+        ++counts_[status];
+        *state = static_cast<uint8_t>((*state & ~STATUS_MASK) | status);
+    }
+
+    /**
+     * Mark a tracked change as delivered at least once.
+     * @param seq_num Sequence number of the change, which should be tracked.
+     */
+    void set_delivered(
+            const SequenceNumber_t& seq_num)
+    {
+        uint8_t* state = get(seq_num);
+        assert(nullptr != state);
+        *state |= DELIVERED;
+    }
+
+    /**
+     * Stop tracking a change.
+     * @param seq_num Sequence number of the change.
+     * @return true when the change was tracked, false otherwise.
+     */
+    bool erase(
+            const SequenceNumber_t& seq_num)
+    {
+        uint8_t* state = get(seq_num);
+        if (nullptr == state)
+        {
+            return false;
+        }
+
+        --counts_[*state & STATUS_MASK];
+        --size_;
+        *state = ABSENT;
+        trim_front();
+        return true;
+    }
+
+    /**
+     * Stop tracking all the changes below a sequence number.
+     * @param seq_num Sequence number of the first change to keep tracking.
+     */
+    void erase_before(
+            const SequenceNumber_t& seq_num)
+    {
+        uint64_t seq = seq_num.to64long();
+        if (empty() || seq <= base_)
+        {
+            return;
+        }
+
+        size_t window = states_.size() - head_;
+        if (seq - base_ >= window)
+        {
+            clear();
+            return;
+        }
+
+        size_t end = head_ + static_cast<size_t>(seq - base_);
+        for (size_t index = head_; index < end; ++index)
+        {
+            if (ABSENT != states_[index])
+            {
+                --counts_[states_[index] & STATUS_MASK];
+                --size_;
+            }
+        }
+        head_ = end;
+        base_ = seq;
+        trim_front();
+    }
+
+    /**
+     * Change the status of all the changes with a given status.
+     * @param previous Status to change.
+     * @param next Status to adopt.
+     * @param func Functor called with the sequence number of each change modified.
+     * @return Number of changes modified.
+     */
+    template<typename Functor>
+    uint32_t convert_status(
+            ChangeForReaderStatus_t previous,
+            ChangeForReaderStatus_t next,
+            Functor func)
+    {
+        size_t pending = counts_[previous];
+        uint32_t changed = 0;
+        for (size_t index = head_; 0 < pending; ++index)
+        {
+            assert(index < states_.size());
+            uint8_t& state = states_[index];
+            if (ABSENT != state && previous == (state & STATUS_MASK))
+            {
+                state = static_cast<uint8_t>((state & ~STATUS_MASK) | next);
+                --pending;
+                ++changed;
+                func(SequenceNumber_t(base_ + (index - head_)));
+            }
+        }
+        counts_[previous] -= changed;
+        counts_[next] += changed;
+        return changed;
+    }
+
+    /**
+     * Stop tracking all the changes.
+     */
+    void clear()
+    {
+        states_.clear();
+        head_ = 0;
+        base_ = 0;
+        size_ = 0;
+        counts_.fill(0);
+    }
+
+private:
+
+    //! Bits keeping the ChangeForReaderStatus_t of a change.
+    static constexpr uint8_t STATUS_MASK = 0x07;
+    //! Bit set when the change has been delivered at least once.
+    static constexpr uint8_t DELIVERED = 0x08;
+    //! Value of the sequence numbers not tracked.
+    static constexpr uint8_t ABSENT = 0xFF;
+
+    static uint8_t encode(
+            ChangeForReaderStatus_t status,
+            bool delivered)
+    {
+        return static_cast<uint8_t>(status | (delivered ? DELIVERED : 0));
+    }
+
+    const uint8_t* get(
+            const SequenceNumber_t& seq_num) const
+    {
+        uint64_t seq = seq_num.to64long();
+        if (empty() || seq < base_ || seq - base_ >= states_.size() - head_)
+        {
+            return nullptr;
+        }
+
+        const uint8_t* state = &states_[head_ + static_cast<size_t>(seq - base_)];
+        return ABSENT == *state ? nullptr : state;
+    }
+
+    uint8_t* get(
+            const SequenceNumber_t& seq_num)
+    {
+        return const_cast<uint8_t*>(static_cast<const ReaderChangeStates*>(this)->get(seq_num));
+    }
+
+    void trim_front()
+    {
+        if (empty())
+        {
+            clear();
+            return;
+        }
+
+        auto first = std::find_if(states_.begin() + head_, states_.end(), [](uint8_t state)
+                        {
+                            return ABSENT != state;
+                        });
+        size_t first_index = static_cast<size_t>(first - states_.begin());
+        base_ += first_index - head_;
+        head_ = first_index;
+
+        // Release the front once it is at least half of the storage, so each byte is moved at most once on average
+        if (head_ >= COMPACT_THRESHOLD && head_ * 2 >= states_.size())
+        {
+            states_.erase(states_.begin(), states_.begin() + head_);
+            head_ = 0;
+        }
+    }
+
+    //! Minimum number of released bytes at the front before moving the rest of the storage.
+    static constexpr size_t COMPACT_THRESHOLD = 64;
+
+    //! Status of each sequence number, starting at index head_.
+    std::vector<uint8_t> states_;
+    //! Index on states_ of the lowest sequence number tracked.
+    size_t head_ = 0;
+    //! Lowest sequence number tracked.
+    uint64_t base_ = 0;
+    //! Number of changes tracked.
+    size_t size_ = 0;
+    //! Number of changes tracked with each status.
+    std::array<size_t, UNDERWAY + 1> counts_{};
+};
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* _FASTDDS_RTPS_WRITER_READERCHANGESTATES_H_ */
@@ -191,6 +191,18 @@ public:
             CDRMessage_t* message,
             std::chrono::steady_clock::time_point max_blocking_time_point) const override;
 
+    /**
+     * Send a message made of several slices through this interface.
+     *
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
     /**
      * Check if the reader is datasharing compatible with this writer
      * @return true if the reader datasharing compatible with this writer
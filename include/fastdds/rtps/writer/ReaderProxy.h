@@ -32,14 +32,15 @@
 #include <fastdds/rtps/common/FragmentNumber.h>
 
 #include <fastdds/rtps/writer/ChangeForReader.h>
+#include <fastdds/rtps/writer/ReaderChangeStates.h>
 #include <fastdds/rtps/writer/ReaderLocator.h>
 
-#include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
-
 #include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <set>
 #include <atomic>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -173,7 +174,7 @@ public:
      * @return true if a heartbeat should be sent, false otherwise.
      */
     bool process_initial_acknack(
-            const std::function<void(ChangeForReader_t& change)>& func);
+            const std::function<void(CacheChange_t* change)>& func);
 
     /*!
      * @brief Sets a change to a particular status (if present in the ReaderProxy)
@@ -214,7 +215,7 @@ public:
      * @return the number of changes that changed its status.
      */
     uint32_t perform_acknack_response(
-            const std::function<void(ChangeForReader_t& change)>& func);
+            const std::function<void(CacheChange_t* change)>& func);
 
     /**
      * Call this to inform a change was removed from history.
@@ -316,6 +317,36 @@ public:
         return false;
     }
 
+    /**
+     * Called when an ACKNACK is received to update the smoothed round trip time and NACK rate of the reader.
+     * Only the first ACKNACK received after each HEARTBEAT gives a round trip sample.
+     * @param last_heartbeat Time when the last HEARTBEAT was sent by the writer.
+     * @param now Time when the ACKNACK was received.
+     * @param requested_changes Whether the ACKNACK requested changes.
+     */
+    void update_acknack_statistics(
+            const std::chrono::steady_clock::time_point& last_heartbeat,
+            const std::chrono::steady_clock::time_point& now,
+            bool requested_changes);
+
+    /**
+     * Get the smoothed time from a HEARTBEAT to the ACKNACK answering it.
+     * @return Round trip time, zero when not measured yet.
+     */
+    std::chrono::nanoseconds ack_round_trip() const
+    {
+        return ack_round_trip_;
+    }
+
+    /**
+     * Get the smoothed ratio of the ACKNACKs requesting changes.
+     * @return Ratio between 0 and 1.
+     */
+    double nack_rate() const
+    {
+        return nack_rate_;
+    }
+
     /**
      * Process an incoming NACKFRAG submessage.
      * @param reader_guid Destination guid of the submessage.
@@ -435,8 +466,10 @@ private:
     bool disable_positive_acks_;
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
-    //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    //!Status of the changes pending for the reader.
+    ReaderChangeStates changes_for_reader_;
+    //!Fragment state of the fragmented changes pending for the reader, sorted by sequence number.
+    std::vector<ChangeForReader_t> fragmented_changes_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -451,8 +484,15 @@ private:
 
     bool active_ = false;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
+    //! Smoothed time from a HEARTBEAT to the ACKNACK answering it.
+    std::chrono::nanoseconds ack_round_trip_{0};
+    //! Smoothed ratio of ACKNACKs requesting changes.
+    double nack_rate_ = 0.0;
+    //! HEARTBEAT which already gave a round trip sample.
+    std::chrono::steady_clock::time_point sampled_heartbeat_;
+
+    using FragmentedChangeIterator = std::vector<ChangeForReader_t>::iterator;
+    using FragmentedChangeConstIterator = std::vector<ChangeForReader_t>::const_iterator;
 
     void disable_timers();
 
@@ -466,7 +506,7 @@ private:
     uint32_t convert_status_on_all_changes(
             ChangeForReaderStatus_t previous,
             ChangeForReaderStatus_t next,
-            const std::function<void(ChangeForReader_t& change)>& func = {});
+            const std::function<void(CacheChange_t* change)>& func = {});
 
     /*!
      * @brief Adds requested fragments. These fragments will be sent in next NackResponseDelay.
@@ -483,23 +523,41 @@ private:
             bool is_relevant);
 
     /**
-     * @brief Find a change with the specified sequence number.
+     * @brief Find the fragment state of a fragmented change.
      * @param seq_num Sequence number to find.
      * @param exact When false, the first change with a sequence number not less than seq_num will be returned.
      * When true, the change with a sequence number value of seq_num will be returned.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
+     * @return Iterator pointing to the change, fragmented_changes_.end() if not found.
      */
-    ChangeIterator find_change(
+    FragmentedChangeIterator find_fragmented_change(
             const SequenceNumber_t& seq_num,
             bool exact);
 
     /**
-     * @brief Find a change with the specified sequence number.
+     * @brief Find the fragment state of a fragmented change.
      * @param seq_num Sequence number to find.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
+     * @return Iterator pointing to the change, fragmented_changes_.end() if not found.
      */
-    ChangeConstIterator find_change(
+    FragmentedChangeConstIterator find_fragmented_change(
             const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Stop tracking a change.
+     * @param seq_num Sequence number of the change.
+     * @return true if the change was being tracked, false otherwise.
+     */
+    bool erase_change(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * @brief Find a change on the writer's history.
+     * @param[in]    seq_num Sequence number to find.
+     * @param[inout] hint Position of the history to start the search from, updated to the position of the change.
+     * @return The change, nullptr if not found.
+     */
+    CacheChange_t* find_history_change(
+            const SequenceNumber_t& seq_num,
+            std::vector<CacheChange_t*>::iterator& hint) const;
 };
 
 } /* namespace rtps */
@@ -98,6 +98,16 @@ public:
     bool change_removed_by_history(
             CacheChange_t* a_change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
+
+    /**
+     * Load from storage the payload of a change loaded lazily, before sending it.
+     * @see RTPSWriter::deliver_sample_nts
+     */
+    DeliveryRetCode deliver_sample_nts(
+            CacheChange_t* cache_change,
+            RTPSMessageGroup& group,
+            LocatorSelectorSender& locator_selector,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
 };
 
 } // namespace rtps
@@ -25,7 +25,9 @@
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/statistics/rtps/ReliabilityTuning.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 
@@ -33,6 +35,9 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class AdaptiveReliability;
+class ControlMessageGroup;
+class ControlMessageTask;
 class ReaderProxy;
 class TimedEvent;
 
@@ -98,6 +103,10 @@ private:
     //!Timed Event to manage the periodic HB to the Reader.
     TimedEvent* periodic_hb_event_;
 
+    //! Periodic HB triggered by the participant, used instead of periodic_hb_event_ when control messages are
+    //! aggregated.
+    ControlMessageTask* periodic_hb_task_;
+
     //! Timed Event to manage the Acknack response delay.
     TimedEvent* nack_response_event_;
 
@@ -109,6 +118,11 @@ private:
     //!WriterTimes
     WriterTimes m_times;
 
+    //! Tunes the heartbeat period and NACK response delay, only when the adaptive reliability mode is enabled.
+    AdaptiveReliability* adaptive_reliability_;
+    //! Time when the last heartbeat was sent, used to measure the ACKNACK round trip on the adaptive mode.
+    std::chrono::steady_clock::time_point last_heartbeat_time_;
+
     //! Vector containing all the remote ReaderProxies.
     ResourceLimitedVector<ReaderProxy*> matched_remote_readers_;
     //! Vector containing all the inactive, ready for reuse, ReaderProxies.
@@ -321,6 +335,14 @@ public:
     void updateTimes(
             const WriterTimes& times);
 
+    /**
+     * Get the heartbeat period and NACK response delay in use, which the adaptive reliability mode tunes from the
+     * observations of the matched readers.
+     * @param [out] tuning Times in use and observations of the remote readers.
+     */
+    void get_reliability_tuning(
+            fastdds::statistics::ReliabilityTuning& tuning) const;
+
     /**
      * Update the period of the disable positive ACKs policy.
      * @param att WriterAttributes parameter.
@@ -432,6 +454,16 @@ public:
             LocatorSelectorSender& locator_selector,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
 
+    /*!
+     * Tells writer the sample will not be sent, although it is kept on the history.
+     * Matched readers requesting it will receive a GAP.
+     *
+     * @param cache_change Pointer to the CacheChange_t that represents the sample which will not be sent.
+     * @note Must be non-thread safe.
+     */
+    void discard_change_nts(
+            CacheChange_t* cache_change) override;
+
     LocatorSelectorSender& get_general_locator_selector() override
     {
         return locator_selector_general_;
@@ -477,6 +509,46 @@ private:
 
     void send_heartbeat_to_all_readers();
 
+    //! Sends a heartbeat to the intraprocess and datasharing readers.
+    void send_heartbeat_to_local_readers();
+
+    //! Whether a matched reader has not acknowledged a change yet.
+    bool has_unacknowledged_changes_nts();
+
+    //! Schedules the periodic heartbeat, unless it is already scheduled.
+    void restart_periodic_heartbeat();
+
+    //! Schedules the periodic heartbeat, unless it is already scheduled, waiting until the given time at most.
+    void restart_periodic_heartbeat(
+            const std::chrono::steady_clock::time_point& max_blocking_time);
+
+    //! Cancels the periodic heartbeat.
+    void cancel_periodic_heartbeat();
+
+    //! Applies the heartbeat period and NACK response delay tuned from the matched readers on the adaptive mode.
+    void adapt_reliability_times_nts();
+
+    /**
+     * @brief Periodic heartbeat triggered by the participant when control messages are aggregated.
+     * Sends the heartbeats that cannot be packed with the control messages of other endpoints.
+     *
+     * @param destinations Filled with the destination locators of the heartbeat to be packed.
+     *
+     * @return True when the periodic heartbeat has to be sent again.
+     */
+    bool prepare_periodic_heartbeat(
+            std::vector<Locator_t>& destinations);
+
+    /**
+     * @brief Adds the heartbeat prepared by prepare_periodic_heartbeat to the messages shared with other endpoints.
+     *
+     * @param group Control messages of the participant.
+     * @param destinations Destination locators filled when preparing the heartbeat, updated when they changed.
+     */
+    void add_periodic_heartbeat(
+            ControlMessageGroup& group,
+            std::vector<Locator_t>& destinations);
+
     void deliver_sample_to_intraprocesses(
             CacheChange_t* change);
 
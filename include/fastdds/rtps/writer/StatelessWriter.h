@@ -165,6 +165,13 @@ public:
     //!Reset the unsent changes.
     void unsent_changes_reset();
 
+    /**
+     * Reset the unsent changes from a sequence number on.
+     * @param first_sequence Sequence number of the first change to send again.
+     */
+    void unsent_changes_reset(
+            const SequenceNumber_t& first_sequence);
+
     /**
      * @brief Check if a specific change has been delivered to the transport layer at least once for every matched
      * remote RTPSReader.
@@ -201,6 +208,21 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
+    /**
+     * Send a message made of several slices through this interface.
+     *
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param locator_selector RTPSMessageSenderInterface reference uses for selecting locators. The reference has to
+     * be a member of this RTPSWriter object.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send_nts(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
+
     /**
      * Get the number of matched readers
      * @return Number of the matched readers
@@ -231,6 +253,16 @@ public:
             LocatorSelectorSender& locator_selector,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
 
+    /*!
+     * Tells writer the sample will not be sent, although it is kept on the history.
+     * It is considered as sent, so it does not block the waits for the delivery of the samples.
+     *
+     * @param cache_change Pointer to the CacheChange_t that represents the sample which will not be sent.
+     * @note Must be non-thread safe.
+     */
+    void discard_change_nts(
+            CacheChange_t* cache_change) override;
+
     LocatorSelectorSender& get_general_locator_selector() override
     {
         return locator_selector_;
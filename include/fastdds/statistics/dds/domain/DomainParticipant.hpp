@@ -23,7 +23,10 @@
 #include <string>
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/statistics/rtps/ReliabilityTuning.hpp>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 #include <fastrtps/fastrtps_dll.h>
 #include <fastrtps/types/TypesBase.h>
 
@@ -86,6 +89,32 @@ public:
     RTPS_DllAPI ReturnCode_t disable_statistics_datawriter(
             const std::string& topic_name);
 
+    /**
+     * @brief This operation retrieves the discovery startup timeline recorded by the participant
+     * @param[out] profile Timeline of the participant, ordered by elapsed time since its creation
+     * @return RETCODE_UNSUPPORTED if the FASTDDS_STATISTICS CMake option has not been set,
+     * RETCODE_NOT_ENABLED if the participant has not been enabled,
+     * and RETCODE_OK otherwise
+     */
+    RTPS_DllAPI ReturnCode_t get_startup_profile(
+            StartupProfile& profile) const;
+
+    /**
+     * @brief This operation retrieves the heartbeat period and NACK response delay in use by a reliable DataWriter,
+     * which are tuned from the observations of its matched readers when the fastdds.adaptive_reliability property is
+     * set on the DataWriter
+     * @param writer DataWriter created by this participant
+     * @param[out] tuning Times in use by the DataWriter, with the observations they were chosen from
+     * @return RETCODE_UNSUPPORTED if the FASTDDS_STATISTICS CMake option has not been set,
+     * RETCODE_BAD_PARAMETER if the DataWriter is nullptr,
+     * RETCODE_NOT_ENABLED if the participant has not been enabled,
+     * RETCODE_PRECONDITION_NOT_MET if the DataWriter is not an enabled reliable DataWriter of this participant,
+     * and RETCODE_OK otherwise
+     */
+    RTPS_DllAPI ReturnCode_t get_reliability_tuning(
+            const eprosima::fastdds::dds::DataWriter* writer,
+            ReliabilityTuning& tuning) const;
+
     /**
      * @brief This operation narrows the DDS DomainParticipant to the Statistics DomainParticipant
      * @param domain_participant Reference to the DDS DomainParticipant
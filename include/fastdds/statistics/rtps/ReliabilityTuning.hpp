@@ -0,0 +1,68 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReliabilityTuning.hpp
+ */
+
+#ifndef _FASTDDS_STATISTICS_RTPS_RELIABILITYTUNING_HPP_
+#define _FASTDDS_STATISTICS_RTPS_RELIABILITYTUNING_HPP_
+
+#include <chrono>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Reliability observations of a reader matched with a reliable writer.
+ * @ingroup STATISTICS_MODULE
+ */
+struct ReaderReliabilityObservation
+{
+    //! Reader observed
+    fastrtps::rtps::GUID_t reader_guid;
+    //! Smoothed time from a HEARTBEAT to the ACKNACK answering it, zero when not measured yet
+    std::chrono::nanoseconds ack_round_trip{0};
+    //! Smoothed ratio of the ACKNACKs requesting changes, between 0 and 1
+    double nack_rate = 0.0;
+};
+
+/**
+ * Reliability times in use by a reliable writer, and the observations they were chosen from.
+ * @ingroup STATISTICS_MODULE
+ */
+struct ReliabilityTuning
+{
+    //! Writer the times belong to
+    fastrtps::rtps::GUID_t writer_guid;
+    //! Whether the times are tuned by the adaptive reliability mode, or are the configured ones
+    bool adaptive = false;
+    //! Period of the HEARTBEAT submessages
+    fastrtps::Duration_t heartbeat_period;
+    //! Delay applied to the response of a NACK
+    fastrtps::Duration_t nack_response_delay;
+    //! Observations of the remote readers, only filled on the adaptive reliability mode
+    std::vector<ReaderReliabilityObservation> readers;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_STATISTICS_RTPS_RELIABILITYTUNING_HPP_
@@ -0,0 +1,141 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StartupProfile.hpp
+ */
+
+#ifndef _FASTDDS_STATISTICS_RTPS_STARTUPPROFILE_HPP_
+#define _FASTDDS_STATISTICS_RTPS_STARTUPPROFILE_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Discovery phases timestamped by the startup profiler of a participant.
+ * @ingroup STATISTICS_MODULE
+ */
+enum class StartupPhase : uint32_t
+{
+    //! Transports have been registered and the participant is able to send and receive
+    TRANSPORTS_INITIALIZED,
+    //! First participant announcement has been sent
+    FIRST_PDP_ANNOUNCEMENT,
+    //! A remote participant has been discovered
+    REMOTE_PARTICIPANT_DISCOVERED,
+    //! A local endpoint has been matched with its first remote endpoint
+    ENDPOINT_MATCHED,
+    //! A TypeLookup reply has been received
+    TYPE_LOOKUP_REPLY,
+    //! The authentication handshake with a remote participant has been completed
+    SECURITY_HANDSHAKE_COMPLETED
+};
+
+/**
+ * Single entry on the startup timeline of a participant.
+ * @ingroup STATISTICS_MODULE
+ */
+struct StartupEvent
+{
+    //! Phase reached
+    StartupPhase phase;
+    //! Local entity involved (participant or endpoint)
+    fastrtps::rtps::GUID_t local_guid;
+    //! Remote entity involved, unknown when the phase is local
+    fastrtps::rtps::GUID_t remote_guid;
+    //! Time elapsed since the participant was created
+    std::chrono::nanoseconds elapsed;
+};
+
+/**
+ * Startup timeline of a participant, events are ordered by elapsed time.
+ * @ingroup STATISTICS_MODULE
+ */
+struct StartupProfile
+{
+    //! Participant the timeline belongs to
+    fastrtps::rtps::GUID_t participant_guid;
+    //! Recorded events
+    std::vector<StartupEvent> events;
+};
+
+/**
+ * Human readable name of a startup phase.
+ * @param phase Phase to convert
+ * @return Name of the phase
+ */
+inline const char* to_string(
+        StartupPhase phase)
+{
+    switch (phase)
+    {
+        case StartupPhase::TRANSPORTS_INITIALIZED:
+            return "TRANSPORTS_INITIALIZED";
+        case StartupPhase::FIRST_PDP_ANNOUNCEMENT:
+            return "FIRST_PDP_ANNOUNCEMENT";
+        case StartupPhase::REMOTE_PARTICIPANT_DISCOVERED:
+            return "REMOTE_PARTICIPANT_DISCOVERED";
+        case StartupPhase::ENDPOINT_MATCHED:
+            return "ENDPOINT_MATCHED";
+        case StartupPhase::TYPE_LOOKUP_REPLY:
+            return "TYPE_LOOKUP_REPLY";
+        case StartupPhase::SECURITY_HANDSHAKE_COMPLETED:
+            return "SECURITY_HANDSHAKE_COMPLETED";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * Prints the startup timeline, one event per line, with times in milliseconds.
+ */
+inline std::ostream& operator <<(
+        std::ostream& output,
+        const StartupProfile& profile)
+{
+    std::ios_base::fmtflags flags = output.flags();
+    std::streamsize precision = output.precision();
+
+    output << "Startup timeline of participant " << profile.participant_guid << std::endl;
+    for (const StartupEvent& event : profile.events)
+    {
+        double ms = std::chrono::duration<double, std::milli>(event.elapsed).count();
+        output << std::setw(12) << std::fixed << std::setprecision(3) << ms << " ms  "
+               << std::left << std::setw(30) << to_string(event.phase) << std::right
+               << event.local_guid;
+        if (fastrtps::rtps::GUID_t::unknown() != event.remote_guid)
+        {
+            output << " <-> " << event.remote_guid;
+        }
+        output << std::endl;
+    }
+
+    output.flags(flags);
+    output.precision(precision);
+    return output;
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_STATISTICS_RTPS_STARTUPPROFILE_HPP_
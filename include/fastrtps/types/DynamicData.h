@@ -175,6 +175,7 @@ protected:
     friend class DynamicDataFactory;
     friend class DynamicPubSubType;
     friend class DynamicDataHelper;
+    friend class DynamicDataSerializationPlan;
     friend class eprosima::fastdds::dds::DDSSQLFilter::DDSFilterExpression;
 
 public:
@@ -20,6 +20,7 @@
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicType.h>
 #include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/FlatDynamicData.h>
 #include <mutex>
 
 //#define DISABLE_DYNAMIC_MEMORY_CHECK
@@ -58,6 +59,22 @@ public:
     RTPS_DllAPI ReturnCode_t delete_data(DynamicData* pData);
 
     RTPS_DllAPI bool is_empty() const;
+
+    /**
+     * Create a sample of the given type stored on a single contiguous buffer.
+     * @param pType Type of the sample
+     * @return The new sample, nullptr if the type contains sequences, maps, unions or bitsets
+     */
+    RTPS_DllAPI FlatDynamicData* create_flat_data(DynamicType_ptr pType);
+
+    /**
+     * Create a copy of a flat sample.
+     * @param pData Sample to copy, which must not be a loaned value
+     * @return The new sample, nullptr on error
+     */
+    RTPS_DllAPI FlatDynamicData* create_flat_copy(const FlatDynamicData* pData);
+
+    RTPS_DllAPI ReturnCode_t delete_flat_data(FlatDynamicData* pData);
 };
 
 
@@ -21,19 +21,47 @@
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/utils/md5.h>
 
+#include <memory>
+
 namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
 namespace fastrtps {
 namespace types {
 
+class DynamicDataSerializationPlan;
+
 class DynamicPubSubType : public eprosima::fastdds::dds::TopicDataType
 {
 protected:
 
     void UpdateDynamicTypeInfo();
 
+    //! Serialize a sample, once its encapsulation is written
+    virtual void serialize_sample(
+            const void* data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Deserialize a sample, once its encapsulation is read
+    virtual void deserialize_sample(
+            void* data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Serialize the key members of a sample
+    virtual void serialize_key(
+            const void* data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
     DynamicType_ptr dynamic_type_;
+    //! Serialization of dynamic_type_, compiled when the type is set
+    std::shared_ptr<const DynamicDataSerializationPlan> plan_;
     MD5 m_md5;
+    //! Buffer for the serialized key, allocated when the type is set
     unsigned char* m_keyBuffer;
+    //! Maximum serialized size of the key members of dynamic_type_
+    size_t m_keyBufferSize;
 
     enum
     {
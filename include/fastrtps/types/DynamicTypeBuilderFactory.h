@@ -18,7 +18,10 @@
 #include <fastrtps/types/TypesBase.h>
 #include <fastrtps/types/AnnotationParameterValue.h>
 #include <fastrtps/types/DynamicTypePtr.h>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <set>
 
 //#define DISABLE_DYNAMIC_MEMORY_CHECK
 
@@ -35,6 +38,7 @@ class TypeObject;
 class DynamicType;
 class DynamicType_ptr;
 class AnnotationParameterValue;
+class FlatDynamicDataLayout;
 
 class DynamicTypeBuilderFactory
 {
@@ -119,10 +123,16 @@ protected:
             const TypeDescriptor* descriptor) const;
 
 #ifndef DISABLE_DYNAMIC_MEMORY_CHECK
-    std::vector<DynamicTypeBuilder*> builders_list_;
+    std::set<DynamicTypeBuilder*> builders_list_;
     mutable std::recursive_mutex mutex_;
 #endif // ifndef DISABLE_DYNAMIC_MEMORY_CHECK
 
+    friend class FlatDynamicDataLayout;
+
+    //! Layouts of the types stored on FlatDynamicData, released along with the factory
+    std::map<const DynamicType*, std::shared_ptr<const FlatDynamicDataLayout>> flat_layouts_;
+    std::mutex flat_layouts_mutex_;
+
 public:
 
     RTPS_DllAPI static DynamicTypeBuilderFactory* get_instance();
@@ -0,0 +1,449 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_FLAT_DYNAMIC_DATA_H
+#define TYPES_FLAT_DYNAMIC_DATA_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastrtps {
+namespace types {
+
+class DynamicData;
+class FlatDynamicDataLayout;
+struct FlatDynamicDataNode;
+
+/**
+ * Alternative representation of DynamicData storing all the values of a sample in a single contiguous buffer.
+ *
+ * The buffer layout is computed once per DynamicType: primitives, enumerations, bitmasks, nested structures, arrays
+ * and bounded sequences are stored inline, and only the characters of strings and the elements of unbounded
+ * sequences live out of line. Creating or copying a sample therefore costs a single allocation, instead of several
+ * per member.
+ *
+ * Types containing maps, unions or bitsets cannot be stored flat; DynamicDataFactory::create_flat_data
+ * returns nullptr for them and DynamicData should be used instead. FlatDynamicData samples are published and
+ * received with FlatDynamicPubSubType, which serializes them as DynamicPubSubType does with DynamicData.
+ *
+ * The accessors follow the DynamicData API. Nested structures, arrays and sequences are accessed through loan_value.
+ */
+class FlatDynamicData
+{
+protected:
+
+    FlatDynamicData(
+            std::shared_ptr<const FlatDynamicDataLayout> layout);
+
+    FlatDynamicData(
+            const FlatDynamicData* pData);
+
+    FlatDynamicData(
+            FlatDynamicData* parent,
+            const FlatDynamicDataNode* node,
+            uint8_t* storage);
+
+    template<typename T>
+    ReturnCode_t get_primitive_value(
+            T& value,
+            MemberId id,
+            TypeKind kind) const;
+
+    template<typename T>
+    ReturnCode_t set_primitive_value(
+            const T& value,
+            MemberId id,
+            TypeKind kind);
+
+    uint8_t* locate(
+            MemberId id,
+            TypeKind kind,
+            const FlatDynamicDataNode** node = nullptr) const;
+
+    //! Whether any value directly nested on this one is loaned
+    bool has_loans() const;
+
+    static ReturnCode_t copy_node_from(
+            DynamicData* data,
+            const FlatDynamicDataNode* node,
+            uint8_t* storage);
+
+    static ReturnCode_t copy_value_from(
+            DynamicData* data,
+            MemberId id,
+            const FlatDynamicDataNode* node,
+            uint8_t* storage);
+
+    static ReturnCode_t copy_node_to(
+            DynamicData* data,
+            const FlatDynamicDataNode* node,
+            const uint8_t* storage);
+
+    static ReturnCode_t copy_value_to(
+            DynamicData* data,
+            MemberId id,
+            const FlatDynamicDataNode* node,
+            const uint8_t* storage);
+
+    std::shared_ptr<const FlatDynamicDataLayout> layout_;
+    const FlatDynamicDataNode* node_;
+    //! Storage of the whole sample, only allocated on the sample itself, not on loaned values
+    std::unique_ptr<std::max_align_t[]> buffer_;
+    uint8_t* root_storage_;
+    uint8_t* storage_;
+    //! Views over nested values, created the first time they are loaned
+    std::map<MemberId, std::unique_ptr<FlatDynamicData>> loans_;
+    bool loaned_;
+
+    // Serializes and deserializes the sample as DynamicData does.
+    bool deserialize(
+            eprosima::fastcdr::Cdr& cdr);
+
+    static size_t getCdrSerializedSize(
+            const FlatDynamicData* data,
+            size_t current_alignment = 0);
+
+    void serialize(
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    void serializeKey(
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    friend class DynamicDataFactory;
+    friend class FlatDynamicPubSubType;
+
+public:
+
+    RTPS_DllAPI ~FlatDynamicData();
+
+    FlatDynamicData(
+            const FlatDynamicData&) = delete;
+
+    FlatDynamicData& operator =(
+            const FlatDynamicData&) = delete;
+
+    RTPS_DllAPI DynamicType_ptr get_type() const;
+
+    RTPS_DllAPI TypeKind get_kind() const;
+
+    RTPS_DllAPI uint32_t get_item_count() const;
+
+    RTPS_DllAPI MemberId get_member_id_by_name(
+            const std::string& name) const;
+
+    RTPS_DllAPI MemberId get_member_id_at_index(
+            uint32_t index) const;
+
+    RTPS_DllAPI bool equals(
+            const FlatDynamicData* other) const;
+
+    RTPS_DllAPI ReturnCode_t clear_all_values();
+
+    /**
+     * Copy all the values of another sample of the same type.
+     * @param other Sample to copy
+     * @return RETCODE_BAD_PARAMETER if the samples do not share the type, RETCODE_OK otherwise
+     */
+    RTPS_DllAPI ReturnCode_t copy_from(
+            const FlatDynamicData* other);
+
+    /**
+     * Fill this sample with the values of a DynamicData of the same type.
+     * @param data DynamicData to read
+     * @return RETCODE_OK on success
+     */
+    RTPS_DllAPI ReturnCode_t copy_from(
+            DynamicData* data);
+
+    /**
+     * Fill a DynamicData of the same type with the values of this sample.
+     * @param data DynamicData to write
+     * @return RETCODE_OK on success
+     */
+    RTPS_DllAPI ReturnCode_t copy_to(
+            DynamicData* data) const;
+
+    RTPS_DllAPI FlatDynamicData* loan_value(
+            MemberId id);
+
+    RTPS_DllAPI ReturnCode_t return_loaned_value(
+            const FlatDynamicData* value);
+
+    /**
+     * Append an element with its default value to a sequence.
+     * @param [out] outId Index of the new element
+     * @return RETCODE_BAD_PARAMETER if this is not a sequence or it is full, RETCODE_PRECONDITION_NOT_MET if an
+     * element is loaned, RETCODE_OK otherwise
+     */
+    RTPS_DllAPI ReturnCode_t insert_sequence_data(
+            MemberId& outId);
+
+    /**
+     * Remove an element of a sequence, moving back the ones following it.
+     * @param id Index of the element
+     * @return RETCODE_BAD_PARAMETER if this is not a sequence or the element does not exist,
+     * RETCODE_PRECONDITION_NOT_MET if an element is loaned, RETCODE_OK otherwise
+     */
+    RTPS_DllAPI ReturnCode_t remove_sequence_data(
+            MemberId id);
+
+    /**
+     * Remove all the elements of a sequence.
+     * @return RETCODE_BAD_PARAMETER if this is not a sequence, RETCODE_PRECONDITION_NOT_MET if an element is loaned,
+     * RETCODE_OK otherwise
+     */
+    RTPS_DllAPI ReturnCode_t clear_data();
+
+    RTPS_DllAPI ReturnCode_t get_int32_value(
+            int32_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_int32_value(
+            int32_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_uint32_value(
+            uint32_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_uint32_value(
+            uint32_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_int16_value(
+            int16_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_int16_value(
+            int16_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_uint16_value(
+            uint16_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_uint16_value(
+            uint16_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_int64_value(
+            int64_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_int64_value(
+            int64_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_uint64_value(
+            uint64_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_uint64_value(
+            uint64_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_float32_value(
+            float& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_float32_value(
+            float value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_float64_value(
+            double& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_float64_value(
+            double value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_float128_value(
+            long double& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_float128_value(
+            long double value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_char8_value(
+            char& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_char8_value(
+            char value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_char16_value(
+            wchar_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_char16_value(
+            wchar_t value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_byte_value(
+            octet& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_byte_value(
+            octet value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_int8_value(
+            int8_t& value,
+            MemberId id) const
+    {
+        octet aux;
+        ReturnCode_t result = get_byte_value(aux, id);
+        value = static_cast<int8_t>(aux);
+        return result;
+    }
+
+    RTPS_DllAPI ReturnCode_t set_int8_value(
+            int8_t value,
+            MemberId id = MEMBER_ID_INVALID)
+    {
+        return set_byte_value(static_cast<octet>(value), id);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_uint8_value(
+            uint8_t& value,
+            MemberId id) const
+    {
+        octet aux;
+        ReturnCode_t result = get_byte_value(aux, id);
+        value = static_cast<uint8_t>(aux);
+        return result;
+    }
+
+    RTPS_DllAPI ReturnCode_t set_uint8_value(
+            uint8_t value,
+            MemberId id = MEMBER_ID_INVALID)
+    {
+        return set_byte_value(static_cast<octet>(value), id);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_bool_value(
+            bool& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_bool_value(
+            bool value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_string_value(
+            std::string& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_string_value(
+            const std::string& value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_wstring_value(
+            std::wstring& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_wstring_value(
+            const std::wstring& value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_enum_value(
+            std::string& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_enum_value(
+            const std::string& value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_enum_value(
+            uint32_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_enum_value(
+            const uint32_t& value,
+            MemberId id = MEMBER_ID_INVALID);
+
+    RTPS_DllAPI ReturnCode_t get_bitmask_value(
+            uint64_t& value) const;
+
+    RTPS_DllAPI ReturnCode_t set_bitmask_value(
+            uint64_t value);
+
+    // Basic types returns (copy)
+    RTPS_DllAPI int32_t get_int32_value(
+            MemberId id) const
+    {
+        int32_t value = 0;
+        get_int32_value(value, id);
+        return value;
+    }
+
+    RTPS_DllAPI uint32_t get_uint32_value(
+            MemberId id) const
+    {
+        uint32_t value = 0;
+        get_uint32_value(value, id);
+        return value;
+    }
+
+    RTPS_DllAPI int64_t get_int64_value(
+            MemberId id) const
+    {
+        int64_t value = 0;
+        get_int64_value(value, id);
+        return value;
+    }
+
+    RTPS_DllAPI uint64_t get_uint64_value(
+            MemberId id) const
+    {
+        uint64_t value = 0;
+        get_uint64_value(value, id);
+        return value;
+    }
+
+    RTPS_DllAPI double get_float64_value(
+            MemberId id) const
+    {
+        double value = 0;
+        get_float64_value(value, id);
+        return value;
+    }
+
+    RTPS_DllAPI std::string get_string_value(
+            MemberId id) const
+    {
+        std::string value;
+        get_string_value(value, id);
+        return value;
+    }
+
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_FLAT_DYNAMIC_DATA_H
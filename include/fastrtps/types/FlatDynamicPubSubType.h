@@ -0,0 +1,71 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_FLAT_DYNAMIC_PUB_SUB_TYPE_H
+#define TYPES_FLAT_DYNAMIC_PUB_SUB_TYPE_H
+
+#include <fastrtps/types/DynamicPubSubType.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * DynamicPubSubType whose samples are FlatDynamicData instead of DynamicData.
+ *
+ * The wire format is the one of DynamicPubSubType, so flat and non flat endpoints of the same type interoperate.
+ * The type must be set on construction and be supported by DynamicDataFactory::create_flat_data.
+ */
+class FlatDynamicPubSubType : public DynamicPubSubType
+{
+protected:
+
+    void serialize_sample(
+            const void* data,
+            eprosima::fastcdr::Cdr& cdr) const override;
+
+    void deserialize_sample(
+            void* data,
+            eprosima::fastcdr::Cdr& cdr) const override;
+
+    void serialize_key(
+            const void* data,
+            eprosima::fastcdr::Cdr& cdr) const override;
+
+public:
+
+    RTPS_DllAPI FlatDynamicPubSubType(
+            DynamicType_ptr pDynamicType);
+
+    RTPS_DllAPI void* createData() override;
+
+    RTPS_DllAPI void deleteData (
+            void* data) override;
+
+    RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+    }
+
+    RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            fastdds::dds::DataRepresentationId_t data_representation) override;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_FLAT_DYNAMIC_PUB_SUB_TYPE_H
@@ -19,7 +19,10 @@
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
+#include <functional>
 #include <mutex>
+#include <set>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -28,8 +31,8 @@ namespace types {
 class TypeObjectFactory
 {
 private:
+    // Also guards the objects, which may be created while looking up an identifier
     mutable std::recursive_mutex m_MutexIdentifiers;
-    mutable std::recursive_mutex m_MutexObjects;
     mutable std::recursive_mutex m_MutexInformations;
 
 protected:
@@ -42,6 +45,12 @@ protected:
     mutable std::map<const TypeIdentifier*, TypeInformation*> informations_;
     mutable std::vector<TypeInformation*> informations_created_;
     std::map<std::string, std::string> aliases_; // Aliases
+    // Names of the entries of identifiers_ and complete_identifiers_ by the hash of the identifier value, so
+    // looking up an identifier by value does not compare it against every stored one.
+    std::unordered_map<size_t, std::set<std::string>> identifier_names_;
+    std::unordered_map<size_t, std::set<std::string>> complete_identifier_names_;
+    // Functions registering the TypeObjects of a type, run the first time the type is looked up
+    mutable std::map<std::string, std::function<void()>> type_object_providers_;
 
     DynamicType_ptr build_dynamic_type(
             TypeDescriptor& descriptor,
@@ -51,9 +60,50 @@ protected:
     const TypeIdentifier* try_get_complete(
             const TypeIdentifier* identifier) const;
 
+    /**
+     * @brief Looks up the stored identifier equal to the given one.
+     * @param identifier
+     * @param build_pending Whether to run the pending providers if a hashed identifier is not found.
+     * @return The stored identifier, the given one if it is not hashed and not stored, or nullptr.
+     */
     const TypeIdentifier* get_stored_type_identifier(
+            const TypeIdentifier* identifier,
+            bool build_pending = true) const;
+
+    /**
+     * @brief Sets the identifier stored for a type name, keeping the hash index up to date.
+     * @param type_name
+     * @param identifier Stored identifier, nullptr to only remove the previous one from the index.
+     * @param complete Whether the entry belongs to complete_identifiers_ or to identifiers_.
+     */
+    void store_type_identifier(
+            const std::string& type_name,
+            const TypeIdentifier* identifier,
+            bool complete);
+
+    /**
+     * @brief Looks up by value the name of a stored identifier.
+     * EK_COMPLETE identifiers are looked up in complete_identifiers_ and any other one in identifiers_.
+     * @param identifier
+     * @return The first name, in alphabetical order, whose identifier is equal to the given one, or nullptr.
+     */
+    const std::string* find_type_identifier_name(
             const TypeIdentifier* identifier) const;
 
+    /**
+     * @brief Runs the provider registered for a type name, if any.
+     * @param type_name
+     */
+    void run_type_object_provider(
+            const std::string& type_name) const;
+
+    /**
+     * @brief Runs all the pending providers.
+     * Used when an identifier is looked up by value, as the name of its type is unknown.
+     * @return true if any provider was run.
+     */
+    bool run_all_type_object_providers() const;
+
     std::string generate_name_and_store_type_identifier(
             const TypeIdentifier* identifier) const;
 
@@ -207,6 +257,17 @@ public:
             const TypeIdentifier* identifier,
             const TypeObject* object);
 
+    /**
+     * @brief Registers a function adding the TypeObjects of a type, instead of adding them right away.
+     * The function is run, and discarded, the first time the type is looked up by name, or when an identifier
+     * not known by the factory is looked up. Types that are never used are therefore never built.
+     * @param type_name
+     * @param provider Function calling add_type_object for type_name.
+     */
+    RTPS_DllAPI void add_type_object_provider(
+            const std::string& type_name,
+            std::function<void()> provider);
+
     RTPS_DllAPI inline void add_alias(
             const std::string& alias_name,
             const std::string& target_type)
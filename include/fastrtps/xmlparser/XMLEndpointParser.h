@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <tinyxml2.h>
@@ -81,15 +82,15 @@ class XMLEndpointParser : XMLParser
 {
 public:
 
-    XMLEndpointParser();
-    virtual ~XMLEndpointParser();
+    RTPS_DllAPI XMLEndpointParser();
+    RTPS_DllAPI virtual ~XMLEndpointParser();
     /**
      * Load the XML file
      * @param filename Name or data of the file to load and parse.
      * The string could contain a filename (file://) or the XML content directly (data://), filename assumed if neither
      * @return True if correct.
      */
-    XMLP_ret loadXMLFile(
+    RTPS_DllAPI XMLP_ret loadXMLFile(
             std::string& filename);
     /**
      * Load the XML node
@@ -99,6 +100,24 @@ public:
     XMLP_ret loadXMLNode(
             tinyxml2::XMLDocument& doc);
 
+    /**
+     * Load a precompiled endpoint table, as generated by saveBinaryFile.
+     * The file is memory mapped and decoded directly, skipping all XML processing.
+     * @param filename Name of the file to load.
+     * @return XML_OK if correct, XML_NOK if the file does not start as an endpoint table or cannot be read,
+     * XML_ERROR if it is corrupt.
+     */
+    RTPS_DllAPI XMLP_ret loadBinaryFile(
+            const std::string& filename);
+
+    /**
+     * Save the previously loaded endpoints as a precompiled endpoint table.
+     * @param filename Name of the file to write.
+     * @return True if correct.
+     */
+    RTPS_DllAPI XMLP_ret saveBinaryFile(
+            const std::string& filename) const;
+
     void loadXMLParticipantEndpoint(
             tinyxml2::XMLElement* xml_endpoint,
             StaticRTPSParticipantInfo* pdata);
@@ -146,6 +165,10 @@ public:
 
 private:
 
+    XMLP_ret loadBinaryTable(
+            const rtps::octet* data,
+            size_t size);
+
     XMLP_ret get_disable_positive_acks_qos(
             tinyxml2::XMLElement* elem,
             DisablePositiveACKsQosPolicy& disable_positive_acks_qos);
@@ -154,6 +177,11 @@ private:
     std::set<uint32_t> m_entityIds;
 
     std::vector<StaticRTPSParticipantInfo*> m_RTPSParticipants;
+
+    //! Readers of all participants indexed by their user defined id
+    std::unordered_map<uint16_t, rtps::ReaderProxyData*> m_readersById;
+    //! Writers of all participants indexed by their user defined id
+    std::unordered_map<uint16_t, rtps::WriterProxyData*> m_writersById;
 };
 
 
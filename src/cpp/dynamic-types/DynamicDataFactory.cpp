@@ -17,6 +17,8 @@
 #include <fastrtps/types/DynamicTypeBuilderFactory.h>
 #include <fastdds/dds/log/Log.hpp>
 
+#include <dynamic-types/FlatDynamicDataLayout.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -227,6 +229,49 @@ bool DynamicDataFactory::is_empty() const
 #endif // ifndef DISABLE_DYNAMIC_MEMORY_CHECK
 }
 
+FlatDynamicData* DynamicDataFactory::create_flat_data(
+        DynamicType_ptr pType)
+{
+    if (pType == nullptr || !pType->is_consistent())
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error creating FlatDynamicData. Invalid dynamic type");
+        return nullptr;
+    }
+
+    std::shared_ptr<const FlatDynamicDataLayout> layout = FlatDynamicDataLayout::get(pType);
+    if (!layout)
+    {
+        return nullptr;
+    }
+    return new FlatDynamicData(layout);
+}
+
+FlatDynamicData* DynamicDataFactory::create_flat_copy(
+        const FlatDynamicData* pData)
+{
+    if (pData == nullptr || !pData->buffer_)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error copying FlatDynamicData. Loaned values cannot be copied");
+        return nullptr;
+    }
+    return new FlatDynamicData(pData);
+}
+
+ReturnCode_t DynamicDataFactory::delete_flat_data(
+        FlatDynamicData* pData)
+{
+    if (pData != nullptr)
+    {
+        if (!pData->buffer_)
+        {
+            EPROSIMA_LOG_ERROR(DYN_TYPES, "Error deleting FlatDynamicData. Loaned values are owned by their sample");
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+        delete pData;
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
 } // namespace types
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,775 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicDataSerializationPlan.cpp
+ */
+
+#include <dynamic-types/DynamicDataSerializationPlan.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+
+#include <utils/ByteSwap.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+using eprosima::fastcdr::Cdr;
+using eprosima::fastcdr::exception::BadParamException;
+
+namespace {
+
+//! Maximum number of elements of a sequence read at once
+constexpr size_t max_chunk_elements = 1024;
+
+//! Size of the primitives whose arrays and sequences are processed at once, 0 for the rest
+uint8_t bulk_element_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_CHAR8:
+        case TK_BYTE:
+            return 1;
+        case TK_INT16:
+        case TK_UINT16:
+            return 2;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+            return 4;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8;
+        default:
+            // Booleans are validated when deserialized, wide chars and long doubles are not stored with their CDR size
+            return 0;
+    }
+}
+
+} // namespace
+
+std::shared_ptr<const DynamicDataSerializationPlan> DynamicDataSerializationPlan::compile(
+        const DynamicType_ptr& type)
+{
+#ifdef DYNAMIC_TYPES_CHECKING
+    static_cast<void>(type);
+    return nullptr;
+#else
+    if (!type)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<DynamicDataSerializationPlan> plan(new DynamicDataSerializationPlan());
+    plan->type_ = type;
+    while (plan->type_ && TK_ALIAS == plan->type_->get_kind())
+    {
+        plan->type_ = plan->type_->get_descriptor()->get_base_type();
+    }
+    if (!plan->type_)
+    {
+        return nullptr;
+    }
+
+    plan->compile_type(plan->type_, MEMBER_ID_INVALID);
+    if (plan->fixed_size_)
+    {
+        plan->serialized_size_ = plan->range_size(0, static_cast<uint32_t>(plan->instructions_.size()), nullptr, 0);
+    }
+    return plan;
+#endif // ifdef DYNAMIC_TYPES_CHECKING
+}
+
+void DynamicDataSerializationPlan::compile_type(
+        const DynamicType_ptr& type,
+        MemberId id)
+{
+    DynamicType_ptr resolved = type;
+    while (resolved && TK_ALIAS == resolved->get_kind())
+    {
+        resolved = resolved->get_descriptor()->get_base_type();
+    }
+    if (!resolved || resolved->get_descriptor()->annotation_is_non_serialized())
+    {
+        return;
+    }
+
+    Instruction instruction {Opcode::GENERIC, resolved->get_kind(), id, 0, 0, resolved};
+    switch (instruction.kind)
+    {
+        case TK_STRING8:
+        case TK_STRING16:
+            fixed_size_ = false;
+            instruction.opcode = Opcode::VALUE;
+            break;
+        case TK_INT16:
+        case TK_UINT16:
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT32:
+        case TK_FLOAT64:
+        case TK_FLOAT128:
+        case TK_CHAR8:
+        case TK_CHAR16:
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_ENUM:
+            instruction.opcode = Opcode::VALUE;
+            break;
+        case TK_STRUCTURE:
+        {
+            // Inherited members are left to DynamicData
+            if (resolved->get_descriptor()->get_base_type())
+            {
+                fixed_size_ = false;
+                break;
+            }
+
+            uint32_t position = static_cast<uint32_t>(instructions_.size());
+            instruction.opcode = Opcode::STRUCTURE;
+            instructions_.push_back(instruction);
+
+            std::map<MemberId, DynamicTypeMember*> members;
+            resolved->get_all_members(members);
+            for (auto& member : members)
+            {
+                // DynamicData only serializes the members whose id is below the number of members
+                const MemberDescriptor* descriptor = member.second->get_descriptor();
+                if (member.first < members.size() && !descriptor->annotation_is_non_serialized())
+                {
+                    compile_type(descriptor->get_type(), member.first);
+                }
+            }
+
+            instructions_[position].end = static_cast<uint32_t>(instructions_.size());
+            return;
+        }
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        {
+            uint32_t position = static_cast<uint32_t>(instructions_.size());
+            if (TK_ARRAY == instruction.kind)
+            {
+                instruction.opcode = Opcode::ARRAY;
+                instruction.count = resolved->get_total_bounds();
+            }
+            else
+            {
+                instruction.opcode = Opcode::SEQUENCE;
+                fixed_size_ = false;
+            }
+            instruction.type = resolved->get_descriptor()->get_element_type();
+            instructions_.push_back(instruction);
+
+            compile_type(instruction.type, MEMBER_ID_INVALID);
+
+            instructions_[position].end = static_cast<uint32_t>(instructions_.size());
+            if (position + 2 == instructions_[position].end && Opcode::VALUE == instructions_[position + 1].opcode)
+            {
+                instructions_[position].element_size = bulk_element_size(instructions_[position + 1].kind);
+            }
+            return;
+        }
+        default:
+            fixed_size_ = false;
+            break;
+    }
+
+    instructions_.push_back(instruction);
+}
+
+bool DynamicDataSerializationPlan::applies_to(
+        const DynamicData* data) const
+{
+    return nullptr != data && data->type_.get() == type_.get();
+}
+
+#ifndef DYNAMIC_TYPES_CHECKING
+
+namespace {
+
+inline DynamicData* member_data(
+        const DynamicData* data,
+        const std::map<MemberId, void*>& values,
+        MemberId id)
+{
+    if (MEMBER_ID_INVALID == id)
+    {
+        return const_cast<DynamicData*>(data);
+    }
+    auto it = values.find(id);
+    return it != values.end() ? static_cast<DynamicData*>(it->second) : nullptr;
+}
+
+/*
+ * Elements are gathered in native endianness and written to the stream in its endianness, so fastcdr only has to
+ * copy them. Swapping is left to the vectorized kernels instead of fastcdr, which swaps them one by one.
+ */
+void write_elements(
+        std::vector<uint8_t>& buffer,
+        uint8_t element_size,
+        size_t count,
+        Cdr& cdr)
+{
+    if (Cdr::DEFAULT_ENDIAN != cdr.endianness())
+    {
+        swap_bytes(buffer.data(), buffer.data(), element_size, count);
+    }
+
+    switch (element_size)
+    {
+        case 1:
+            cdr.serialize_array(buffer.data(), count);
+            break;
+        case 2:
+            cdr.serialize_array(reinterpret_cast<const uint16_t*>(buffer.data()), count, Cdr::DEFAULT_ENDIAN);
+            break;
+        case 4:
+            cdr.serialize_array(reinterpret_cast<const uint32_t*>(buffer.data()), count, Cdr::DEFAULT_ENDIAN);
+            break;
+        default:
+            cdr.serialize_array(reinterpret_cast<const uint64_t*>(buffer.data()), count, Cdr::DEFAULT_ENDIAN);
+            break;
+    }
+}
+
+void read_elements(
+        std::vector<uint8_t>& buffer,
+        uint8_t element_size,
+        size_t count,
+        Cdr& cdr)
+{
+    switch (element_size)
+    {
+        case 1:
+            cdr.deserialize_array(buffer.data(), count);
+            break;
+        case 2:
+            cdr.deserialize_array(reinterpret_cast<uint16_t*>(buffer.data()), count, Cdr::DEFAULT_ENDIAN);
+            break;
+        case 4:
+            cdr.deserialize_array(reinterpret_cast<uint32_t*>(buffer.data()), count, Cdr::DEFAULT_ENDIAN);
+            break;
+        default:
+            cdr.deserialize_array(reinterpret_cast<uint64_t*>(buffer.data()), count, Cdr::DEFAULT_ENDIAN);
+            break;
+    }
+
+    if (Cdr::DEFAULT_ENDIAN != cdr.endianness())
+    {
+        swap_bytes(buffer.data(), buffer.data(), element_size, count);
+    }
+}
+
+} // namespace
+
+size_t DynamicDataSerializationPlan::serialized_size(
+        const DynamicData* data,
+        size_t current_alignment) const
+{
+    if (fixed_size_ && 0 == current_alignment)
+    {
+        return serialized_size_;
+    }
+    return range_size(0, static_cast<uint32_t>(instructions_.size()), data, current_alignment);
+}
+
+size_t DynamicDataSerializationPlan::range_size(
+        uint32_t begin,
+        uint32_t end,
+        const DynamicData* data,
+        size_t current_alignment) const
+{
+    size_t initial_alignment = current_alignment;
+
+    uint32_t pc = begin;
+    while (pc < end)
+    {
+        const Instruction& instruction = instructions_[pc];
+        // A null sample stands for the default value, as in elements of arrays which were never set
+        const DynamicData* target = nullptr == data ? nullptr : member_data(data, data->values_, instruction.id);
+
+        switch (instruction.opcode)
+        {
+            case Opcode::VALUE:
+                switch (instruction.kind)
+                {
+                    case TK_INT16:
+                    case TK_UINT16:
+                        current_alignment += 2 + Cdr::alignment(current_alignment, 2);
+                        break;
+                    case TK_INT32:
+                    case TK_UINT32:
+                    case TK_FLOAT32:
+                    case TK_ENUM:
+                    case TK_CHAR16: // WCHARS NEED 32 Bits on Linux & MacOS
+                        current_alignment += 4 + Cdr::alignment(current_alignment, 4);
+                        break;
+                    case TK_INT64:
+                    case TK_UINT64:
+                    case TK_FLOAT64:
+                        current_alignment += 8 + Cdr::alignment(current_alignment, 8);
+                        break;
+                    case TK_FLOAT128:
+                        current_alignment += 16 + Cdr::alignment(current_alignment, 8);
+                        break;
+                    case TK_STRING8:
+                        // string length + characters + 1
+                        current_alignment += 4 + Cdr::alignment(current_alignment, 4) + 1 +
+                                (nullptr == target ? 0 :
+                                static_cast<const std::string*>(target->values_.begin()->second)->length());
+                        break;
+                    case TK_STRING16:
+                        // string length + (characters * 4)
+                        current_alignment += 4 + Cdr::alignment(current_alignment, 4) +
+                                (nullptr == target ? 0 :
+                                static_cast<const std::wstring*>(target->values_.begin()->second)->length() * 4);
+                        break;
+                    default:
+                        current_alignment += 1;
+                        break;
+                }
+                ++pc;
+                break;
+            case Opcode::STRUCTURE:
+                current_alignment += range_size(pc + 1, instruction.end, target, current_alignment);
+                pc = instruction.end;
+                break;
+            case Opcode::ARRAY:
+                for (uint32_t idx = 0; idx < instruction.count; ++idx)
+                {
+                    const DynamicData* element = nullptr == target ? nullptr :
+                            member_data(target, target->values_, idx);
+                    current_alignment += range_size(pc + 1, instruction.end, element, current_alignment);
+                }
+                pc = instruction.end;
+                break;
+            case Opcode::SEQUENCE:
+                // Elements count
+                current_alignment += 4 + Cdr::alignment(current_alignment, 4);
+                if (nullptr != target)
+                {
+                    for (auto& element : target->values_)
+                    {
+                        current_alignment += range_size(pc + 1, instruction.end,
+                                        static_cast<const DynamicData*>(element.second), current_alignment);
+                    }
+                }
+                pc = instruction.end;
+                break;
+            case Opcode::GENERIC:
+                current_alignment += nullptr == target ?
+                        DynamicData::getEmptyCdrSerializedSize(instruction.type.get(), current_alignment) :
+                        DynamicData::getCdrSerializedSize(target, current_alignment);
+                ++pc;
+                break;
+        }
+    }
+
+    return current_alignment - initial_alignment;
+}
+
+void DynamicDataSerializationPlan::serialize(
+        const DynamicData* data,
+        Cdr& cdr) const
+{
+    serialize_range(0, static_cast<uint32_t>(instructions_.size()), data, cdr);
+}
+
+void DynamicDataSerializationPlan::serialize_range(
+        uint32_t begin,
+        uint32_t end,
+        const DynamicData* data,
+        Cdr& cdr) const
+{
+    uint32_t pc = begin;
+    while (pc < end)
+    {
+        const Instruction& instruction = instructions_[pc];
+        const DynamicData* target = member_data(data, data->values_, instruction.id);
+        if (nullptr == target)
+        {
+            throw BadParamException("Missing member on DynamicData");
+        }
+
+        switch (instruction.opcode)
+        {
+            case Opcode::VALUE:
+            {
+                const void* value = target->values_.begin()->second;
+                switch (instruction.kind)
+                {
+                    case TK_INT16:
+                        cdr << *static_cast<const int16_t*>(value);
+                        break;
+                    case TK_UINT16:
+                        cdr << *static_cast<const uint16_t*>(value);
+                        break;
+                    case TK_INT32:
+                        cdr << *static_cast<const int32_t*>(value);
+                        break;
+                    case TK_UINT32:
+                    case TK_ENUM:
+                        cdr << *static_cast<const uint32_t*>(value);
+                        break;
+                    case TK_INT64:
+                        cdr << *static_cast<const int64_t*>(value);
+                        break;
+                    case TK_UINT64:
+                        cdr << *static_cast<const uint64_t*>(value);
+                        break;
+                    case TK_FLOAT32:
+                        cdr << *static_cast<const float*>(value);
+                        break;
+                    case TK_FLOAT64:
+                        cdr << *static_cast<const double*>(value);
+                        break;
+                    case TK_FLOAT128:
+                        cdr << *static_cast<const long double*>(value);
+                        break;
+                    case TK_CHAR8:
+                        cdr << *static_cast<const char*>(value);
+                        break;
+                    case TK_CHAR16:
+                        cdr << *static_cast<const wchar_t*>(value);
+                        break;
+                    case TK_BOOLEAN:
+                        cdr << *static_cast<const bool*>(value);
+                        break;
+                    case TK_BYTE:
+                        cdr << *static_cast<const octet*>(value);
+                        break;
+                    case TK_STRING8:
+                        cdr << *static_cast<const std::string*>(value);
+                        break;
+                    case TK_STRING16:
+                        cdr << *static_cast<const std::wstring*>(value);
+                        break;
+                    default:
+                        break;
+                }
+                ++pc;
+                break;
+            }
+            case Opcode::STRUCTURE:
+                serialize_range(pc + 1, instruction.end, target, cdr);
+                pc = instruction.end;
+                break;
+            case Opcode::ARRAY:
+                if (0 != instruction.element_size && target->values_.size() == instruction.count)
+                {
+                    serialize_elements(target, instruction.element_size, cdr);
+                    pc = instruction.end;
+                    break;
+                }
+
+                for (uint32_t idx = 0; idx < instruction.count; ++idx)
+                {
+                    auto it = target->values_.find(idx);
+                    if (it != target->values_.end())
+                    {
+                        serialize_range(pc + 1, instruction.end, static_cast<const DynamicData*>(it->second), cdr);
+                    }
+                    else
+                    {
+                        target->serialize_empty_data(instruction.type, cdr);
+                    }
+                }
+                pc = instruction.end;
+                break;
+            case Opcode::SEQUENCE:
+            {
+                uint32_t size = static_cast<uint32_t>(target->values_.size());
+                cdr << size;
+                if (0 != instruction.element_size)
+                {
+                    serialize_elements(target, instruction.element_size, cdr);
+                    pc = instruction.end;
+                    break;
+                }
+
+                for (uint32_t idx = 0; idx < size; ++idx)
+                {
+                    serialize_range(pc + 1, instruction.end,
+                            static_cast<const DynamicData*>(target->values_.at(idx)), cdr);
+                }
+                pc = instruction.end;
+                break;
+            }
+            case Opcode::GENERIC:
+                target->serialize(cdr);
+                ++pc;
+                break;
+        }
+    }
+}
+
+void DynamicDataSerializationPlan::deserialize(
+        DynamicData* data,
+        Cdr& cdr) const
+{
+    deserialize_range(0, static_cast<uint32_t>(instructions_.size()), data, cdr);
+}
+
+void DynamicDataSerializationPlan::deserialize_range(
+        uint32_t begin,
+        uint32_t end,
+        DynamicData* data,
+        Cdr& cdr) const
+{
+    uint32_t pc = begin;
+    while (pc < end)
+    {
+        const Instruction& instruction = instructions_[pc];
+        DynamicData* target = member_data(data, data->values_, instruction.id);
+        if (nullptr == target)
+        {
+            throw BadParamException("Missing member on DynamicData");
+        }
+
+        switch (instruction.opcode)
+        {
+            case Opcode::VALUE:
+            {
+                void* value = target->values_.begin()->second;
+                switch (instruction.kind)
+                {
+                    case TK_INT16:
+                        cdr >> *static_cast<int16_t*>(value);
+                        break;
+                    case TK_UINT16:
+                        cdr >> *static_cast<uint16_t*>(value);
+                        break;
+                    case TK_INT32:
+                        cdr >> *static_cast<int32_t*>(value);
+                        break;
+                    case TK_UINT32:
+                    case TK_ENUM:
+                        cdr >> *static_cast<uint32_t*>(value);
+                        break;
+                    case TK_INT64:
+                        cdr >> *static_cast<int64_t*>(value);
+                        break;
+                    case TK_UINT64:
+                        cdr >> *static_cast<uint64_t*>(value);
+                        break;
+                    case TK_FLOAT32:
+                        cdr >> *static_cast<float*>(value);
+                        break;
+                    case TK_FLOAT64:
+                        cdr >> *static_cast<double*>(value);
+                        break;
+                    case TK_FLOAT128:
+                        cdr >> *static_cast<long double*>(value);
+                        break;
+                    case TK_CHAR8:
+                        cdr >> *static_cast<char*>(value);
+                        break;
+                    case TK_CHAR16:
+                        cdr >> *static_cast<wchar_t*>(value);
+                        break;
+                    case TK_BOOLEAN:
+                        cdr >> *static_cast<bool*>(value);
+                        break;
+                    case TK_BYTE:
+                        cdr >> *static_cast<octet*>(value);
+                        break;
+                    case TK_STRING8:
+                        cdr >> *static_cast<std::string*>(value);
+                        break;
+                    case TK_STRING16:
+                        cdr >> *static_cast<std::wstring*>(value);
+                        break;
+                    default:
+                        break;
+                }
+                ++pc;
+                break;
+            }
+            case Opcode::STRUCTURE:
+                deserialize_range(pc + 1, instruction.end, target, cdr);
+                pc = instruction.end;
+                break;
+            case Opcode::ARRAY:
+                // Elements holding the default value are not stored, DynamicData decides whether to store them
+                if (0 != instruction.element_size && target->values_.size() == instruction.count)
+                {
+                    deserialize_elements(target, instruction.element_size, cdr);
+                }
+                else if (target->values_.size() == instruction.count)
+                {
+                    for (uint32_t idx = 0; idx < instruction.count; ++idx)
+                    {
+                        deserialize_range(pc + 1, instruction.end,
+                                static_cast<DynamicData*>(target->values_.at(idx)), cdr);
+                    }
+                }
+                else
+                {
+                    target->deserialize(cdr);
+                }
+                pc = instruction.end;
+                break;
+            case Opcode::SEQUENCE:
+                if (0 != instruction.element_size)
+                {
+                    deserialize_sequence_elements(target, instruction.element_size, cdr);
+                }
+                else
+                {
+                    // Elements are created by DynamicData
+                    target->deserialize(cdr);
+                }
+                pc = instruction.end;
+                break;
+            case Opcode::GENERIC:
+                target->deserialize(cdr);
+                ++pc;
+                break;
+        }
+    }
+}
+
+void DynamicDataSerializationPlan::serialize_elements(
+        const DynamicData* data,
+        uint8_t element_size,
+        Cdr& cdr)
+{
+    size_t count = data->values_.size();
+    if (0 == count)
+    {
+        return;
+    }
+
+    // Elements are sorted by index
+    std::vector<uint8_t> buffer(count * element_size);
+    uint8_t* position = buffer.data();
+    for (auto& element : data->values_)
+    {
+        memcpy(position, static_cast<const DynamicData*>(element.second)->values_.begin()->second, element_size);
+        position += element_size;
+    }
+    write_elements(buffer, element_size, count, cdr);
+}
+
+void DynamicDataSerializationPlan::deserialize_elements(
+        DynamicData* data,
+        uint8_t element_size,
+        Cdr& cdr)
+{
+    size_t count = data->values_.size();
+    if (0 == count)
+    {
+        return;
+    }
+
+    std::vector<uint8_t> buffer(count * element_size);
+    read_elements(buffer, element_size, count, cdr);
+    const uint8_t* position = buffer.data();
+    for (auto& element : data->values_)
+    {
+        memcpy(static_cast<DynamicData*>(element.second)->values_.begin()->second, position, element_size);
+        position += element_size;
+    }
+}
+
+void DynamicDataSerializationPlan::deserialize_sequence_elements(
+        DynamicData* data,
+        uint8_t element_size,
+        Cdr& cdr)
+{
+    uint32_t size = 0;
+    cdr >> size;
+
+    // Read in chunks, so a wrong length fails on the end of the stream instead of allocating all its elements
+    std::vector<uint8_t> buffer;
+    uint32_t idx = 0;
+    while (idx < size)
+    {
+        size_t count = std::min<size_t>(size - idx, max_chunk_elements);
+        buffer.resize(count * element_size);
+        read_elements(buffer, element_size, count, cdr);
+
+        const uint8_t* position = buffer.data();
+        for (size_t i = 0; i < count; ++i, ++idx)
+        {
+            // Elements are created as DynamicData does, which keeps the ones it already has
+            DynamicData* element = nullptr;
+            auto it = data->values_.lower_bound(idx);
+            if (it != data->values_.end() && it->first == idx)
+            {
+                element = static_cast<DynamicData*>(it->second);
+            }
+            else
+            {
+                element = DynamicDataFactory::get_instance()->create_data(
+                    data->type_->get_descriptor()->get_element_type());
+                data->values_.emplace_hint(it, idx, element);
+            }
+            element->key_element_ = false;
+
+            memcpy(element->values_.begin()->second, position, element_size);
+            position += element_size;
+        }
+    }
+}
+
+#else
+
+size_t DynamicDataSerializationPlan::serialized_size(
+        const DynamicData* data,
+        size_t current_alignment) const
+{
+    return DynamicData::getCdrSerializedSize(data, current_alignment);
+}
+
+void DynamicDataSerializationPlan::serialize(
+        const DynamicData* data,
+        Cdr& cdr) const
+{
+    data->serialize(cdr);
+}
+
+void DynamicDataSerializationPlan::deserialize(
+        DynamicData* data,
+        Cdr& cdr) const
+{
+    data->deserialize(cdr);
+}
+
+#endif // ifndef DYNAMIC_TYPES_CHECKING
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,190 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicDataSerializationPlan.hpp
+ */
+
+#ifndef _FASTDDS_DYNAMIC_TYPES_DYNAMICDATASERIALIZATIONPLAN_HPP_
+#define _FASTDDS_DYNAMIC_TYPES_DYNAMICDATASERIALIZATIONPLAN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastrtps {
+namespace types {
+
+class DynamicData;
+
+/**
+ * Serialization of the DynamicData samples of a type, compiled once from its DynamicType.
+ *
+ * The type tree is flattened into a list of instructions in wire order. Aliases are resolved and non serialized
+ * members are dropped when compiling, so serializing a sample does not look up member descriptors or annotations.
+ * Structures and arrays are scopes over a range of instructions. Unions, maps, bitsets and bitmasks are delegated
+ * to DynamicData.
+ * Arrays and sequences of fixed size numeric primitives are gathered and (de)serialized at once, swapping their bytes
+ * with vectorized kernels when the endianness of the stream is not the native one.
+ */
+class DynamicDataSerializationPlan
+{
+public:
+
+    /**
+     * Compile the plan of a type.
+     * @param type Type of the samples
+     * @return The plan, nullptr when DynamicData is built with DYNAMIC_TYPES_CHECKING
+     */
+    static std::shared_ptr<const DynamicDataSerializationPlan> compile(
+            const DynamicType_ptr& type);
+
+    /**
+     * Check whether a sample can be processed with this plan.
+     * @param data Sample to check
+     * @return true if the sample was created from the type the plan was compiled from
+     */
+    bool applies_to(
+            const DynamicData* data) const;
+
+    /**
+     * Serialized size of a sample, without encapsulation.
+     * Types only containing fixed size members return a value computed when compiling.
+     * @param data Sample
+     * @param current_alignment Current position on the CDR stream
+     * @return Size in bytes
+     */
+    size_t serialized_size(
+            const DynamicData* data,
+            size_t current_alignment = 0) const;
+
+    void serialize(
+            const DynamicData* data,
+            fastcdr::Cdr& cdr) const;
+
+    void deserialize(
+            DynamicData* data,
+            fastcdr::Cdr& cdr) const;
+
+private:
+
+    enum class Opcode : uint8_t
+    {
+        //! Primitive, enumeration or string
+        VALUE,
+        //! Structure, its members are the instructions up to end
+        STRUCTURE,
+        //! Array, each element is processed with the instructions up to end
+        ARRAY,
+        //! Sequence, each element is processed with the instructions up to end
+        SEQUENCE,
+        //! Any other kind, processed by DynamicData itself
+        GENERIC
+    };
+
+    struct Instruction
+    {
+        Opcode opcode;
+        TypeKind kind;
+        //! Member of the current sample the instruction applies to, MEMBER_ID_INVALID for the sample itself
+        MemberId id;
+        //! Number of elements of arrays
+        uint32_t count;
+        //! Index of the first instruction after the scope of structures, arrays and sequences
+        uint32_t end;
+        //! Resolved type, or element type for arrays and sequences
+        DynamicType_ptr type;
+        //! Size of the elements of arrays and sequences of primitives processed at once, 0 for the rest
+        uint8_t element_size = 0;
+    };
+
+    DynamicDataSerializationPlan() = default;
+
+    void compile_type(
+            const DynamicType_ptr& type,
+            MemberId id);
+
+    size_t range_size(
+            uint32_t begin,
+            uint32_t end,
+            const DynamicData* data,
+            size_t current_alignment) const;
+
+    void serialize_range(
+            uint32_t begin,
+            uint32_t end,
+            const DynamicData* data,
+            fastcdr::Cdr& cdr) const;
+
+    void deserialize_range(
+            uint32_t begin,
+            uint32_t end,
+            DynamicData* data,
+            fastcdr::Cdr& cdr) const;
+
+    /**
+     * Serialize at once the elements of an array or sequence of primitives.
+     * @param data Array or sequence, holding all its elements
+     * @param element_size Size of the primitives
+     * @param cdr Stream
+     */
+    static void serialize_elements(
+            const DynamicData* data,
+            uint8_t element_size,
+            fastcdr::Cdr& cdr);
+
+    /**
+     * Deserialize at once the elements of an array of primitives.
+     * @param data Array, holding all its elements
+     * @param element_size Size of the primitives
+     * @param cdr Stream
+     */
+    static void deserialize_elements(
+            DynamicData* data,
+            uint8_t element_size,
+            fastcdr::Cdr& cdr);
+
+    /**
+     * Deserialize the length of a sequence of primitives and its elements, which are read in chunks at once.
+     * @param data Sequence, whose missing elements are created
+     * @param element_size Size of the primitives
+     * @param cdr Stream
+     */
+    static void deserialize_sequence_elements(
+            DynamicData* data,
+            uint8_t element_size,
+            fastcdr::Cdr& cdr);
+
+    //! Resolved root type, to which samples must point to use the plan
+    DynamicType_ptr type_;
+    std::vector<Instruction> instructions_;
+    //! Whether the serialized size does not depend on the values
+    bool fixed_size_ = true;
+    size_t serialized_size_ = 0;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_DYNAMIC_TYPES_DYNAMICDATASERIALIZATIONPLAN_HPP_
@@ -24,6 +24,8 @@
 #include <fastrtps/types/DynamicTypeMember.h>
 #include <fastrtps/types/TypeDescriptor.h>
 
+#include <dynamic-types/DynamicDataSerializationPlan.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -31,6 +33,7 @@ namespace types {
 DynamicPubSubType::DynamicPubSubType()
     : dynamic_type_(nullptr)
     , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
 }
 
@@ -38,6 +41,7 @@ DynamicPubSubType::DynamicPubSubType(
         DynamicType_ptr pType)
     : dynamic_type_(pType)
     , m_keyBuffer(nullptr)
+    , m_keyBufferSize(0)
 {
     UpdateDynamicTypeInfo();
 }
@@ -53,6 +57,7 @@ DynamicPubSubType::~DynamicPubSubType()
 void DynamicPubSubType::CleanDynamicType()
 {
     dynamic_type_ = nullptr;
+    plan_.reset();
 }
 
 DynamicType_ptr DynamicPubSubType::GetDynamicType() const
@@ -116,7 +121,7 @@ bool DynamicPubSubType::deserialize(
         deser.read_encapsulation();
         payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
         //Deserialize the object:
-        ((DynamicData*)data)->deserialize(deser);
+        deserialize_sample(data, deser);
     }
     catch (eprosima::fastcdr::exception::Exception& /*exception*/)
     {
@@ -134,36 +139,18 @@ bool DynamicPubSubType::getKey(
     {
         return false;
     }
-    DynamicData* pDynamicData = (DynamicData*)data;
-    size_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_));
-
-    if (m_keyBuffer == nullptr)
-    {
-        m_keyBuffer = (unsigned char*)malloc(keyBufferSize > 16 ? keyBufferSize : 16);
-        memset(m_keyBuffer, 0, keyBufferSize > 16 ? keyBufferSize : 16);
-    }
-
-    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, m_keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS,
             eprosima::fastdds::rtps::DEFAULT_XCDR_VERSION);                                                                            // Object that serializes the data.
-    pDynamicData->serializeKey(ser);
-    if (force_md5 || keyBufferSize > 16)
+    try
     {
-        m_md5.init();
-        m_md5.update(m_keyBuffer, (unsigned int)ser.get_serialized_data_length());
-        m_md5.finalize();
-        for (uint8_t i = 0; i < 16; ++i)
-        {
-            handle->value[i] = m_md5.digest[i];
-        }
+        serialize_key(data, ser);
     }
-    else
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
     {
-        for (uint8_t i = 0; i < 16; ++i)
-        {
-            handle->value[i] = m_keyBuffer[i];
-        }
+        return false;
     }
+    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(), m_keyBufferSize, force_md5, m_md5, handle);
     return true;
 }
 
@@ -172,9 +159,15 @@ std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(
         fastdds::dds::DataRepresentationId_t data_representation)
 {
     static_cast<void>(data_representation);
-    return [data]() -> uint32_t
+    std::shared_ptr<const DynamicDataSerializationPlan> plan = plan_;
+    return [data, plan]() -> uint32_t
            {
-               return (uint32_t)DynamicData::getCdrSerializedSize((DynamicData*)data) + 4 /*encapsulation*/;
+               const DynamicData* dynamic_data = static_cast<const DynamicData*>(data);
+               if (plan && plan->applies_to(dynamic_data))
+               {
+                   return static_cast<uint32_t>(plan->serialized_size(dynamic_data)) + 4 /*encapsulation*/;
+               }
+               return (uint32_t)DynamicData::getCdrSerializedSize(dynamic_data) + 4 /*encapsulation*/;
            };
 }
 
@@ -229,7 +222,8 @@ bool DynamicPubSubType::serialize(
     {
         // Serialize encapsulation
         ser.serialize_encapsulation();
-        ((DynamicData*)data)->serialize(ser); // Serialize the object:
+        // Serialize the object:
+        serialize_sample(data, ser);
     }
     catch (eprosima::fastcdr::exception::Exception& /*exception*/)
     {
@@ -240,6 +234,43 @@ bool DynamicPubSubType::serialize(
     return true;
 }
 
+void DynamicPubSubType::serialize_sample(
+        const void* data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    const DynamicData* dynamic_data = static_cast<const DynamicData*>(data);
+    if (plan_ && plan_->applies_to(dynamic_data))
+    {
+        plan_->serialize(dynamic_data, cdr);
+    }
+    else
+    {
+        dynamic_data->serialize(cdr);
+    }
+}
+
+void DynamicPubSubType::deserialize_sample(
+        void* data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    DynamicData* dynamic_data = static_cast<DynamicData*>(data);
+    if (plan_ && plan_->applies_to(dynamic_data))
+    {
+        plan_->deserialize(dynamic_data, cdr);
+    }
+    else
+    {
+        dynamic_data->deserialize(cdr);
+    }
+}
+
+void DynamicPubSubType::serialize_key(
+        const void* data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    static_cast<const DynamicData*>(data)->serializeKey(cdr);
+}
+
 void DynamicPubSubType::UpdateDynamicTypeInfo()
 {
     if (dynamic_type_ != nullptr)
@@ -254,6 +285,14 @@ void DynamicPubSubType::UpdateDynamicTypeInfo()
         }
 
         m_typeSize = static_cast<uint32_t>(DynamicData::getMaxCdrSerializedSize(dynamic_type_) + 4);
+        if (m_isGetKeyDefined)
+        {
+            m_keyBufferSize = DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_);
+            free(m_keyBuffer);
+            m_keyBuffer = (unsigned char*)malloc(m_keyBufferSize > 16 ? m_keyBufferSize : 16);
+            memset(m_keyBuffer, 0, m_keyBufferSize > 16 ? m_keyBufferSize : 16);
+        }
+        plan_ = DynamicDataSerializationPlan::compile(dynamic_type_);
         setName(dynamic_type_->get_name().c_str());
 
         // Retrieve extensibility.
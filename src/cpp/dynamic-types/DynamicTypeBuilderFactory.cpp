@@ -143,7 +143,7 @@ void DynamicTypeBuilderFactory::add_builder_to_list(
     (void)pBuilder;
 #ifndef DISABLE_DYNAMIC_MEMORY_CHECK
     std::unique_lock<std::recursive_mutex> scoped(mutex_);
-    builders_list_.push_back(pBuilder);
+    builders_list_.insert(pBuilder);
 #endif // ifndef DISABLE_DYNAMIC_MEMORY_CHECK
 }
 
@@ -798,7 +798,7 @@ ReturnCode_t DynamicTypeBuilderFactory::delete_builder(
     {
 #ifndef DISABLE_DYNAMIC_MEMORY_CHECK
         std::unique_lock<std::recursive_mutex> scoped(mutex_);
-        auto it = std::find(builders_list_.begin(), builders_list_.end(), builder);
+        auto it = builders_list_.find(builder);
         if (it != builders_list_.end())
         {
             builders_list_.erase(it);
@@ -0,0 +1,952 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/FlatDynamicData.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicType.h>
+
+#include <dynamic-types/FlatDynamicDataLayout.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+FlatDynamicData::FlatDynamicData(
+        std::shared_ptr<const FlatDynamicDataLayout> layout)
+    : layout_(std::move(layout))
+    , node_(layout_->root())
+    , buffer_(FlatDynamicDataLayout::allocate(layout_->size()))
+    , root_storage_(reinterpret_cast<uint8_t*>(buffer_.get()))
+    , storage_(root_storage_)
+    , loaned_(false)
+{
+    layout_->construct(root_storage_);
+}
+
+FlatDynamicData::FlatDynamicData(
+        const FlatDynamicData* pData)
+    : layout_(pData->layout_)
+    , node_(layout_->root())
+    , buffer_(FlatDynamicDataLayout::allocate(layout_->size()))
+    , root_storage_(reinterpret_cast<uint8_t*>(buffer_.get()))
+    , storage_(root_storage_)
+    , loaned_(false)
+{
+    layout_->construct_copy(root_storage_, pData->root_storage_);
+}
+
+FlatDynamicData::FlatDynamicData(
+        FlatDynamicData* parent,
+        const FlatDynamicDataNode* node,
+        uint8_t* storage)
+    : layout_(parent->layout_)
+    , node_(node)
+    , root_storage_(parent->root_storage_)
+    , storage_(storage)
+    , loaned_(false)
+{
+}
+
+FlatDynamicData::~FlatDynamicData()
+{
+    loans_.clear();
+    // Views over nested values do not own their storage
+    if (buffer_)
+    {
+        layout_->destroy(root_storage_);
+    }
+}
+
+uint8_t* FlatDynamicData::locate(
+        MemberId id,
+        TypeKind kind,
+        const FlatDynamicDataNode** node) const
+{
+    const FlatDynamicDataNode* found = node_;
+    uint8_t* ptr = storage_;
+    if (MEMBER_ID_INVALID != id)
+    {
+        found = node_->find(id, storage_, ptr);
+        if (nullptr == found)
+        {
+            return nullptr;
+        }
+    }
+
+    if (found->kind != kind)
+    {
+        return nullptr;
+    }
+
+    if (nullptr != node)
+    {
+        *node = found;
+    }
+    return ptr;
+}
+
+template<typename T>
+ReturnCode_t FlatDynamicData::get_primitive_value(
+        T& value,
+        MemberId id,
+        TypeKind kind) const
+{
+    const uint8_t* ptr = locate(id, kind);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    memcpy(&value, ptr, sizeof(T));
+    return ReturnCode_t::RETCODE_OK;
+}
+
+template<typename T>
+ReturnCode_t FlatDynamicData::set_primitive_value(
+        const T& value,
+        MemberId id,
+        TypeKind kind)
+{
+    uint8_t* ptr = locate(id, kind);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    memcpy(ptr, &value, sizeof(T));
+    return ReturnCode_t::RETCODE_OK;
+}
+
+DynamicType_ptr FlatDynamicData::get_type() const
+{
+    return node_->type;
+}
+
+TypeKind FlatDynamicData::get_kind() const
+{
+    return node_->kind;
+}
+
+uint32_t FlatDynamicData::get_item_count() const
+{
+    switch (node_->kind)
+    {
+        case TK_STRUCTURE:
+            return static_cast<uint32_t>(node_->members.size());
+        case TK_ARRAY:
+            return node_->count;
+        case TK_SEQUENCE:
+            return node_->length(storage_);
+        default:
+            return 1;
+    }
+}
+
+MemberId FlatDynamicData::get_member_id_by_name(
+        const std::string& name) const
+{
+    for (const FlatDynamicDataNode::Member& member : node_->members)
+    {
+        if (member.name == name)
+        {
+            return member.id;
+        }
+    }
+    return MEMBER_ID_INVALID;
+}
+
+MemberId FlatDynamicData::get_member_id_at_index(
+        uint32_t index) const
+{
+    if (TK_STRUCTURE == node_->kind && index < node_->members.size())
+    {
+        return node_->members[index].id;
+    }
+    else if ((TK_ARRAY == node_->kind && index < node_->count) ||
+            (TK_SEQUENCE == node_->kind && index < node_->length(storage_)))
+    {
+        return index;
+    }
+    return MEMBER_ID_INVALID;
+}
+
+bool FlatDynamicData::equals(
+        const FlatDynamicData* other) const
+{
+    if (nullptr == other)
+    {
+        return false;
+    }
+    if (other == this)
+    {
+        return true;
+    }
+    // Samples sharing the layout also share the nodes, otherwise the types must be compared
+    if (other->node_ != node_ && !node_->type->equals(other->node_->type.get()))
+    {
+        return false;
+    }
+    return FlatDynamicDataLayout::equals(node_, storage_, other->storage_);
+}
+
+ReturnCode_t FlatDynamicData::clear_all_values()
+{
+    layout_->reset(root_storage_, static_cast<uint32_t>(storage_ - root_storage_), node_->size);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::copy_from(
+        const FlatDynamicData* other)
+{
+    if (nullptr == other || other->node_ != node_)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error copying FlatDynamicData. The samples do not share the type.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (other != this)
+    {
+        layout_->assign(storage_, other->storage_, static_cast<uint32_t>(storage_ - root_storage_), node_->size);
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::copy_from(
+        DynamicData* data)
+{
+    if (nullptr == data || data->get_kind() != node_->kind)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error copying DynamicData. The kind of the data doesn't match.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    return copy_node_from(data, node_, storage_);
+}
+
+ReturnCode_t FlatDynamicData::copy_to(
+        DynamicData* data) const
+{
+    if (nullptr == data || data->get_kind() != node_->kind)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error copying to DynamicData. The kind of the data doesn't match.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    return copy_node_to(data, node_, storage_);
+}
+
+FlatDynamicData* FlatDynamicData::loan_value(
+        MemberId id)
+{
+    uint8_t* member = nullptr;
+    const FlatDynamicDataNode* node = node_->find(id, storage_, member);
+    if (nullptr == node)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error loaning Value. MemberId not found.");
+        return nullptr;
+    }
+
+    std::unique_ptr<FlatDynamicData>& view = loans_[id];
+    if (!view)
+    {
+        view.reset(new FlatDynamicData(this, node, member));
+        if (TK_SEQUENCE == node_->kind)
+        {
+            // Elements of sequences are managed by the layout of the elements, which shares the lifetime of layout_
+            view->layout_ = std::shared_ptr<const FlatDynamicDataLayout>(layout_, node_->element_layout);
+        }
+    }
+    else if (view->loaned_)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error loaning Value. The value has been loaned previously.");
+        return nullptr;
+    }
+
+    // Elements of sequences move when the sequence grows, so the storage is refreshed on every loan
+    view->storage_ = member;
+    view->root_storage_ = (TK_SEQUENCE == node_->kind) ? member : root_storage_;
+    view->loaned_ = true;
+    return view.get();
+}
+
+ReturnCode_t FlatDynamicData::return_loaned_value(
+        const FlatDynamicData* value)
+{
+    for (auto& loan : loans_)
+    {
+        if (loan.second.get() == value && loan.second->loaned_)
+        {
+            loan.second->loaned_ = false;
+            return ReturnCode_t::RETCODE_OK;
+        }
+    }
+
+    EPROSIMA_LOG_ERROR(DYN_TYPES, "Error returning loaned Value. The value hasn't been loaned.");
+    return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+}
+
+bool FlatDynamicData::has_loans() const
+{
+    return std::any_of(loans_.begin(), loans_.end(),
+                   [](const std::pair<const MemberId, std::unique_ptr<FlatDynamicData>>& loan)
+                   {
+                       return loan.second->loaned_;
+                   });
+}
+
+ReturnCode_t FlatDynamicData::insert_sequence_data(
+        MemberId& outId)
+{
+    outId = MEMBER_ID_INVALID;
+    if (TK_SEQUENCE != node_->kind)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES,
+                "Error inserting data. The kind " << node_->kind << " doesn't support this method");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (has_loans())
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error inserting data. An element of the sequence is loaned.");
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    uint32_t length = node_->length(storage_);
+    if (BOUND_UNLIMITED != node_->bound && length >= node_->bound)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error inserting data. The container is full.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    FlatDynamicDataLayout::resize(node_, storage_, length + 1);
+    outId = length;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::remove_sequence_data(
+        MemberId id)
+{
+    if (TK_SEQUENCE != node_->kind)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error removing data. The current Kind " << node_->kind
+                                                                               << " doesn't support this method");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (has_loans())
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error removing data. An element of the sequence is loaned.");
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+    if (id >= node_->length(storage_))
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error removing data. Member not found");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    FlatDynamicDataLayout::erase(node_, storage_, id);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::clear_data()
+{
+    if (TK_SEQUENCE != node_->kind)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error clearing data. The current Kind " << node_->kind
+                                                                               << " doesn't support this method");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (has_loans())
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error clearing data. An element of the sequence is loaned.");
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+    FlatDynamicDataLayout::resize(node_, storage_, 0);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::get_int32_value(
+        int32_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_INT32);
+}
+
+ReturnCode_t FlatDynamicData::set_int32_value(
+        int32_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_INT32);
+}
+
+ReturnCode_t FlatDynamicData::get_uint32_value(
+        uint32_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_UINT32);
+}
+
+ReturnCode_t FlatDynamicData::set_uint32_value(
+        uint32_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_UINT32);
+}
+
+ReturnCode_t FlatDynamicData::get_int16_value(
+        int16_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_INT16);
+}
+
+ReturnCode_t FlatDynamicData::set_int16_value(
+        int16_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_INT16);
+}
+
+ReturnCode_t FlatDynamicData::get_uint16_value(
+        uint16_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_UINT16);
+}
+
+ReturnCode_t FlatDynamicData::set_uint16_value(
+        uint16_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_UINT16);
+}
+
+ReturnCode_t FlatDynamicData::get_int64_value(
+        int64_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_INT64);
+}
+
+ReturnCode_t FlatDynamicData::set_int64_value(
+        int64_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_INT64);
+}
+
+ReturnCode_t FlatDynamicData::get_uint64_value(
+        uint64_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_UINT64);
+}
+
+ReturnCode_t FlatDynamicData::set_uint64_value(
+        uint64_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_UINT64);
+}
+
+ReturnCode_t FlatDynamicData::get_float32_value(
+        float& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_FLOAT32);
+}
+
+ReturnCode_t FlatDynamicData::set_float32_value(
+        float value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_FLOAT32);
+}
+
+ReturnCode_t FlatDynamicData::get_float64_value(
+        double& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_FLOAT64);
+}
+
+ReturnCode_t FlatDynamicData::set_float64_value(
+        double value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_FLOAT64);
+}
+
+ReturnCode_t FlatDynamicData::get_float128_value(
+        long double& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_FLOAT128);
+}
+
+ReturnCode_t FlatDynamicData::set_float128_value(
+        long double value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_FLOAT128);
+}
+
+ReturnCode_t FlatDynamicData::get_char8_value(
+        char& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_CHAR8);
+}
+
+ReturnCode_t FlatDynamicData::set_char8_value(
+        char value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_CHAR8);
+}
+
+ReturnCode_t FlatDynamicData::get_char16_value(
+        wchar_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_CHAR16);
+}
+
+ReturnCode_t FlatDynamicData::set_char16_value(
+        wchar_t value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_CHAR16);
+}
+
+ReturnCode_t FlatDynamicData::get_byte_value(
+        octet& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_BYTE);
+}
+
+ReturnCode_t FlatDynamicData::set_byte_value(
+        octet value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_BYTE);
+}
+
+ReturnCode_t FlatDynamicData::get_bool_value(
+        bool& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_BOOLEAN);
+}
+
+ReturnCode_t FlatDynamicData::set_bool_value(
+        bool value,
+        MemberId id)
+{
+    return set_primitive_value(value, id, TK_BOOLEAN);
+}
+
+ReturnCode_t FlatDynamicData::get_string_value(
+        std::string& value,
+        MemberId id) const
+{
+    const uint8_t* ptr = locate(id, TK_STRING8);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    value = *reinterpret_cast<const std::string*>(ptr);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::set_string_value(
+        const std::string& value,
+        MemberId id)
+{
+    const FlatDynamicDataNode* node = nullptr;
+    uint8_t* ptr = locate(id, TK_STRING8, &node);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (value.length() > node->bound)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error setting string value. The given string is greater than the length limit.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    *reinterpret_cast<std::string*>(ptr) = value;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::get_wstring_value(
+        std::wstring& value,
+        MemberId id) const
+{
+    const uint8_t* ptr = locate(id, TK_STRING16);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    value = *reinterpret_cast<const std::wstring*>(ptr);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::set_wstring_value(
+        const std::wstring& value,
+        MemberId id)
+{
+    const FlatDynamicDataNode* node = nullptr;
+    uint8_t* ptr = locate(id, TK_STRING16, &node);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (value.length() > node->bound)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error setting wstring value. The given string is greater than the length limit.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    *reinterpret_cast<std::wstring*>(ptr) = value;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::get_enum_value(
+        std::string& value,
+        MemberId id) const
+{
+    const FlatDynamicDataNode* node = nullptr;
+    const uint8_t* ptr = locate(id, TK_ENUM, &node);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    auto it = node->literals.find(*reinterpret_cast<const uint32_t*>(ptr));
+    if (it == node->literals.end())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    value = it->second;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::set_enum_value(
+        const std::string& value,
+        MemberId id)
+{
+    const FlatDynamicDataNode* node = nullptr;
+    uint8_t* ptr = locate(id, TK_ENUM, &node);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    for (const auto& literal : node->literals)
+    {
+        if (literal.second == value)
+        {
+            *reinterpret_cast<uint32_t*>(ptr) = literal.first;
+            return ReturnCode_t::RETCODE_OK;
+        }
+    }
+    EPROSIMA_LOG_ERROR(DYN_TYPES, "Error setting enum value. The given string " << value << " isn't a valid literal.");
+    return ReturnCode_t::RETCODE_BAD_PARAMETER;
+}
+
+ReturnCode_t FlatDynamicData::get_enum_value(
+        uint32_t& value,
+        MemberId id) const
+{
+    return get_primitive_value(value, id, TK_ENUM);
+}
+
+ReturnCode_t FlatDynamicData::set_enum_value(
+        const uint32_t& value,
+        MemberId id)
+{
+    const FlatDynamicDataNode* node = nullptr;
+    uint8_t* ptr = locate(id, TK_ENUM, &node);
+    if (nullptr == ptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (node->literals.find(value) == node->literals.end())
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error setting enum value. The given value " << value << " isn't valid.");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    *reinterpret_cast<uint32_t*>(ptr) = value;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::get_bitmask_value(
+        uint64_t& value) const
+{
+    return get_primitive_value(value, MEMBER_ID_INVALID, TK_BITMASK);
+}
+
+ReturnCode_t FlatDynamicData::set_bitmask_value(
+        uint64_t value)
+{
+    return set_primitive_value(value, MEMBER_ID_INVALID, TK_BITMASK);
+}
+
+bool FlatDynamicData::deserialize(
+        eprosima::fastcdr::Cdr& cdr)
+{
+    FlatDynamicDataLayout::deserialize(node_, storage_, cdr);
+    return true;
+}
+
+size_t FlatDynamicData::getCdrSerializedSize(
+        const FlatDynamicData* data,
+        size_t current_alignment)
+{
+    return FlatDynamicDataLayout::serialized_size(data->node_, data->storage_, current_alignment);
+}
+
+void FlatDynamicData::serialize(
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    FlatDynamicDataLayout::serialize(node_, storage_, cdr);
+}
+
+void FlatDynamicData::serializeKey(
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    FlatDynamicDataLayout::serialize_key(node_, storage_, cdr);
+}
+
+ReturnCode_t FlatDynamicData::copy_node_from(
+        DynamicData* data,
+        const FlatDynamicDataNode* node,
+        uint8_t* storage)
+{
+    ReturnCode_t ret = ReturnCode_t::RETCODE_OK;
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+            for (const FlatDynamicDataNode::Member& member : node->members)
+            {
+                ret = copy_value_from(data, member.id, member.node, storage + member.offset);
+                if (ReturnCode_t::RETCODE_OK != ret)
+                {
+                    break;
+                }
+            }
+            break;
+        case TK_ARRAY:
+            for (uint32_t i = 0; i < node->count && ReturnCode_t::RETCODE_OK == ret; ++i)
+            {
+                ret = copy_value_from(data, i, node->element, storage + i * node->element->size);
+            }
+            break;
+        case TK_SEQUENCE:
+        {
+            uint32_t length = data->get_item_count();
+            if (BOUND_UNLIMITED != node->bound && length > node->bound)
+            {
+                EPROSIMA_LOG_ERROR(DYN_TYPES, "Error copying DynamicData. The sequence exceeds its bound.");
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            FlatDynamicDataLayout::resize(node, storage, length);
+            for (uint32_t i = 0; i < length && ReturnCode_t::RETCODE_OK == ret; ++i)
+            {
+                ret = copy_value_from(data, i, node->element, node->element_at(storage, i));
+            }
+            break;
+        }
+        case TK_BITMASK:
+            ret = data->get_bitmask_value(*reinterpret_cast<uint64_t*>(storage));
+            break;
+        default:
+            ret = copy_value_from(data, MEMBER_ID_INVALID, node, storage);
+            break;
+    }
+    return ret;
+}
+
+ReturnCode_t FlatDynamicData::copy_value_from(
+        DynamicData* data,
+        MemberId id,
+        const FlatDynamicDataNode* node,
+        uint8_t* storage)
+{
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        case TK_BITMASK:
+        {
+            if (MEMBER_ID_INVALID == id)
+            {
+                return copy_node_from(data, node, storage);
+            }
+            DynamicData* child = data->loan_value(id);
+            if (nullptr == child)
+            {
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            ReturnCode_t ret = copy_node_from(child, node, storage);
+            data->return_loaned_value(child);
+            return ret;
+        }
+        case TK_INT16:
+            return data->get_int16_value(*reinterpret_cast<int16_t*>(storage), id);
+        case TK_UINT16:
+            return data->get_uint16_value(*reinterpret_cast<uint16_t*>(storage), id);
+        case TK_INT32:
+            return data->get_int32_value(*reinterpret_cast<int32_t*>(storage), id);
+        case TK_UINT32:
+            return data->get_uint32_value(*reinterpret_cast<uint32_t*>(storage), id);
+        case TK_INT64:
+            return data->get_int64_value(*reinterpret_cast<int64_t*>(storage), id);
+        case TK_UINT64:
+            return data->get_uint64_value(*reinterpret_cast<uint64_t*>(storage), id);
+        case TK_FLOAT32:
+            return data->get_float32_value(*reinterpret_cast<float*>(storage), id);
+        case TK_FLOAT64:
+            return data->get_float64_value(*reinterpret_cast<double*>(storage), id);
+        case TK_FLOAT128:
+            return data->get_float128_value(*reinterpret_cast<long double*>(storage), id);
+        case TK_CHAR8:
+            return data->get_char8_value(*reinterpret_cast<char*>(storage), id);
+        case TK_CHAR16:
+            return data->get_char16_value(*reinterpret_cast<wchar_t*>(storage), id);
+        case TK_BYTE:
+            return data->get_byte_value(*reinterpret_cast<octet*>(storage), id);
+        case TK_BOOLEAN:
+            return data->get_bool_value(*reinterpret_cast<bool*>(storage), id);
+        case TK_ENUM:
+            return data->get_enum_value(*reinterpret_cast<uint32_t*>(storage), id);
+        case TK_STRING8:
+            return data->get_string_value(*reinterpret_cast<std::string*>(storage), id);
+        case TK_STRING16:
+            return data->get_wstring_value(*reinterpret_cast<std::wstring*>(storage), id);
+        default:
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+}
+
+ReturnCode_t FlatDynamicData::copy_node_to(
+        DynamicData* data,
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage)
+{
+    ReturnCode_t ret = ReturnCode_t::RETCODE_OK;
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+            for (const FlatDynamicDataNode::Member& member : node->members)
+            {
+                ret = copy_value_to(data, member.id, member.node, storage + member.offset);
+                if (ReturnCode_t::RETCODE_OK != ret)
+                {
+                    break;
+                }
+            }
+            break;
+        case TK_ARRAY:
+            for (uint32_t i = 0; i < node->count && ReturnCode_t::RETCODE_OK == ret; ++i)
+            {
+                ret = copy_value_to(data, i, node->element, storage + i * node->element->size);
+            }
+            break;
+        case TK_SEQUENCE:
+        {
+            ret = data->clear_data();
+            uint32_t length = node->length(storage);
+            for (uint32_t i = 0; i < length && ReturnCode_t::RETCODE_OK == ret; ++i)
+            {
+                MemberId id = MEMBER_ID_INVALID;
+                ret = data->insert_sequence_data(id);
+                if (ReturnCode_t::RETCODE_OK == ret)
+                {
+                    ret = copy_value_to(data, id, node->element, node->element_at(storage, i));
+                }
+            }
+            break;
+        }
+        case TK_BITMASK:
+            ret = data->set_bitmask_value(*reinterpret_cast<const uint64_t*>(storage));
+            break;
+        default:
+            ret = copy_value_to(data, MEMBER_ID_INVALID, node, storage);
+            break;
+    }
+    return ret;
+}
+
+ReturnCode_t FlatDynamicData::copy_value_to(
+        DynamicData* data,
+        MemberId id,
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage)
+{
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        case TK_BITMASK:
+        {
+            if (MEMBER_ID_INVALID == id)
+            {
+                return copy_node_to(data, node, storage);
+            }
+            DynamicData* child = data->loan_value(id);
+            if (nullptr == child)
+            {
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            ReturnCode_t ret = copy_node_to(child, node, storage);
+            data->return_loaned_value(child);
+            return ret;
+        }
+        case TK_INT16:
+            return data->set_int16_value(*reinterpret_cast<const int16_t*>(storage), id);
+        case TK_UINT16:
+            return data->set_uint16_value(*reinterpret_cast<const uint16_t*>(storage), id);
+        case TK_INT32:
+            return data->set_int32_value(*reinterpret_cast<const int32_t*>(storage), id);
+        case TK_UINT32:
+            return data->set_uint32_value(*reinterpret_cast<const uint32_t*>(storage), id);
+        case TK_INT64:
+            return data->set_int64_value(*reinterpret_cast<const int64_t*>(storage), id);
+        case TK_UINT64:
+            return data->set_uint64_value(*reinterpret_cast<const uint64_t*>(storage), id);
+        case TK_FLOAT32:
+            return data->set_float32_value(*reinterpret_cast<const float*>(storage), id);
+        case TK_FLOAT64:
+            return data->set_float64_value(*reinterpret_cast<const double*>(storage), id);
+        case TK_FLOAT128:
+            return data->set_float128_value(*reinterpret_cast<const long double*>(storage), id);
+        case TK_CHAR8:
+            return data->set_char8_value(*reinterpret_cast<const char*>(storage), id);
+        case TK_CHAR16:
+            return data->set_char16_value(*reinterpret_cast<const wchar_t*>(storage), id);
+        case TK_BYTE:
+            return data->set_byte_value(*reinterpret_cast<const octet*>(storage), id);
+        case TK_BOOLEAN:
+            return data->set_bool_value(*reinterpret_cast<const bool*>(storage), id);
+        case TK_ENUM:
+            return data->set_enum_value(*reinterpret_cast<const uint32_t*>(storage), id);
+        case TK_STRING8:
+            return data->set_string_value(*reinterpret_cast<const std::string*>(storage), id);
+        case TK_STRING16:
+            return data->set_wstring_value(*reinterpret_cast<const std::wstring*>(storage), id);
+        default:
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,1385 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlatDynamicDataLayout.cpp
+ */
+
+#include <dynamic-types/FlatDynamicDataLayout.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+using eprosima::fastcdr::Cdr;
+using eprosima::fastcdr::exception::BadParamException;
+
+namespace {
+
+constexpr uint32_t member_not_found = std::numeric_limits<uint32_t>::max();
+
+//! Maximum size of the elements of a bounded sequence for them to be stored inline
+constexpr uint64_t max_inline_sequence_size = 64 * 1024;
+
+bool primitive_storage(
+        TypeKind kind,
+        uint32_t& size,
+        uint32_t& alignment)
+{
+    switch (kind)
+    {
+        case TK_INT16:
+        case TK_UINT16:
+            size = alignment = 2;
+            return true;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+            size = alignment = 4;
+            return true;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+        case TK_BITMASK:
+            size = alignment = 8;
+            return true;
+        case TK_FLOAT128:
+            size = sizeof(long double);
+            alignment = alignof(long double);
+            return true;
+        case TK_CHAR8:
+        case TK_BYTE:
+            size = alignment = 1;
+            return true;
+        case TK_CHAR16:
+            size = sizeof(wchar_t);
+            alignment = alignof(wchar_t);
+            return true;
+        case TK_BOOLEAN:
+            size = sizeof(bool);
+            alignment = alignof(bool);
+            return true;
+        case TK_STRING8:
+            size = sizeof(std::string);
+            alignment = alignof(std::string);
+            return true;
+        case TK_STRING16:
+            size = sizeof(std::wstring);
+            alignment = alignof(std::wstring);
+            return true;
+        default:
+            return false;
+    }
+}
+
+inline uint32_t align(
+        uint32_t offset,
+        uint32_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+template<typename T>
+inline bool equal_values(
+        const uint8_t* left,
+        const uint8_t* right)
+{
+    return *reinterpret_cast<const T*>(left) == *reinterpret_cast<const T*>(right);
+}
+
+//! Size of the primitives whose arrays and sequences are (de)serialized at once, 0 for the rest
+uint32_t bulk_element_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_CHAR8:
+        case TK_BYTE:
+            return 1;
+        case TK_INT16:
+        case TK_UINT16:
+            return 2;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+            return 4;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8;
+        default:
+            // Booleans are validated when deserialized, wide chars and long doubles are not stored with their CDR size
+            return 0;
+    }
+}
+
+//! Size on the wire of a bitmask, 0 when DynamicData does not serialize it
+uint32_t bitmask_size(
+        const FlatDynamicDataNode* node)
+{
+    switch (node->type->get_size())
+    {
+        case 1:
+            return 1;
+        case 2:
+            return 2;
+        case 3:
+            return 4;
+        case 4:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+size_t elements_serialized_size(
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage,
+        uint32_t count,
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+    uint32_t element_size = bulk_element_size(node->element->kind);
+    if (0 != element_size)
+    {
+        if (0 < count)
+        {
+            current_alignment += Cdr::alignment(current_alignment, element_size) +
+                    static_cast<size_t>(count) * element_size;
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            current_alignment += FlatDynamicDataLayout::serialized_size(node->element, node->element_at(storage, i),
+                            current_alignment);
+        }
+    }
+
+    return current_alignment - initial_alignment;
+}
+
+void serialize_elements(
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage,
+        uint32_t count,
+        Cdr& cdr)
+{
+    if (0 == count)
+    {
+        return;
+    }
+
+    // Elements are contiguous, so primitives are written at once
+    const uint8_t* elements = node->element_at(storage, 0);
+    switch (node->element->kind)
+    {
+        case TK_CHAR8:
+            cdr.serialize_array(reinterpret_cast<const char*>(elements), count);
+            break;
+        case TK_BYTE:
+            cdr.serialize_array(elements, count);
+            break;
+        case TK_INT16:
+            cdr.serialize_array(reinterpret_cast<const int16_t*>(elements), count);
+            break;
+        case TK_UINT16:
+            cdr.serialize_array(reinterpret_cast<const uint16_t*>(elements), count);
+            break;
+        case TK_INT32:
+            cdr.serialize_array(reinterpret_cast<const int32_t*>(elements), count);
+            break;
+        case TK_UINT32:
+        case TK_ENUM:
+            cdr.serialize_array(reinterpret_cast<const uint32_t*>(elements), count);
+            break;
+        case TK_INT64:
+            cdr.serialize_array(reinterpret_cast<const int64_t*>(elements), count);
+            break;
+        case TK_UINT64:
+            cdr.serialize_array(reinterpret_cast<const uint64_t*>(elements), count);
+            break;
+        case TK_FLOAT32:
+            cdr.serialize_array(reinterpret_cast<const float*>(elements), count);
+            break;
+        case TK_FLOAT64:
+            cdr.serialize_array(reinterpret_cast<const double*>(elements), count);
+            break;
+        default:
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                FlatDynamicDataLayout::serialize(node->element, node->element_at(storage, i), cdr);
+            }
+            break;
+    }
+}
+
+void deserialize_elements(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage,
+        uint32_t count,
+        Cdr& cdr)
+{
+    if (0 == count)
+    {
+        return;
+    }
+
+    uint8_t* elements = node->element_at(storage, 0);
+    switch (node->element->kind)
+    {
+        case TK_CHAR8:
+            cdr.deserialize_array(reinterpret_cast<char*>(elements), count);
+            break;
+        case TK_BYTE:
+            cdr.deserialize_array(elements, count);
+            break;
+        case TK_INT16:
+            cdr.deserialize_array(reinterpret_cast<int16_t*>(elements), count);
+            break;
+        case TK_UINT16:
+            cdr.deserialize_array(reinterpret_cast<uint16_t*>(elements), count);
+            break;
+        case TK_INT32:
+            cdr.deserialize_array(reinterpret_cast<int32_t*>(elements), count);
+            break;
+        case TK_UINT32:
+        case TK_ENUM:
+            cdr.deserialize_array(reinterpret_cast<uint32_t*>(elements), count);
+            break;
+        case TK_INT64:
+            cdr.deserialize_array(reinterpret_cast<int64_t*>(elements), count);
+            break;
+        case TK_UINT64:
+            cdr.deserialize_array(reinterpret_cast<uint64_t*>(elements), count);
+            break;
+        case TK_FLOAT32:
+            cdr.deserialize_array(reinterpret_cast<float*>(elements), count);
+            break;
+        case TK_FLOAT64:
+            cdr.deserialize_array(reinterpret_cast<double*>(elements), count);
+            break;
+        default:
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                FlatDynamicDataLayout::deserialize(node->element, node->element_at(storage, i), cdr);
+            }
+            break;
+    }
+}
+
+} // namespace
+
+const FlatDynamicDataNode* FlatDynamicDataNode::find(
+        MemberId id,
+        uint8_t* storage,
+        uint8_t*& member) const
+{
+    if (TK_STRUCTURE == kind)
+    {
+        size_t pos = find_member(id);
+        if (pos < members.size())
+        {
+            member = storage + members[pos].offset;
+            return members[pos].node;
+        }
+    }
+    else if ((TK_ARRAY == kind && id < count) || (TK_SEQUENCE == kind && id < length(storage)))
+    {
+        member = element_at(storage, id);
+        return element;
+    }
+    return nullptr;
+}
+
+uint8_t* FlatDynamicDataNode::element_at(
+        uint8_t* storage,
+        uint32_t index) const
+{
+    if (TK_SEQUENCE == kind)
+    {
+        storage = (0 != elements_offset) ? storage + elements_offset :
+                reinterpret_cast<uint8_t*>(reinterpret_cast<FlatDynamicDataSequence*>(storage)->elements);
+    }
+    return storage + index * element->size;
+}
+
+size_t FlatDynamicDataNode::find_member(
+        MemberId id) const
+{
+    if (!member_by_id.empty())
+    {
+        if (id < member_by_id.size() && member_not_found != member_by_id[id])
+        {
+            return member_by_id[id];
+        }
+        return members.size();
+    }
+
+    for (size_t pos = 0; pos < members.size(); ++pos)
+    {
+        if (members[pos].id == id)
+        {
+            return pos;
+        }
+    }
+    return members.size();
+}
+
+std::shared_ptr<const FlatDynamicDataLayout> FlatDynamicDataLayout::get(
+        const DynamicType_ptr& type)
+{
+    if (!type)
+    {
+        return nullptr;
+    }
+
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    std::lock_guard<std::mutex> guard(factory->flat_layouts_mutex_);
+    std::map<const DynamicType*, std::shared_ptr<const FlatDynamicDataLayout>>& layouts = factory->flat_layouts_;
+
+    auto it = layouts.find(type.get());
+    if (it != layouts.end())
+    {
+        return (nullptr != it->second->root_) ? it->second : nullptr;
+    }
+
+    // Release the layouts of the types no longer used before adding a new one
+    for (it = layouts.begin(); it != layouts.end();)
+    {
+        bool unused = (1 == it->second.use_count()) && it->second->is_unused();
+        it = unused ? layouts.erase(it) : std::next(it);
+    }
+
+    std::shared_ptr<FlatDynamicDataLayout> layout(new FlatDynamicDataLayout());
+    layout->type_ = type;
+    layout->root_ = layout->build(type);
+    if (nullptr == layout->root_)
+    {
+        EPROSIMA_LOG_INFO(DYN_TYPES, "Type " << type->get_name() << " cannot be stored on a flat layout");
+        layout->element_layouts_.clear();
+        layout->nodes_.clear();
+    }
+    else
+    {
+        layout->image_.assign(layout->root_->size, 0u);
+        layout->add_values(layout->root_, 0);
+    }
+
+    // The type is kept on the layout so its address is not reused while cached
+    layout->type_references_ = 1 + std::count_if(layout->nodes_.begin(), layout->nodes_.end(),
+                    [&type](const std::unique_ptr<FlatDynamicDataNode>& node)
+                    {
+                        return node->type.get() == type.get();
+                    });
+
+    // Unsupported types are also cached, to avoid computing them again
+    layouts.emplace(type.get(), layout);
+    return (nullptr != layout->root_) ? layout : nullptr;
+}
+
+bool FlatDynamicDataLayout::is_unused() const
+{
+    // Only the cache can get new references to a type nobody else holds
+    return type_.use_count() == type_references_;
+}
+
+const FlatDynamicDataNode* FlatDynamicDataLayout::build(
+        const DynamicType_ptr& type)
+{
+    DynamicType_ptr resolved = type;
+    while (resolved && TK_ALIAS == resolved->get_kind())
+    {
+        resolved = resolved->get_descriptor()->get_base_type();
+    }
+    if (!resolved)
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<FlatDynamicDataNode> node(new FlatDynamicDataNode());
+    node->kind = resolved->get_kind();
+    node->type = resolved;
+    node->key = type->key_annotation();
+
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+        {
+            std::map<MemberId, DynamicTypeMember*> members;
+            if (ReturnCode_t::RETCODE_OK != resolved->get_all_members(members))
+            {
+                return nullptr;
+            }
+
+            std::vector<const MemberDescriptor*> descriptors;
+            for (auto& member : members)
+            {
+                descriptors.push_back(member.second->get_descriptor());
+            }
+            std::sort(descriptors.begin(), descriptors.end(),
+                    [](const MemberDescriptor* a, const MemberDescriptor* b)
+                    {
+                        return a->get_index() < b->get_index();
+                    });
+
+            uint32_t offset = 0;
+            MemberId max_id = 0;
+            for (const MemberDescriptor* descriptor : descriptors)
+            {
+                const FlatDynamicDataNode* child = build(descriptor->get_type());
+                if (nullptr == child)
+                {
+                    return nullptr;
+                }
+
+                // DynamicData only serializes the members whose id is below the number of members
+                bool serialized = descriptor->get_id() < descriptors.size() &&
+                        !descriptor->annotation_is_non_serialized() &&
+                        !descriptor->get_type()->get_descriptor()->annotation_is_non_serialized();
+
+                offset = align(offset, child->alignment);
+                node->members.push_back({descriptor->get_id(), descriptor->get_name(), offset, child,
+                                         descriptor->annotation_get_default(), serialized});
+                offset += child->size;
+                node->alignment = std::max(node->alignment, child->alignment);
+                max_id = std::max(max_id, descriptor->get_id());
+            }
+            node->size = align(offset, node->alignment);
+
+            node->wire_order.resize(node->members.size());
+            for (uint32_t pos = 0; pos < node->members.size(); ++pos)
+            {
+                node->wire_order[pos] = pos;
+            }
+            std::sort(node->wire_order.begin(), node->wire_order.end(),
+                    [&node](uint32_t a, uint32_t b)
+                    {
+                        return node->members[a].id < node->members[b].id;
+                    });
+
+            // Direct indexing unless member ids are too sparse
+            if (!node->members.empty() && max_id < 2 * node->members.size() + 16)
+            {
+                node->member_by_id.assign(max_id + 1, member_not_found);
+                for (uint32_t pos = 0; pos < node->members.size(); ++pos)
+                {
+                    node->member_by_id[node->members[pos].id] = pos;
+                }
+            }
+            break;
+        }
+        case TK_ARRAY:
+        {
+            node->element = build(resolved->get_descriptor()->get_element_type());
+            if (nullptr == node->element)
+            {
+                return nullptr;
+            }
+            node->count = resolved->get_total_bounds();
+            node->size = node->element->size * node->count;
+            node->alignment = node->element->alignment;
+            break;
+        }
+        case TK_SEQUENCE:
+        {
+            node->element = build(resolved->get_descriptor()->get_element_type());
+            if (nullptr == node->element)
+            {
+                return nullptr;
+            }
+            node->bound = resolved->get_bounds();
+            node->element_layout = add_element_layout(node->element);
+
+            uint64_t elements_size = static_cast<uint64_t>(node->bound) * node->element->size;
+            if (BOUND_UNLIMITED == node->bound || max_inline_sequence_size < elements_size)
+            {
+                node->size = sizeof(FlatDynamicDataSequence);
+                node->alignment = alignof(FlatDynamicDataSequence);
+            }
+            else
+            {
+                node->alignment = std::max<uint32_t>(alignof(uint32_t), node->element->alignment);
+                node->elements_offset = align(sizeof(uint32_t), node->element->alignment);
+                node->size = align(node->elements_offset + static_cast<uint32_t>(elements_size), node->alignment);
+            }
+            break;
+        }
+        case TK_ENUM:
+        {
+            std::map<MemberId, DynamicTypeMember*> literals;
+            resolved->get_all_members(literals);
+            for (auto& literal : literals)
+            {
+                node->literals.emplace(literal.first, literal.second->get_name());
+            }
+            primitive_storage(node->kind, node->size, node->alignment);
+            break;
+        }
+        default:
+        {
+            // Maps, unions and bitsets have a variable or tagged layout
+            if (!primitive_storage(node->kind, node->size, node->alignment))
+            {
+                return nullptr;
+            }
+            node->bound = resolved->get_bounds();
+            break;
+        }
+    }
+
+    nodes_.push_back(std::move(node));
+    return nodes_.back().get();
+}
+
+const FlatDynamicDataLayout* FlatDynamicDataLayout::add_element_layout(
+        const FlatDynamicDataNode* element)
+{
+    std::unique_ptr<FlatDynamicDataLayout> layout(new FlatDynamicDataLayout());
+    layout->type_ = element->type;
+    layout->root_ = element;
+    layout->image_.assign(element->size, 0u);
+    layout->add_values(element, 0);
+    element_layouts_.push_back(std::move(layout));
+    return element_layouts_.back().get();
+}
+
+void FlatDynamicDataLayout::add_values(
+        const FlatDynamicDataNode* node,
+        uint32_t offset)
+{
+    switch (node->kind)
+    {
+        case TK_STRING8:
+        case TK_STRING16:
+            slots_.emplace_back(offset, node);
+            break;
+        case TK_STRUCTURE:
+            for (const FlatDynamicDataNode::Member& member : node->members)
+            {
+                add_values(member.node, offset + member.offset);
+                if (!member.default_value.empty())
+                {
+                    add_default(member.node, offset + member.offset, member.default_value);
+                }
+            }
+            break;
+        case TK_ARRAY:
+            for (uint32_t i = 0; i < node->count; ++i)
+            {
+                add_values(node->element, offset + i * node->element->size);
+            }
+            break;
+        case TK_SEQUENCE:
+            if (0 == node->elements_offset)
+            {
+                slots_.emplace_back(offset, node);
+            }
+            else
+            {
+                for (uint32_t i = 0; i < node->bound; ++i)
+                {
+                    add_values(node->element, offset + node->elements_offset + i * node->element->size);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void FlatDynamicDataLayout::add_default(
+        const FlatDynamicDataNode* node,
+        uint32_t offset,
+        const std::string& value)
+{
+    uint8_t* ptr = image_.data() + offset;
+
+    try
+    {
+        switch (node->kind)
+        {
+            case TK_INT16:
+                *reinterpret_cast<int16_t*>(ptr) = static_cast<int16_t>(std::stoi(value));
+                break;
+            case TK_UINT16:
+                *reinterpret_cast<uint16_t*>(ptr) = static_cast<uint16_t>(std::stoul(value));
+                break;
+            case TK_INT32:
+                *reinterpret_cast<int32_t*>(ptr) = std::stoi(value);
+                break;
+            case TK_UINT32:
+            case TK_ENUM:
+                *reinterpret_cast<uint32_t*>(ptr) = static_cast<uint32_t>(std::stoul(value));
+                break;
+            case TK_INT64:
+                *reinterpret_cast<int64_t*>(ptr) = std::stoll(value);
+                break;
+            case TK_UINT64:
+            case TK_BITMASK:
+                *reinterpret_cast<uint64_t*>(ptr) = std::stoull(value);
+                break;
+            case TK_FLOAT32:
+                *reinterpret_cast<float*>(ptr) = std::stof(value);
+                break;
+            case TK_FLOAT64:
+                *reinterpret_cast<double*>(ptr) = std::stod(value);
+                break;
+            case TK_FLOAT128:
+                *reinterpret_cast<long double*>(ptr) = std::stold(value);
+                break;
+            case TK_CHAR8:
+                *reinterpret_cast<char*>(ptr) = value[0];
+                break;
+            case TK_CHAR16:
+                *reinterpret_cast<wchar_t*>(ptr) = static_cast<wchar_t>(value[0]);
+                break;
+            case TK_BOOLEAN:
+                // Any other value, as false or 0, gives false
+                *reinterpret_cast<bool*>(ptr) = ("true" == value || "1" == value);
+                break;
+            case TK_BYTE:
+                *ptr = static_cast<uint8_t>(std::stoul(value));
+                break;
+            case TK_STRING8:
+                string_defaults_.emplace_back(offset, value);
+                break;
+            case TK_STRING16:
+                wstring_defaults_.emplace_back(offset, std::wstring(value.begin(), value.end()));
+                break;
+            default:
+                break;
+        }
+    }
+    catch (const std::exception&)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Invalid default value " << value << " on type " << type_->get_name());
+    }
+}
+
+void FlatDynamicDataLayout::construct(
+        uint8_t* storage) const
+{
+    memcpy(storage, image_.data(), image_.size());
+    construct_slots(storage, 0, size());
+}
+
+void FlatDynamicDataLayout::construct_copy(
+        uint8_t* storage,
+        const uint8_t* other) const
+{
+    memcpy(storage, other, size());
+    for (const Slot& slot : slots_)
+    {
+        copy_slot(slot.second, storage + slot.first, other + slot.first);
+    }
+}
+
+void FlatDynamicDataLayout::assign(
+        uint8_t* storage,
+        const uint8_t* other,
+        uint32_t offset,
+        uint32_t size) const
+{
+    uint32_t copied = 0;
+    for (auto it = first_slot(offset); it != slots_.end() && it->first < offset + size; ++it)
+    {
+        uint32_t pos = it->first - offset;
+        memcpy(storage + copied, other + copied, pos - copied);
+        assign_slot(it->second, storage + pos, other + pos);
+        copied = pos + it->second->size;
+    }
+    memcpy(storage + copied, other + copied, size - copied);
+}
+
+void FlatDynamicDataLayout::destroy(
+        uint8_t* storage) const
+{
+    destroy_slots(storage, 0, size());
+}
+
+void FlatDynamicDataLayout::reset(
+        uint8_t* storage,
+        uint32_t offset,
+        uint32_t size) const
+{
+    destroy_slots(storage, offset, offset + size);
+    memcpy(storage + offset, image_.data() + offset, size);
+    construct_slots(storage, offset, offset + size);
+}
+
+void FlatDynamicDataLayout::resize(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage,
+        uint32_t length)
+{
+    const FlatDynamicDataLayout* elements = node->element_layout;
+    uint32_t element_size = node->element->size;
+
+    if (0 != node->elements_offset)
+    {
+        // Removed elements get back their default values, as the ones never used
+        uint32_t& current = *reinterpret_cast<uint32_t*>(storage);
+        for (uint32_t i = length; i < current; ++i)
+        {
+            elements->reset(node->element_at(storage, i), 0, element_size);
+        }
+        current = length;
+        return;
+    }
+
+    FlatDynamicDataSequence& sequence = *reinterpret_cast<FlatDynamicDataSequence*>(storage);
+    if (length > sequence.capacity)
+    {
+        uint32_t capacity = static_cast<uint32_t>(std::min<uint64_t>(
+                    std::max<uint64_t>(length, 2ull * sequence.capacity), std::numeric_limits<uint32_t>::max()));
+        std::max_align_t* buffer = allocate(static_cast<size_t>(capacity) * element_size);
+        uint8_t* old_elements = reinterpret_cast<uint8_t*>(sequence.elements);
+        elements->construct_copy_elements(reinterpret_cast<uint8_t*>(buffer), old_elements, sequence.length);
+        for (uint32_t i = 0; i < sequence.length; ++i)
+        {
+            elements->destroy(old_elements + i * element_size);
+        }
+        delete[] sequence.elements;
+        sequence.elements = buffer;
+        sequence.capacity = capacity;
+    }
+
+    uint8_t* data = reinterpret_cast<uint8_t*>(sequence.elements);
+    for (uint32_t i = length; i < sequence.length; ++i)
+    {
+        elements->destroy(data + i * element_size);
+    }
+    for (uint32_t i = sequence.length; i < length; ++i)
+    {
+        elements->construct(data + i * element_size);
+    }
+    sequence.length = length;
+}
+
+void FlatDynamicDataLayout::erase(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage,
+        uint32_t index)
+{
+    const FlatDynamicDataLayout* elements = node->element_layout;
+    uint32_t element_size = node->element->size;
+    uint32_t length = node->length(storage);
+
+    if (elements->slots_.empty())
+    {
+        uint8_t* position = node->element_at(storage, index);
+        memmove(position, position + element_size, (length - index - 1) * element_size);
+    }
+    else
+    {
+        for (uint32_t i = index + 1; i < length; ++i)
+        {
+            elements->assign(node->element_at(storage, i - 1), node->element_at(storage, i), 0, element_size);
+        }
+    }
+    resize(node, storage, length - 1);
+}
+
+size_t FlatDynamicDataLayout::serialized_size(
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage,
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+    switch (node->kind)
+    {
+        case TK_INT16:
+        case TK_UINT16:
+            current_alignment += 2 + Cdr::alignment(current_alignment, 2);
+            break;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+        case TK_CHAR16: // WCHARS NEED 32 Bits on Linux & MacOS
+            current_alignment += 4 + Cdr::alignment(current_alignment, 4);
+            break;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            current_alignment += 8 + Cdr::alignment(current_alignment, 8);
+            break;
+        case TK_FLOAT128:
+            current_alignment += 16 + Cdr::alignment(current_alignment, 8);
+            break;
+        case TK_CHAR8:
+        case TK_BOOLEAN:
+        case TK_BYTE:
+            current_alignment += 1;
+            break;
+        case TK_STRING8:
+            // string length + characters + 1
+            current_alignment += 4 + Cdr::alignment(current_alignment, 4) +
+                    reinterpret_cast<const std::string*>(storage)->length() + 1;
+            break;
+        case TK_STRING16:
+            // string length + (characters * 4)
+            current_alignment += 4 + Cdr::alignment(current_alignment, 4) +
+                    reinterpret_cast<const std::wstring*>(storage)->length() * 4;
+            break;
+        case TK_BITMASK:
+        {
+            uint32_t size = bitmask_size(node);
+            if (0 != size)
+            {
+                current_alignment += size + Cdr::alignment(current_alignment, size);
+            }
+            break;
+        }
+        case TK_STRUCTURE:
+            for (uint32_t pos : node->wire_order)
+            {
+                const FlatDynamicDataNode::Member& member = node->members[pos];
+                if (member.serialized)
+                {
+                    current_alignment += serialized_size(member.node, storage + member.offset, current_alignment);
+                }
+            }
+            break;
+        case TK_ARRAY:
+            current_alignment += elements_serialized_size(node, storage, node->count, current_alignment);
+            break;
+        case TK_SEQUENCE:
+            // Elements count
+            current_alignment += 4 + Cdr::alignment(current_alignment, 4);
+            current_alignment += elements_serialized_size(node, storage, node->length(storage), current_alignment);
+            break;
+        default:
+            break;
+    }
+
+    return current_alignment - initial_alignment;
+}
+
+void FlatDynamicDataLayout::serialize(
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage,
+        Cdr& cdr)
+{
+    switch (node->kind)
+    {
+        case TK_INT16:
+            cdr << *reinterpret_cast<const int16_t*>(storage);
+            break;
+        case TK_UINT16:
+            cdr << *reinterpret_cast<const uint16_t*>(storage);
+            break;
+        case TK_INT32:
+            cdr << *reinterpret_cast<const int32_t*>(storage);
+            break;
+        case TK_UINT32:
+        case TK_ENUM:
+            cdr << *reinterpret_cast<const uint32_t*>(storage);
+            break;
+        case TK_INT64:
+            cdr << *reinterpret_cast<const int64_t*>(storage);
+            break;
+        case TK_UINT64:
+            cdr << *reinterpret_cast<const uint64_t*>(storage);
+            break;
+        case TK_FLOAT32:
+            cdr << *reinterpret_cast<const float*>(storage);
+            break;
+        case TK_FLOAT64:
+            cdr << *reinterpret_cast<const double*>(storage);
+            break;
+        case TK_FLOAT128:
+            cdr << *reinterpret_cast<const long double*>(storage);
+            break;
+        case TK_CHAR8:
+            cdr << *reinterpret_cast<const char*>(storage);
+            break;
+        case TK_CHAR16:
+            cdr << *reinterpret_cast<const wchar_t*>(storage);
+            break;
+        case TK_BOOLEAN:
+            cdr << *reinterpret_cast<const bool*>(storage);
+            break;
+        case TK_BYTE:
+            cdr << *storage;
+            break;
+        case TK_STRING8:
+            cdr << *reinterpret_cast<const std::string*>(storage);
+            break;
+        case TK_STRING16:
+            cdr << *reinterpret_cast<const std::wstring*>(storage);
+            break;
+        case TK_BITMASK:
+        {
+            uint64_t value = *reinterpret_cast<const uint64_t*>(storage);
+            switch (bitmask_size(node))
+            {
+                case 1:
+                    cdr << static_cast<uint8_t>(value);
+                    break;
+                case 2:
+                    cdr << static_cast<uint16_t>(value);
+                    break;
+                case 4:
+                    cdr << static_cast<uint32_t>(value);
+                    break;
+                case 8:
+                    cdr << value;
+                    break;
+                default:
+                    EPROSIMA_LOG_ERROR(DYN_TYPES, "Cannot serialize bitmask of size " << node->type->get_size());
+                    break;
+            }
+            break;
+        }
+        case TK_STRUCTURE:
+            for (uint32_t pos : node->wire_order)
+            {
+                const FlatDynamicDataNode::Member& member = node->members[pos];
+                if (member.serialized)
+                {
+                    serialize(member.node, storage + member.offset, cdr);
+                }
+            }
+            break;
+        case TK_ARRAY:
+            serialize_elements(node, storage, node->count, cdr);
+            break;
+        case TK_SEQUENCE:
+        {
+            uint32_t length = node->length(storage);
+            cdr << length;
+            serialize_elements(node, storage, length, cdr);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void FlatDynamicDataLayout::deserialize(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage,
+        Cdr& cdr)
+{
+    switch (node->kind)
+    {
+        case TK_INT16:
+            cdr >> *reinterpret_cast<int16_t*>(storage);
+            break;
+        case TK_UINT16:
+            cdr >> *reinterpret_cast<uint16_t*>(storage);
+            break;
+        case TK_INT32:
+            cdr >> *reinterpret_cast<int32_t*>(storage);
+            break;
+        case TK_UINT32:
+        case TK_ENUM:
+            cdr >> *reinterpret_cast<uint32_t*>(storage);
+            break;
+        case TK_INT64:
+            cdr >> *reinterpret_cast<int64_t*>(storage);
+            break;
+        case TK_UINT64:
+            cdr >> *reinterpret_cast<uint64_t*>(storage);
+            break;
+        case TK_FLOAT32:
+            cdr >> *reinterpret_cast<float*>(storage);
+            break;
+        case TK_FLOAT64:
+            cdr >> *reinterpret_cast<double*>(storage);
+            break;
+        case TK_FLOAT128:
+            cdr >> *reinterpret_cast<long double*>(storage);
+            break;
+        case TK_CHAR8:
+            cdr >> *reinterpret_cast<char*>(storage);
+            break;
+        case TK_CHAR16:
+            cdr >> *reinterpret_cast<wchar_t*>(storage);
+            break;
+        case TK_BOOLEAN:
+            cdr >> *reinterpret_cast<bool*>(storage);
+            break;
+        case TK_BYTE:
+            cdr >> *storage;
+            break;
+        case TK_STRING8:
+            cdr >> *reinterpret_cast<std::string*>(storage);
+            break;
+        case TK_STRING16:
+            cdr >> *reinterpret_cast<std::wstring*>(storage);
+            break;
+        case TK_BITMASK:
+        {
+            uint64_t& value = *reinterpret_cast<uint64_t*>(storage);
+            switch (bitmask_size(node))
+            {
+                case 1:
+                {
+                    uint8_t temp;
+                    cdr >> temp;
+                    value = temp;
+                    break;
+                }
+                case 2:
+                {
+                    uint16_t temp;
+                    cdr >> temp;
+                    value = temp;
+                    break;
+                }
+                case 4:
+                {
+                    uint32_t temp;
+                    cdr >> temp;
+                    value = temp;
+                    break;
+                }
+                case 8:
+                    cdr >> value;
+                    break;
+                default:
+                    EPROSIMA_LOG_ERROR(DYN_TYPES, "Cannot deserialize bitmask of size " << node->type->get_size());
+                    break;
+            }
+            break;
+        }
+        case TK_STRUCTURE:
+            for (uint32_t pos : node->wire_order)
+            {
+                const FlatDynamicDataNode::Member& member = node->members[pos];
+                if (member.serialized)
+                {
+                    deserialize(member.node, storage + member.offset, cdr);
+                }
+            }
+            break;
+        case TK_ARRAY:
+            deserialize_elements(node, storage, node->count, cdr);
+            break;
+        case TK_SEQUENCE:
+        {
+            uint32_t length = 0;
+            cdr >> length;
+            if (BOUND_UNLIMITED != node->bound && length > node->bound)
+            {
+                throw BadParamException("Sequence length exceeds its bound");
+            }
+            resize(node, storage, length);
+            deserialize_elements(node, storage, length, cdr);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void FlatDynamicDataLayout::serialize_key(
+        const FlatDynamicDataNode* node,
+        const uint8_t* storage,
+        Cdr& cdr)
+{
+    // Structures check the key of their members, whether they are serialized or not
+    if (TK_STRUCTURE == node->kind)
+    {
+        for (uint32_t pos : node->wire_order)
+        {
+            const FlatDynamicDataNode::Member& member = node->members[pos];
+            serialize_key(member.node, storage + member.offset, cdr);
+        }
+    }
+    else if (node->key)
+    {
+        serialize(node, storage, cdr);
+    }
+}
+
+std::max_align_t* FlatDynamicDataLayout::allocate(
+        size_t size)
+{
+    size_t count = (std::max<size_t>(size, 1u) + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+    return new std::max_align_t[count];
+}
+
+std::vector<FlatDynamicDataLayout::Slot>::const_iterator FlatDynamicDataLayout::first_slot(
+        uint32_t offset) const
+{
+    return std::lower_bound(slots_.begin(), slots_.end(), offset,
+                   [](const Slot& slot, uint32_t value)
+                   {
+                       return slot.first < value;
+                   });
+}
+
+void FlatDynamicDataLayout::construct_slots(
+        uint8_t* storage,
+        uint32_t begin,
+        uint32_t end) const
+{
+    for (auto it = first_slot(begin); it != slots_.end() && it->first < end; ++it)
+    {
+        construct_slot(it->second, storage + it->first);
+    }
+
+    for (const auto& value : string_defaults_)
+    {
+        if (value.first >= begin && value.first < end)
+        {
+            *reinterpret_cast<std::string*>(storage + value.first) = value.second;
+        }
+    }
+    for (const auto& value : wstring_defaults_)
+    {
+        if (value.first >= begin && value.first < end)
+        {
+            *reinterpret_cast<std::wstring*>(storage + value.first) = value.second;
+        }
+    }
+}
+
+void FlatDynamicDataLayout::destroy_slots(
+        uint8_t* storage,
+        uint32_t begin,
+        uint32_t end) const
+{
+    for (auto it = first_slot(begin); it != slots_.end() && it->first < end; ++it)
+    {
+        destroy_slot(it->second, storage + it->first);
+    }
+}
+
+void FlatDynamicDataLayout::construct_slot(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage)
+{
+    switch (node->kind)
+    {
+        case TK_STRING8:
+            new (storage) std::string();
+            break;
+        case TK_STRING16:
+            new (storage) std::wstring();
+            break;
+        default:
+            new (storage) FlatDynamicDataSequence();
+            break;
+    }
+}
+
+void FlatDynamicDataLayout::copy_slot(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage,
+        const uint8_t* other)
+{
+    switch (node->kind)
+    {
+        case TK_STRING8:
+            new (storage) std::string(*reinterpret_cast<const std::string*>(other));
+            break;
+        case TK_STRING16:
+            new (storage) std::wstring(*reinterpret_cast<const std::wstring*>(other));
+            break;
+        default:
+        {
+            const FlatDynamicDataSequence& source = *reinterpret_cast<const FlatDynamicDataSequence*>(other);
+            FlatDynamicDataSequence* sequence = new (storage) FlatDynamicDataSequence();
+            if (0 < source.length)
+            {
+                sequence->elements = allocate(static_cast<size_t>(source.length) * node->element->size);
+                sequence->capacity = source.length;
+                node->element_layout->construct_copy_elements(reinterpret_cast<uint8_t*>(sequence->elements),
+                        reinterpret_cast<const uint8_t*>(source.elements), source.length);
+                sequence->length = source.length;
+            }
+            break;
+        }
+    }
+}
+
+void FlatDynamicDataLayout::assign_slot(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage,
+        const uint8_t* other)
+{
+    switch (node->kind)
+    {
+        case TK_STRING8:
+            *reinterpret_cast<std::string*>(storage) = *reinterpret_cast<const std::string*>(other);
+            break;
+        case TK_STRING16:
+            *reinterpret_cast<std::wstring*>(storage) = *reinterpret_cast<const std::wstring*>(other);
+            break;
+        default:
+        {
+            uint32_t length = node->length(other);
+            resize(node, storage, length);
+            for (uint32_t i = 0; i < length; ++i)
+            {
+                node->element_layout->assign(node->element_at(storage, i), node->element_at(other, i), 0,
+                        node->element->size);
+            }
+            break;
+        }
+    }
+}
+
+void FlatDynamicDataLayout::destroy_slot(
+        const FlatDynamicDataNode* node,
+        uint8_t* storage)
+{
+    using std::string;
+    using std::wstring;
+
+    switch (node->kind)
+    {
+        case TK_STRING8:
+            reinterpret_cast<string*>(storage)->~string();
+            break;
+        case TK_STRING16:
+            reinterpret_cast<wstring*>(storage)->~wstring();
+            break;
+        default:
+        {
+            FlatDynamicDataSequence& sequence = *reinterpret_cast<FlatDynamicDataSequence*>(storage);
+            uint8_t* data = reinterpret_cast<uint8_t*>(sequence.elements);
+            for (uint32_t i = 0; i < sequence.length; ++i)
+            {
+                node->element_layout->destroy(data + i * node->element->size);
+            }
+            delete[] sequence.elements;
+            break;
+        }
+    }
+}
+
+void FlatDynamicDataLayout::construct_copy_elements(
+        uint8_t* storage,
+        const uint8_t* other,
+        uint32_t count) const
+{
+    if (slots_.empty())
+    {
+        memcpy(storage, other, static_cast<size_t>(count) * size());
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        construct_copy(storage + i * size(), other + i * size());
+    }
+}
+
+bool FlatDynamicDataLayout::equals(
+        const FlatDynamicDataNode* node,
+        const uint8_t* left,
+        const uint8_t* right)
+{
+    switch (node->kind)
+    {
+        case TK_INT16:
+        case TK_UINT16:
+            return equal_values<uint16_t>(left, right);
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_ENUM:
+            return equal_values<uint32_t>(left, right);
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_BITMASK:
+            return equal_values<uint64_t>(left, right);
+        case TK_FLOAT32:
+            return equal_values<float>(left, right);
+        case TK_FLOAT64:
+            return equal_values<double>(left, right);
+        case TK_FLOAT128:
+            return equal_values<long double>(left, right);
+        case TK_CHAR8:
+        case TK_BYTE:
+            return *left == *right;
+        case TK_CHAR16:
+            return equal_values<wchar_t>(left, right);
+        case TK_BOOLEAN:
+            return equal_values<bool>(left, right);
+        case TK_STRING8:
+            return equal_values<std::string>(left, right);
+        case TK_STRING16:
+            return equal_values<std::wstring>(left, right);
+        case TK_STRUCTURE:
+            for (const FlatDynamicDataNode::Member& member : node->members)
+            {
+                if (!equals(member.node, left + member.offset, right + member.offset))
+                {
+                    return false;
+                }
+            }
+            return true;
+        case TK_ARRAY:
+            for (uint32_t i = 0; i < node->count; ++i)
+            {
+                uint32_t offset = i * node->element->size;
+                if (!equals(node->element, left + offset, right + offset))
+                {
+                    return false;
+                }
+            }
+            return true;
+        case TK_SEQUENCE:
+        {
+            uint32_t length = node->length(left);
+            if (length != node->length(right))
+            {
+                return false;
+            }
+            for (uint32_t i = 0; i < length; ++i)
+            {
+                if (!equals(node->element, node->element_at(left, i), node->element_at(right, i)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
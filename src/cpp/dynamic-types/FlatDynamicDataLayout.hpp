@@ -0,0 +1,409 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlatDynamicDataLayout.hpp
+ */
+
+#ifndef _FASTDDS_DYNAMIC_TYPES_FLATDYNAMICDATALAYOUT_HPP_
+#define _FASTDDS_DYNAMIC_TYPES_FLATDYNAMICDATALAYOUT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastrtps {
+namespace types {
+
+class FlatDynamicDataLayout;
+
+/**
+ * Storage of a sequence whose elements are stored out of line, as the characters of strings.
+ * Only its first length elements are constructed.
+ */
+struct FlatDynamicDataSequence
+{
+    //! Number of elements, placed first as on sequences stored inline
+    uint32_t length;
+    //! Number of elements fitting on the allocated storage
+    uint32_t capacity;
+    std::max_align_t* elements;
+};
+
+/**
+ * Storage description of a type inside a FlatDynamicData buffer.
+ * Primitives, enumerations, bitmasks and string objects are stored inline. Structures and arrays are stored inline
+ * as the concatenation of their members or elements. Bounded sequences are stored inline as their length followed
+ * by storage for as many elements as their bound, which hold their default values when not used. Unbounded sequences,
+ * and the bounded ones too big to be stored inline, are stored as a FlatDynamicDataSequence.
+ */
+struct FlatDynamicDataNode
+{
+    struct Member
+    {
+        MemberId id;
+        std::string name;
+        //! Offset of the member from the start of the enclosing structure
+        uint32_t offset;
+        const FlatDynamicDataNode* node;
+        //! Value of the default annotation of the member, if any
+        std::string default_value;
+        //! Whether DynamicData serializes the member: its id is below the number of members and it is not non serialized
+        bool serialized;
+    };
+
+    //! Kind of the type, aliases already resolved
+    TypeKind kind = TK_NONE;
+    //! Resolved type, used for enumeration literals and conversions
+    DynamicType_ptr type;
+    uint32_t size = 0;
+    uint32_t alignment = 1;
+
+    //! Structure members, in member index order
+    std::vector<Member> members;
+    //! Position on members indexed by MemberId, when member ids are dense
+    std::vector<uint32_t> member_by_id;
+    //! Positions on members in MemberId order, the order of the wire
+    std::vector<uint32_t> wire_order;
+
+    //! Array and sequence element, and number of elements of arrays
+    const FlatDynamicDataNode* element = nullptr;
+    uint32_t count = 0;
+
+    //! Maximum length of strings and sequences
+    uint32_t bound = 0;
+    //! Offset of the elements of sequences stored inline from the start of the sequence, 0 when stored out of line
+    uint32_t elements_offset = 0;
+    //! Layout of the elements of sequences, to construct, copy and destroy them one by one
+    const FlatDynamicDataLayout* element_layout = nullptr;
+    //! Enumeration literals
+    std::map<uint32_t, std::string> literals;
+    //! Whether the type has the key annotation, so the value is part of the key as on DynamicData
+    bool key = false;
+
+    /**
+     * Look for the storage of a member (structures) or element (arrays and sequences)
+     * @param id MemberId of the member, or index of the element
+     * @param storage Storage of this node
+     * @param [out] member Storage of the member
+     * @return Node of the member, nullptr if not found
+     */
+    const FlatDynamicDataNode* find(
+            MemberId id,
+            uint8_t* storage,
+            uint8_t*& member) const;
+
+    /**
+     * Look for the position of a structure member on members
+     * @param id MemberId of the member
+     * @return Position of the member, or members.size() if not found
+     */
+    size_t find_member(
+            MemberId id) const;
+
+    /**
+     * Number of elements of a sequence
+     * @param storage Storage of the sequence
+     */
+    uint32_t length(
+            const uint8_t* storage) const
+    {
+        return *reinterpret_cast<const uint32_t*>(storage);
+    }
+
+    /**
+     * Storage of an element of an array or sequence
+     * @param storage Storage of the array or sequence
+     * @param index Index of the element, not checked against the number of elements
+     */
+    uint8_t* element_at(
+            uint8_t* storage,
+            uint32_t index) const;
+
+    const uint8_t* element_at(
+            const uint8_t* storage,
+            uint32_t index) const
+    {
+        return element_at(const_cast<uint8_t*>(storage), index);
+    }
+};
+
+/**
+ * Storage layout computed once per DynamicType and shared by all the FlatDynamicData samples of the type.
+ */
+class FlatDynamicDataLayout
+{
+public:
+
+    /**
+     * Retrieve the layout of a type, computing it the first time.
+     * Layouts are cached on the DynamicTypeBuilderFactory instance, and released along with it or once neither the
+     * type nor any sample of it is used anymore.
+     * @param type Type to lay out
+     * @return Layout of the type, nullptr if the type contains members that cannot be stored flat
+     */
+    static std::shared_ptr<const FlatDynamicDataLayout> get(
+            const DynamicType_ptr& type);
+
+    //! Storage description of the root type
+    const FlatDynamicDataNode* root() const
+    {
+        return root_;
+    }
+
+    //! Size in bytes of a sample
+    uint32_t size() const
+    {
+        return root_->size;
+    }
+
+    /**
+     * Construct a sample with default values on the given storage
+     * @param storage Uninitialized storage of size() bytes
+     */
+    void construct(
+            uint8_t* storage) const;
+
+    /**
+     * Construct a sample as a copy of another one
+     * @param storage Uninitialized storage of size() bytes
+     * @param other Sample to copy
+     */
+    void construct_copy(
+            uint8_t* storage,
+            const uint8_t* other) const;
+
+    /**
+     * Copy the values of part of a sample into the same part of another one
+     * @param storage Start of the part being overwritten
+     * @param other Start of the part being copied
+     * @param offset Offset of the part being overwritten from the start of its sample
+     * @param size Size of the part
+     */
+    void assign(
+            uint8_t* storage,
+            const uint8_t* other,
+            uint32_t offset,
+            uint32_t size) const;
+
+    /**
+     * Destroy a sample previously constructed on the given storage
+     * @param storage Storage of the sample
+     */
+    void destroy(
+            uint8_t* storage) const;
+
+    /**
+     * Reset the values of part of a sample to their defaults
+     * @param storage Storage of the sample
+     * @param offset Offset of the part being reset
+     * @param size Size of the part being reset
+     */
+    void reset(
+            uint8_t* storage,
+            uint32_t offset,
+            uint32_t size) const;
+
+    /**
+     * Compare the values of part of two samples
+     * @return true when all the values are equal
+     */
+    static bool equals(
+            const FlatDynamicDataNode* node,
+            const uint8_t* left,
+            const uint8_t* right);
+
+    /**
+     * Change the number of elements of a sequence. New elements get their default values.
+     * @param node Node of the sequence
+     * @param storage Storage of the sequence
+     * @param length New number of elements, not above the bound of the sequence
+     */
+    static void resize(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage,
+            uint32_t length);
+
+    /**
+     * Remove an element of a sequence, moving back the ones following it
+     * @param node Node of the sequence
+     * @param storage Storage of the sequence
+     * @param index Index of the element, below the number of elements
+     */
+    static void erase(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage,
+            uint32_t index);
+
+    /**
+     * Serialized size of a value, following DynamicData
+     * @param node Node of the value
+     * @param storage Storage of the value
+     * @param current_alignment Current position on the CDR stream
+     * @return Size in bytes
+     */
+    static size_t serialized_size(
+            const FlatDynamicDataNode* node,
+            const uint8_t* storage,
+            size_t current_alignment);
+
+    /**
+     * Serialize a value as DynamicData does
+     * @param node Node of the value
+     * @param storage Storage of the value
+     * @param cdr Stream
+     */
+    static void serialize(
+            const FlatDynamicDataNode* node,
+            const uint8_t* storage,
+            fastcdr::Cdr& cdr);
+
+    /**
+     * Deserialize a value, resizing its sequences
+     * @param node Node of the value
+     * @param storage Storage of the value
+     * @param cdr Stream
+     * @throw fastcdr::exception::BadParamException if a sequence exceeds its bound
+     */
+    static void deserialize(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage,
+            fastcdr::Cdr& cdr);
+
+    /**
+     * Serialize the key values of a value as DynamicData does
+     * @param node Node of the value
+     * @param storage Storage of the value
+     * @param cdr Stream
+     */
+    static void serialize_key(
+            const FlatDynamicDataNode* node,
+            const uint8_t* storage,
+            fastcdr::Cdr& cdr);
+
+    /**
+     * Allocate uninitialized storage suitable for any value
+     * @param size Size in bytes
+     */
+    static std::max_align_t* allocate(
+            size_t size);
+
+private:
+
+    //! Position of a value which cannot be copied bytewise
+    using Slot = std::pair<uint32_t, const FlatDynamicDataNode*>;
+
+    FlatDynamicDataLayout() = default;
+
+    /**
+     * Check whether the type of the layout is only referenced by the layout itself.
+     * Should be called with the cache locked.
+     */
+    bool is_unused() const;
+
+    const FlatDynamicDataNode* build(
+            const DynamicType_ptr& type);
+
+    void add_values(
+            const FlatDynamicDataNode* node,
+            uint32_t offset);
+
+    void add_default(
+            const FlatDynamicDataNode* node,
+            uint32_t offset,
+            const std::string& value);
+
+    /**
+     * Create the layout of the elements of a sequence, whose nodes are owned by this layout
+     * @param element Node of the elements
+     */
+    const FlatDynamicDataLayout* add_element_layout(
+            const FlatDynamicDataNode* element);
+
+    std::vector<Slot>::const_iterator first_slot(
+            uint32_t offset) const;
+
+    void construct_slots(
+            uint8_t* storage,
+            uint32_t begin,
+            uint32_t end) const;
+
+    void destroy_slots(
+            uint8_t* storage,
+            uint32_t begin,
+            uint32_t end) const;
+
+    static void construct_slot(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage);
+
+    static void copy_slot(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage,
+            const uint8_t* other);
+
+    static void assign_slot(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage,
+            const uint8_t* other);
+
+    static void destroy_slot(
+            const FlatDynamicDataNode* node,
+            uint8_t* storage);
+
+    /**
+     * Copy construct consecutive elements of a sequence
+     * @param storage Uninitialized storage of the elements
+     * @param other Elements to copy
+     * @param count Number of elements
+     */
+    void construct_copy_elements(
+            uint8_t* storage,
+            const uint8_t* other,
+            uint32_t count) const;
+
+    // Keeps the described type alive while the layout is cached
+    DynamicType_ptr type_;
+    //! References to type_ held by the layout itself
+    long type_references_ = 0;
+    std::vector<std::unique_ptr<FlatDynamicDataNode>> nodes_;
+    //! Layouts of the elements of the sequences, referencing the nodes of this layout
+    std::vector<std::unique_ptr<FlatDynamicDataLayout>> element_layouts_;
+    const FlatDynamicDataNode* root_ = nullptr;
+
+    //! Default image of the trivially copyable values
+    std::vector<uint8_t> image_;
+    //! Strings and sequences stored out of line, which cannot be copied bytewise, in ascending offset order
+    std::vector<Slot> slots_;
+    //! Non empty default values of strings
+    std::vector<std::pair<uint32_t, std::string>> string_defaults_;
+    std::vector<std::pair<uint32_t, std::wstring>> wstring_defaults_;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_DYNAMIC_TYPES_FLATDYNAMICDATALAYOUT_HPP_
@@ -0,0 +1,78 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/FlatDynamicPubSubType.h>
+
+#include <fastcdr/Cdr.h>
+
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/FlatDynamicData.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+FlatDynamicPubSubType::FlatDynamicPubSubType(
+        DynamicType_ptr pDynamicType)
+    : DynamicPubSubType(pDynamicType)
+{
+}
+
+void* FlatDynamicPubSubType::createData()
+{
+    return DynamicDataFactory::get_instance()->create_flat_data(dynamic_type_);
+}
+
+void FlatDynamicPubSubType::deleteData(
+        void* data)
+{
+    DynamicDataFactory::get_instance()->delete_flat_data(static_cast<FlatDynamicData*>(data));
+}
+
+std::function<uint32_t()> FlatDynamicPubSubType::getSerializedSizeProvider(
+        void* data,
+        fastdds::dds::DataRepresentationId_t data_representation)
+{
+    static_cast<void>(data_representation);
+    return [data]() -> uint32_t
+           {
+               return static_cast<uint32_t>(FlatDynamicData::getCdrSerializedSize(
+                          static_cast<const FlatDynamicData*>(data))) + 4 /*encapsulation*/;
+           };
+}
+
+void FlatDynamicPubSubType::serialize_sample(
+        const void* data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    static_cast<const FlatDynamicData*>(data)->serialize(cdr);
+}
+
+void FlatDynamicPubSubType::deserialize_sample(
+        void* data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    static_cast<FlatDynamicData*>(data)->deserialize(cdr);
+}
+
+void FlatDynamicPubSubType::serialize_key(
+        const void* data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    static_cast<const FlatDynamicData*>(data)->serializeKey(cdr);
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
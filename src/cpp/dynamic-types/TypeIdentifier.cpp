@@ -1315,6 +1315,12 @@ bool TypeIdentifier::consistent(
                 return false;
             }
 
+            // Equal hashes come from equal TypeObjects, which need not be looked up nor compared
+            if (*this == x)
+            {
+                return true;
+            }
+
             const TypeObject* localObj = TypeObjectFactory::get_instance()->get_type_object(this);
             const TypeObject* remoteObj = TypeObjectFactory::get_instance()->get_type_object(&x);
             if (localObj == nullptr)
@@ -46,6 +46,72 @@ public:
 };
 
 static TypeObjectFactoryReleaser s_releaser;
+
+// Hash of the value of a TypeIdentifier, consistent with TypeIdentifier::operator ==
+static size_t hash_type_identifier(
+        const TypeIdentifier& identifier)
+{
+    size_t hash = identifier._d();
+    auto combine = [&hash](size_t value)
+            {
+                hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            };
+
+    switch (identifier._d())
+    {
+        case TI_STRING8_SMALL:
+        case TI_STRING16_SMALL:
+            combine(identifier.string_sdefn().bound());
+            break;
+        case TI_STRING8_LARGE:
+        case TI_STRING16_LARGE:
+            combine(identifier.string_ldefn().bound());
+            break;
+        case TI_PLAIN_SEQUENCE_SMALL:
+            combine(identifier.seq_sdefn().bound());
+            combine(hash_type_identifier(*identifier.seq_sdefn().element_identifier()));
+            break;
+        case TI_PLAIN_SEQUENCE_LARGE:
+            combine(identifier.seq_ldefn().bound());
+            combine(hash_type_identifier(*identifier.seq_ldefn().element_identifier()));
+            break;
+        case TI_PLAIN_ARRAY_SMALL:
+            for (SBound bound : identifier.array_sdefn().array_bound_seq())
+            {
+                combine(bound);
+            }
+            combine(hash_type_identifier(*identifier.array_sdefn().element_identifier()));
+            break;
+        case TI_PLAIN_ARRAY_LARGE:
+            for (LBound bound : identifier.array_ldefn().array_bound_seq())
+            {
+                combine(bound);
+            }
+            combine(hash_type_identifier(*identifier.array_ldefn().element_identifier()));
+            break;
+        case TI_PLAIN_MAP_SMALL:
+            combine(identifier.map_sdefn().bound());
+            combine(hash_type_identifier(*identifier.map_sdefn().key_identifier()));
+            combine(hash_type_identifier(*identifier.map_sdefn().element_identifier()));
+            break;
+        case TI_PLAIN_MAP_LARGE:
+            combine(identifier.map_ldefn().bound());
+            combine(hash_type_identifier(*identifier.map_ldefn().key_identifier()));
+            combine(hash_type_identifier(*identifier.map_ldefn().element_identifier()));
+            break;
+        case EK_MINIMAL:
+        case EK_COMPLETE:
+            for (int i = 0; i < 14; ++i)
+            {
+                combine(identifier.equivalence_hash()[i]);
+            }
+            break;
+        default:
+            break;
+    }
+    return hash;
+}
+
 static TypeObjectFactory* g_instance = nullptr;
 TypeObjectFactory* TypeObjectFactory::get_instance()
 {
@@ -77,82 +143,82 @@ TypeObjectFactory::TypeObjectFactory()
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BOOLEAN);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BOOLEAN, auxIdent));
+    store_type_identifier(TKNAME_BOOLEAN, auxIdent, false);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BYTE, auxIdent));
+    store_type_identifier(TKNAME_BYTE, auxIdent, false);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT8, auxIdent));
+    store_type_identifier(TKNAME_UINT8, auxIdent, false);
     // TK_BYTE:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT8, auxIdent));
+    store_type_identifier(TKNAME_INT8, auxIdent, false);
     // TK_INT16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT16, auxIdent));
+    store_type_identifier(TKNAME_INT16, auxIdent, false);
     // TK_INT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT32, auxIdent));
+    store_type_identifier(TKNAME_INT32, auxIdent, false);
     // TK_INT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_INT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT64, auxIdent));
+    store_type_identifier(TKNAME_INT64, auxIdent, false);
     // TK_UINT16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT16, auxIdent));
+    store_type_identifier(TKNAME_UINT16, auxIdent, false);
     // TK_UINT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT32, auxIdent));
+    store_type_identifier(TKNAME_UINT32, auxIdent, false);
     // TK_UINT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_UINT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT64, auxIdent));
+    store_type_identifier(TKNAME_UINT64, auxIdent, false);
     // TK_FLOAT32:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT32, auxIdent));
+    store_type_identifier(TKNAME_FLOAT32, auxIdent, false);
     // TK_FLOAT64:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT64, auxIdent));
+    store_type_identifier(TKNAME_FLOAT64, auxIdent, false);
     // TK_FLOAT128:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_FLOAT128);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT128, auxIdent));
+    store_type_identifier(TKNAME_FLOAT128, auxIdent, false);
     // TK_CHAR8:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR8);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR8, auxIdent));
+    store_type_identifier(TKNAME_CHAR8, auxIdent, false);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16, auxIdent));
+    store_type_identifier(TKNAME_CHAR16, auxIdent, false);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier();
     identifiers_created_.push_back(auxIdent);
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16T, auxIdent));
+    store_type_identifier(TKNAME_CHAR16T, auxIdent, false);
 }
 
 TypeObjectFactory::~TypeObjectFactory()
@@ -170,6 +236,9 @@ TypeObjectFactory::~TypeObjectFactory()
         std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
         identifiers_.clear();
         complete_identifiers_.clear();
+        identifier_names_.clear();
+        complete_identifier_names_.clear();
+        type_object_providers_.clear();
 
         for (TypeIdentifier* id : identifiers_created_)
         {
@@ -178,7 +247,7 @@ TypeObjectFactory::~TypeObjectFactory()
         identifiers_created_.clear();
     }
     {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
+        std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
         auto obj_it = objects_.begin();
         while (obj_it != objects_.end())
         {
@@ -209,7 +278,7 @@ void TypeObjectFactory::nullify_all_entries(
     {
         if (it->second == identifier)
         {
-            it->second = nullptr;
+            store_type_identifier(it->first, nullptr, false);
         }
     }
 
@@ -217,7 +286,7 @@ void TypeObjectFactory::nullify_all_entries(
     {
         if (it->second == identifier)
         {
-            it->second = nullptr;
+            store_type_identifier(it->first, nullptr, true);
         }
     }
 
@@ -880,7 +949,7 @@ const TypeObject* TypeObjectFactory::get_type_object(
 const TypeObject* TypeObjectFactory::get_type_object(
         const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr)
     {
         return nullptr;
@@ -1076,6 +1145,7 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier(
         bool complete) const
 {
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    run_type_object_provider(type_name);
 
     if (complete)
     {
@@ -1109,6 +1179,7 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
         const std::string& type_name) const
 {
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    run_type_object_provider(type_name);
 
     if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
     {
@@ -1121,32 +1192,23 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
 }
 
 const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
-        const TypeIdentifier* identifier) const
+        const TypeIdentifier* identifier,
+        bool build_pending) const
 {
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr)
     {
         return nullptr;
     }
-    if (identifier->_d() == EK_COMPLETE)
+    const std::string* name = find_type_identifier_name(identifier);
+    if (name != nullptr)
     {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier)
-            {
-                return it.second;
-            }
-        }
+        return identifier->_d() == EK_COMPLETE ? complete_identifiers_.at(*name) : identifiers_.at(*name);
     }
-    else
+    // Hashed identifiers may belong to a type whose provider has not run yet
+    if (build_pending && identifier->_d() >= EK_MINIMAL && run_all_type_object_providers())
     {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier)
-            {
-                return it.second;
-            }
-        }
+        return get_stored_type_identifier(identifier, false);
     }
     // If isn't minimal, return directly
     if (identifier->_d() < EK_MINIMAL)
@@ -1156,34 +1218,106 @@ const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
     return nullptr;
 }
 
-std::string TypeObjectFactory::get_type_name(
-        const TypeIdentifier* identifier) const
+void TypeObjectFactory::store_type_identifier(
+        const std::string& type_name,
+        const TypeIdentifier* identifier,
+        bool complete)
 {
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-    if (identifier == nullptr)
-    {
-        return "<NULLPTR>";
-    }
-    if (identifier->_d() == EK_COMPLETE)
+    auto& identifiers = complete ? complete_identifiers_ : identifiers_;
+    auto& names = complete ? complete_identifier_names_ : identifier_names_;
+
+    auto it = identifiers.find(type_name);
+    if (it != identifiers.end() && it->second != nullptr)
     {
-        for (auto& it : complete_identifiers_)
+        auto bucket = names.find(hash_type_identifier(*it->second));
+        if (bucket != names.end())
         {
-            if (*(it.second) == *identifier)
+            bucket->second.erase(type_name);
+            if (bucket->second.empty())
             {
-                return it.first;
+                names.erase(bucket);
             }
         }
     }
-    else
+
+    identifiers[type_name] = identifier;
+    if (identifier != nullptr)
     {
-        for (auto& it : identifiers_)
+        names[hash_type_identifier(*identifier)].insert(type_name);
+    }
+}
+
+const std::string* TypeObjectFactory::find_type_identifier_name(
+        const TypeIdentifier* identifier) const
+{
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    bool complete = identifier->_d() == EK_COMPLETE;
+    const auto& identifiers = complete ? complete_identifiers_ : identifiers_;
+    const auto& names = complete ? complete_identifier_names_ : identifier_names_;
+
+    auto bucket = names.find(hash_type_identifier(*identifier));
+    if (bucket != names.end())
+    {
+        for (const std::string& name : bucket->second)
         {
-            if (*(it.second) == *identifier)
+            auto it = identifiers.find(name);
+            if (it != identifiers.end() && it->second != nullptr && *it->second == *identifier)
             {
-                return it.first;
+                return &it->first;
             }
         }
     }
+    return nullptr;
+}
+
+void TypeObjectFactory::add_type_object_provider(
+        const std::string& type_name,
+        std::function<void()> provider)
+{
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    type_object_providers_[type_name] = std::move(provider);
+}
+
+void TypeObjectFactory::run_type_object_provider(
+        const std::string& type_name) const
+{
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    auto it = type_object_providers_.find(type_name);
+    if (it != type_object_providers_.end())
+    {
+        // Removed before running, as the provider looks the type up itself
+        std::function<void()> provider = std::move(it->second);
+        type_object_providers_.erase(it);
+        provider();
+    }
+}
+
+bool TypeObjectFactory::run_all_type_object_providers() const
+{
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    bool any_run = !type_object_providers_.empty();
+    while (!type_object_providers_.empty())
+    {
+        std::string type_name = type_object_providers_.begin()->first;
+        run_type_object_provider(type_name);
+    }
+    return any_run;
+}
+
+std::string TypeObjectFactory::get_type_name(
+        const TypeIdentifier* identifier) const
+{
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    if (identifier == nullptr)
+    {
+        return "<NULLPTR>";
+    }
+    const std::string* name = find_type_identifier_name(identifier);
+    if (name != nullptr)
+    {
+        return *name;
+    }
 
     // Maybe they are using an external TypeIdentifier?
     const TypeIdentifier* internalId = get_stored_type_identifier(identifier);
@@ -1345,18 +1479,14 @@ void TypeObjectFactory::add_type_identifier(
         const std::string& type_name,
         const TypeIdentifier* identifier)
 {
-    const TypeIdentifier* alreadyExists = get_stored_type_identifier(identifier);
+    // A pending type with the same name takes precedence, as if it had been added first.
+    // Registering a type must not build the other pending ones.
+    run_type_object_provider(type_name);
+    const TypeIdentifier* alreadyExists = get_stored_type_identifier(identifier, false);
     if (alreadyExists != nullptr && alreadyExists != identifier)
     {
         // Don't copy
-        if (is_type_identifier_complete(alreadyExists))
-        {
-            complete_identifiers_[type_name] = alreadyExists;
-        }
-        else
-        {
-            identifiers_[type_name] = alreadyExists;
-        }
+        store_type_identifier(type_name, alreadyExists, is_type_identifier_complete(alreadyExists));
         return;
     }
 
@@ -1369,7 +1499,7 @@ void TypeObjectFactory::add_type_identifier(
             TypeIdentifier* id = new TypeIdentifier();
             identifiers_created_.push_back(id);
             *id = *identifier;
-            complete_identifiers_[type_name] = id;
+            store_type_identifier(type_name, id, true);
         }
     }
     else
@@ -1379,7 +1509,7 @@ void TypeObjectFactory::add_type_identifier(
             TypeIdentifier* id = new TypeIdentifier();
             identifiers_created_.push_back(id);
             *id = *identifier;
-            identifiers_[type_name] = id;
+            store_type_identifier(type_name, id, false);
         }
     }
 }
@@ -1391,7 +1521,7 @@ void TypeObjectFactory::add_type_object(
 {
     add_type_identifier(type_name, identifier);
 
-    std::unique_lock<std::recursive_mutex> scopedObj(m_MutexObjects);
+    std::unique_lock<std::recursive_mutex> scopedObj(m_MutexIdentifiers);
 
     if (object != nullptr)
     {
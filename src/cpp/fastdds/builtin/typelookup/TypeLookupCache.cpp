@@ -0,0 +1,242 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeLookupCache.cpp
+ */
+
+#include <fastdds/builtin/typelookup/TypeLookupCache.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+#include <fastcdr/exceptions/Exception.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/utils/md5.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace builtin {
+
+using fastrtps::types::TypeIdentifier;
+using fastrtps::types::TypeObject;
+
+TypeLookupCache& TypeLookupCache::get_instance()
+{
+    static TypeLookupCache instance;
+    return instance;
+}
+
+bool TypeLookupCache::make_key(
+        const TypeIdentifier& identifier,
+        Key& key)
+{
+    if (identifier._d() != fastrtps::types::EK_MINIMAL && identifier._d() != fastrtps::types::EK_COMPLETE)
+    {
+        return false;
+    }
+
+    key[0] = identifier._d();
+    memcpy(&key[1], identifier.equivalence_hash(), key.size() - 1);
+    return true;
+}
+
+bool TypeLookupCache::get_type(
+        const TypeIdentifier& identifier,
+        TypeObject& object)
+{
+    Key key;
+    if (make_key(identifier, key))
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = types_.find(key);
+        if (it != types_.end())
+        {
+            object = it->second.object;
+            ++hits_;
+            return true;
+        }
+    }
+
+    ++misses_;
+    return false;
+}
+
+void TypeLookupCache::add_type(
+        const TypeIdentifier& identifier,
+        const TypeObject& object)
+{
+    Key key;
+    if (make_key(identifier, key))
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        Entry& entry = types_[key];
+        entry.identifier = identifier;
+        entry.object = object;
+    }
+}
+
+bool TypeLookupCache::matches_hash(
+        const TypeIdentifier& identifier,
+        const TypeObject& object)
+{
+    if ((identifier._d() != fastrtps::types::EK_MINIMAL && identifier._d() != fastrtps::types::EK_COMPLETE) ||
+            identifier._d() != object._d())
+    {
+        return false;
+    }
+
+    // Fixed endian (Page 221, EquivalenceHash definition of Extensible and Dynamic Topic Types for DDS document)
+    eprosima::fastcdr::CdrSizeCalculator calculator(eprosima::fastcdr::CdrVersion::XCDRv1);
+    size_t current_alignment {0};
+    fastrtps::rtps::SerializedPayload_t payload(static_cast<uint32_t>(
+                calculator.calculate_serialized_size(object, current_alignment) + 4));
+    eprosima::fastcdr::FastBuffer fastbuffer((char*) payload.data, payload.max_size);
+    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::LITTLE_ENDIANNESS,
+            eprosima::fastcdr::CdrVersion::XCDRv1);
+
+    try
+    {
+        ser << object;
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        return false;
+    }
+
+    MD5 object_hash;
+    object_hash.update((char*)payload.data, static_cast<uint32_t>(ser.get_serialized_data_length()));
+    object_hash.finalize();
+    return 0 == memcmp(identifier.equivalence_hash(), object_hash.digest, 14);
+}
+
+size_t TypeLookupCache::size() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return types_.size();
+}
+
+void TypeLookupCache::clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    types_.clear();
+    hits_ = 0;
+    misses_ = 0;
+}
+
+bool TypeLookupCache::save(
+        const std::string& filename) const
+{
+    std::vector<char> buffer;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        // Encapsulation, number of types and then the identifier and object of each one
+        eprosima::fastcdr::CdrSizeCalculator calculator(eprosima::fastcdr::CdrVersion::XCDRv1);
+        size_t current_alignment {4};
+        size_t size = 4 + 4;
+        for (const auto& type : types_)
+        {
+            size += calculator.calculate_serialized_size(type.second.identifier, current_alignment);
+            size += calculator.calculate_serialized_size(type.second.object, current_alignment);
+        }
+        buffer.resize(size);
+
+        eprosima::fastcdr::FastBuffer fastbuffer(buffer.data(), buffer.size());
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                eprosima::fastcdr::CdrVersion::XCDRv1);
+
+        try
+        {
+            ser.serialize_encapsulation();
+            ser << static_cast<uint32_t>(types_.size());
+            for (const auto& type : types_)
+            {
+                ser << type.second.identifier;
+                ser << type.second.object;
+            }
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "Cannot serialize the TypeLookup cache");
+            return false;
+        }
+        buffer.resize(ser.get_serialized_data_length());
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!file)
+    {
+        EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "Cannot write the TypeLookup cache to " << filename);
+        return false;
+    }
+    return true;
+}
+
+bool TypeLookupCache::load(
+        const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    eprosima::fastcdr::FastBuffer fastbuffer(buffer.data(), buffer.size());
+    eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN);
+
+    try
+    {
+        deser.read_encapsulation();
+        uint32_t count = 0;
+        deser >> count;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            TypeIdentifier identifier;
+            TypeObject object;
+            deser >> identifier;
+            deser >> object;
+
+            // As for the ones received, a TypeObject not matching its identifier is not cached
+            if (!matches_hash(identifier, object))
+            {
+                EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "Ignoring TypeObject not matching its TypeIdentifier "
+                        << "on TypeLookup cache file " << filename);
+                continue;
+            }
+            add_type(identifier, object);
+        }
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "Malformed TypeLookup cache file " << filename);
+        return false;
+    }
+    return true;
+}
+
+} // namespace builtin
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,145 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeLookupCache.hpp
+ */
+
+#ifndef _FASTDDS_TYPELOOKUP_SERVICE_CACHE_HPP_
+#define _FASTDDS_TYPELOOKUP_SERVICE_CACHE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <fastrtps/types/TypeIdentifier.h>
+#include <fastrtps/types/TypeObject.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace builtin {
+
+/**
+ * Process wide cache of the TypeObjects received through the TypeLookup Service.
+ *
+ * It is shared by every participant of the process, so a type retrieved from one peer is not requested again when
+ * another participant discovers it. Entries are indexed by the kind and equivalence hash of their TypeIdentifier.
+ */
+class TypeLookupCache
+{
+public:
+
+    //! Get the instance shared by all the participants of the process.
+    static TypeLookupCache& get_instance();
+
+    /**
+     * Look up the TypeObject of a type, counting a hit or a miss.
+     * @param identifier TypeIdentifier of the type. Only EK_MINIMAL and EK_COMPLETE identifiers are cached.
+     * @param [out] object TypeObject of the type, when found.
+     * @return true if the type was found.
+     */
+    bool get_type(
+            const fastrtps::types::TypeIdentifier& identifier,
+            fastrtps::types::TypeObject& object);
+
+    /**
+     * Store the TypeObject of a type, replacing any previous one.
+     * @param identifier TypeIdentifier of the type. Ignored unless it is EK_MINIMAL or EK_COMPLETE.
+     * @param object TypeObject of the type.
+     */
+    void add_type(
+            const fastrtps::types::TypeIdentifier& identifier,
+            const fastrtps::types::TypeObject& object);
+
+    /**
+     * Check that a TypeObject is the one hashed on a TypeIdentifier, so types received from other participants
+     * are not cached under the identifier of a different type.
+     * @param identifier TypeIdentifier of the type. Only EK_MINIMAL and EK_COMPLETE identifiers are checked.
+     * @param object TypeObject of the type.
+     * @return true if the equivalence hash of the identifier is the one of the object.
+     */
+    static bool matches_hash(
+            const fastrtps::types::TypeIdentifier& identifier,
+            const fastrtps::types::TypeObject& object);
+
+    //! Number of types stored.
+    size_t size() const;
+
+    //! Number of lookups which found the type.
+    uint64_t hits() const
+    {
+        return hits_.load();
+    }
+
+    //! Number of lookups which did not find the type.
+    uint64_t misses() const
+    {
+        return misses_.load();
+    }
+
+    //! Remove every type and reset the counters.
+    void clear();
+
+    /**
+     * Write every type stored to a file, so a later process can load them.
+     * @param filename Path of the file, overwritten if it exists.
+     * @return true if the file was written.
+     */
+    bool save(
+            const std::string& filename) const;
+
+    /**
+     * Add the types stored in a file written by save().
+     * @param filename Path of the file.
+     * @return true if the file was read. Types loaded before an error are kept.
+     */
+    bool load(
+            const std::string& filename);
+
+private:
+
+    //! Kind followed by the equivalence hash of the TypeIdentifier.
+    using Key = std::array<fastrtps::types::octet, 15>;
+
+    struct Entry
+    {
+        fastrtps::types::TypeIdentifier identifier;
+        fastrtps::types::TypeObject object;
+    };
+
+    TypeLookupCache() = default;
+
+    static bool make_key(
+            const fastrtps::types::TypeIdentifier& identifier,
+            Key& key);
+
+    mutable std::mutex mutex_;
+
+    std::map<Key, Entry> types_;
+
+    std::atomic<uint64_t> hits_{0};
+
+    std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace builtin
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TYPELOOKUP_SERVICE_CACHE_HPP_
@@ -30,9 +30,12 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipantListener.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 // TODO Uncomment if security is implemented.
 //#include <fastdds/rtps/common/Guid.h>
@@ -40,9 +43,11 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastdds/builtin/typelookup/TypeLookupCache.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <algorithm>
+#include <cstdlib>
 
 namespace eprosima {
 
@@ -75,6 +80,9 @@ TypeLookupManager::TypeLookupManager(
     , temp_writer_proxy_data_(
         prot->mp_participantImpl->getRTPSParticipantAttributes().allocation.locators.max_unicast_locators,
         prot->mp_participantImpl->getRTPSParticipantAttributes().allocation.locators.max_multicast_locators)
+    , types_request_event_(nullptr)
+    , types_reply_event_(nullptr)
+    , types_reply_timeout_(std::chrono::seconds(10))
     /* TODO Uncomment if security is implemented
      #if HAVE_SECURITY
         , builtin_request_writer_secure_(nullptr)
@@ -92,6 +100,13 @@ TypeLookupManager::TypeLookupManager(
 
 TypeLookupManager::~TypeLookupManager()
 {
+    delete types_request_event_;
+    delete types_reply_event_;
+    if (!cache_file_.empty())
+    {
+        TypeLookupCache::get_instance().save(cache_file_);
+    }
+
     /* TODO Uncomment if security is implemented
      #if HAVE_SECURITY
         participant_->deleteUserEndpoint(builtin_request_writer_secure_);
@@ -134,6 +149,67 @@ bool TypeLookupManager::init_typelookup_service(
 {
     EPROSIMA_LOG_INFO(TYPELOOKUP_SERVICE, "Initializing TypeLookup Service");
     participant_ = participant;
+
+    const PropertyPolicy& properties = participant->getRTPSParticipantAttributes().properties;
+    double batch_period_ms = 5;
+    const std::string* batch_property = PropertyPolicyHelper::find_property(properties,
+                    "fastdds.typelookup.batch_period");
+    if (nullptr != batch_property)
+    {
+        char* ptr = nullptr;
+        unsigned long period = strtoul(batch_property->c_str(), &ptr, 10);
+
+        if (batch_property->c_str() != ptr)     // A valid integer was read.
+        {
+            batch_period_ms = static_cast<double>(period);
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(TYPELOOKUP_SERVICE,
+                    "Not numerical value for fastdds.typelookup.batch_period property. Using default period");
+        }
+    }
+    types_request_event_ = new TimedEvent(participant->getEventResource(),
+                    [this]() -> bool
+                    {
+                        send_types_requests();
+                        return false;
+                    },
+                    batch_period_ms);
+
+    const std::string* timeout_property = PropertyPolicyHelper::find_property(properties,
+                    "fastdds.typelookup.reply_timeout");
+    if (nullptr != timeout_property)
+    {
+        char* ptr = nullptr;
+        unsigned long timeout = strtoul(timeout_property->c_str(), &ptr, 10);
+
+        if (timeout_property->c_str() != ptr)     // A valid integer was read.
+        {
+            types_reply_timeout_ = std::chrono::milliseconds(timeout);
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(TYPELOOKUP_SERVICE,
+                    "Not numerical value for fastdds.typelookup.reply_timeout property. Using default timeout");
+        }
+    }
+    types_reply_event_ = new TimedEvent(participant->getEventResource(),
+                    [this]() -> bool
+                    {
+                        return expire_types_requests();
+                    },
+                    static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        types_reply_timeout_).count()));
+
+    const std::string* cache_property = PropertyPolicyHelper::find_property(properties,
+                    "fastdds.typelookup.cache_file");
+    if (nullptr != cache_property && !cache_property->empty())
+    {
+        cache_file_ = *cache_property;
+        TypeLookupCache::get_instance().load(cache_file_);
+    }
+
     bool retVal = create_endpoints();
     /*
      #if HAVE_SECURITY
@@ -505,21 +581,182 @@ SampleIdentity TypeLookupManager::get_types(
     SampleIdentity id = INVALID_SAMPLE_IDENTITY;
     if (builtin_protocols_->m_att.typelookup_config.use_client)
     {
-        TypeLookup_getTypes_In in;
-        in.type_ids = id_seq;
-        TypeLookup_RequestTypeSupport type;
-        TypeLookup_Request* request = static_cast<TypeLookup_Request*>(type.create_data());
-        request->data.getTypes(in);
-
-        if (send_request(*request))
+        id = next_request_id();
         {
-            id = request->header.requestId;
+            std::lock_guard<std::mutex> guard(types_requests_mutex_);
+            queued_types_requests_.push_back({id, id_seq});
         }
-        type.delete_data(request);
+        // Does nothing if already waiting, so the request joins the current batch.
+        types_request_event_->restart_timer();
     }
     return id;
 }
 
+void TypeLookupManager::send_types_requests()
+{
+    TypeLookupCache& cache = TypeLookupCache::get_instance();
+    std::vector<std::pair<SampleIdentity, fastrtps::types::TypeIdentifierTypeObjectPair>> cached;
+    TypeLookup_getTypes_In in;
+    std::vector<TypesRequest> waiting;
+
+    {
+        std::lock_guard<std::mutex> guard(types_requests_mutex_);
+        for (TypesRequest& queued : queued_types_requests_)
+        {
+            TypesRequest pending {queued.id, {}};
+            for (const fastrtps::types::TypeIdentifier& type_id : queued.type_ids)
+            {
+                fastrtps::types::TypeIdentifierTypeObjectPair pair;
+                if (cache.get_type(type_id, pair.type_object()))
+                {
+                    pair.type_identifier(type_id);
+                    cached.emplace_back(queued.id, std::move(pair));
+                    continue;
+                }
+
+                pending.type_ids.push_back(type_id);
+                if (std::find(in.type_ids.begin(), in.type_ids.end(), type_id) == in.type_ids.end())
+                {
+                    in.type_ids.push_back(type_id);
+                }
+            }
+
+            if (!pending.type_ids.empty())
+            {
+                waiting.push_back(std::move(pending));
+            }
+        }
+
+        EPROSIMA_LOG_INFO(TYPELOOKUP_SERVICE, "Batching " << queued_types_requests_.size() << " getTypes requests: "
+                << cached.size() << " types from cache, " << in.type_ids.size() << " types requested");
+        queued_types_requests_.clear();
+
+        if (!in.type_ids.empty())
+        {
+            TypeLookup_Request* request = static_cast<TypeLookup_Request*>(request_type_.create_data());
+            request->data.getTypes(in);
+
+            if (send_request(*request))
+            {
+                SentTypesRequest& sent = sent_types_requests_[request->header.requestId];
+                sent.expiration = std::chrono::steady_clock::now() + types_reply_timeout_;
+                sent.waiting = std::move(waiting);
+                // Does nothing if already waiting, as it is restarted while requests are left.
+                types_reply_event_->restart_timer();
+            }
+            else
+            {
+                EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "Cannot send getTypes request");
+            }
+            request_type_.delete_data(request);
+        }
+    }
+
+    for (const auto& type : cached)
+    {
+        notify_type_discovery(type.first, type.second);
+    }
+}
+
+void TypeLookupManager::on_types_reply(
+        const SampleIdentity& request_id,
+        const TypeLookup_getTypes_Out& out)
+{
+    TypeLookupCache& cache = TypeLookupCache::get_instance();
+    std::vector<std::pair<SampleIdentity, const fastrtps::types::TypeIdentifierTypeObjectPair*>> received;
+
+    {
+        std::lock_guard<std::mutex> guard(types_requests_mutex_);
+        auto sent = sent_types_requests_.find(request_id);
+        if (sent == sent_types_requests_.end())
+        {
+            // Not one of our requests, or already replied by other servers
+            return;
+        }
+
+        for (const fastrtps::types::TypeIdentifierTypeObjectPair& pair : out.types)
+        {
+            if (pair.type_object()._d() != fastrtps::types::EK_COMPLETE) // Just in case
+            {
+                continue;
+            }
+
+            // Other servers may reply to the same request. Only the first reply of each type is notified.
+            bool requested = false;
+            for (TypesRequest& waiting : sent->second.waiting)
+            {
+                auto type_id = std::find(waiting.type_ids.begin(), waiting.type_ids.end(), pair.type_identifier());
+                if (type_id != waiting.type_ids.end())
+                {
+                    if (!requested && !TypeLookupCache::matches_hash(pair.type_identifier(), pair.type_object()))
+                    {
+                        EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "Ignoring TypeObject not matching its TypeIdentifier "
+                                << "on reply to request " << request_id);
+                        break;
+                    }
+                    requested = true;
+                    waiting.type_ids.erase(type_id);
+                    received.emplace_back(waiting.id, &pair);
+                }
+            }
+
+            if (requested)
+            {
+                cache.add_type(pair.type_identifier(), pair.type_object());
+            }
+        }
+
+        std::vector<TypesRequest>& waiting = sent->second.waiting;
+        waiting.erase(std::remove_if(waiting.begin(), waiting.end(),
+                [](const TypesRequest& request)
+                {
+                    return request.type_ids.empty();
+                }), waiting.end());
+        if (waiting.empty())
+        {
+            sent_types_requests_.erase(sent);
+        }
+    }
+
+    for (const auto& type : received)
+    {
+        notify_type_discovery(type.first, *type.second);
+    }
+}
+
+bool TypeLookupManager::expire_types_requests()
+{
+    std::lock_guard<std::mutex> guard(types_requests_mutex_);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for (auto sent = sent_types_requests_.begin(); sent != sent_types_requests_.end();)
+    {
+        if (sent->second.expiration <= now)
+        {
+            EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE, "getTypes request " << sent->first << " not replied in time");
+            sent = sent_types_requests_.erase(sent);
+        }
+        else
+        {
+            ++sent;
+        }
+    }
+    return !sent_types_requests_.empty();
+}
+
+void TypeLookupManager::notify_type_discovery(
+        const SampleIdentity& request_id,
+        const fastrtps::types::TypeIdentifierTypeObjectPair& pair)
+{
+    // If build_dynamic_type failed, just sent the nullptr already contained on it.
+    participant_->getListener()->on_type_discovery(
+        participant_->getUserRTPSParticipant(),
+        request_id,
+        "", // No topic_name available
+        &pair.type_identifier(),
+        &pair.type_object(),
+        fastrtps::types::DynamicType_ptr(nullptr));
+}
+
 std::string TypeLookupManager::get_instanceName() const
 {
     std::stringstream ss;
@@ -534,13 +771,21 @@ std::string TypeLookupManager::get_instanceName() const
     return "dds.builtin.TOS." + str;
 }
 
+SampleIdentity TypeLookupManager::next_request_id() const
+{
+    SampleIdentity id;
+    id.writer_guid(builtin_request_writer_->getGuid());
+    std::lock_guard<std::mutex> guard(request_seq_mutex_);
+    id.sequence_number(request_seq_number_);
+    ++request_seq_number_;
+    return id;
+}
+
 bool TypeLookupManager::send_request(
         TypeLookup_Request& req) const
 {
     req.header.instanceName = get_instanceName();
-    req.header.requestId.writer_guid(builtin_request_writer_->getGuid());
-    req.header.requestId.sequence_number(request_seq_number_);
-    ++request_seq_number_;
+    req.header.requestId = next_request_id();
 
     CacheChange_t* change = builtin_request_writer_->new_change(
         [&req]()
@@ -76,25 +76,14 @@ void TypeLookupReplyListener::onNewCacheChangeAdded(
             return;
         }
 
+        tlm_->participant_->on_startup_phase(fastdds::statistics::StartupPhase::TYPE_LOOKUP_REPLY,
+                tlm_->get_builtin_request_writer_guid(), change->writerGUID);
+
         switch (reply.return_value._d())
         {
             case TypeLookup_getTypes_Hash:
             {
-                const TypeLookup_getTypes_Out types = reply.return_value.getType().result();
-                for (auto pair : types.types)
-                {
-                    if (pair.type_object()._d() == EK_COMPLETE) // Just in case
-                    {
-                        // If build_dynamic_type failed, just sent the nullptr already contained on it.
-                        tlm_->participant_->getListener()->on_type_discovery(
-                            tlm_->participant_->getUserRTPSParticipant(),
-                            reply.header.requestId,
-                            "", // No topic_name available
-                            &pair.type_identifier(),
-                            &pair.type_object(),
-                            DynamicType_ptr(nullptr));
-                    }
-                }
+                tlm_->on_types_reply(reply.header.requestId, reply.return_value.getType().result());
                 // TODO Call a callback once the job is done
                 break;
             }
@@ -112,6 +112,40 @@ bool ParameterList::updateCacheChangeFromInlineQos(
     return readParameterListfromCDRMsg(*msg, parameter_process, false, qos_size);
 }
 
+bool ParameterList::hash_parameter_list(
+        const fastrtps::rtps::CDRMessage_t& msg,
+        bool use_encapsulation,
+        uint64_t& hash)
+{
+    auto parameter_process = [](
+        ParameterId_t,
+        uint16_t,
+        const fastrtps::rtps::octet*,
+        fastrtps::rtps::Endianness_t)
+            {
+                return true;
+            };
+
+    uint32_t qos_size = 0;
+    if (!read_parameter_views_from_cdr_msg(msg, parameter_process, use_encapsulation, qos_size))
+    {
+        return false;
+    }
+
+    // 64-bit FNV-1a over the whole list, so changes on any parameter (or on its order) are detected.
+    uint32_t length = qos_size + (use_encapsulation ? 4u : 0u);
+    const fastrtps::rtps::octet* data = &msg.buffer[msg.pos];
+    uint64_t value = 14695981039346656037ull;
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        value ^= data[i];
+        value *= 1099511628211ull;
+    }
+
+    hash = value;
+    return true;
+}
+
 bool ParameterList::read_guid_from_cdr_msg(
         fastrtps::rtps::CDRMessage_t& msg,
         uint16_t search_pid,
@@ -139,6 +139,105 @@ public:
         return true;
     }
 
+    /**
+     * Traverse a parameterList on a CDRMessage without deserializing nor copying any of the parameter values.
+     * @param[in] msg Reference to the message (the pos should be correct, otherwise the behaviour is undefined).
+     *                Neither the contents nor the pos of the message are modified.
+     * @param[in] processor Function to process each of the parameters in the list. It receives the parameter id,
+     *                      the parameter length, a pointer to the parameter value inside the message buffer, and the
+     *                      endianness of the list.
+     * @param[in] use_encapsulation Whether encapsulation field should be read.
+     * @param[out] qos_size Number of bytes of the list, including the PID_SENTINEL but not the encapsulation.
+     * @return true if the list is well formed up to its PID_SENTINEL and all parameters were processed,
+     * false otherwise.
+     */
+    template<typename Pred>
+    static bool read_parameter_views_from_cdr_msg(
+            const fastrtps::rtps::CDRMessage_t& msg,
+            Pred processor,
+            bool use_encapsulation,
+            uint32_t& qos_size)
+    {
+        qos_size = 0;
+
+        uint32_t pos = msg.pos;
+        fastrtps::rtps::Endianness_t endian = msg.msg_endian;
+        if (use_encapsulation)
+        {
+            if ((pos + 4) > msg.length)
+            {
+                return false;
+            }
+
+            fastrtps::rtps::octet encapsulation = msg.buffer[pos + 1];
+            if (encapsulation == PL_CDR_BE)
+            {
+                endian = fastrtps::rtps::Endianness_t::BIGEND;
+            }
+            else if (encapsulation == PL_CDR_LE)
+            {
+                endian = fastrtps::rtps::Endianness_t::LITTLEEND;
+            }
+            else
+            {
+                return false;
+            }
+            pos += 4;
+        }
+
+        auto read_uint16 = [endian](
+            const fastrtps::rtps::octet* data)
+                {
+                    return (endian == fastrtps::rtps::Endianness_t::BIGEND) ?
+                           static_cast<uint16_t>((data[0] << 8) | data[1]) :
+                           static_cast<uint16_t>((data[1] << 8) | data[0]);
+                };
+
+        while ((pos + qos_size + 4) <= msg.length)
+        {
+            const fastrtps::rtps::octet* header = &msg.buffer[pos + qos_size];
+            ParameterId_t pid = static_cast<ParameterId_t>(read_uint16(header));
+            uint16_t plength = read_uint16(header + 2);
+
+            if (pid == PID_SENTINEL)
+            {
+                // PID_SENTINEL is always considered of length 0
+                qos_size += 4;
+                return true;
+            }
+
+            if ((pos + qos_size + 4 + plength) > msg.length)
+            {
+                return false;
+            }
+
+            if (!processor(pid, plength, header + 4, endian))
+            {
+                return false;
+            }
+
+            // Align to 4 byte boundary and prepare for next iteration
+            qos_size = (qos_size + 4 + plength + 3) & ~3;
+        }
+
+        return false;
+    }
+
+    /**
+     * Compute a hash of the serialized contents of a parameterList on a CDRMessage.
+     * The list is only pre-scanned, so none of its parameters are deserialized.
+     * Two lists with the same hash can be considered to hold the same information.
+     * @param[in] msg Reference to the message (the pos should be correct, otherwise the behaviour is undefined).
+     *                Neither the contents nor the pos of the message are modified.
+     * @param[in] use_encapsulation Whether encapsulation field should be read.
+     * @param[out] hash Hash of the list, including its encapsulation when @c use_encapsulation is true.
+     * @return true if the list is well formed, false otherwise.
+     */
+    static bool hash_parameter_list(
+            const fastrtps::rtps::CDRMessage_t& msg,
+            bool use_encapsulation,
+            uint64_t& hash);
+
     /**
      * Read guid from the KEY_HASH or another specific PID parameter of a CDRMessage
      * @param[in,out] msg Reference to the message (pos should be correct, otherwise the behaviour is undefined).
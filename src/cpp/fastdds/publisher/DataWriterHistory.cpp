@@ -86,10 +86,14 @@ void DataWriterHistory::rebuild_instances()
 {
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
+        const SerializedPayload_t empty_payload;
         for (CacheChange_t* change : m_changes)
         {
             t_m_Inst_Caches::iterator vit;
-            if (find_or_add_key(change->instanceHandle, change->serializedPayload, &vit))
+            // Changes loaded lazily by the persistence service have no payload yet
+            const SerializedPayload_t& payload =
+                    (nullptr != change->payload_owner()) ? change->serializedPayload : empty_payload;
+            if (find_or_add_key(change->instanceHandle, payload, &vit))
             {
                 vit->second.cache_changes.push_back(change);
             }
@@ -124,7 +128,7 @@ fastrtps::rtps::SerializedPayload_t* DataWriterHistory::get_key_value(
         const fastrtps::rtps::InstanceHandle_t& handle)
 {
     t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
-    if (vit != keyed_changes_.end() && vit->second.is_registered())
+    if (vit != keyed_changes_.end() && vit->second.is_registered() && nullptr != vit->second.key_payload.data)
     {
         return &vit->second.key_payload;
     }
@@ -279,12 +283,15 @@ bool DataWriterHistory::find_or_add_key(
         const SerializedPayload_t& payload,
         t_m_Inst_Caches::iterator* vit_out)
 {
-    static_cast<void>(payload);
-
     t_m_Inst_Caches::iterator vit;
     vit = keyed_changes_.find(instance_handle);
     if (vit != keyed_changes_.end())
     {
+        // Instances rebuilt from changes loaded lazily get their key from the first sample with a payload
+        if (nullptr == vit->second.key_payload.data && nullptr != payload.data)
+        {
+            vit->second.key_payload.copy(&payload, false);
+        }
         *vit_out = vit;
         return true;
     }
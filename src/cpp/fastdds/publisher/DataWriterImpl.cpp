@@ -22,6 +22,7 @@
 
 #include <functional>
 #include <iostream>
+#include <string>
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -269,6 +270,23 @@ ReturnCode_t DataWriterImpl::enable()
         w_att.endpoint.properties.properties().push_back(std::move(property));
     }
 
+    // Deadline and lifespan in microseconds, used by the earliest deadline first flow controller scheduler.
+    if (qos_.deadline().period != c_TimeInfinite &&
+            nullptr == PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.sfc.deadline"))
+    {
+        property.name("fastdds.sfc.deadline");
+        property.value(std::to_string(qos_.deadline().period.to_ns() / 1000));
+        w_att.endpoint.properties.properties().push_back(std::move(property));
+    }
+
+    if (qos_.lifespan().duration != c_TimeInfinite &&
+            nullptr == PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.sfc.lifespan"))
+    {
+        property.name("fastdds.sfc.lifespan");
+        property.value(std::to_string(qos_.lifespan().duration.to_ns() / 1000));
+        w_att.endpoint.properties.properties().push_back(std::move(property));
+    }
+
     if (qos_.reliable_writer_qos().disable_positive_acks.enabled &&
             qos_.reliable_writer_qos().disable_positive_acks.duration != c_TimeInfinite)
     {
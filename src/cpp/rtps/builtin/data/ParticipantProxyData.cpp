@@ -19,6 +19,7 @@
 
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 
@@ -387,7 +388,8 @@ bool ParticipantProxyData::readFromCDRMessage(
         const NetworkFactory& network,
         bool is_shm_transport_available)
 {
-    auto param_process = [this, &network, &is_shm_transport_available](
+    bool has_announcement_hash = false;
+    auto param_process = [this, &network, &is_shm_transport_available, &has_announcement_hash](
         CDRMessage_t* msg, const ParameterId_t& pid, uint16_t plength)
             {
                 switch (pid)
@@ -641,6 +643,13 @@ bool ParticipantProxyData::readFromCDRMessage(
                         break;
                     }
 
+                    case fastdds::dds::PID_ANNOUNCEMENT_HASH:
+                    {
+                        // Vendor specific parameter, which may be anything else on other vendors
+                        has_announcement_hash = true;
+                        break;
+                    }
+
                     case fastdds::dds::PID_PARTICIPANT_SECURITY_INFO:
                     {
 #if HAVE_SECURITY
@@ -672,7 +681,20 @@ bool ParticipantProxyData::readFromCDRMessage(
     clear();
     try
     {
-        return ParameterList::readParameterListfromCDRMsg(*msg, param_process, use_encapsulation, qos_size);
+        if (!ParameterList::readParameterListfromCDRMsg(*msg, param_process, use_encapsulation, qos_size))
+        {
+            return false;
+        }
+
+        if (has_announcement_hash && (m_VendorId == c_VendorId_eProsima))
+        {
+            // Compact announcements do not carry the participant information, and should be resolved
+            // against the full announcement they stand for.
+            EPROSIMA_LOG_INFO(RTPS_PARTICIPANT, "Received a compact announcement");
+            return false;
+        }
+
+        return true;
     }
     catch (std::bad_alloc& ba)
     {
@@ -681,6 +703,114 @@ bool ParticipantProxyData::readFromCDRMessage(
     }
 }
 
+uint32_t ParticipantProxyData::get_compact_serialized_size(
+        bool include_encapsulation) const
+{
+    uint32_t ret_val = include_encapsulation ? 4 : 0;
+
+    // PID_PROTOCOL_VERSION
+    ret_val += 4 + 4;
+
+    // PID_VENDORID
+    ret_val += 4 + 4;
+
+    // PID_PARTICIPANT_GUID
+    ret_val += 4 + PARAMETER_GUID_LENGTH;
+
+    // PID_ANNOUNCEMENT_HASH
+    ret_val += 4 + 8;
+
+    // PID_SENTINEL
+    return ret_val + 4;
+}
+
+bool ParticipantProxyData::writeCompactToCDRMessage(
+        CDRMessage_t* msg,
+        bool write_encapsulation,
+        uint64_t announcement_hash) const
+{
+    if (write_encapsulation)
+    {
+        if (!ParameterList::writeEncapsulationToCDRMsg(msg))
+        {
+            return false;
+        }
+    }
+
+    {
+        ParameterProtocolVersion_t p(fastdds::dds::PID_PROTOCOL_VERSION, 4);
+        p.protocolVersion = this->m_protocolVersion;
+        if (!fastdds::dds::ParameterSerializer<ParameterProtocolVersion_t>::add_to_cdr_message(p, msg))
+        {
+            return false;
+        }
+    }
+    {
+        ParameterVendorId_t p(fastdds::dds::PID_VENDORID, 4);
+        p.vendorId[0] = this->m_VendorId[0];
+        p.vendorId[1] = this->m_VendorId[1];
+        if (!fastdds::dds::ParameterSerializer<ParameterVendorId_t>::add_to_cdr_message(p, msg))
+        {
+            return false;
+        }
+    }
+    {
+        ParameterGuid_t p(fastdds::dds::PID_PARTICIPANT_GUID, PARAMETER_GUID_LENGTH, m_guid);
+        if (!fastdds::dds::ParameterSerializer<ParameterGuid_t>::add_to_cdr_message(p, msg))
+        {
+            return false;
+        }
+    }
+    {
+        bool valid = CDRMessage::addUInt16(msg, fastdds::dds::PID_ANNOUNCEMENT_HASH);
+        valid &= CDRMessage::addUInt16(msg, 8);
+        valid &= CDRMessage::addUInt64(msg, announcement_hash);
+        if (!valid)
+        {
+            return false;
+        }
+    }
+
+    return fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_sentinel(msg);
+}
+
+bool ParticipantProxyData::readCompactAnnouncementHash(
+        const CDRMessage_t& msg,
+        bool use_encapsulation,
+        uint64_t& announcement_hash)
+{
+    bool is_compact = false;
+    bool is_eprosima = false;
+    auto param_process = [&is_compact, &is_eprosima, &announcement_hash](
+        const ParameterId_t pid,
+        uint16_t plength,
+        const octet* value,
+        Endianness_t endian)
+            {
+                if ((fastdds::dds::PID_VENDORID == pid) && (4 <= plength))
+                {
+                    is_eprosima = (c_VendorId_eProsima[0] == value[0]) && (c_VendorId_eProsima[1] == value[1]);
+                }
+                else if ((fastdds::dds::PID_ANNOUNCEMENT_HASH == pid) && (8 == plength))
+                {
+                    uint64_t hash = 0;
+                    for (uint16_t i = 0; i < 8; ++i)
+                    {
+                        uint16_t byte = (BIGEND == endian) ? i : static_cast<uint16_t>(7 - i);
+                        hash = (hash << 8) | value[byte];
+                    }
+                    announcement_hash = hash;
+                    is_compact = true;
+                }
+                return true;
+            };
+
+    uint32_t qos_size = 0;
+    // PID_ANNOUNCEMENT_HASH is vendor specific, so it is only meaningful on announcements from eProsima participants
+    return ParameterList::read_parameter_views_from_cdr_msg(msg, param_process, use_encapsulation, qos_size) &&
+           is_compact && is_eprosima;
+}
+
 void ParticipantProxyData::clear()
 {
     m_protocolVersion = ProtocolVersion_t();
@@ -709,6 +839,7 @@ void ParticipantProxyData::clear()
     m_properties.length = 0;
     m_userData.clear();
     m_userData.length = 0;
+    m_announcement_hash = 0;
 }
 
 void ParticipantProxyData::copy(
@@ -729,6 +860,7 @@ void ParticipantProxyData::copy(
     isAlive = pdata.isAlive;
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
+    m_announcement_hash = pdata.m_announcement_hash;
 
     // This method is only called when a new participant is discovered.The destination of the copy
     // will always be a new ParticipantProxyData or one from the pool, so there is no need for
@@ -751,6 +883,7 @@ bool ParticipantProxyData::updateData(
     isAlive = true;
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
+    m_announcement_hash = pdata.m_announcement_hash;
 #if HAVE_SECURITY
     identity_token_ = pdata.identity_token_;
     permissions_token_ = pdata.permissions_token_;
@@ -838,6 +971,31 @@ GUID_t ParticipantProxyData::get_persistence_guid() const
     return persistent;
 }
 
+void ParticipantProxyData::set_compact_announcements_support()
+{
+    if (!supports_compact_announcements())
+    {
+        m_properties.push_back(fastdds::dds::parameter_property_compact_announcements, "1");
+    }
+}
+
+bool ParticipantProxyData::supports_compact_announcements() const
+{
+    // Vendor specific properties are only meaningful when coming from eProsima participants
+    if (m_VendorId != c_VendorId_eProsima)
+    {
+        return false;
+    }
+
+    return std::any_of(
+        m_properties.begin(),
+        m_properties.end(),
+        [](const fastdds::dds::ParameterProperty_t& p)
+        {
+            return fastdds::dds::parameter_property_compact_announcements == p.first();
+        });
+}
+
 void ParticipantProxyData::set_sample_identity(
         const SampleIdentity& sid)
 {
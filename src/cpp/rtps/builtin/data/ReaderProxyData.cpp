@@ -104,6 +104,7 @@ ReaderProxyData::ReaderProxyData(
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
     , content_filter_(readerInfo.content_filter_)
+    , announcement_hash_(readerInfo.announcement_hash_)
 {
     if (readerInfo.m_type_id)
     {
@@ -145,6 +146,7 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
     content_filter_ = readerInfo.content_filter_;
+    announcement_hash_ = readerInfo.announcement_hash_;
 
     if (readerInfo.m_type_id)
     {
@@ -1082,6 +1084,7 @@ void ReaderProxyData::clear()
     m_qos.clear();
     m_properties.clear();
     m_properties.length = 0;
+    announcement_hash_ = 0;
     content_filter_.filter_class_name = "";
     content_filter_.content_filtered_topic_name = "";
     content_filter_.related_topic_name = "";
@@ -1146,6 +1149,7 @@ void ReaderProxyData::copy(
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
     content_filter_ = rdata->content_filter_;
+    announcement_hash_ = rdata->announcement_hash_;
 
     if (rdata->m_type_id)
     {
@@ -88,6 +88,7 @@ WriterProxyData::WriterProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(writerInfo.m_properties)
+    , announcement_hash_(writerInfo.announcement_hash_)
 {
     if (writerInfo.m_type_id)
     {
@@ -136,6 +137,7 @@ WriterProxyData& WriterProxyData::operator =(
     persistence_guid_ = writerInfo.persistence_guid_;
     m_qos.setQos(writerInfo.m_qos, true);
     m_properties = writerInfo.m_properties;
+    announcement_hash_ = writerInfo.announcement_hash_;
 
     if (writerInfo.m_type_id)
     {
@@ -1060,6 +1062,7 @@ void WriterProxyData::clear()
     persistence_guid_ = c_Guid_Unknown;
     m_properties.clear();
     m_properties.length = 0;
+    announcement_hash_ = 0;
 
     if (m_type_id)
     {
@@ -1091,6 +1094,7 @@ void WriterProxyData::copy(
     m_topicKind = wdata->m_topicKind;
     persistence_guid_ = wdata->persistence_guid_;
     m_properties = wdata->m_properties;
+    announcement_hash_ = wdata->announcement_hash_;
 
     if (wdata->m_type_id)
     {
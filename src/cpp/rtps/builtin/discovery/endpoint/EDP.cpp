@@ -1105,6 +1105,8 @@ bool EDP::pairingReader(
 #else
                 if (R->matched_writer_add(*wdatait))
                 {
+                    mp_RTPSParticipant->on_startup_phase(fastdds::statistics::StartupPhase::ENDPOINT_MATCHED,
+                            R->getGuid(), wdatait->guid());
                     EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
                             "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
                             wdatait->remote_locators());
@@ -1201,6 +1203,8 @@ bool EDP::pairingWriter(
 #else
                 if (W->matched_reader_add(*rdatait))
                 {
+                    mp_RTPSParticipant->on_startup_phase(fastdds::statistics::StartupPhase::ENDPOINT_MATCHED,
+                            W->getGuid(), rdatait->guid());
                     EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
                             "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
                             rdatait->remote_locators());
@@ -1287,6 +1291,8 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
 #else
                         if (w.matched_reader_add(*rdata))
                         {
+                            mp_RTPSParticipant->on_startup_phase(fastdds::statistics::StartupPhase::ENDPOINT_MATCHED,
+                                    w.getGuid(), rdata->guid());
                             EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
                             "RP:" << rdata->guid() << " match W:" << w.getGuid() << ". RLoc:" <<
                                 rdata->remote_locators());
@@ -1431,6 +1437,8 @@ bool EDP::pairing_remote_reader_with_local_writer_after_security(
 
                     if (w.matched_reader_add(remote_reader_data))
                     {
+                        mp_RTPSParticipant->on_startup_phase(fastdds::statistics::StartupPhase::ENDPOINT_MATCHED,
+                                w.getGuid(), remote_reader_data.guid());
                         EPROSIMA_LOG_INFO(RTPS_EDP, "Valid Matching to local writer: " << writerGUID.entityId);
 
                         matched = true;
@@ -1494,6 +1502,8 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
 #else
                         if (r.matched_writer_add(*wdata))
                         {
+                            mp_RTPSParticipant->on_startup_phase(fastdds::statistics::StartupPhase::ENDPOINT_MATCHED,
+                                    r.getGuid(), wdata->guid());
                             EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
                             "WP:" << wdata->guid() << " match R:" << r.getGuid() << ". WLoc:" <<
                                 wdata->remote_locators());
@@ -1641,6 +1651,8 @@ bool EDP::pairing_remote_writer_with_local_reader_after_security(
                     // TODO(richiware) Implement and use move with attributes
                     if (r.matched_writer_add(remote_writer_data))
                     {
+                        mp_RTPSParticipant->on_startup_phase(fastdds::statistics::StartupPhase::ENDPOINT_MATCHED,
+                                r.getGuid(), remote_writer_data.guid());
                         EPROSIMA_LOG_INFO(RTPS_EDP, "Valid Matching to local reader: " << readerGUID.entityId);
 
                         matched = true;
@@ -1753,6 +1765,14 @@ bool EDP::checkTypeObject(
     if (wdata->has_type() && wdata->type().m_type_object._d() != static_cast<uint8_t>(0x00) &&
             rdata->has_type() && rdata->type().m_type_object._d() != static_cast<uint8_t>(0x00))
     {
+        // Equal hashed identifiers imply equal objects, avoiding the structural comparison
+        if (hasTypeIdentifier(wdata, rdata) &&
+                wdata->type_id().m_type_identifier._d() >= types::EK_MINIMAL &&
+                wdata->type_id().m_type_identifier == rdata->type_id().m_type_identifier)
+        {
+            return true;
+        }
+
         // TODO - Remove once XCDR or XCDR2 is implemented.
         /*
          * Currently consistency checks are applied to type structure and compatibility,
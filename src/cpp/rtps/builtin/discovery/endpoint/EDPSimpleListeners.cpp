@@ -64,7 +64,8 @@ void EDPBasePUBListener::add_writer_from_change(
         ReaderHistory* reader_history,
         CacheChange_t* change,
         EDP* edp,
-        bool release_change /*=true*/)
+        bool release_change /*=true*/,
+        uint64_t announcement_hash /*=0*/)
 {
     //LOAD INFORMATION IN DESTINATION WRITER PROXY DATA
     const NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
@@ -74,6 +75,8 @@ void EDPBasePUBListener::add_writer_from_change(
     if (temp_writer_data->readFromCDRMessage(&tempMsg, network,
             edp->mp_RTPSParticipant->has_shm_transport()))
     {
+        temp_writer_data->announcement_hash(announcement_hash);
+
         if (temp_writer_data->guid().guidPrefix == edp->mp_RTPSParticipant->getGuid().guidPrefix)
         {
             EPROSIMA_LOG_INFO(RTPS_EDP, "Message from own RTPSParticipant, ignoring");
@@ -125,6 +128,22 @@ void EDPBasePUBListener::add_writer_from_change(
     }
 }
 
+bool EDPBasePUBListener::is_known_writer_announcement(
+        const CacheChange_t* change,
+        EDP* edp,
+        uint64_t& announcement_hash)
+{
+    announcement_hash = 0;
+    CDRMessage_t tempMsg(change->serializedPayload);
+    if (!ParameterList::hash_parameter_list(tempMsg, true, announcement_hash) ||
+            !change->instanceHandle.isDefined())
+    {
+        return false;
+    }
+
+    return edp->mp_PDP->is_writer_announcement_known(iHandle2GUID(change->instanceHandle), announcement_hash);
+}
+
 void EDPSimplePUBListener::onNewCacheChangeAdded(
         RTPSReader* reader,
         const CacheChange_t* const change_in)
@@ -148,8 +167,16 @@ void EDPSimplePUBListener::onNewCacheChangeAdded(
     {
         PREVENT_PDP_DEADLOCK(reader, change, sedp_->mp_PDP);
 
+        uint64_t announcement_hash = 0;
+        if (is_known_writer_announcement(change, sedp_, announcement_hash))
+        {
+            EPROSIMA_LOG_INFO(RTPS_EDP, "Unchanged announcement for writer " << iHandle2GUID(change->instanceHandle));
+            reader_history->remove_change(change);
+            return;
+        }
+
         // Note: change is removed from history inside this method.
-        add_writer_from_change(reader, reader_history, change, sedp_);
+        add_writer_from_change(reader, reader_history, change, sedp_, true, announcement_hash);
     }
     else
     {
@@ -175,7 +202,8 @@ void EDPBaseSUBListener::add_reader_from_change(
         ReaderHistory* reader_history,
         CacheChange_t* change,
         EDP* edp,
-        bool release_change /*=true*/)
+        bool release_change /*=true*/,
+        uint64_t announcement_hash /*=0*/)
 {
     //LOAD INFORMATION IN TEMPORAL WRITER PROXY DATA
     const NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
@@ -185,6 +213,8 @@ void EDPBaseSUBListener::add_reader_from_change(
     if (temp_reader_data->readFromCDRMessage(&tempMsg, network,
             edp->mp_RTPSParticipant->has_shm_transport()))
     {
+        temp_reader_data->announcement_hash(announcement_hash);
+
         if (temp_reader_data->guid().guidPrefix == edp->mp_RTPSParticipant->getGuid().guidPrefix)
         {
             EPROSIMA_LOG_INFO(RTPS_EDP, "From own RTPSParticipant, ignoring");
@@ -239,6 +269,22 @@ void EDPBaseSUBListener::add_reader_from_change(
     }
 }
 
+bool EDPBaseSUBListener::is_known_reader_announcement(
+        const CacheChange_t* change,
+        EDP* edp,
+        uint64_t& announcement_hash)
+{
+    announcement_hash = 0;
+    CDRMessage_t tempMsg(change->serializedPayload);
+    if (!ParameterList::hash_parameter_list(tempMsg, true, announcement_hash) ||
+            !change->instanceHandle.isDefined())
+    {
+        return false;
+    }
+
+    return edp->mp_PDP->is_reader_announcement_known(iHandle2GUID(change->instanceHandle), announcement_hash);
+}
+
 void EDPSimpleSUBListener::onNewCacheChangeAdded(
         RTPSReader* reader,
         const CacheChange_t* const change_in)
@@ -262,8 +308,16 @@ void EDPSimpleSUBListener::onNewCacheChangeAdded(
     {
         PREVENT_PDP_DEADLOCK(reader, change, sedp_->mp_PDP);
 
+        uint64_t announcement_hash = 0;
+        if (is_known_reader_announcement(change, sedp_, announcement_hash))
+        {
+            EPROSIMA_LOG_INFO(RTPS_EDP, "Unchanged announcement for reader " << iHandle2GUID(change->instanceHandle));
+            reader_history->remove_change(change);
+            return;
+        }
+
         // Note: change is removed from history inside this method.
-        add_reader_from_change(reader, reader_history, change, sedp_);
+        add_reader_from_change(reader, reader_history, change, sedp_, true, announcement_hash);
     }
     else
     {
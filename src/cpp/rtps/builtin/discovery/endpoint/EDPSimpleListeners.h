@@ -79,7 +79,22 @@ protected:
             ReaderHistory* reader_history,
             CacheChange_t* change,
             EDP* edp,
-            bool release_change = true);
+            bool release_change = true,
+            uint64_t announcement_hash = 0);
+
+    /**
+     * Check whether a change holds the same announcement that was last processed for its writer,
+     * without deserializing it.
+     * @param change Pointer to the received change. Its instance handle should be already computed.
+     * @param edp Pointer to the EDP holding the known writer proxies.
+     * @param [out] announcement_hash Hash of the announcement held by the change, to be kept on the proxy when
+     * the change is processed.
+     * @return true if the full processing of the change can be skipped.
+     */
+    bool is_known_writer_announcement(
+            const CacheChange_t* change,
+            EDP* edp,
+            uint64_t& announcement_hash);
 };
 
 /**
@@ -101,7 +116,22 @@ protected:
             ReaderHistory* reader_history,
             CacheChange_t* change,
             EDP* edp,
-            bool release_change = true);
+            bool release_change = true,
+            uint64_t announcement_hash = 0);
+
+    /**
+     * Check whether a change holds the same announcement that was last processed for its reader,
+     * without deserializing it.
+     * @param change Pointer to the received change. Its instance handle should be already computed.
+     * @param edp Pointer to the EDP holding the known reader proxies.
+     * @param [out] announcement_hash Hash of the announcement held by the change, to be kept on the proxy when
+     * the change is processed.
+     * @return true if the full processing of the change can be skipped.
+     */
+    bool is_known_reader_announcement(
+            const CacheChange_t* change,
+            EDP* edp,
+            uint64_t& announcement_hash);
 };
 
 /*!
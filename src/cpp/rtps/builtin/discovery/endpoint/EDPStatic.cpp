@@ -130,7 +130,13 @@ bool EDPStatic::initEDP(
     else if (0 == content.rfind("file://", 0))
     {
         std::string file_name = content.substr(7);
-        returned_value =  (this->mp_edpXML->loadXMLFile(file_name) == xmlparser::XMLP_ret::XML_OK);
+        // Precompiled endpoint tables are loaded directly. Any other file is parsed as XML.
+        xmlparser::XMLP_ret ret = this->mp_edpXML->loadBinaryFile(file_name);
+        if (xmlparser::XMLP_ret::XML_NOK == ret)
+        {
+            ret = this->mp_edpXML->loadXMLFile(file_name);
+        }
+        returned_value = (ret == xmlparser::XMLP_ret::XML_OK);
     }
 
     // Check there is a Participant's property changing the exchange format.
@@ -102,6 +102,15 @@ bool DirectMessageSender::send(
                    Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
 }
 
+bool DirectMessageSender::send(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    return participant_->sendSync(buffers, total_bytes, participant_->getGuid(),
+                   Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -57,6 +57,7 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastdds/core/policy/ParameterList.hpp>
 #include <rtps/builtin/discovery/participant/PDPEndpoints.hpp>
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/network/ExternalLocatorsProcessor.hpp>
@@ -213,6 +214,9 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
         ret_val->isAlive = true;
         // Notify discovery of remote participant
         getRTPSParticipant()->on_entity_discovery(participant_guid, ret_val->m_properties);
+        getRTPSParticipant()->on_startup_phase(
+            fastdds::statistics::StartupPhase::REMOTE_PARTICIPANT_DISCOVERED, mp_RTPSParticipant->getGuid(),
+            participant_guid);
     }
     participant_proxies_.push_back(ret_val);
 
@@ -472,19 +476,47 @@ void PDP::announceParticipantState(
 
         if (!dispose)
         {
-            if (m_hasChangedLocalPDP.exchange(false) || new_change)
+            bool write_full = m_hasChangedLocalPDP.exchange(false) || new_change;
+            bool write_compact = false;
+
+            this->mp_mutex->lock();
+            if (!write_full && (0 < compact_announcements_full_period_))
+            {
+                // Periodic announcement with compact announcements enabled. Only one out of
+                // compact_announcements_full_period_ announcements carries the full participant data.
+                if (++periodic_announcements_since_full_ >= compact_announcements_full_period_)
+                {
+                    periodic_announcements_since_full_ = 0;
+                    write_full = compact_announcement_in_history_;
+                }
+                else
+                {
+                    write_compact = !compact_announcement_in_history_ &&
+                            remote_participants_support_compact_announcements_nts();
+                }
+            }
+            else if (write_full)
+            {
+                periodic_announcements_since_full_ = 0;
+            }
+
+            if (write_full || write_compact)
             {
-                this->mp_mutex->lock();
                 ParticipantProxyData* local_participant_data = getLocalParticipantProxyData();
                 InstanceHandle_t key = local_participant_data->m_key;
                 ParticipantProxyData proxy_data_copy(*local_participant_data);
+                uint64_t full_announcement_hash = full_announcement_hash_;
                 this->mp_mutex->unlock();
 
-                if (history.getHistorySize() > 0)
+                // The full announcement is kept on the history next to the compact one, so participants that
+                // match later receive the full announcement before the compact one.
+                while (!write_compact && history.getHistorySize() > 0)
                 {
                     history.remove_min_change();
                 }
-                uint32_t cdr_size = proxy_data_copy.get_serialized_size(true);
+                uint32_t cdr_size = write_compact ?
+                        proxy_data_copy.get_compact_serialized_size(true) :
+                        proxy_data_copy.get_serialized_size(true);
                 change = writer.new_change(
                     [cdr_size]() -> uint32_t
                     {
@@ -504,11 +536,29 @@ void PDP::announceParticipantState(
                     aux_msg.msg_endian =  LITTLEEND;
 #endif // if __BIG_ENDIAN__
 
-                    if (proxy_data_copy.writeToCDRMessage(&aux_msg, true))
+                    bool serialized = write_compact ?
+                            proxy_data_copy.writeCompactToCDRMessage(&aux_msg, true, full_announcement_hash) :
+                            proxy_data_copy.writeToCDRMessage(&aux_msg, true);
+                    if (serialized)
                     {
                         change->serializedPayload.length = (uint16_t)aux_msg.length;
 
+                        if (!write_compact)
+                        {
+                            // Keep the hash receivers will compute for this announcement
+                            aux_msg.pos = 0;
+                            fastdds::dds::ParameterList::hash_parameter_list(aux_msg, true, full_announcement_hash);
+                        }
+
+                        {
+                            std::lock_guard<std::recursive_mutex> guard(*this->mp_mutex);
+                            full_announcement_hash_ = full_announcement_hash;
+                            compact_announcement_in_history_ = write_compact;
+                        }
+
                         history.add_change(change, wparams);
+                        getRTPSParticipant()->on_startup_phase(
+                            fastdds::statistics::StartupPhase::FIRST_PDP_ANNOUNCEMENT, mp_RTPSParticipant->getGuid());
                     }
                     else
                     {
@@ -516,15 +566,19 @@ void PDP::announceParticipantState(
                     }
                 }
             }
-
+            else
+            {
+                this->mp_mutex->unlock();
+            }
         }
         else
         {
             this->mp_mutex->lock();
             ParticipantProxyData proxy_data_copy(*getLocalParticipantProxyData());
+            compact_announcement_in_history_ = false;
             this->mp_mutex->unlock();
 
-            if (history.getHistorySize() > 0)
+            while (history.getHistorySize() > 0)
             {
                 history.remove_min_change();
             }
@@ -562,6 +616,25 @@ void PDP::announceParticipantState(
     }
 }
 
+bool PDP::remote_participants_support_compact_announcements_nts() const
+{
+    // Participants unable to resolve a compact announcement would take it as a participant without locators
+    bool any_remote = false;
+    for (const ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix != mp_RTPSParticipant->getGuid().guidPrefix)
+        {
+            if (!pit->supports_compact_announcements())
+            {
+                return false;
+            }
+            any_remote = true;
+        }
+    }
+
+    return any_remote;
+}
+
 void PDP::stopParticipantAnnouncement()
 {
     if (resend_participant_info_event_)
@@ -593,6 +666,22 @@ bool PDP::has_reader_proxy_data(
     return false;
 }
 
+bool PDP::is_reader_announcement_known(
+        const GUID_t& reader,
+        uint64_t announcement_hash)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+    for (ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix == reader.guidPrefix)
+        {
+            auto it = pit->m_readers->find(reader.entityId);
+            return (it != pit->m_readers->end()) && (it->second->announcement_hash() == announcement_hash);
+        }
+    }
+    return false;
+}
+
 bool PDP::lookupReaderProxyData(
         const GUID_t& reader,
         ReaderProxyData& rdata)
@@ -628,6 +717,22 @@ bool PDP::has_writer_proxy_data(
     return false;
 }
 
+bool PDP::is_writer_announcement_known(
+        const GUID_t& writer,
+        uint64_t announcement_hash)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+    for (ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix == writer.guidPrefix)
+        {
+            auto it = pit->m_writers->find(writer.entityId);
+            return (it != pit->m_writers->end()) && (it->second->announcement_hash() == announcement_hash);
+        }
+    }
+    return false;
+}
+
 bool PDP::lookupWriterProxyData(
         const GUID_t& writer,
         WriterProxyData& wdata)
@@ -97,15 +97,50 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        CDRMessage_t msg(change->serializedPayload);
+
+        // Periodic announcements are usually identical to the last one received from the same participant.
+        // Pre-scan the parameter list and skip the full parsing when nothing has changed.
+        // Compact announcements directly carry the hash of the full announcement they stand for.
+        uint64_t announcement_hash = 0;
+        bool is_compact = ParticipantProxyData::readCompactAnnouncementHash(msg, true, announcement_hash);
+        if (is_compact || ParameterList::hash_parameter_list(msg, true, announcement_hash))
+        {
+            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+            {
+                if (guid == it->m_guid)
+                {
+                    if (it->m_announcement_hash == announcement_hash)
+                    {
+                        EPROSIMA_LOG_INFO(RTPS_PDP, "Unchanged announcement from " << guid << ", skipping");
+                        lock.unlock();
+                        parent_pdp_->builtin_endpoints_->remove_from_pdp_reader_history(change);
+                        return;
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (is_compact)
+        {
+            // The full announcement is needed. It will be received either periodically or when the remote
+            // participant discovers us.
+            EPROSIMA_LOG_INFO(RTPS_PDP, "Compact announcement from " << guid << " cannot be resolved, ignoring");
+            lock.unlock();
+            parent_pdp_->builtin_endpoints_->remove_from_pdp_reader_history(change);
+            return;
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
-        CDRMessage_t msg(change->serializedPayload);
         temp_participant_data_.clear();
         if (temp_participant_data_.readFromCDRMessage(&msg, true, parent_pdp_->getRTPSParticipant()->network_factory(),
                 parent_pdp_->getRTPSParticipant()->has_shm_transport()))
         {
             // After correctly reading it
+            temp_participant_data_.m_announcement_hash = announcement_hash;
             change->instanceHandle = temp_participant_data_.m_key;
             guid = temp_participant_data_.m_guid;
 
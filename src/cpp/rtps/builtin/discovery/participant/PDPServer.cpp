@@ -915,6 +915,8 @@ void PDPServer::announceParticipantState(
                     // Add our change to PDPWriterHistory
                     history.add_change(change, wp);
                     change->write_params = wp;
+                    getRTPSParticipant()->on_startup_phase(
+                        fastdds::statistics::StartupPhase::FIRST_PDP_ANNOUNCEMENT, mp_RTPSParticipant->getGuid());
 
                     // Update the database with our own data
                     if (discovery_db().update(
@@ -74,6 +74,9 @@ void PDPSimple::initializeParticipantProxyData(
 {
     PDP::initializeParticipantProxyData(participant_data);
 
+    // Compact announcements from other participants are resolved by PDPListener
+    participant_data->set_compact_announcements_support();
+
     if (getRTPSParticipant()->getAttributes().builtin.discovery_config.
                     use_SIMPLE_EndpointDiscoveryProtocol)
     {
@@ -117,6 +120,25 @@ void PDPSimple::initializeParticipantProxyData(
 bool PDPSimple::init(
         RTPSParticipantImpl* part)
 {
+    // Needed to size the history of the announcements
+    const std::string* compact_property = PropertyPolicyHelper::find_property(
+        part->getRTPSParticipantAttributes().properties, "fastdds.discovery.compact_announcements");
+    if (nullptr != compact_property)
+    {
+        char* ptr = nullptr;
+        unsigned long full_period = strtoul(compact_property->c_str(), &ptr, 10);
+
+        if (compact_property->c_str() != ptr)     // A valid integer was read.
+        {
+            compact_announcements_full_period_ = static_cast<uint32_t>(full_period);
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP,
+                    "Not numerical value for fastdds.discovery.compact_announcements property. Compact announcements disabled");
+        }
+    }
+
     // The DATA(p) must be processed after EDP endpoint creation
     if (!PDP::initPDP(part))
     {
@@ -237,11 +259,28 @@ void PDPSimple::announceParticipantState(
         StatelessWriter& writer = *(endpoints->writer.writer_);
         WriterHistory& history = *(endpoints->writer.history_);
 
+        SequenceNumber_t next_sequence_number = history.next_sequence_number();
         PDP::announceParticipantState(writer, history, new_change, dispose, wp);
 
-        if (!(dispose || new_change))
+        // When compact announcements are enabled, a periodic announcement may have added a change, which is
+        // already being sent.
+        if (!(dispose || new_change) && (next_sequence_number == history.next_sequence_number()))
         {
-            writer.unsent_changes_reset();
+            bool compact_announcement_in_history = false;
+            {
+                std::lock_guard<std::recursive_mutex> lock(*getMutex());
+                compact_announcement_in_history = compact_announcement_in_history_;
+            }
+
+            if (compact_announcement_in_history)
+            {
+                // Only the compact announcement, which follows the full one, is repeated
+                writer.unsent_changes_reset(next_sequence_number - 1);
+            }
+            else
+            {
+                writer.unsent_changes_reset();
+            }
         }
     }
 }
@@ -308,8 +347,9 @@ bool PDPSimple::createPDPEndpoints()
 
     //SPDP BUILTIN RTPSParticipant WRITER
     hatt.payloadMaxSize = mp_builtin->m_att.writerPayloadSize;
-    hatt.initialReservedCaches = 1;
-    hatt.maximumReservedCaches = 1;
+    // A compact announcement is kept next to the full one
+    hatt.initialReservedCaches = (0 < compact_announcements_full_period_) ? 2 : 1;
+    hatt.maximumReservedCaches = hatt.initialReservedCaches;
     hatt.memoryPolicy = mp_builtin->m_att.writerHistoryMemoryPolicy;
 
     PoolConfig writer_pool_cfg = PoolConfig::from_history_attributes(hatt);
@@ -447,7 +487,22 @@ void PDPSimple::assignRemoteEndpoints(
 
         if (pW != nullptr)
         {
-            pW->unsent_changes_reset();
+            bool compact_announcement_in_history = false;
+            {
+                std::lock_guard<std::recursive_mutex> lock(*getMutex());
+                compact_announcement_in_history = compact_announcement_in_history_;
+            }
+
+            if (compact_announcement_in_history && !pdata->supports_compact_announcements())
+            {
+                // The new participant cannot resolve a compact announcement, so stop sending them
+                announceParticipantState(true);
+            }
+            else
+            {
+                // The full announcement is sent before the compact one, if any
+                pW->unsent_changes_reset();
+            }
         }
         else
         {
@@ -93,6 +93,14 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr))));
                 break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr))));
+                break;
             default:
                 assert(false);
         }
@@ -132,6 +140,14 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr))));
                 break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr))));
+                break;
             default:
                 assert(false);
         }
@@ -3,16 +3,24 @@
 
 #include "FlowController.hpp"
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <limits>
 #include <map>
+#include <memory>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace eprosima {
 namespace fastdds {
@@ -81,6 +89,19 @@ struct FlowQueue
         return nullptr;
     }
 
+    /*!
+     * Returns the first change, new ones before old ones, which is not skipped.
+     *
+     * @param skip Predicate returning true for the changes which cannot be sent now.
+     */
+    template<typename Predicate>
+    fastrtps::rtps::CacheChange_t* get_next_change(
+            Predicate skip) noexcept
+    {
+        fastrtps::rtps::CacheChange_t* change = new_ones_.find_first(skip);
+        return nullptr != change ? change : old_ones_.find_first(skip);
+    }
+
     void add_interested_changes_to_queue() noexcept
     {
         // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
@@ -88,6 +109,21 @@ struct FlowQueue
         old_ones_.add_list(old_interested_);
     }
 
+    /*!
+     * Removes a change from the queue it is linked to.
+     * This function should be called with mutex_ locked.
+     */
+    static void remove_change(
+            fastrtps::rtps::CacheChange_t* change) noexcept
+    {
+        assert(change->writer_info.is_linked.load());
+        change->writer_info.previous->writer_info.next = change->writer_info.next;
+        change->writer_info.next->writer_info.previous = change->writer_info.previous;
+        change->writer_info.previous = nullptr;
+        change->writer_info.next = nullptr;
+        change->writer_info.is_linked.store(false);
+    }
+
 private:
 
     struct ListInfo
@@ -130,8 +166,10 @@ private:
         void add_change(
                 fastrtps::rtps::CacheChange_t* change) noexcept
         {
+            // Changes handed off through a FlowHandoffQueue are already marked as linked, but are not on any list.
             bool expected = false;
-            if (change->writer_info.is_linked.compare_exchange_strong(expected, true))
+            if (change->writer_info.is_linked.compare_exchange_strong(expected, true) ||
+                    nullptr == change->writer_info.previous)
             {
                 change->writer_info.previous = tail.writer_info.previous;
                 change->writer_info.previous->writer_info.next = change;
@@ -157,6 +195,22 @@ private:
             }
         }
 
+        template<typename Predicate>
+        fastrtps::rtps::CacheChange_t* find_first(
+                Predicate skip) noexcept
+        {
+            for (fastrtps::rtps::CacheChange_t* change = head.writer_info.next; &tail != change;
+                    change = change->writer_info.next)
+            {
+                if (!skip(change))
+                {
+                    return change;
+                }
+            }
+
+            return nullptr;
+        }
+
         fastrtps::rtps::CacheChange_t head;
         fastrtps::rtps::CacheChange_t tail;
     };
@@ -178,6 +232,66 @@ private:
     ListInfo old_ones_;
 };
 
+/*!
+ * Lock-free queue used by user threads to hand off new changes to the asynchronous threads.
+ *
+ * Any number of threads can push changes, but only one thread at a time can pop them, i.e. the one holding the flow
+ * controller's mutex. Pushed changes are marked as linked, and use writer_info.next as link, until they are popped and
+ * added to their writer's FlowQueue.
+ */
+struct FlowHandoffQueue
+{
+    ~FlowHandoffQueue() noexcept
+    {
+        assert(nullptr == head_.load());
+    }
+
+    /*!
+     * Pushes a change not linked to any queue.
+     *
+     * @return true if the queue was empty, so the consumer may be waiting and has to be notified.
+     */
+    bool push(
+            fastrtps::rtps::CacheChange_t* change) noexcept
+    {
+        change->writer_info.is_linked.store(true);
+        change->writer_info.previous = nullptr;
+        fastrtps::rtps::CacheChange_t* head = head_.load(std::memory_order_relaxed);
+        do
+        {
+            change->writer_info.next = head;
+        } while (!head_.compare_exchange_weak(head, change, std::memory_order_release, std::memory_order_relaxed));
+
+        return nullptr == head;
+    }
+
+    /*!
+     * Takes all the changes in the queue.
+     *
+     * @return First change, in push order. The rest are reached through writer_info.next.
+     */
+    fastrtps::rtps::CacheChange_t* pop_all() noexcept
+    {
+        fastrtps::rtps::CacheChange_t* change = head_.exchange(nullptr, std::memory_order_acquire);
+        fastrtps::rtps::CacheChange_t* first = nullptr;
+
+        // Changes were stacked, so reverse them.
+        while (nullptr != change)
+        {
+            fastrtps::rtps::CacheChange_t* next = change->writer_info.next;
+            change->writer_info.next = first;
+            first = change;
+            change = next;
+        }
+
+        return first;
+    }
+
+private:
+
+    std::atomic<fastrtps::rtps::CacheChange_t*> head_ {nullptr};
+};
+
 /** Classes used to specify FlowController's publication model **/
 
 //! Only sends new samples synchronously. There is no mechanism to send old ones.
@@ -197,9 +311,19 @@ struct FlowControllerAsyncPublishMode
 {
     FlowControllerAsyncPublishMode(
             fastrtps::rtps::RTPSParticipantImpl* participant,
-            const FlowControllerDescriptor*)
+            const FlowControllerDescriptor* descriptor)
         : group(participant, true)
     {
+        if (nullptr != descriptor)
+        {
+            for (uint32_t sender = 1; sender < descriptor->sender_threads; ++sender)
+            {
+                sender_groups.emplace_back(new fastrtps::rtps::RTPSMessageGroup(participant, true));
+            }
+
+            max_coalescing_delay = std::chrono::microseconds(descriptor->max_coalescing_delay_us);
+            max_coalescing_bytes = descriptor->max_coalescing_bytes;
+        }
     }
 
     virtual ~FlowControllerAsyncPublishMode()
@@ -209,12 +333,81 @@ struct FlowControllerAsyncPublishMode
             {
                 std::unique_lock<fastrtps::TimedMutex> lock(changes_interested_mutex);
                 running = false;
-                cv.notify_one();
+                cv.notify_all();
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
             }
-            thread.join();
         }
     }
 
+    //! Number of threads sending samples.
+    uint32_t sender_threads() const
+    {
+        return static_cast<uint32_t>(sender_groups.size()) + 1;
+    }
+
+    //! Group used by a sender thread to build its messages.
+    fastrtps::rtps::RTPSMessageGroup& sender_group(
+            uint32_t sender)
+    {
+        return 0 == sender ? group : *sender_groups[sender - 1];
+    }
+
+    //! Whether the sender threads keep their messages waiting for more samples.
+    bool coalescing() const
+    {
+        return 0 < max_coalescing_delay.count();
+    }
+
+    //! Message of a sender thread kept waiting for more samples.
+    struct PendingMessage
+    {
+        //! Time point when the message has to be sent. Max when no message is pending.
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        //! Bytes sent by the group when the message started. They change whenever the group flushes.
+        uint32_t sent_bytes = 0;
+    };
+
+    /*!
+     * Sends the message of a sender thread if enough bytes are pending or its first sample has waited enough.
+     * A new message starts whenever the group has flushed the previous one, i.e. when changing to another writer or
+     * when the message is full, so each message waits at most max_coalescing_delay.
+     *
+     * @param group Group of the sender thread.
+     * @param [in,out] pending Message of the sender thread, updated when a new message starts.
+     * @return true if the message is left waiting for more samples.
+     */
+    bool coalesce(
+            fastrtps::rtps::RTPSMessageGroup& group,
+            PendingMessage& pending)
+    {
+        uint32_t pending_bytes = group.get_pending_bytes();
+        if (0 == pending_bytes)
+        {
+            pending.deadline = std::chrono::steady_clock::time_point::max();
+            return false;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        uint32_t sent_bytes = group.get_current_bytes_processed() - pending_bytes;
+        if (std::chrono::steady_clock::time_point::max() == pending.deadline || sent_bytes != pending.sent_bytes)
+        {
+            pending.deadline = now + max_coalescing_delay;
+            pending.sent_bytes = sent_bytes;
+        }
+
+        if ((0 < max_coalescing_bytes && max_coalescing_bytes <= pending_bytes) || pending.deadline <= now)
+        {
+            group.flush_and_reset();
+            pending.deadline = std::chrono::steady_clock::time_point::max();
+            return false;
+        }
+
+        return true;
+    }
+
     bool fast_check_is_there_slot_for_change(
             fastrtps::rtps::CacheChange_t*) const
     {
@@ -238,17 +431,53 @@ struct FlowControllerAsyncPublishMode
     {
     }
 
-    std::thread thread;
+    template<typename Scheduler>
+    fastrtps::rtps::CacheChange_t* get_next_change(
+            Scheduler& sched)
+    {
+        return sched.get_next_change_nts();
+    }
+
+    bool destinations_ready(
+            const fastrtps::rtps::CacheChange_t*,
+            const fastrtps::rtps::LocatorSelectorSender&)
+    {
+        return true;
+    }
+
+    void delivery_starts()
+    {
+    }
+
+    void record_delivery(
+            const fastrtps::rtps::LocatorSelectorSender&)
+    {
+    }
+
+    std::vector<std::thread> threads;
 
     std::atomic_bool running {false};
 
     fastrtps::TimedConditionVariable cv;
 
+    //! Group of the first sender thread.
     fastrtps::rtps::RTPSMessageGroup group;
 
+    //! Groups of the rest of sender threads.
+    std::vector<std::unique_ptr<fastrtps::rtps::RTPSMessageGroup>> sender_groups;
+
+    //! Maximum time a message is kept waiting for more samples. Zero when not coalescing.
+    std::chrono::microseconds max_coalescing_delay {0};
+
+    //! Pending bytes making a message to be sent when coalescing. Zero for no limit.
+    uint32_t max_coalescing_bytes = 0;
+
     //! Mutex for interested samples to be added.
     fastrtps::TimedMutex changes_interested_mutex;
 
+    //! New samples waiting to be added to the scheduler.
+    FlowHandoffQueue new_changes;
+
     //! Used to warning async thread a writer wants to remove a sample.
     std::atomic<uint32_t> writers_interested_in_remove = {0};
 };
@@ -280,12 +509,46 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         max_bytes_per_period = descriptor->max_bytes_per_period;
         period_ms = std::chrono::milliseconds(descriptor->period_ms);
-        group.set_sent_bytes_limitation(static_cast<uint32_t>(max_bytes_per_period));
+        max_burst_bytes = descriptor->max_burst_bytes;
+
+        // The bandwidth is accounted on the group of a single thread.
+        if (!sender_groups.empty())
+        {
+            EPROSIMA_LOG_WARNING(RTPS_WRITER,
+                    "Flow controllers limiting the bandwidth only use one sender thread. Ignoring sender_threads");
+            sender_groups.clear();
+        }
+
+        // Messages are already sent when the bandwidth of the period is exhausted.
+        if (coalescing())
+        {
+            EPROSIMA_LOG_WARNING(RTPS_WRITER,
+                    "Flow controllers limiting the bandwidth do not coalesce. Ignoring max_coalescing_delay_us");
+            max_coalescing_delay = std::chrono::microseconds::zero();
+        }
+
+        if (0 < max_burst_bytes)
+        {
+            // Each delivery is limited to the burst size. The limitation per period applies to each destination.
+            bytes_per_us_ = static_cast<double>(max_bytes_per_period) /
+                    std::chrono::duration<double, std::micro>(period_ms).count();
+            group.set_sent_bytes_limitation(max_burst_bytes);
+        }
+        else
+        {
+            group.set_sent_bytes_limitation(static_cast<uint32_t>(max_bytes_per_period));
+        }
     }
 
     bool fast_check_is_there_slot_for_change(
             fastrtps::rtps::CacheChange_t* change)
     {
+        if (0 < max_burst_bytes)
+        {
+            // Checked on each destination by destinations_ready().
+            return true;
+        }
+
         // Not fragmented sample, the fast check is if the serialized payload fit.
         uint32_t size_to_check = change->serializedPayload.length;
 
@@ -321,6 +584,11 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
     bool wait(
             std::unique_lock<fastrtps::TimedMutex>& lock)
     {
+        if (0 < max_burst_bytes)
+        {
+            return wait_paced(lock);
+        }
+
         auto lapse = std::chrono::steady_clock::now() - last_period_;
         bool reset_limit = true;
 
@@ -350,21 +618,214 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
     void process_deliver_retcode(
             const fastrtps::rtps::DeliveryRetCode& ret_value)
     {
-        if (fastrtps::rtps::DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
+        // When pacing, the bytes sent before exceeding the burst size were taken from the destinations.
+        if (fastrtps::rtps::DeliveryRetCode::EXCEEDED_LIMIT == ret_value && 0 == max_burst_bytes)
         {
             force_wait_ = true;
         }
     }
 
+    /*!
+     * Returns the next change to be sent, skipping the ones of writers waiting for their destinations to be
+     * refilled.
+     */
+    template<typename Scheduler>
+    fastrtps::rtps::CacheChange_t* get_next_change(
+            Scheduler& sched)
+    {
+        if (0 < max_burst_bytes && !paced_writers_.empty())
+        {
+            // Forget the writers whose destinations have been refilled.
+            auto now = std::chrono::steady_clock::now();
+            paced_writers_.erase(std::remove_if(paced_writers_.begin(), paced_writers_.end(),
+                    [now](const PacedWriter& writer)
+                    {
+                        return writer.second <= now;
+                    }), paced_writers_.end());
+
+            if (!paced_writers_.empty())
+            {
+                return sched.get_next_change_nts([this](fastrtps::rtps::CacheChange_t* change)
+                               {
+                                   return paced_writers_.end() != std::find_if(paced_writers_.begin(),
+                                   paced_writers_.end(), [change](const PacedWriter& writer)
+                                   {
+                                       return writer.first == change->writerGUID;
+                                   });
+                               });
+            }
+        }
+
+        return sched.get_next_change_nts();
+    }
+
+    /*!
+     * Checks whether all the destinations currently selected by the writer of a change have tokens for it, or for
+     * its next fragment. When not, the writer is skipped until they are refilled.
+     *
+     * @return true when the change can be sent.
+     */
+    bool destinations_ready(
+            const fastrtps::rtps::CacheChange_t* change,
+            const fastrtps::rtps::LocatorSelectorSender& locator_selector)
+    {
+        if (0 == max_burst_bytes)
+        {
+            return true;
+        }
+
+        uint32_t size_to_check = change->serializedPayload.length;
+        if (0 != change->getFragmentCount())
+        {
+            size_to_check = change->getFragmentSize();
+        }
+        double needed = static_cast<double>(std::min(size_to_check, max_burst_bytes));
+
+        auto now = std::chrono::steady_clock::now();
+        auto ready = now;
+        locator_selector.locator_selector.for_each([&](const fastrtps::rtps::Locator_t& locator)
+                {
+                    TokenBucket& bucket = refill(locator, now);
+                    if (needed > bucket.tokens)
+                    {
+                        auto refilled = now + std::chrono::microseconds(
+                            static_cast<int64_t>((needed - bucket.tokens) / bytes_per_us_) + 1);
+                        ready = std::max(ready, refilled);
+                    }
+                });
+
+        if (ready > now)
+        {
+            paced_writers_.emplace_back(change->writerGUID, ready);
+            return false;
+        }
+
+        return true;
+    }
+
+    void delivery_starts()
+    {
+        if (0 < max_burst_bytes)
+        {
+            bytes_before_delivery_ = group.get_current_bytes_processed();
+        }
+    }
+
+    /*!
+     * Takes the bytes added to the group by a delivery from the tokens of the destinations selected by the writer.
+     * Tokens may become negative, i.e. when the selection changed on the delivery, delaying the destinations until
+     * the debt is refilled.
+     */
+    void record_delivery(
+            const fastrtps::rtps::LocatorSelectorSender& locator_selector)
+    {
+        if (0 == max_burst_bytes)
+        {
+            return;
+        }
+
+        double bytes = static_cast<double>(group.get_current_bytes_processed() - bytes_before_delivery_);
+        group.reset_current_bytes_processed();
+
+        auto now = std::chrono::steady_clock::now();
+        locator_selector.locator_selector.for_each([&](const fastrtps::rtps::Locator_t& locator)
+                {
+                    refill(locator, now).tokens -= bytes;
+                });
+    }
+
     int32_t max_bytes_per_period = 0;
 
     std::chrono::milliseconds period_ms;
 
+    uint32_t max_burst_bytes = 0;
+
 private:
 
+    struct TokenBucket
+    {
+        double tokens;
+        std::chrono::steady_clock::time_point last_refill;
+    };
+
+    //! Writer skipped until the time its destinations have tokens again.
+    using PacedWriter = std::pair<fastrtps::rtps::GUID_t, std::chrono::steady_clock::time_point>;
+
+    TokenBucket& refill(
+            const fastrtps::rtps::Locator_t& locator,
+            const std::chrono::steady_clock::time_point& now)
+    {
+        auto it = buckets_.find(locator);
+        if (buckets_.end() == it)
+        {
+            it = buckets_.emplace(locator, TokenBucket{static_cast<double>(max_burst_bytes), now}).first;
+        }
+        else
+        {
+            TokenBucket& bucket = it->second;
+            double refilled = bucket.tokens +
+                    std::chrono::duration<double, std::micro>(now - bucket.last_refill).count() * bytes_per_us_;
+            bucket.tokens = std::min(refilled, static_cast<double>(max_burst_bytes));
+            bucket.last_refill = now;
+        }
+
+        return it->second;
+    }
+
+    /*!
+     * Wait until there is a new change added, a skipped writer can send again or the period is exceeded.
+     *
+     * @return true if the period was exceeded.
+     */
+    bool wait_paced(
+            std::unique_lock<fastrtps::TimedMutex>& lock)
+    {
+        auto deadline = last_period_ + period_ms;
+        for (const PacedWriter& writer : paced_writers_)
+        {
+            deadline = std::min(deadline, writer.second);
+        }
+
+        cv.wait_until(lock, deadline);
+
+        auto now = std::chrono::steady_clock::now();
+        bool reset_limit = now - last_period_ >= period_ms;
+        if (reset_limit)
+        {
+            last_period_ = now;
+            group.reset_current_bytes_processed();
+
+            // Full buckets are the same as new ones, so they are not kept for destinations no longer used.
+            for (auto it = buckets_.begin(); it != buckets_.end();)
+            {
+                if (static_cast<double>(max_burst_bytes) <= refill(it->first, now).tokens)
+                {
+                    it = buckets_.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        return reset_limit;
+    }
+
     bool force_wait_ = false;
 
     std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
+
+    //! Bytes added to the tokens of each destination every microsecond.
+    double bytes_per_us_ = 0;
+
+    //! Tokens of each destination. Only used when max_burst_bytes is not 0.
+    std::map<fastrtps::rtps::Locator_t, TokenBucket> buckets_;
+
+    //! Writers skipped because some of their destinations have no tokens.
+    std::vector<PacedWriter> paced_writers_;
+
+    uint32_t bytes_before_delivery_ = 0;
 };
 
 
@@ -383,7 +844,9 @@ struct FlowControllerFifoSchedule
     {
     }
 
-    void work_done() const
+    void work_done(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*) const
     {
         // Do nothing
     }
@@ -415,6 +878,18 @@ struct FlowControllerFifoSchedule
         return queue_.get_next_change();
     }
 
+    /*!
+     * Returns the first sample in the queue which is not skipped.
+     *
+     * @param skip Predicate returning true for the changes which cannot be sent now.
+     */
+    template<typename Predicate>
+    fastrtps::rtps::CacheChange_t* get_next_change_nts(
+            Predicate skip)
+    {
+        return queue_.get_next_change(skip);
+    }
+
     /*!
      * Store the sample at the end of the list.
      *
@@ -435,6 +910,13 @@ struct FlowControllerFifoSchedule
     {
     }
 
+    bool sample_expired(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*) const
+    {
+        return false;
+    }
+
 private:
 
     //! Scheduler queue. FIFO scheduler only has one queue.
@@ -506,7 +988,9 @@ struct FlowControllerRoundRobinSchedule
         }
     }
 
-    void work_done()
+    void work_done(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*)
     {
         assert(0 < writers_queue_.size());
         assert(writers_queue_.end() != next_writer_);
@@ -555,6 +1039,25 @@ struct FlowControllerRoundRobinSchedule
         return ret_change;
     }
 
+    template<typename Predicate>
+    fastrtps::rtps::CacheChange_t* get_next_change_nts(
+            Predicate skip)
+    {
+        fastrtps::rtps::CacheChange_t* ret_change = nullptr;
+
+        if (0 < writers_queue_.size())
+        {
+            auto starting_it = next_writer_;     // For avoid loops.
+
+            do
+            {
+                ret_change = std::get<1>(*next_writer_).get_next_change(skip);
+            } while (nullptr == ret_change && starting_it != set_next_writer());
+        }
+
+        return ret_change;
+    }
+
     void add_interested_changes_to_queue_nts()
     {
         // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
@@ -573,6 +1076,13 @@ struct FlowControllerRoundRobinSchedule
     {
     }
 
+    bool sample_expired(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*) const
+    {
+        return false;
+    }
+
 private:
 
     iterator find(
@@ -640,7 +1150,9 @@ struct FlowControllerHighPrioritySchedule
         priorities_.erase(it);
     }
 
-    void work_done() const
+    void work_done(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*) const
     {
         // Do nothing
     }
@@ -674,12 +1186,29 @@ struct FlowControllerHighPrioritySchedule
         return ret_change;
     }
 
-    void add_interested_changes_to_queue_nts()
+    template<typename Predicate>
+    fastrtps::rtps::CacheChange_t* get_next_change_nts(
+            Predicate skip)
     {
-        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
-        for (auto& queue : writers_queue_)
+        fastrtps::rtps::CacheChange_t* ret_change = nullptr;
+
+        if (0 < writers_queue_.size())
         {
-            queue.second.add_interested_changes_to_queue();
+            for (auto it = writers_queue_.begin(); nullptr == ret_change && it != writers_queue_.end(); ++it)
+            {
+                ret_change = it->second.get_next_change(skip);
+            }
+        }
+
+        return ret_change;
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (auto& queue : writers_queue_)
+        {
+            queue.second.add_interested_changes_to_queue();
         }
     }
 
@@ -692,6 +1221,13 @@ struct FlowControllerHighPrioritySchedule
     {
     }
 
+    bool sample_expired(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*) const
+    {
+        return false;
+    }
+
 private:
 
     FlowQueue& find_queue(
@@ -794,15 +1330,18 @@ struct FlowControllerPriorityWithReservationSchedule
         priority_it->second.erase(writer_it);
     }
 
-    void work_done()
+    void work_done(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
     {
-        if (nullptr != writer_being_processed_)
+        // Account the change in the writer's reservation when it was scheduled because of it.
+        auto writer_it = writers_queue_.find(writer);
+        assert(writer_it != writers_queue_.end());
+        uint32_t size_to_check = get_size_to_check(change);
+
+        if (std::get<2>(writer_it->second) > (std::get<3>(writer_it->second) + size_to_check))
         {
-            assert(0 != size_being_processed_);
-            auto writer = writers_queue_.find(writer_being_processed_);
-            std::get<3>(writer->second) += size_being_processed_;
-            writer_being_processed_ = nullptr;
-            size_being_processed_ = 0;
+            std::get<3>(writer_it->second) += size_to_check;
         }
     }
 
@@ -827,6 +1366,16 @@ struct FlowControllerPriorityWithReservationSchedule
     }
 
     fastrtps::rtps::CacheChange_t* get_next_change_nts()
+    {
+        return get_next_change_nts([](fastrtps::rtps::CacheChange_t*)
+                       {
+                           return false;
+                       });
+    }
+
+    template<typename Predicate>
+    fastrtps::rtps::CacheChange_t* get_next_change_nts(
+            Predicate skip)
     {
         fastrtps::rtps::CacheChange_t* highest_priority = nullptr;
         fastrtps::rtps::CacheChange_t* ret_change = nullptr;
@@ -838,7 +1387,7 @@ struct FlowControllerPriorityWithReservationSchedule
                 for (auto writer_it : priority.second)
                 {
                     auto writer = writers_queue_.find(writer_it);
-                    fastrtps::rtps::CacheChange_t* change = std::get<0>(writer->second).get_next_change();
+                    fastrtps::rtps::CacheChange_t* change = std::get<0>(writer->second).get_next_change(skip);
 
                     if (nullptr == highest_priority)
                     {
@@ -849,17 +1398,9 @@ struct FlowControllerPriorityWithReservationSchedule
                     {
                         // Check if writer's next change can be processed because the writer's bandwidth reservation is
                         // enough.
-                        uint32_t size_to_check = change->serializedPayload.length;
-                        if (0 != change->getFragmentCount())
-                        {
-                            size_to_check = change->getFragmentSize();
-                        }
-
-                        if (std::get<2>(writer->second) > (std::get<3>(writer->second) + size_to_check))
+                        if (std::get<2>(writer->second) > (std::get<3>(writer->second) + get_size_to_check(change)))
                         {
                             ret_change = change;
-                            writer_being_processed_ = writer_it;
-                            size_being_processed_ = size_to_check;
                             break;
                         }
                     }
@@ -898,8 +1439,26 @@ struct FlowControllerPriorityWithReservationSchedule
         }
     }
 
+    bool sample_expired(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t*) const
+    {
+        return false;
+    }
+
 private:
 
+    static uint32_t get_size_to_check(
+            const fastrtps::rtps::CacheChange_t* change)
+    {
+        uint32_t size_to_check = change->serializedPayload.length;
+        if (0 != change->getFragmentCount())
+        {
+            size_to_check = change->getFragmentSize();
+        }
+        return size_to_check;
+    }
+
     using map_writers = std::unordered_map<fastrtps::rtps::RTPSWriter*, std::tuple<FlowQueue, int32_t, uint32_t,
                     uint32_t>>;
 
@@ -910,10 +1469,229 @@ private:
     map_priorities priorities_;
 
     uint32_t bandwidth_limit_ = 0;
+};
 
-    fastrtps::rtps::RTPSWriter* writer_being_processed_ = nullptr;
+//! Earliest deadline first scheduling
+struct FlowControllerEarliestDeadlineFirstSchedule
+{
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        assert(nullptr != writer);
+        assert(writers_queue_.end() == find(writer));
+        int64_t deadline_ns = get_duration_property(writer, "fastdds.sfc.deadline");
+        int64_t lifespan_ns = get_duration_property(writer, "fastdds.sfc.lifespan");
 
-    uint32_t size_being_processed_ = 0;
+        // A sample has to be sent before its lifespan expires, even when it has a later deadline.
+        if (0 < lifespan_ns && (0 == deadline_ns || lifespan_ns < deadline_ns))
+        {
+            deadline_ns = lifespan_ns;
+        }
+
+        writers_queue_.emplace_back(writer, FlowQueue(), deadline_ns, lifespan_ns);
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        assert(std::get<1>(*it).is_empty());
+        writers_queue_.erase(it);
+    }
+
+    void work_done(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        int64_t deadline_ns = std::get<2>(*it);
+
+        if (0 < deadline_ns && change->sourceTimestamp.to_ns() + deadline_ns < now_ns())
+        {
+            ++missed_deadlines_;
+        }
+    }
+
+    void add_new_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        std::get<1>(*it).add_new_sample(change);
+    }
+
+    void add_old_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        std::get<1>(*it).add_old_sample(change);
+    }
+
+    fastrtps::rtps::CacheChange_t* get_next_change_nts()
+    {
+        return get_next_change_nts([](fastrtps::rtps::CacheChange_t*)
+                       {
+                           return false;
+                       });
+    }
+
+    /*!
+     * Returns the sample with the earliest deadline among the next sample of each writer, which is the one whose
+     * source timestamp plus the writer's deadline, or lifespan when shorter, comes first.
+     * Samples of a writer keep their order, and samples of writers without deadline are sent after the rest.
+     * Samples whose lifespan has expired are returned first, so they are discarded as soon as possible.
+     *
+     * @param skip Predicate returning true for the changes which cannot be sent now.
+     */
+    template<typename Predicate>
+    fastrtps::rtps::CacheChange_t* get_next_change_nts(
+            Predicate skip)
+    {
+        fastrtps::rtps::CacheChange_t* ret_change = nullptr;
+        int64_t ret_due = std::numeric_limits<int64_t>::max();
+        int64_t now = now_ns();
+
+        for (auto& writer : writers_queue_)
+        {
+            FlowQueue& queue = std::get<1>(writer);
+            int64_t deadline_ns = std::get<2>(writer);
+            int64_t lifespan_ns = std::get<3>(writer);
+            fastrtps::rtps::CacheChange_t* change = queue.get_next_change(skip);
+
+            if (nullptr != change)
+            {
+                int64_t due = 0 < deadline_ns ?
+                        change->sourceTimestamp.to_ns() + deadline_ns : std::numeric_limits<int64_t>::max();
+
+                if (0 < lifespan_ns && change->sourceTimestamp.to_ns() + lifespan_ns <= now)
+                {
+                    due = std::numeric_limits<int64_t>::min();
+                }
+
+                if (nullptr == ret_change || due < ret_due ||
+                        (due == ret_due && change->sourceTimestamp < ret_change->sourceTimestamp))
+                {
+                    ret_change = change;
+                    ret_due = due;
+                }
+            }
+        }
+
+        return ret_change;
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (auto& queue : writers_queue_)
+        {
+            std::get<1>(queue).add_interested_changes_to_queue();
+        }
+    }
+
+    void set_bandwith_limitation(
+            uint32_t) const
+    {
+    }
+
+    void trigger_bandwidth_limit_reset() const
+    {
+    }
+
+    /*!
+     * Returns whether the lifespan of a sample has expired, so it has to be discarded instead of sent.
+     * The sample is counted as an expired sample.
+     */
+    bool sample_expired(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        int64_t lifespan_ns = std::get<3>(*it);
+
+        if (0 < lifespan_ns && change->sourceTimestamp.to_ns() + lifespan_ns <= now_ns())
+        {
+            ++expired_samples_;
+            return true;
+        }
+
+        return false;
+    }
+
+    //! Number of samples removed from the queue because their lifespan expired before they could be sent.
+    uint64_t get_expired_samples() const
+    {
+        return expired_samples_.load();
+    }
+
+    //! Number of samples sent after their deadline.
+    uint64_t get_missed_deadlines() const
+    {
+        return missed_deadlines_.load();
+    }
+
+private:
+
+    //! Writer, its queue, its deadline and its lifespan in nanoseconds. 0 means infinite.
+    using element = std::tuple<fastrtps::rtps::RTPSWriter*, FlowQueue, int64_t, int64_t>;
+    using container = std::vector<element>;
+    using iterator = container::iterator;
+
+    iterator find(
+            const fastrtps::rtps::RTPSWriter* writer)
+    {
+        return std::find_if(writers_queue_.begin(), writers_queue_.end(),
+                       [writer](const element& current_writer) -> bool
+                       {
+                           return writer == std::get<0>(current_writer);
+                       });
+    }
+
+    static int64_t get_duration_property(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::string& name)
+    {
+        int64_t duration_ns = 0;
+        auto property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+            writer->getAttributes().properties, name);
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            unsigned long long duration_us = strtoull(property->c_str(), &ptr, 10);
+
+            if (property->c_str() != ptr)     // A valid integer was read.
+            {
+                duration_ns = static_cast<int64_t>(duration_us) * 1000;
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                        "Not numerical value for " << name << " property. Set to infinite");
+            }
+        }
+
+        return duration_ns;
+    }
+
+    static int64_t now_ns()
+    {
+        fastrtps::rtps::Time_t now;
+        fastrtps::rtps::Time_t::now(now);
+        return now.to_ns();
+    }
+
+    container writers_queue_;
+
+    std::atomic<uint64_t> expired_samples_ {0};
+
+    std::atomic<uint64_t> missed_deadlines_ {0};
 };
 
 template<typename PublishMode, typename SampleScheduling>
@@ -976,8 +1754,8 @@ public:
             fastrtps::rtps::RTPSWriter* writer) override
     {
         std::unique_lock<fastrtps::TimedMutex> lock(mutex_);
+        unregister_writer_impl(lock, writer);
         writers_.erase(writer->getGuid());
-        unregister_writer_impl(writer);
     }
 
     /*
@@ -1036,6 +1814,12 @@ public:
         return get_max_payload_impl();
     }
 
+    //! Scheduler of the samples, i.e. for retrieving its counters.
+    const scheduler& get_scheduler() const
+    {
+        return sched;
+    }
+
 private:
 
     /*!
@@ -1048,8 +1832,11 @@ private:
         bool expected = false;
         if (async_mode.running.compare_exchange_strong(expected, true))
         {
-            // Code for initializing the asynchronous thread.
-            async_mode.thread = std::thread(&FlowControllerImpl::run, this);
+            // Code for initializing the asynchronous threads.
+            for (uint32_t sender = 0; sender < async_mode.sender_threads(); ++sender)
+            {
+                async_mode.threads.emplace_back(&FlowControllerImpl::run, this, sender);
+            }
         }
     }
 
@@ -1070,6 +1857,15 @@ private:
     {
         std::unique_lock<fastrtps::TimedMutex> in_lock(async_mode.changes_interested_mutex);
         sched.register_writer(writer);
+
+        if (1 < async_mode.sender_threads())
+        {
+            // Assign the writer to the thread with less writers.
+            sender_writers_.resize(async_mode.sender_threads(), 0);
+            auto sender_it = std::min_element(sender_writers_.begin(), sender_writers_.end());
+            ++(*sender_it);
+            writer_senders_[writer->getGuid()] = static_cast<uint32_t>(sender_it - sender_writers_.begin());
+        }
     }
 
     template<typename PubMode = PublishMode>
@@ -1083,49 +1879,90 @@ private:
     template<typename PubMode = PublishMode>
     typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     unregister_writer_impl(
+            std::unique_lock<fastrtps::TimedMutex>& lock,
             fastrtps::rtps::RTPSWriter* writer)
     {
+        auto is_busy = [this, writer]()
+                {
+                    return busy_writers_.end() != std::find(busy_writers_.begin(), busy_writers_.end(),
+                                   writer->getGuid());
+                };
+        if (is_busy())
+        {
+            // Wake up a thread keeping a message of the writer waiting for more samples, and wait for it to be sent.
+            ++writers_unregistering_;
+            {
+                std::unique_lock<fastrtps::TimedMutex> in_lock(async_mode.changes_interested_mutex);
+                async_mode.cv.notify_all();
+            }
+            busy_writers_cv_.wait(lock, [&is_busy]()
+                    {
+                        return !is_busy();
+                    });
+            --writers_unregistering_;
+        }
+
         std::unique_lock<fastrtps::TimedMutex> in_lock(async_mode.changes_interested_mutex);
+        // Handed off changes may be the writer's ones.
+        add_interested_changes_to_queue_nts();
         sched.unregister_writer(writer);
+
+        auto sender_it = writer_senders_.find(writer->getGuid());
+        if (writer_senders_.end() != sender_it)
+        {
+            --sender_writers_[sender_it->second];
+            writer_senders_.erase(sender_it);
+        }
     }
 
     template<typename PubMode = PublishMode>
     typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     unregister_writer_impl(
+            std::unique_lock<fastrtps::TimedMutex>&,
             fastrtps::rtps::RTPSWriter*)
     {
         // Do nothing.
     }
 
     /*!
-     * This function store internally the sample and wake up the async thread.
+     * This function hands off the sample to the async threads and wakes them up.
+     * The sample is added to the scheduler by an async thread, so no lock is taken unless they may be waiting.
+     * With strict real-time the lock is taken before handing off the sample, as a sample already handed off cannot
+     * be taken back when the lock is not acquired in time, and the async threads could miss the notification.
      *
      * @note Before calling this function, the change's writer mutex have to be locked.
      */
     template<typename PubMode = PublishMode>
     typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
     enqueue_new_sample_impl(
-            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::RTPSWriter*,
             fastrtps::rtps::CacheChange_t* change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
     {
-        bool ret_value = false;
         assert(!change->writer_info.is_linked.load());
-        // Sync delivery failed. Try to store for asynchronous delivery.
+        // Sync delivery failed. Store for asynchronous delivery.
 #if HAVE_STRICT_REALTIME
         std::unique_lock<fastrtps::TimedMutex> lock(async_mode.changes_interested_mutex, std::defer_lock);
-        if (lock.try_lock_until(max_blocking_time))
+        if (!lock.try_lock_until(max_blocking_time))
+        {
+            return false;
+        }
+
+        if (async_mode.new_changes.push(change))
+        {
+            async_mode.cv.notify_one();
+        }
 #else
         static_cast<void>(max_blocking_time);
-        std::unique_lock<fastrtps::TimedMutex> lock(async_mode.changes_interested_mutex);
-#endif // if HAVE_STRICT_REALTIME{
+        if (async_mode.new_changes.push(change))
         {
-            sched.add_new_sample(writer, change);
+            // The async threads only wait after finding the queue empty with changes_interested_mutex locked.
+            std::unique_lock<fastrtps::TimedMutex> lock(async_mode.changes_interested_mutex);
             async_mode.cv.notify_one();
-            ret_value = true;
         }
+#endif // if HAVE_STRICT_REALTIME
 
-        return ret_value;
+        return true;
     }
 
     /*! This function is used when PublishMode = FlowControllerPureSyncPublishMode.
@@ -1274,6 +2111,8 @@ private:
                 std::unique_lock<fastrtps::TimedMutex> interested_lock(async_mode.changes_interested_mutex);
 #endif // if HAVE_STRICT_REALTIME
                 {
+                    // The change may be still handed off.
+                    add_interested_changes_to_queue_nts();
 
                     // When blocked, both pointer are different than nullptr or equal.
                     assert((nullptr != change->writer_info.previous &&
@@ -1324,10 +2163,131 @@ private:
     }
 
     /*!
-     * Function run by the asynchronous thread.
+     * Adds the handed off new changes and the interested old ones to the scheduler's queues.
+     *
+     * @note Before calling this function, mutex_ and changes_interested_mutex have to be locked.
+     */
+    void add_interested_changes_to_queue_nts()
+    {
+        fastrtps::rtps::CacheChange_t* change = async_mode.new_changes.pop_all();
+        while (nullptr != change)
+        {
+            fastrtps::rtps::CacheChange_t* next = change->writer_info.next;
+            change->writer_info.next = nullptr;
+            auto writer_it = writers_.find(change->writerGUID);
+            assert(writers_.end() != writer_it);
+            sched.add_new_sample(writer_it->second, change);
+            change = next;
+        }
+
+        sched.add_interested_changes_to_queue_nts();
+    }
+
+    /*!
+     * Returns the next change to be sent by a thread.
+     * When there are several sender threads, a thread sends first the changes of its own writers, and then the ones of
+     * writers not being sent by another thread. Changes of a writer being sent by another thread are skipped, so each
+     * writer's changes are sent in order.
+     *
+     * @note Before calling this function, mutex_ has to be locked.
+     */
+    fastrtps::rtps::CacheChange_t* get_next_change_nts(
+            uint32_t sender)
+    {
+        if (1 == async_mode.sender_threads())
+        {
+            return async_mode.get_next_change(sched);
+        }
+
+        auto is_busy = [this](fastrtps::rtps::CacheChange_t* change)
+                {
+                    return busy_writers_.end() != std::find(busy_writers_.begin(), busy_writers_.end(),
+                                   change->writerGUID);
+                };
+
+        fastrtps::rtps::CacheChange_t* change = sched.get_next_change_nts(
+            [this, sender, &is_busy](fastrtps::rtps::CacheChange_t* change)
+            {
+                auto sender_it = writer_senders_.find(change->writerGUID);
+                return is_busy(change) || writer_senders_.end() == sender_it || sender != sender_it->second;
+            });
+
+        if (nullptr == change)
+        {
+            // Help the threads of other writers.
+            change = sched.get_next_change_nts(is_busy);
+        }
+
+        return change;
+    }
+
+    /*!
+     * Waits for new changes to be sent in the pending message of a sender thread, until it has to be sent.
+     * mutex_ is released while waiting, so other threads can register writers or deliver changes meanwhile. The writer
+     * of the pending message is kept on busy_writers_, so it is not unregistered until the thread stops waiting.
+     *
+     * @param sender Index of the thread.
+     * @param lock Lock of mutex_, which is locked again when returning.
+     * @param group Group of the thread.
+     * @param writer_guid GUID of the writer of the pending message.
+     * @param [in,out] pending Pending message of the thread.
+     * @return The next change to be sent, or nullptr if the pending message was sent or the thread has to stop
+     * waiting.
+     *
+     * @note Before calling this function, mutex_ has to be locked.
      */
-    void run()
+    fastrtps::rtps::CacheChange_t* wait_coalescing_nts(
+            uint32_t sender,
+            std::unique_lock<fastrtps::TimedMutex>& lock,
+            fastrtps::rtps::RTPSMessageGroup& group,
+            const fastrtps::rtps::GUID_t& writer_guid,
+            FlowControllerAsyncPublishMode::PendingMessage& pending)
+    {
+        fastrtps::rtps::CacheChange_t* change = nullptr;
+        std::unique_lock<fastrtps::TimedMutex> in_lock(async_mode.changes_interested_mutex);
+
+        while (nullptr == change && async_mode.running && 0 == async_mode.writers_interested_in_remove &&
+                0 == writers_unregistering_ && async_mode.coalesce(group, pending))
+        {
+            busy_writers_.push_back(writer_guid);
+            lock.unlock();
+            async_mode.cv.wait_until(in_lock, pending.deadline);
+
+            in_lock.unlock();
+            lock.lock();
+            in_lock.lock();
+            busy_writers_.erase(std::find(busy_writers_.begin(), busy_writers_.end(), writer_guid));
+            busy_writers_cv_.notify_all();
+
+            add_interested_changes_to_queue_nts();
+            change = get_next_change_nts(sender);
+        }
+
+        if (nullptr == change && 0 != group.get_pending_bytes())
+        {
+            // Stopped waiting before the delay, i.e. the writer is being unregistered.
+            group.flush_and_reset();
+            pending.deadline = std::chrono::steady_clock::time_point::max();
+        }
+
+        return change;
+    }
+
+    /*!
+     * Function run by each asynchronous thread.
+     *
+     * When there are several sender threads, mutex_ is released while a change is delivered, so other threads can
+     * deliver the changes of other writers meanwhile. The change is kept on the queue and its writer is marked as busy.
+     *
+     * @param sender Index of the thread.
+     */
+    void run(
+            uint32_t sender)
     {
+        fastrtps::rtps::RTPSMessageGroup& group = async_mode.sender_group(sender);
+        const bool parallel = 1 < async_mode.sender_threads();
+        FlowControllerAsyncPublishMode::PendingMessage pending_message;
+
         while (async_mode.running)
         {
             // There are writers interested in removing a sample.
@@ -1343,10 +2303,11 @@ private:
             {
                 std::unique_lock<fastrtps::TimedMutex> in_lock(async_mode.changes_interested_mutex);
                 // Add interested changes into the queue.
-                sched.add_interested_changes_to_queue_nts();
+                add_interested_changes_to_queue_nts();
 
                 while (async_mode.running &&
-                        (async_mode.force_wait() || nullptr == (change_to_process = sched.get_next_change_nts())))
+                        (async_mode.force_wait() ||
+                        nullptr == (change_to_process = get_next_change_nts(sender))))
                 {
                     // Release main mutex to allow registering/unregistering writers while this thread is waiting.
                     lock.unlock();
@@ -1360,19 +2321,19 @@ private:
                     {
                         sched.trigger_bandwidth_limit_reset();
                     }
-                    sched.add_interested_changes_to_queue_nts();
+                    add_interested_changes_to_queue_nts();
+                }
+
+                if (parallel && nullptr != change_to_process)
+                {
+                    // Several changes may have been handed off at once. Let another thread look for them.
+                    async_mode.cv.notify_one();
                 }
             }
 
             fastrtps::rtps::RTPSWriter* current_writer = nullptr;
             while (nullptr != change_to_process)
             {
-                // Fast check if next change will enter.
-                if (!async_mode.fast_check_is_there_slot_for_change(change_to_process))
-                {
-                    break;
-                }
-
                 if (nullptr == current_writer || current_writer->getGuid() != change_to_process->writerGUID)
                 {
                     auto writer_it = writers_.find(change_to_process->writerGUID);
@@ -1386,33 +2347,85 @@ private:
                     break;
                 }
 
+                if (sched.sample_expired(current_writer, change_to_process))
+                {
+                    // The writer tells its readers the change will not be sent.
+                    FlowQueue::remove_change(change_to_process);
+                    current_writer->discard_change_nts(change_to_process);
+                    current_writer->getMutex().unlock();
+                    change_to_process = get_next_change_nts(sender);
+                    continue;
+                }
+
+                // Fast check if next change will enter.
+                if (!async_mode.fast_check_is_there_slot_for_change(change_to_process))
+                {
+                    current_writer->getMutex().unlock();
+                    break;
+                }
+
                 fastrtps::rtps::LocatorSelectorSender& locator_selector =
                         current_writer->get_async_locator_selector();
-                async_mode.group.sender(current_writer, &locator_selector);
+                group.sender(current_writer, &locator_selector);
                 locator_selector.lock();
 
-                // Remove previously from queue, because deliver_sample_nts could call FlowController::remove_sample()
-                // provoking a deadlock.
-                fastrtps::rtps::CacheChange_t* previous = change_to_process->writer_info.previous;
-                fastrtps::rtps::CacheChange_t* next = change_to_process->writer_info.next;
-                previous->writer_info.next = next;
-                next->writer_info.previous = previous;
-                change_to_process->writer_info.previous = nullptr;
-                change_to_process->writer_info.next = nullptr;
-                change_to_process->writer_info.is_linked.store(false);
+                if (!async_mode.destinations_ready(change_to_process, locator_selector))
+                {
+                    // Try with the changes of other writers.
+                    locator_selector.unlock();
+                    current_writer->getMutex().unlock();
+                    change_to_process = get_next_change_nts(sender);
+                    continue;
+                }
+
+                fastrtps::rtps::CacheChange_t* previous = nullptr;
+                fastrtps::rtps::CacheChange_t* next = nullptr;
+                if (parallel)
+                {
+                    busy_writers_.push_back(change_to_process->writerGUID);
+                    lock.unlock();
+                }
+                else
+                {
+                    // Remove previously from queue, because deliver_sample_nts could call
+                    // FlowController::remove_sample() provoking a deadlock.
+                    previous = change_to_process->writer_info.previous;
+                    next = change_to_process->writer_info.next;
+                    FlowQueue::remove_change(change_to_process);
+                }
 
+                async_mode.delivery_starts();
                 fastrtps::rtps::DeliveryRetCode ret_delivery = current_writer->deliver_sample_nts(
-                    change_to_process, async_mode.group, locator_selector,
+                    change_to_process, group, locator_selector,
                     std::chrono::steady_clock::now() + std::chrono::hours(24));
+                async_mode.record_delivery(locator_selector);
+
+                if (parallel)
+                {
+                    lock.lock();
+                    busy_writers_.erase(std::find(busy_writers_.begin(), busy_writers_.end(),
+                            change_to_process->writerGUID));
+                    busy_writers_cv_.notify_all();
+
+                    // The change may have been removed while it was being delivered.
+                    if (fastrtps::rtps::DeliveryRetCode::DELIVERED == ret_delivery &&
+                            change_to_process->writer_info.is_linked.load())
+                    {
+                        FlowQueue::remove_change(change_to_process);
+                    }
+                }
 
                 if (fastrtps::rtps::DeliveryRetCode::DELIVERED != ret_delivery)
                 {
-                    // If delivery fails, put the change again in the queue.
-                    change_to_process->writer_info.is_linked.store(true);
-                    previous->writer_info.next = change_to_process;
-                    next->writer_info.previous = change_to_process;
-                    change_to_process->writer_info.previous = previous;
-                    change_to_process->writer_info.next = next;
+                    if (!parallel)
+                    {
+                        // If delivery fails, put the change again in the queue.
+                        change_to_process->writer_info.is_linked.store(true);
+                        previous->writer_info.next = change_to_process;
+                        next->writer_info.previous = change_to_process;
+                        change_to_process->writer_info.previous = previous;
+                        change_to_process->writer_info.next = next;
+                    }
 
                     async_mode.process_deliver_retcode(ret_delivery);
 
@@ -1425,7 +2438,9 @@ private:
                 locator_selector.unlock();
                 current_writer->getMutex().unlock();
 
-                sched.work_done();
+                sched.work_done(current_writer, change_to_process);
+
+                bool coalescing = async_mode.coalescing() && async_mode.coalesce(group, pending_message);
 
                 if (0 != async_mode.writers_interested_in_remove)
                 {
@@ -1436,13 +2451,21 @@ private:
                 // Add interested changes into the queue.
                 {
                     std::unique_lock<fastrtps::TimedMutex> in_lock(async_mode.changes_interested_mutex);
-                    sched.add_interested_changes_to_queue_nts();
+                    add_interested_changes_to_queue_nts();
                 }
 
-                change_to_process = sched.get_next_change_nts();
+                change_to_process = get_next_change_nts(sender);
+
+                if (nullptr == change_to_process && coalescing)
+                {
+                    // Wait for more samples to send in the same message.
+                    change_to_process = wait_coalescing_nts(sender, lock, group, current_writer->getGuid(),
+                                    pending_message);
+                }
             }
 
-            async_mode.group.sender(nullptr, nullptr);
+            group.sender(nullptr, nullptr);
+            pending_message.deadline = std::chrono::steady_clock::time_point::max();
         }
     }
 
@@ -1450,6 +2473,12 @@ private:
     typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
     get_max_payload_impl()
     {
+        // When pacing, a delivery cannot exceed the burst size.
+        if (0 < async_mode.max_burst_bytes)
+        {
+            return std::min(static_cast<uint32_t>(async_mode.max_bytes_per_period), async_mode.max_burst_bytes);
+        }
+
         return static_cast<uint32_t>(async_mode.max_bytes_per_period);
     }
 
@@ -1468,6 +2497,22 @@ private:
 
     scheduler sched;
 
+    //! Sender thread assigned to each writer, when there are several.
+    std::map<fastrtps::rtps::GUID_t, uint32_t> writer_senders_;
+
+    //! Number of writers assigned to each sender thread.
+    std::vector<uint32_t> sender_writers_;
+
+    //! Writers whose changes are being delivered, or whose message is waiting for more samples, by a thread without
+    //! holding mutex_.
+    std::vector<fastrtps::rtps::GUID_t> busy_writers_;
+
+    //! Notified when a writer stops being busy.
+    fastrtps::TimedConditionVariable busy_writers_cv_;
+
+    //! Number of writers being unregistered while busy. Threads waiting for more samples stop waiting meanwhile.
+    uint32_t writers_unregistering_ = 0;
+
     // async_mode must be destroyed before sched.
     publish_mode async_mode;
 };
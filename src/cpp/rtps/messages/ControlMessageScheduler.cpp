@@ -0,0 +1,385 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessageScheduler.cpp
+ */
+
+#include <rtps/messages/ControlMessageScheduler.hpp>
+
+#include <cassert>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/Endpoint.h>
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/resources/TimedEvent.h>
+#include <fastrtps/utils/TimeConversion.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+ControlMessageGroup::ControlMessageGroup(
+        RTPSParticipantImpl* participant)
+    : participant_(participant)
+    , participant_guid_(participant->getGuid().guidPrefix, c_EntityId_RTPSParticipant)
+    , group_(new RTPSMessageGroup(participant))
+{
+}
+
+ControlMessageGroup::~ControlMessageGroup()
+{
+    try
+    {
+        group_.reset();
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Max blocking time reached");
+    }
+}
+
+RTPSMessageGroup& ControlMessageGroup::use(
+        Endpoint* endpoint,
+        RTPSMessageSenderInterface* sender,
+        const std::vector<Locator_t>& destinations)
+{
+    if (nullptr == endpoint_sender_)
+    {
+        group_->sender(endpoint, this);
+    }
+    else if (destinations != destinations_)
+    {
+        group_->flush_and_reset();
+    }
+
+    destinations_ = destinations;
+    endpoint_sender_ = sender;
+    group_->endpoint(endpoint);
+    return *group_;
+}
+
+bool ControlMessageGroup::send(
+        CDRMessage_t* message,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    // Control messages not sent are repeated on the next period of their endpoints, so a failure does not abort
+    // the submessages of the rest of endpoints.
+    if (!participant_->sendSync(message, participant_guid_, Locators(destinations_.begin()),
+            Locators(destinations_.end()), max_blocking_time_point))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT, "Control message could not be sent");
+    }
+    return true;
+}
+
+bool ControlMessageGroup::send(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    if (!participant_->sendSync(buffers, total_bytes, participant_guid_, Locators(destinations_.begin()),
+            Locators(destinations_.end()), max_blocking_time_point))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT, "Control message could not be sent");
+    }
+    return true;
+}
+
+ControlMessageTask::ControlMessageTask(
+        ControlMessageScheduler& scheduler,
+        PrepareCallback prepare,
+        AddCallback add,
+        double milliseconds)
+    : scheduler_(scheduler)
+    , prepare_(std::move(prepare))
+    , add_(std::move(add))
+    , interval_us_(static_cast<int64_t>(milliseconds * 1000))
+{
+}
+
+ControlMessageTask::~ControlMessageTask()
+{
+    scheduler_.unregister(this);
+}
+
+void ControlMessageTask::restart_timer()
+{
+    scheduler_.restart(this);
+}
+
+void ControlMessageTask::restart_timer(
+        const std::chrono::steady_clock::time_point& timeout)
+{
+    scheduler_.restart(this, timeout);
+}
+
+void ControlMessageTask::cancel_timer()
+{
+    scheduler_.cancel(this);
+}
+
+void ControlMessageTask::update_interval(
+        const Duration_t& interval)
+{
+    interval_us_ = TimeConv::Duration_t2MicroSecondsInt64(interval);
+}
+
+void ControlMessageTask::update_interval_millisec(
+        double interval)
+{
+    interval_us_ = static_cast<int64_t>(interval * 1000);
+}
+
+double ControlMessageTask::getIntervalMilliSec() const
+{
+    return static_cast<double>(interval_us_.load()) / 1000.0;
+}
+
+ControlMessageScheduler::ControlMessageScheduler(
+        RTPSParticipantImpl* participant,
+        double window_ms)
+    : participant_(participant)
+    , window_(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(window_ms)))
+{
+    event_.reset(new TimedEvent(participant->getEventResource(),
+            [this]() -> bool
+            {
+                return trigger();
+            }, 0));
+}
+
+ControlMessageScheduler::~ControlMessageScheduler()
+{
+    // Waits for a running batch to finish
+    event_.reset();
+    assert(queue_.empty());
+}
+
+void ControlMessageScheduler::schedule_nts(
+        ControlMessageTask* task)
+{
+    task->due_ = Clock::now() + std::chrono::microseconds(task->interval_us_.load());
+    task->position_ = queue_.emplace(task->due_, task);
+    task->scheduled_ = true;
+    arm_nts(task->due_);
+}
+
+void ControlMessageScheduler::unschedule_nts(
+        ControlMessageTask* task)
+{
+    if (task->scheduled_)
+    {
+        queue_.erase(task->position_);
+        task->scheduled_ = false;
+    }
+    else if (task->pending_)
+    {
+        std::replace(batch_.begin(), batch_.end(), task, static_cast<ControlMessageTask*>(nullptr));
+        task->pending_ = false;
+    }
+    task->restart_ = false;
+}
+
+void ControlMessageScheduler::restart_nts(
+        ControlMessageTask* task)
+{
+    if (task->pending_)
+    {
+        // Scheduled again when the current batch finishes
+        task->restart_ = true;
+    }
+    else if (!task->scheduled_)
+    {
+        schedule_nts(task);
+    }
+}
+
+void ControlMessageScheduler::restart(
+        ControlMessageTask* task)
+{
+    std::lock_guard<std::timed_mutex> guard(mutex_);
+    restart_nts(task);
+}
+
+void ControlMessageScheduler::restart(
+        ControlMessageTask* task,
+        const Clock::time_point& timeout)
+{
+    std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+    if (lock.try_lock_until(timeout))
+    {
+        restart_nts(task);
+    }
+}
+
+void ControlMessageScheduler::cancel(
+        ControlMessageTask* task)
+{
+    std::lock_guard<std::timed_mutex> guard(mutex_);
+    unschedule_nts(task);
+}
+
+void ControlMessageScheduler::unregister(
+        ControlMessageTask* task)
+{
+    std::unique_lock<std::timed_mutex> lock(mutex_);
+    unschedule_nts(task);
+    cv_.wait(lock, [task]()
+            {
+                return !task->running_;
+            });
+}
+
+void ControlMessageScheduler::arm_nts(
+        const Clock::time_point& due)
+{
+    if (triggering_ || (armed_ && armed_due_ <= due))
+    {
+        // The timed event already fires on time, or will be armed when the current batch finishes
+        return;
+    }
+
+    armed_ = true;
+    armed_due_ = due;
+    double delay_ms = std::chrono::duration<double, std::milli>(due - Clock::now()).count();
+    event_->cancel_timer();
+    event_->update_interval_millisec(0 < delay_ms ? delay_ms : 0);
+    event_->restart_timer();
+}
+
+template<class Function>
+void ControlMessageScheduler::run_pending(
+        std::unique_lock<std::timed_mutex>& lock,
+        size_t index,
+        Function function)
+{
+    ControlMessageTask* task = batch_[index];
+    if (nullptr == task)
+    {
+        return;
+    }
+
+    task->running_ = true;
+    lock.unlock();
+    function(task);
+    lock.lock();
+    task->running_ = false;
+    cv_.notify_all();
+}
+
+bool ControlMessageScheduler::trigger()
+{
+    std::unique_lock<std::timed_mutex> lock(mutex_);
+    armed_ = false;
+    triggering_ = true;
+
+    // Every task due within the window is triggered now
+    Clock::time_point limit = Clock::now() + window_;
+    batch_.clear();
+    while (!queue_.empty() && queue_.begin()->first <= limit)
+    {
+        ControlMessageTask* task = queue_.begin()->second;
+        queue_.erase(queue_.begin());
+        task->scheduled_ = false;
+        task->pending_ = true;
+        task->restart_ = false;
+        batch_.push_back(task);
+    }
+
+    bool has_destinations = false;
+    for (size_t i = 0; i < batch_.size(); ++i)
+    {
+        run_pending(lock, i, [](ControlMessageTask* task)
+                {
+                    task->destinations_.clear();
+                    task->reschedule_ = task->prepare_(task->destinations_);
+                });
+        has_destinations = has_destinations || (nullptr != batch_[i] && !batch_[i]->destinations_.empty());
+    }
+
+    if (has_destinations)
+    {
+        // Tasks with the same destinations are added one after the other, so they share the same messages
+        std::stable_sort(batch_.begin(), batch_.end(), [](
+                    const ControlMessageTask* a,
+                    const ControlMessageTask* b)
+                {
+                    if (nullptr == a || nullptr == b)
+                    {
+                        return nullptr != a && nullptr == b;
+                    }
+                    return a->destinations_ < b->destinations_;
+                });
+
+        lock.unlock();
+        std::unique_ptr<ControlMessageGroup> group;
+        try
+        {
+            group.reset(new ControlMessageGroup(participant_));
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Max blocking time reached");
+        }
+        lock.lock();
+
+        if (group)
+        {
+            for (size_t i = 0; i < batch_.size(); ++i)
+            {
+                run_pending(lock, i, [&group](ControlMessageTask* task)
+                        {
+                            if (!task->destinations_.empty())
+                            {
+                                task->add_(*group, task->destinations_);
+                            }
+                        });
+            }
+
+            // Send the last messages
+            lock.unlock();
+            group.reset();
+            lock.lock();
+        }
+    }
+
+    for (ControlMessageTask* task : batch_)
+    {
+        if (nullptr != task)
+        {
+            task->pending_ = false;
+            if (task->reschedule_ || task->restart_)
+            {
+                schedule_nts(task);
+            }
+            task->restart_ = false;
+        }
+    }
+    batch_.clear();
+    triggering_ = false;
+
+    if (!queue_.empty())
+    {
+        arm_nts(queue_.begin()->first);
+    }
+
+    return false;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
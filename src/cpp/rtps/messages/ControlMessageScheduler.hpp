@@ -0,0 +1,366 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessageScheduler.hpp
+ */
+
+#ifndef RTPS_MESSAGES_CONTROLMESSAGESCHEDULER_HPP
+#define RTPS_MESSAGES_CONTROLMESSAGESCHEDULER_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastrtps/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ControlMessageScheduler;
+class Endpoint;
+class RTPSParticipantImpl;
+class TimedEvent;
+
+/**
+ * Groups the control submessages of several endpoints of a participant, sending them to the same destination
+ * locators in the same RTPS messages.
+ *
+ * Each endpoint adds its submessages with the group returned by @ref use, which takes the destination GUIDs of the
+ * submessages from the sender of the endpoint. The messages are only flushed when the destination locators change.
+ * Submessages are never protected as a whole message, so this must not be used when RTPS protection is enabled.
+ * The messages are reported as sent by the participant, as their submessages may belong to several endpoints.
+ * @ingroup WRITER_MODULE
+ */
+class ControlMessageGroup : public RTPSMessageSenderInterface
+{
+public:
+
+    /**
+     * Construct a ControlMessageGroup, taking a send buffer from the participant.
+     * @param participant Participant sending the messages.
+     */
+    explicit ControlMessageGroup(
+            RTPSParticipantImpl* participant);
+
+    /**
+     * Send the remaining submessages and return the send buffer to the participant.
+     */
+    ~ControlMessageGroup();
+
+    /**
+     * Message group where an endpoint adds its control submessages.
+     * When the destination locators are not the ones of the submessages already added, those are sent first.
+     * @param endpoint Endpoint adding the submessages.
+     * @param sender Sender of the endpoint, giving the destination GUIDs of the submessages.
+     * @param destinations Destination locators of the submessages, sorted and without duplicates.
+     * @return Reference to the message group.
+     */
+    RTPSMessageGroup& use(
+            Endpoint* endpoint,
+            RTPSMessageSenderInterface* sender,
+            const std::vector<Locator_t>& destinations);
+
+    /**
+     * Fill a list of destination locators, sorted and without duplicates, as expected by @ref use.
+     * @param begin Iterator at the first locator.
+     * @param end Iterator at the end locator.
+     * @param destinations List to fill.
+     */
+    template<class LocatorIteratorT>
+    static void collect_destinations(
+            const LocatorIteratorT& begin,
+            const LocatorIteratorT& end,
+            std::vector<Locator_t>& destinations)
+    {
+        destinations.clear();
+        for (LocatorIteratorT it = begin; it != end; ++it)
+        {
+            destinations.push_back(*it);
+        }
+        std::sort(destinations.begin(), destinations.end());
+        destinations.erase(std::unique(destinations.begin(), destinations.end()), destinations.end());
+    }
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return endpoint_sender_->destination_guid_prefix();
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return endpoint_sender_->remote_participants();
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return endpoint_sender_->remote_guids();
+    }
+
+    bool send(
+            CDRMessage_t* message,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
+    bool send(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
+    void lock() override
+    {
+        mutex_.lock();
+    }
+
+    void unlock() override
+    {
+        mutex_.unlock();
+    }
+
+private:
+
+    RTPSParticipantImpl* participant_ = nullptr;
+
+    //! Sender of the endpoint adding submessages.
+    RTPSMessageSenderInterface* endpoint_sender_ = nullptr;
+
+    //! GUID of the participant, reported as the sender of the messages, as they gather several endpoints.
+    GUID_t participant_guid_;
+
+    std::vector<Locator_t> destinations_;
+
+    std::recursive_mutex mutex_;
+
+    std::unique_ptr<RTPSMessageGroup> group_;
+};
+
+/**
+ * Periodic control message of an endpoint, triggered by a @ref ControlMessageScheduler.
+ * Its interface mimics the one of @ref TimedEvent.
+ * @ingroup WRITER_MODULE
+ */
+class ControlMessageTask
+{
+public:
+
+    /**
+     * Called when the task is due, with the destinations of the submessages to pack with other tasks.
+     * The callback sends by itself what cannot be packed, leaving the destinations empty when there is nothing else.
+     * Returns whether the task has to be triggered again after its interval.
+     */
+    using PrepareCallback = std::function<bool (std::vector<Locator_t>&)>;
+
+    /**
+     * Called after every due task was prepared, only when the task filled its destinations,
+     * to add its submessages to the group. Receives the destinations filled when preparing it, which the callback
+     * updates if they changed since then.
+     */
+    using AddCallback = std::function<void (ControlMessageGroup&, std::vector<Locator_t>&)>;
+
+    /**
+     * Construct a task, registering it on the scheduler.
+     * @param scheduler Scheduler triggering the task.
+     * @param prepare Callback preparing the task.
+     * @param add Callback adding the submessages of the task.
+     * @param milliseconds Interval of the task.
+     */
+    ControlMessageTask(
+            ControlMessageScheduler& scheduler,
+            PrepareCallback prepare,
+            AddCallback add,
+            double milliseconds);
+
+    /**
+     * Unregister the task, waiting for its callbacks to finish.
+     */
+    ~ControlMessageTask();
+
+    //! Schedule the task after its interval, unless it is already scheduled.
+    void restart_timer();
+
+    /**
+     * Schedule the task after its interval, unless it is already scheduled.
+     * @param timeout Maximum time to wait for the scheduler.
+     */
+    void restart_timer(
+            const std::chrono::steady_clock::time_point& timeout);
+
+    //! Cancel the task, also when it is due and waiting to be triggered.
+    void cancel_timer();
+
+    /**
+     * Update the interval of the task, which applies the next time it is scheduled.
+     * @param interval New interval.
+     */
+    void update_interval(
+            const Duration_t& interval);
+
+    /**
+     * Update the interval of the task, which applies the next time it is scheduled.
+     * @param interval New interval in milliseconds.
+     */
+    void update_interval_millisec(
+            double interval);
+
+    //! Get the interval of the task in milliseconds.
+    double getIntervalMilliSec() const;
+
+private:
+
+    friend class ControlMessageScheduler;
+
+    ControlMessageScheduler& scheduler_;
+
+    PrepareCallback prepare_;
+
+    AddCallback add_;
+
+    //! Interval in microseconds.
+    std::atomic<int64_t> interval_us_;
+
+    std::chrono::steady_clock::time_point due_;
+
+    //! Destinations filled by the last call to prepare_.
+    std::vector<Locator_t> destinations_;
+
+    //! Waiting on the queue of the scheduler.
+    bool scheduled_ = false;
+
+    //! Taken from the queue to be triggered on the current batch.
+    bool pending_ = false;
+
+    //! One of its callbacks is being called.
+    bool running_ = false;
+
+    //! Restarted while pending.
+    bool restart_ = false;
+
+    //! Returned by the last call to prepare_.
+    bool reschedule_ = false;
+
+    //! Position on the queue of the scheduler, when scheduled.
+    std::multimap<std::chrono::steady_clock::time_point, ControlMessageTask*>::iterator position_;
+};
+
+/**
+ * Triggers the periodic control messages of the endpoints of a participant (HEARTBEAT and ACKNACK submessages)
+ * from a single timed event. Every task due within an aggregation window is triggered on the same batch, and the
+ * submessages of the batch are packed on as few RTPS messages as possible, one per set of destination locators.
+ * @ingroup WRITER_MODULE
+ */
+class ControlMessageScheduler
+{
+public:
+
+    /**
+     * Construct a ControlMessageScheduler.
+     * @param participant Participant sending the messages, whose event thread triggers the tasks.
+     * @param window_ms Aggregation window in milliseconds. Tasks due until this time after the earliest one are
+     * triggered with it.
+     */
+    ControlMessageScheduler(
+            RTPSParticipantImpl* participant,
+            double window_ms);
+
+    ~ControlMessageScheduler();
+
+private:
+
+    friend class ControlMessageTask;
+
+    using Clock = std::chrono::steady_clock;
+
+    using Queue = std::multimap<Clock::time_point, ControlMessageTask*>;
+
+    void schedule_nts(
+            ControlMessageTask* task);
+
+    void unschedule_nts(
+            ControlMessageTask* task);
+
+    void restart_nts(
+            ControlMessageTask* task);
+
+    void restart(
+            ControlMessageTask* task);
+
+    void restart(
+            ControlMessageTask* task,
+            const Clock::time_point& timeout);
+
+    void cancel(
+            ControlMessageTask* task);
+
+    void unregister(
+            ControlMessageTask* task);
+
+    //! Arm the timed event to fire at the given time, unless it is armed for an earlier one.
+    void arm_nts(
+            const Clock::time_point& due);
+
+    //! Callback of the timed event.
+    bool trigger();
+
+    //! Run a callback of a task still pending on the current batch.
+    template<class Function>
+    void run_pending(
+            std::unique_lock<std::timed_mutex>& lock,
+            size_t index,
+            Function function);
+
+    RTPSParticipantImpl* participant_;
+
+    Clock::duration window_;
+
+    std::timed_mutex mutex_;
+
+    std::condition_variable_any cv_;
+
+    Queue queue_;
+
+    //! Tasks of the batch being triggered. Those cancelled while pending are set to nullptr.
+    std::vector<ControlMessageTask*> batch_;
+
+    //! The batch is being triggered.
+    bool triggering_ = false;
+
+    bool armed_ = false;
+
+    Clock::time_point armed_due_;
+
+    std::unique_ptr<TimedEvent> event_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // RTPS_MESSAGES_CONTROLMESSAGESCHEDULER_HPP
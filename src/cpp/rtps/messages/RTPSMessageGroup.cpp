@@ -25,6 +25,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
+#include <rtps/history/ITopicPayloadPool.h>
 #include <rtps/messages/RTPSGapBuilder.hpp>
 #include <rtps/messages/RTPSMessageGroup_t.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -253,6 +254,8 @@ RTPSMessageGroup::~RTPSMessageGroup() noexcept(false)
 
 void RTPSMessageGroup::reset_to_header()
 {
+    release_gathered_payloads();
+
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
@@ -299,12 +302,42 @@ void RTPSMessageGroup::send()
 
             eprosima::fastdds::statistics::rtps::add_statistics_submessage(msgToSend);
 
-            if (!sender_->send(msgToSend,
-                    max_blocking_time_point_))
+            bool sent = false;
+            uint32_t total_bytes = msgToSend->length + gathered_bytes_;
+            if (0 < send_buffer_->gathered_payloads_count_)
+            {
+                // Interleave the slices of full_msg_ with the payloads left out of it
+                std::vector<fastdds::rtps::NetworkBuffer>& buffers = send_buffer_->network_buffers_;
+                buffers.clear();
+                uint32_t position = 0;
+                for (uint32_t i = 0; i < send_buffer_->gathered_payloads_count_; ++i)
+                {
+                    const RTPSMessageGroup_t::GatheredPayload& payload = send_buffer_->gathered_payloads_[i];
+                    if (payload.position > position)
+                    {
+                        buffers.emplace_back(&msgToSend->buffer[position], payload.position - position);
+                        position = payload.position;
+                    }
+                    buffers.emplace_back(payload.data, payload.length);
+                }
+                if (msgToSend->length > position)
+                {
+                    buffers.emplace_back(&msgToSend->buffer[position], msgToSend->length - position);
+                }
+
+                sent = sender_->send(buffers, total_bytes, max_blocking_time_point_);
+                release_gathered_payloads();
+            }
+            else
+            {
+                sent = sender_->send(msgToSend, max_blocking_time_point_);
+            }
+
+            if (!sent)
             {
                 throw timeout();
             }
-            current_sent_bytes_ += msgToSend->length;
+            current_sent_bytes_ += total_bytes;
         }
     }
 }
@@ -336,18 +369,20 @@ bool RTPSMessageGroup::insert_submessage(
         const GuidPrefix_t& destination_guid_prefix,
         bool is_big_submessage)
 {
-    if (!append_message(full_msg_, submessage_msg_))
+    if (!append_submessage())
     {
         // Retry
         flush_and_reset();
         add_info_dst_in_buffer(full_msg_, destination_guid_prefix);
 
-        if (!append_message(full_msg_, submessage_msg_))
+        if (!append_submessage())
         {
+            pending_payload_change_ = nullptr;
             EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
             return false;
         }
     }
+    pending_payload_change_ = nullptr;
 
     // Messages with a submessage bigger than 64KB cannot have more submessages and should be flushed
     if (is_big_submessage)
@@ -358,6 +393,88 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+bool RTPSMessageGroup::append_submessage()
+{
+    uint32_t submessage_start = full_msg_->pos;
+    uint32_t gathered_length = gathered_bytes_;
+    if (nullptr != pending_payload_change_)
+    {
+        gathered_length += pending_payload_length_;
+    }
+
+    // Keep room for the payloads which are not copied into full_msg_
+    if (gathered_length >= full_msg_->max_size)
+    {
+        return false;
+    }
+    full_msg_->max_size -= gathered_length;
+    bool ret_val = append_message(full_msg_, submessage_msg_);
+    full_msg_->max_size += gathered_length;
+
+    if (ret_val && nullptr != pending_payload_change_)
+    {
+        RTPSMessageGroup_t::GatheredPayload& payload =
+                send_buffer_->gathered_payloads_[send_buffer_->gathered_payloads_count_];
+
+        // Take a reference on the payload, so it is not released before the message is sent
+        SerializedPayload_t data;
+        data.data = pending_payload_change_->serializedPayload.data;
+        data.length = pending_payload_change_->serializedPayload.length;
+        IPayloadPool* owner = const_cast<IPayloadPool*>(pending_payload_change_->payload_owner());
+        payload.reference.writerGUID = pending_payload_change_->writerGUID;
+        payload.reference.sequenceNumber = pending_payload_change_->sequenceNumber;
+        ret_val = owner->get_payload(data, owner, payload.reference);
+        data.data = nullptr;
+
+        if (ret_val)
+        {
+            payload.position = submessage_start + pending_payload_position_;
+            payload.data = pending_payload_data_;
+            payload.length = pending_payload_length_;
+            gathered_bytes_ += pending_payload_length_;
+            ++send_buffer_->gathered_payloads_count_;
+        }
+        else
+        {
+            full_msg_->pos = submessage_start;
+            full_msg_->length = submessage_start;
+        }
+    }
+
+    return ret_val;
+}
+
+bool RTPSMessageGroup::can_gather_payload(
+        const CacheChange_t& change,
+        uint32_t length) const
+{
+#if HAVE_SECURITY
+    // Protected messages are encoded as a whole
+    if ((participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection()) ||
+            endpoint_->getAttributes().security_attributes().is_submessage_protected ||
+            endpoint_->getAttributes().security_attributes().is_payload_protected)
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    // Only payloads from a pool with reference counting can be kept until the message is sent
+    return min_gathered_payload_size_ <= length &&
+           RTPSMessageGroup_t::max_gathered_payloads > send_buffer_->gathered_payloads_count_ &&
+           nullptr != dynamic_cast<const ITopicPayloadPool*>(change.payload_owner());
+}
+
+void RTPSMessageGroup::release_gathered_payloads()
+{
+    for (uint32_t i = 0; i < send_buffer_->gathered_payloads_count_; ++i)
+    {
+        CacheChange_t& reference = send_buffer_->gathered_payloads_[i].reference;
+        reference.payload_owner()->release_payload(reference);
+    }
+    send_buffer_->gathered_payloads_count_ = 0;
+    gathered_bytes_ = 0;
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -437,7 +554,8 @@ bool RTPSMessageGroup::add_data(
 
     // Check limitation
     uint32_t data_size = change.serializedPayload.length;
-    if (data_exceeds_limitation(data_size, sent_bytes_limitation_, current_sent_bytes_, full_msg_->length))
+    if (data_exceeds_limitation(data_size, sent_bytes_limitation_, current_sent_bytes_,
+            full_msg_->length + gathered_bytes_))
     {
         flush_and_reset();
         throw limit_exceeded();
@@ -487,8 +605,10 @@ bool RTPSMessageGroup::add_data(
 
     // TODO (Ricardo). Check to create special wrapper.
     bool is_big_submessage;
+    bool gather = can_gather_payload(change, change.serializedPayload.length);
+    uint32_t payload_position = 0;
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
-            readerId, expectsInlineQos, inline_qos, &is_big_submessage))
+            readerId, expectsInlineQos, inline_qos, &is_big_submessage, gather ? &payload_position : nullptr))
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
@@ -496,6 +616,14 @@ bool RTPSMessageGroup::add_data(
     }
     change_to_add.serializedPayload.data = nullptr;
 
+    if (0 < payload_position)
+    {
+        pending_payload_change_ = &change;
+        pending_payload_data_ = change.serializedPayload.data;
+        pending_payload_length_ = change.serializedPayload.length;
+        pending_payload_position_ = payload_position;
+    }
+
 #if HAVE_SECURITY
     if (endpoint_->getAttributes().security_attributes().is_submessage_protected)
     {
@@ -540,7 +668,8 @@ bool RTPSMessageGroup::add_data_frag(
     uint32_t fragment_size = fragment_number < change.getFragmentCount() ? change.getFragmentSize() :
             change.serializedPayload.length - fragment_start;
     // Check limitation
-    if (data_exceeds_limitation(fragment_size, sent_bytes_limitation_, current_sent_bytes_, full_msg_->length))
+    if (data_exceeds_limitation(fragment_size, sent_bytes_limitation_, current_sent_bytes_,
+            full_msg_->length + gathered_bytes_))
     {
         flush_and_reset();
         throw limit_exceeded();
@@ -589,9 +718,11 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    bool gather = can_gather_payload(change, fragment_size);
+    uint32_t payload_position = 0;
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change, fragment_number,
             change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
-            expectsInlineQos, inline_qos))
+            expectsInlineQos, inline_qos, gather ? &payload_position : nullptr))
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
@@ -599,6 +730,14 @@ bool RTPSMessageGroup::add_data_frag(
     }
     change_to_add.serializedPayload.data = nullptr;
 
+    if (0 < payload_position)
+    {
+        pending_payload_change_ = &change;
+        pending_payload_data_ = change.serializedPayload.data + fragment_start;
+        pending_payload_length_ = fragment_size;
+        pending_payload_position_ = payload_position;
+    }
+
 #if HAVE_SECURITY
     if (endpoint_->getAttributes().security_attributes().is_submessage_protected)
     {
@@ -841,7 +980,7 @@ bool RTPSMessageGroup::add_acknack(
 
     // Notify the statistics module, note that only readers add acknacks
     assert(nullptr != dynamic_cast<RTPSReader*>(endpoint_));
-    static_cast<fastdds::statistics::StatisticsReaderImpl*>(static_cast<RTPSReader*>(endpoint_))->on_acknack(count);
+    static_cast<RTPSReader*>(endpoint_)->on_acknack(count);
 
     return insert_submessage(false);
 }
@@ -21,6 +21,11 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <array>
+#include <vector>
+
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
+#include <fastrtps/rtps/common/CacheChange.h>
 #include <fastrtps/rtps/common/CDRMessage_t.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
@@ -37,6 +42,24 @@ class RTPSMessageGroup_t
 {
 public:
 
+    //! Maximum number of payloads of a message which are not copied into rtpsmsg_fullmsg_
+    static constexpr uint32_t max_gathered_payloads = 16;
+
+    /**
+     * A serialized payload sent from the buffer where the writer stores it.
+     */
+    struct GatheredPayload
+    {
+        //! Position of rtpsmsg_fullmsg_ where the payload is inserted
+        uint32_t position = 0;
+        //! First byte to send
+        const octet* data = nullptr;
+        //! Number of bytes to send
+        uint32_t length = 0;
+        //! Holds a reference to the payload until the message is sent
+        CacheChange_t reference;
+    };
+
     RTPSMessageGroup_t(
 #if HAVE_SECURITY
             bool has_security,
@@ -51,6 +74,7 @@ public:
     {
         rtpsmsg_fullmsg_.reserve(payload);
         rtpsmsg_submessage_.reserve(payload);
+        network_buffers_.reserve(2 * max_gathered_payloads + 1);
 
 #if HAVE_SECURITY
         if (has_security)
@@ -78,6 +102,7 @@ public:
         rtpsmsg_fullmsg_.init(buffer_ptr, payload);
         buffer_ptr += payload;
         rtpsmsg_submessage_.init(buffer_ptr, payload);
+        network_buffers_.reserve(2 * max_gathered_payloads + 1);
 
 #if HAVE_SECURITY
         if (has_security)
@@ -104,6 +129,15 @@ public:
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Payloads of rtpsmsg_fullmsg_ not copied into it, sorted by position
+    std::array<GatheredPayload, max_gathered_payloads> gathered_payloads_;
+
+    //! Number of valid entries on gathered_payloads_
+    uint32_t gathered_payloads_count_ = 0;
+
+    //! Slices of the message being sent, when it has gathered payloads
+    std::vector<fastdds::rtps::NetworkBuffer> network_buffers_;
 };
 
 } // namespace rtps
@@ -181,7 +181,8 @@ bool RTPSMessageCreator::addSubmessageData(
         const EntityId_t& readerId,
         bool expectsInlineQos,
         InlineQosWriter* inlineQos,
-        bool* is_big_submessage)
+        bool* is_big_submessage,
+        uint32_t* payload_position)
 {
     octet status = 0;
     octet flags = 0;
@@ -189,6 +190,8 @@ bool RTPSMessageCreator::addSubmessageData(
     bool dataFlag = false;
     bool keyFlag = false;
     bool inlineQosFlag = false;
+    // Bytes of the payload left out of msg
+    uint32_t payload_length = 0;
 
     Endianness_t old_endianess = msg->msg_endian;
 #if FASTDDS_IS_BIG_ENDIAN_TARGET
@@ -230,9 +233,22 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     //Add Serialized Payload
+    if (nullptr != payload_position)
+    {
+        *payload_position = 0;
+    }
     if (dataFlag)
     {
-        added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data, change->serializedPayload.length);
+        if (nullptr != payload_position)
+        {
+            *payload_position = msg->pos;
+            payload_length = change->serializedPayload.length;
+        }
+        else
+        {
+            added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data,
+                            change->serializedPayload.length);
+        }
     }
 
     if (keyFlag)
@@ -256,7 +272,7 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     // Align submessage to rtps alignment (4).
-    uint32_t align = (4 - msg->pos % 4) & 3;
+    uint32_t align = (4 - (msg->pos + payload_length) % 4) & 3;
     for (uint32_t count = 0; count < align; ++count)
     {
         added_no_error &= CDRMessage::addOctet(msg, 0);
@@ -268,7 +284,7 @@ bool RTPSMessageCreator::addSubmessageData(
         //submsgElem.length += align;
     }
 
-    uint32_t size32 = msg->pos - position_size_count_size;
+    uint32_t size32 = msg->pos + payload_length - position_size_count_size;
     if (size32 <= std::numeric_limits<uint16_t>::max())
     {
         submessage_size = static_cast<uint16_t>(size32);
@@ -339,7 +355,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
         TopicKind_t topicKind,
         const EntityId_t& readerId,
         bool expectsInlineQos,
-        InlineQosWriter* inlineQos)
+        InlineQosWriter* inlineQos,
+        uint32_t* payload_position)
 {
     octet status = 0;
     octet flags = 0;
@@ -347,6 +364,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
     bool dataFlag = false;
     bool keyFlag = false;
     bool inlineQosFlag = false;
+    // Bytes of the payload left out of msg
+    uint32_t payload_length = 0;
 
     Endianness_t old_endianess = msg->msg_endian;
 #if FASTDDS_IS_BIG_ENDIAN_TARGET
@@ -383,9 +402,21 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
     }
 
     //Add Serialized Payload XXX TODO
+    if (nullptr != payload_position)
+    {
+        *payload_position = 0;
+    }
     if (!keyFlag) // keyflag = 0 means that the serializedPayload SubmessageElement contains the serialized Data
     {
-        added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        if (nullptr != payload_position)
+        {
+            *payload_position = msg->pos;
+            payload_length = payload.length;
+        }
+        else
+        {
+            added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        }
     }
     else
     {
@@ -408,7 +439,7 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
 
     // TODO(Ricardo) This should be on cachechange.
     // Align submessage to rtps alignment (4).
-    submessage_size = uint16_t(msg->pos - position_size_count_size);
+    submessage_size = uint16_t(msg->pos + payload_length - position_size_count_size);
     for (; submessage_size& 3; ++submessage_size)
     {
         added_no_error &= CDRMessage::addOctet(msg, 0);
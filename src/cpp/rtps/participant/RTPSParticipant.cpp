@@ -234,6 +234,19 @@ void RTPSParticipant::set_enabled_statistics_writers_mask(
     mp_impl->set_enabled_statistics_writers_mask(enabled_writers);
 }
 
+void RTPSParticipant::get_startup_profile(
+        fastdds::statistics::StartupProfile& profile) const
+{
+    mp_impl->get_startup_profile(profile);
+}
+
+bool RTPSParticipant::get_reliability_tuning(
+        const GUID_t& writer_guid,
+        fastdds::statistics::ReliabilityTuning& tuning) const
+{
+    return mp_impl->get_reliability_tuning(writer_guid, tuning);
+}
+
 #endif // FASTDDS_STATISTICS
 
 } /* namespace rtps */
@@ -57,6 +57,7 @@
 #include <rtps/builtin/discovery/participant/PDPServer.hpp>
 #include <rtps/builtin/discovery/participant/PDPClient.h>
 #include <rtps/history/BasicPayloadPool.hpp>
+#include <rtps/messages/ControlMessageScheduler.hpp>
 #include <rtps/network/ExternalLocatorsProcessor.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/persistence/PersistenceService.h>
@@ -407,6 +408,8 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         flow_controller_factory_.register_flow_controller(*flow_controller_desc.get());
     }
 
+    on_startup_phase(fastdds::statistics::StartupPhase::TRANSPORTS_INITIALIZED, m_guid);
+
 #if HAVE_SECURITY
     if (m_security_manager.is_security_active())
     {
@@ -417,6 +420,33 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 #endif // if HAVE_SECURITY
 
+    // Control messages of the endpoints are aggregated when requested, unless they are protected as whole messages
+    const std::string* aggregation_window = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.control_messages.aggregation_window");
+    if (nullptr != aggregation_window)
+    {
+        char* ptr = nullptr;
+        unsigned long window_ms = strtoul(aggregation_window->c_str(), &ptr, 10);
+
+        if (aggregation_window->c_str() == ptr)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Not numerical value for fastdds.control_messages.aggregation_window property. "
+                    "Control messages are not aggregated");
+        }
+#if HAVE_SECURITY
+        else if (m_security_manager.is_security_active())
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT,
+                    "Control messages are not aggregated on participants with security enabled");
+        }
+#endif // if HAVE_SECURITY
+        else if (0 < window_ms)
+        {
+            control_message_scheduler_.reset(new ControlMessageScheduler(this, static_cast<double>(window_ms)));
+        }
+    }
+
     // Copy NetworkFactory network_configuration to participant attributes prior to proxy creation
     // NOTE: all transports already registered before
     m_att.builtin.network_configuration = m_network_Factory.network_configuration();
@@ -505,6 +535,9 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
 {
     disable();
 
+    // Every endpoint was deleted, so no control message task remains registered
+    control_message_scheduler_.reset();
+
 #if HAVE_SECURITY
     m_security_manager.destroy();
 #endif // if HAVE_SECURITY
@@ -2696,6 +2729,31 @@ void RTPSParticipantImpl::set_enabled_statistics_writers_mask(
     }
 }
 
+bool RTPSParticipantImpl::get_reliability_tuning(
+        const GUID_t& writer_guid,
+        fastdds::statistics::ReliabilityTuning& tuning)
+{
+    // The writer cannot be deleted while the list is locked
+    shared_lock<shared_mutex> _(endpoints_list_mutex);
+
+    for (auto writer : m_userWriterList)
+    {
+        if (writer->getGuid() == writer_guid)
+        {
+            StatefulWriter* stateful_writer = dynamic_cast<StatefulWriter*>(writer);
+            if (nullptr == stateful_writer)
+            {
+                return false;
+            }
+
+            stateful_writer->get_reliability_tuning(tuning);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 #endif // FASTDDS_STATISTICS
 
 bool RTPSParticipantImpl::should_match_local_endpoints(
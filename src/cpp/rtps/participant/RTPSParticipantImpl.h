@@ -84,6 +84,7 @@ class RTPSParticipant;
 class RTPSParticipantListener;
 class BuiltinProtocols;
 struct CDRMessage_t;
+class ControlMessageScheduler;
 class Endpoint;
 class RTPSWriter;
 class WriterAttributes;
@@ -246,6 +247,16 @@ public:
         return mp_event_thr;
     }
 
+    /**
+     * Get the scheduler packing the periodic control messages of the endpoints of this participant.
+     * @return nullptr when the property fastdds.control_messages.aggregation_window is not set, or security is
+     * enabled, in which case each endpoint sends its own control messages.
+     */
+    ControlMessageScheduler* control_message_scheduler() const
+    {
+        return control_message_scheduler_.get();
+    }
+
     /**
      * Send a message to several locations
      * @param msg Message to send.
@@ -263,41 +274,41 @@ public:
             const LocatorIteratorT& destination_locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point)
     {
-        bool ret_code = false;
-#if HAVE_STRICT_REALTIME
-        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
-        if (lock.try_lock_until(max_blocking_time_point))
-#else
-        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_);
-#endif // if HAVE_STRICT_REALTIME
-        {
-            ret_code = true;
-
-            for (auto& send_resource : send_resource_list_)
-            {
-                LocatorIteratorT locators_begin = destination_locators_begin;
-                LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
-                        max_blocking_time_point);
-            }
-
-            lock.unlock();
-
-            // notify statistics module
-            on_rtps_send(
-                sender_guid,
-                destination_locators_begin,
-                destination_locators_end,
-                msg->length);
-
-            // checkout if sender is a discovery endpoint
-            on_discovery_packet(
-                sender_guid,
-                destination_locators_begin,
-                destination_locators_end);
-        }
+        return send_sync_impl(msg->length, sender_guid, destination_locators_begin, destination_locators_end,
+                       max_blocking_time_point,
+                       [msg](SenderResource& send_resource, LocatorsIterator* locators_begin,
+                       LocatorsIterator* locators_end, const std::chrono::steady_clock::time_point& timeout)
+                       {
+                           send_resource.send(msg->buffer, msg->length, locators_begin, locators_end, timeout);
+                       });
+    }
 
-        return ret_code;
+    /**
+     * Send a message made of several slices to several locations
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param sender_guid GUID of the producer of the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point execution time limit timepoint.
+     * @return true if at least one locator has been sent.
+     */
+    template<class LocatorIteratorT>
+    bool sendSync(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        return send_sync_impl(total_bytes, sender_guid, destination_locators_begin, destination_locators_end,
+                       max_blocking_time_point,
+                       [&buffers, total_bytes](SenderResource& send_resource, LocatorsIterator* locators_begin,
+                       LocatorsIterator* locators_end, const std::chrono::steady_clock::time_point& timeout)
+                       {
+                           send_resource.send(buffers, total_bytes, locators_begin, locators_end, timeout);
+                       });
     }
 
     //!Get the participant Mutex
@@ -508,6 +519,51 @@ public:
 
 private:
 
+    template<class LocatorIteratorT, class SendFunction>
+    bool send_sync_impl(
+            uint32_t length,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point,
+            SendFunction send_function)
+    {
+        bool ret_code = false;
+#if HAVE_STRICT_REALTIME
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
+        if (lock.try_lock_until(max_blocking_time_point))
+#else
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_);
+#endif // if HAVE_STRICT_REALTIME
+        {
+            ret_code = true;
+
+            for (auto& send_resource : send_resource_list_)
+            {
+                LocatorIteratorT locators_begin = destination_locators_begin;
+                LocatorIteratorT locators_end = destination_locators_end;
+                send_function(*send_resource, &locators_begin, &locators_end, max_blocking_time_point);
+            }
+
+            lock.unlock();
+
+            // notify statistics module
+            on_rtps_send(
+                sender_guid,
+                destination_locators_begin,
+                destination_locators_end,
+                length);
+
+            // checkout if sender is a discovery endpoint
+            on_discovery_packet(
+                sender_guid,
+                destination_locators_begin,
+                destination_locators_end);
+        }
+
+        return ret_code;
+    }
+
     //! DomainId
     uint32_t domain_id_;
     //!Attributes of the RTPSParticipant
@@ -522,6 +578,8 @@ private:
     // ResourceSend* mp_send_thr;
     //! Event Resource
     ResourceEvent mp_event_thr;
+    //! Scheduler of the periodic control messages of the endpoints
+    std::unique_ptr<ControlMessageScheduler> control_message_scheduler_;
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Id counter to correctly assign the ids to writers and readers.
@@ -1116,6 +1174,17 @@ public:
     void set_enabled_statistics_writers_mask(
             uint32_t enabled_writers) override;
 
+    /**
+     * @brief Retrieve the heartbeat period and NACK response delay in use by a reliable writer
+     *
+     * @param writer_guid GUID of the writer
+     * @param [out] tuning Times in use by the writer
+     * @return false if the writer is not a reliable writer of this participant, true otherwise
+     */
+    bool get_reliability_tuning(
+            const GUID_t& writer_guid,
+            fastdds::statistics::ReliabilityTuning& tuning);
+
 #endif // FASTDDS_STATISTICS
 
     bool should_match_local_endpoints()
@@ -0,0 +1,860 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogStructuredPersistenceService.cpp
+ *
+ */
+
+#include <rtps/persistence/LogStructuredPersistenceService.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include <boost/interprocess/file_mapping.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/history/WriterHistory.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/*
+ * Layout of the segment files.
+ *
+ * Each segment starts with a header holding SEGMENT_MAGIC and the id of the segment, followed by the records.
+ * A record is a RecordHeader followed by its body, padded to 8 bytes. The CRC covers the kind, the length and the
+ * body, and the state is written last, so a record whose state is not RECORD_LIVE or RECORD_DEAD, or whose CRC does
+ * not match, marks the end of the segment.
+ *
+ * The segments of a log are listed in its manifest file, rewritten whenever a segment is created or deleted, after
+ * the greatest sequence number stored on the log. It is kept there, as the segment holding it may be deleted once
+ * the change is removed.
+ */
+
+static constexpr uint32_t SEGMENT_MAGIC = 0x474C5346;
+static constexpr uint32_t MANIFEST_MAGIC = 0x4D4C5346;
+static constexpr uint32_t SEGMENT_HEADER_SIZE = 16;
+
+static constexpr uint32_t RECORD_EMPTY = 0;
+static constexpr uint32_t RECORD_LIVE = 0x4556494C;
+static constexpr uint32_t RECORD_DEAD = 0x44414544;
+
+static constexpr uint32_t KIND_WRITER_CHANGE = 1;
+static constexpr uint32_t KIND_READER_SEQ = 2;
+
+//! Sequence number, instance handle, related sample identity and source timestamp
+static constexpr uint32_t WRITER_CHANGE_BODY_SIZE = 8 + 16 + 16 + 8 + 8;
+//! Writer GUID and sequence number
+static constexpr uint32_t READER_SEQ_BODY_SIZE = 16 + 8;
+
+struct RecordHeader
+{
+    uint32_t state;
+    uint32_t crc;
+    uint32_t kind;
+    //! Bytes of the body
+    uint32_t length;
+};
+
+static constexpr uint32_t RECORD_HEADER_SIZE = sizeof(RecordHeader);
+
+static uint32_t record_size(
+        uint32_t length)
+{
+    return (RECORD_HEADER_SIZE + length + 7u) & ~7u;
+}
+
+static uint32_t crc32(
+        const octet* data,
+        size_t length)
+{
+    static const std::array<uint32_t, 256> table = []()
+            {
+                std::array<uint32_t, 256> values;
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    uint32_t value = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        value = (value & 1u) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+                    }
+                    values[i] = value;
+                }
+                return values;
+            }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void write_sequence(
+        octet* buffer,
+        const SequenceNumber_t& sequence_number)
+{
+    int64_t value = sequence_number.to64long();
+    memcpy(buffer, &value, sizeof(value));
+}
+
+static SequenceNumber_t read_sequence(
+        const octet* buffer)
+{
+    int64_t value = 0;
+    memcpy(&value, buffer, sizeof(value));
+    return SequenceNumber_t(static_cast<int32_t>((value >> 32) & 0xFFFFFFFF),
+                   static_cast<uint32_t>(value & 0xFFFFFFFF));
+}
+
+static void write_guid(
+        octet* buffer,
+        const GUID_t& guid)
+{
+    memcpy(buffer, guid.guidPrefix.value, GuidPrefix_t::size);
+    memcpy(buffer + GuidPrefix_t::size, guid.entityId.value, EntityId_t::size);
+}
+
+static GUID_t read_guid(
+        const octet* buffer)
+{
+    GUID_t guid;
+    memcpy(guid.guidPrefix.value, buffer, GuidPrefix_t::size);
+    memcpy(guid.entityId.value, buffer + GuidPrefix_t::size, EntityId_t::size);
+    return guid;
+}
+
+/**
+ * Build a file name from a GUID string, which may contain characters not allowed on file names.
+ */
+static std::string hex_name(
+        const std::string& guid)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string name;
+    name.reserve(guid.size() * 2);
+    for (char c : guid)
+    {
+        name.push_back(digits[(static_cast<unsigned char>(c) >> 4) & 0x0F]);
+        name.push_back(digits[static_cast<unsigned char>(c) & 0x0F]);
+    }
+    return name;
+}
+
+IPersistenceService* create_log_structured_persistence_service(
+        const char* directory,
+        uint32_t segment_size,
+        bool sync,
+        bool lazy_load)
+{
+    return new LogStructuredPersistenceService(directory, segment_size, sync, lazy_load);
+}
+
+LogStructuredPersistenceService::LogStructuredPersistenceService(
+        const std::string& directory,
+        uint32_t segment_size,
+        bool sync,
+        bool lazy_load)
+    : directory_(directory)
+    , segment_size_(std::max(segment_size, SEGMENT_HEADER_SIZE + record_size(WRITER_CHANGE_BODY_SIZE)))
+    , sync_(sync)
+    , lazy_load_(lazy_load)
+{
+}
+
+LogStructuredPersistenceService::~LogStructuredPersistenceService()
+{
+    // Records already are on the page cache, just schedule them to be written
+    for (auto& logs : {&writer_logs_, &reader_logs_})
+    {
+        for (auto& log : *logs)
+        {
+            for (auto& segment : log.second->segments)
+            {
+                segment->region.flush(0, 0, true);
+            }
+        }
+    }
+}
+
+bool LogStructuredPersistenceService::load_writer_from_storage(
+        const std::string& persistence_guid,
+        const GUID_t& writer_guid,
+        WriterHistory* history,
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        SequenceNumber_t& next_sequence)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    SegmentLog& log = get_log(persistence_guid, false);
+
+    std::vector<CacheChange_t*>& changes = get_changes(history);
+    for (const auto& entry : log.changes)
+    {
+        const octet* record = entry.second.segment->data() + entry.second.offset;
+        RecordHeader header;
+        memcpy(&header, record, sizeof(header));
+        const octet* body = record + RECORD_HEADER_SIZE;
+        uint32_t size = header.length - WRITER_CHANGE_BODY_SIZE;
+
+        CacheChange_t* change = nullptr;
+        if (!change_pool->reserve_cache(change))
+        {
+            continue;
+        }
+
+        bool load_payload = !lazy_load_ || 0 == size;
+        if (load_payload && !payload_pool->get_payload(size, *change))
+        {
+            change_pool->release_cache(change);
+            continue;
+        }
+
+        change->kind = ALIVE;
+        change->writerGUID = writer_guid;
+        change->sequenceNumber = entry.first;
+        memcpy(change->instanceHandle.value, body + 8, 16);
+        change->serializedPayload.length = size;
+        if (load_payload)
+        {
+            memcpy(change->serializedPayload.data, body + WRITER_CHANGE_BODY_SIZE, size);
+        }
+        change->writer_info.previous = nullptr;
+        change->writer_info.next = nullptr;
+        change->writer_info.num_sent_submessages = 0;
+
+        auto& si = change->write_params.related_sample_identity();
+        si.writer_guid(read_guid(body + 24));
+        si.sequence_number(read_sequence(body + 40));
+
+        int64_t timestamp = 0;
+        memcpy(&timestamp, body + 48, sizeof(timestamp));
+        change->sourceTimestamp.from_ns(timestamp);
+
+        set_fragments(history, change);
+
+        changes.push_back(change);
+    }
+
+    if (log.last_sequence != SequenceNumber_t())
+    {
+        next_sequence = log.last_sequence;
+    }
+
+    return true;
+}
+
+bool LogStructuredPersistenceService::load_writer_payload(
+        const std::string& persistence_guid,
+        CacheChange_t& change,
+        const std::shared_ptr<IPayloadPool>& payload_pool)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " loading payload for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    SegmentLog& log = get_log(persistence_guid, false);
+
+    auto it = log.changes.find(change.sequenceNumber);
+    if (it == log.changes.end())
+    {
+        return false;
+    }
+
+    const octet* record = it->second.segment->data() + it->second.offset;
+    RecordHeader header;
+    memcpy(&header, record, sizeof(header));
+    uint32_t size = header.length - WRITER_CHANGE_BODY_SIZE;
+    if (size != change.serializedPayload.length || !payload_pool->get_payload(size, change))
+    {
+        return false;
+    }
+
+    memcpy(change.serializedPayload.data, record + RECORD_HEADER_SIZE + WRITER_CHANGE_BODY_SIZE, size);
+    change.serializedPayload.length = size;
+    return true;
+}
+
+bool LogStructuredPersistenceService::add_writer_change_to_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
+
+    octet body[WRITER_CHANGE_BODY_SIZE];
+    const SampleIdentity& related_sample_identity = change.write_params.related_sample_identity();
+    int64_t timestamp = change.sourceTimestamp.to_ns();
+    write_sequence(body, change.sequenceNumber);
+    memcpy(body + 8, change.instanceHandle.value, 16);
+    write_guid(body + 24, related_sample_identity.writer_guid());
+    write_sequence(body + 40, related_sample_identity.sequence_number());
+    memcpy(body + 48, &timestamp, sizeof(timestamp));
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    SegmentLog& log = get_log(persistence_guid, false);
+
+    // As on SQLite3, a change cannot be stored twice
+    if (log.changes.find(change.sequenceNumber) != log.changes.end())
+    {
+        return false;
+    }
+
+    Location location;
+    if (!append(log, KIND_WRITER_CHANGE, body, WRITER_CHANGE_BODY_SIZE,
+            change.serializedPayload.data, change.serializedPayload.length, location))
+    {
+        return false;
+    }
+    log.changes.emplace(change.sequenceNumber, location);
+
+    if (log.last_sequence < change.sequenceNumber)
+    {
+        log.last_sequence = change.sequenceNumber;
+    }
+
+    return true;
+}
+
+bool LogStructuredPersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    SegmentLog& log = get_log(persistence_guid, false);
+
+    auto it = log.changes.find(change.sequenceNumber);
+    if (it != log.changes.end())
+    {
+        Location location = it->second;
+        log.changes.erase(it);
+        kill_record(location);
+        compact(log, location.segment);
+    }
+
+    return true;
+}
+
+bool LogStructuredPersistenceService::load_reader_from_storage(
+        const std::string& reader_guid,
+        foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    SegmentLog& log = get_log(reader_guid, true);
+
+    for (const auto& entry : log.readers)
+    {
+        const octet* body = entry.second.segment->data() + entry.second.offset + RECORD_HEADER_SIZE;
+        seq_map[entry.first] = read_sequence(body + 16);
+    }
+
+    return true;
+}
+
+bool LogStructuredPersistenceService::update_writer_seq_on_storage(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
+
+    octet body[READER_SEQ_BODY_SIZE];
+    write_guid(body, writer_guid);
+    write_sequence(body + 16, seq_number);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    SegmentLog& log = get_log(reader_guid, true);
+
+    Location location;
+    if (!append(log, KIND_READER_SEQ, body, READER_SEQ_BODY_SIZE, nullptr, 0, location))
+    {
+        return false;
+    }
+
+    auto it = log.readers.find(writer_guid);
+    if (it != log.readers.end())
+    {
+        Location previous = it->second;
+        it->second = location;
+        kill_record(previous);
+        compact(log, previous.segment);
+    }
+    else
+    {
+        log.readers.emplace(writer_guid, location);
+    }
+
+    return true;
+}
+
+LogStructuredPersistenceService::SegmentLog& LogStructuredPersistenceService::get_log(
+        const std::string& guid,
+        bool is_reader)
+{
+    auto& logs = is_reader ? reader_logs_ : writer_logs_;
+    auto it = logs.find(guid);
+    if (it == logs.end())
+    {
+        std::unique_ptr<SegmentLog> log(new SegmentLog());
+        log->base_name = directory_ + "/" + (is_reader ? "reader_" : "writer_") + hex_name(guid);
+        load_log(*log);
+        it = logs.emplace(guid, std::move(log)).first;
+    }
+    return *it->second;
+}
+
+void LogStructuredPersistenceService::load_log(
+        SegmentLog& log)
+{
+    std::vector<uint32_t> ids;
+    read_manifest(log.base_name, ids, log.last_sequence);
+
+    bool missing_segments = false;
+    for (uint32_t id : ids)
+    {
+        log.next_segment_id = std::max(log.next_segment_id, id + 1);
+
+        std::unique_ptr<Segment> segment(new Segment());
+        segment->id = id;
+        segment->filename = log.base_name + "." + std::to_string(id) + ".seg";
+
+        uint32_t header[2] = {0, 0};
+        if (!map_segment(*segment) || segment->size() < SEGMENT_HEADER_SIZE ||
+                (memcpy(header, segment->data(), sizeof(header)), header[0] != SEGMENT_MAGIC) || header[1] != id)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Ignoring invalid segment " << segment->filename);
+            missing_segments = true;
+            continue;
+        }
+
+        log.segments.push_back(std::move(segment));
+        index_segment(log, *log.segments.back());
+    }
+
+    if (missing_segments)
+    {
+        write_manifest(log);
+    }
+}
+
+void LogStructuredPersistenceService::index_segment(
+        SegmentLog& log,
+        Segment& segment)
+{
+    octet* data = segment.data();
+    uint32_t size = segment.size();
+    uint32_t offset = SEGMENT_HEADER_SIZE;
+    bool torn = false;
+
+    while (size - offset >= RECORD_HEADER_SIZE)
+    {
+        RecordHeader header;
+        memcpy(&header, data + offset, sizeof(header));
+        if (header.state == RECORD_EMPTY)
+        {
+            break;
+        }
+
+        if ((header.state != RECORD_LIVE && header.state != RECORD_DEAD) ||
+                header.length > size - offset - RECORD_HEADER_SIZE ||
+                header.crc != crc32(data + offset + 8, 8 + header.length))
+        {
+            torn = true;
+            break;
+        }
+
+        const octet* body = data + offset + RECORD_HEADER_SIZE;
+        Location location{&segment, offset};
+        bool live = header.state == RECORD_LIVE;
+        if (live)
+        {
+            segment.live_bytes += record_size(header.length);
+            ++segment.live_records;
+        }
+
+        if (header.kind == KIND_WRITER_CHANGE && header.length >= WRITER_CHANGE_BODY_SIZE)
+        {
+            SequenceNumber_t sequence_number = read_sequence(body);
+            if (log.last_sequence < sequence_number)
+            {
+                log.last_sequence = sequence_number;
+            }
+
+            if (live)
+            {
+                // A copy left by an interrupted compaction
+                auto it = log.changes.find(sequence_number);
+                if (it != log.changes.end())
+                {
+                    kill_record(it->second);
+                    it->second = location;
+                }
+                else
+                {
+                    log.changes.emplace(sequence_number, location);
+                }
+            }
+        }
+        else if (header.kind == KIND_READER_SEQ && header.length == READER_SEQ_BODY_SIZE)
+        {
+            if (live)
+            {
+                // Records are scanned in the order they were written, so the last one wins
+                GUID_t writer_guid = read_guid(body);
+                auto it = log.readers.find(writer_guid);
+                if (it != log.readers.end())
+                {
+                    kill_record(it->second);
+                    it->second = location;
+                }
+                else
+                {
+                    log.readers.emplace(writer_guid, location);
+                }
+            }
+        }
+        else if (live)
+        {
+            kill_record(location);
+        }
+
+        offset += record_size(header.length);
+    }
+
+    segment.end = offset;
+
+    if (torn)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Discarding incomplete record on " << segment.filename);
+        // Clear the incomplete record, so it is not mistaken for the end of the ones appended later
+        memset(data + offset, 0, size - offset);
+    }
+}
+
+bool LogStructuredPersistenceService::append(
+        SegmentLog& log,
+        uint32_t kind,
+        const octet* body,
+        uint32_t body_length,
+        const octet* payload,
+        uint32_t payload_length,
+        Location& location)
+{
+    if (payload_length > std::numeric_limits<uint32_t>::max() - SEGMENT_HEADER_SIZE - RECORD_HEADER_SIZE -
+            body_length - 8)
+    {
+        return false;
+    }
+
+    uint32_t length = body_length + payload_length;
+    uint32_t size = record_size(length);
+
+    Segment* segment = log.segments.empty() ? nullptr : log.segments.back().get();
+    if (nullptr == segment || segment->size() - segment->end < size)
+    {
+        segment = create_segment(log, std::max(segment_size_, SEGMENT_HEADER_SIZE + size));
+        if (nullptr == segment)
+        {
+            return false;
+        }
+    }
+
+    octet* record = segment->data() + segment->end;
+    RecordHeader header{RECORD_EMPTY, 0, kind, length};
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + RECORD_HEADER_SIZE, body, body_length);
+    if (payload_length > 0)
+    {
+        memcpy(record + RECORD_HEADER_SIZE + body_length, payload, payload_length);
+    }
+    header.crc = crc32(record + 8, 8 + length);
+    memcpy(record + 4, &header.crc, sizeof(header.crc));
+
+    // The state must not be stored before the rest of the record
+    std::atomic_signal_fence(std::memory_order_release);
+    memcpy(record, &RECORD_LIVE, sizeof(RECORD_LIVE));
+
+    location.segment = segment;
+    location.offset = segment->end;
+    segment->end += size;
+    segment->live_bytes += size;
+    ++segment->live_records;
+
+    flush_record(location);
+    return true;
+}
+
+LogStructuredPersistenceService::Segment* LogStructuredPersistenceService::create_segment(
+        SegmentLog& log,
+        uint32_t size)
+{
+    std::unique_ptr<Segment> segment(new Segment());
+    segment->id = log.next_segment_id++;
+    segment->filename = log.base_name + "." + std::to_string(segment->id) + ".seg";
+
+    {
+        std::ofstream file(segment->filename, std::ios::binary | std::ios::trunc);
+        file.seekp(size - 1);
+        file.put(0);
+        if (!file)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Cannot create segment " << segment->filename);
+            return nullptr;
+        }
+    }
+
+    if (!map_segment(*segment))
+    {
+        std::remove(segment->filename.c_str());
+        return nullptr;
+    }
+
+    uint32_t header[2] = {SEGMENT_MAGIC, segment->id};
+    memcpy(segment->data(), header, sizeof(header));
+    segment->end = SEGMENT_HEADER_SIZE;
+
+    log.segments.push_back(std::move(segment));
+    if (!write_manifest(log))
+    {
+        std::string filename = log.segments.back()->filename;
+        log.segments.pop_back();
+        std::remove(filename.c_str());
+        return nullptr;
+    }
+
+    return log.segments.back().get();
+}
+
+bool LogStructuredPersistenceService::map_segment(
+        Segment& segment)
+{
+    try
+    {
+        boost::interprocess::file_mapping file(segment.filename.c_str(), boost::interprocess::read_write);
+        boost::interprocess::mapped_region region(file, boost::interprocess::read_write);
+        segment.region.swap(region);
+        return true;
+    }
+    catch (const boost::interprocess::interprocess_exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Cannot map segment " << segment.filename << ": " << e.what());
+    }
+
+    return false;
+}
+
+void LogStructuredPersistenceService::kill_record(
+        const Location& location)
+{
+    octet* record = location.segment->data() + location.offset;
+    RecordHeader header;
+    memcpy(&header, record, sizeof(header));
+    memcpy(record, &RECORD_DEAD, sizeof(RECORD_DEAD));
+
+    location.segment->live_bytes -= record_size(header.length);
+    --location.segment->live_records;
+
+    if (sync_)
+    {
+        location.segment->region.flush(location.offset, sizeof(header), false);
+    }
+}
+
+void LogStructuredPersistenceService::compact(
+        SegmentLog& log,
+        Segment* segment)
+{
+    // The last segment is kept, as records are appended to it
+    if (segment == log.segments.back().get())
+    {
+        return;
+    }
+
+    // Move the live records of a segment mostly made of removed ones to the end of the log
+    if (segment->live_records > 0 && segment->live_bytes < (segment->end - SEGMENT_HEADER_SIZE) / 4)
+    {
+        uint32_t offset = SEGMENT_HEADER_SIZE;
+        while (offset < segment->end)
+        {
+            const octet* record = segment->data() + offset;
+            RecordHeader header;
+            memcpy(&header, record, sizeof(header));
+
+            if (header.state == RECORD_LIVE)
+            {
+                const octet* body = record + RECORD_HEADER_SIZE;
+                Location location;
+                if (!append(log, header.kind, body, header.length, nullptr, 0, location))
+                {
+                    return;
+                }
+
+                if (header.kind == KIND_WRITER_CHANGE)
+                {
+                    log.changes[read_sequence(body)] = location;
+                }
+                else
+                {
+                    log.readers[read_guid(body)] = location;
+                }
+                kill_record(Location{segment, offset});
+            }
+
+            offset += record_size(header.length);
+        }
+    }
+
+    if (segment->live_records == 0)
+    {
+        delete_segment(log, segment);
+    }
+}
+
+void LogStructuredPersistenceService::delete_segment(
+        SegmentLog& log,
+        Segment* segment)
+{
+    auto it = std::find_if(log.segments.begin(), log.segments.end(),
+                    [segment](const std::unique_ptr<Segment>& item)
+                    {
+                        return item.get() == segment;
+                    });
+
+    std::unique_ptr<Segment> deleted = std::move(*it);
+    log.segments.erase(it);
+    if (!write_manifest(log))
+    {
+        // Keep the segment, as the manifest still lists it
+        log.segments.insert(std::upper_bound(log.segments.begin(), log.segments.end(), deleted,
+                [](const std::unique_ptr<Segment>& a, const std::unique_ptr<Segment>& b)
+                {
+                    return a->id < b->id;
+                }), std::move(deleted));
+        return;
+    }
+
+    std::string filename = deleted->filename;
+    // Unmap the file before removing it
+    deleted.reset();
+    std::remove(filename.c_str());
+}
+
+bool LogStructuredPersistenceService::write_manifest(
+        const SegmentLog& log)
+{
+    std::vector<uint32_t> content;
+    content.reserve(log.segments.size() + 5);
+    content.push_back(MANIFEST_MAGIC);
+    content.push_back(static_cast<uint32_t>(log.segments.size()));
+    for (const auto& segment : log.segments)
+    {
+        content.push_back(segment->id);
+    }
+    content.push_back(static_cast<uint32_t>(log.last_sequence.high));
+    content.push_back(log.last_sequence.low);
+    content.push_back(crc32(reinterpret_cast<const octet*>(content.data()), content.size() * sizeof(uint32_t)));
+
+    // Write a new manifest and replace the previous one, so a crash leaves one of them complete
+    std::string filename = log.base_name + ".manifest";
+    std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream file(tmp_filename, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(content.data()),
+                static_cast<std::streamsize>(content.size() * sizeof(uint32_t)));
+        if (!file)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Cannot write " << tmp_filename);
+            return false;
+        }
+    }
+
+    if (0 != std::rename(tmp_filename.c_str(), filename.c_str()))
+    {
+        // Some platforms do not replace existing files when renaming
+        std::remove(filename.c_str());
+        if (0 != std::rename(tmp_filename.c_str(), filename.c_str()))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Cannot replace " << filename);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void LogStructuredPersistenceService::read_manifest(
+        const std::string& base_name,
+        std::vector<uint32_t>& ids,
+        SequenceNumber_t& last_sequence)
+{
+    std::string filename = base_name + ".manifest";
+    for (const std::string& name : {filename, filename + ".tmp"})
+    {
+        std::ifstream file(name, std::ios::binary);
+        if (!file)
+        {
+            continue;
+        }
+
+        std::vector<uint32_t> content;
+        uint32_t value = 0;
+        while (file.read(reinterpret_cast<char*>(&value), sizeof(value)))
+        {
+            content.push_back(value);
+        }
+
+        if (content.size() >= 5 && content[0] == MANIFEST_MAGIC && content[1] == content.size() - 5 &&
+                content.back() == crc32(reinterpret_cast<const octet*>(content.data()),
+                (content.size() - 1) * sizeof(uint32_t)))
+        {
+            ids.assign(content.begin() + 2, content.end() - 3);
+            last_sequence = SequenceNumber_t(static_cast<int32_t>(content[content.size() - 3]),
+                            content[content.size() - 2]);
+            return;
+        }
+
+        EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Ignoring invalid manifest " << name);
+    }
+}
+
+void LogStructuredPersistenceService::flush_record(
+        const Location& location)
+{
+    if (sync_)
+    {
+        RecordHeader header;
+        memcpy(&header, location.segment->data() + location.offset, sizeof(header));
+        location.segment->region.flush(location.offset, record_size(header.length), false);
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,227 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogStructuredPersistenceService.h
+ */
+
+#ifndef LOGSTRUCTUREDPERSISTENCESERVICE_H_
+#define LOGSTRUCTUREDPERSISTENCESERVICE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <rtps/persistence/PersistenceService.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Create a new log structured implementation of persistence service
+ * @param directory Existing directory where the segment files are created.
+ * @param segment_size Size in bytes of each segment file.
+ * @param sync Whether to flush each record to disk before returning.
+ * @param lazy_load Whether to copy the payloads of the writer changes only when they are sent.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+IPersistenceService* create_log_structured_persistence_service(
+        const char* directory,
+        uint32_t segment_size,
+        bool sync,
+        bool lazy_load = false);
+
+/**
+ * Persistence service implementation over append only segment files.
+ *
+ * Each writer and each reader has its own log, made of a list of memory mapped segment files. Records are appended
+ * to the last segment and checked with a CRC when loaded, so a record torn by a crash is discarded. Removing a change
+ * only marks its record as dead. Segments without live records are deleted and sparse ones are compacted, moving
+ * their live records to the end of the log.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class LogStructuredPersistenceService : public IPersistenceService
+{
+public:
+
+    /**
+     * @param directory Existing directory where the segment files are created.
+     * @param segment_size Size in bytes of each segment file. Larger records get a segment of their own.
+     * @param sync Whether to flush each record to disk before returning. Otherwise records survive a crash of the
+     * process but may be lost on a crash of the system.
+     * @param lazy_load When true, loading a writer leaves the payloads on the mapped segments, and they are copied
+     * when load_writer_payload is called.
+     */
+    LogStructuredPersistenceService(
+            const std::string& directory,
+            uint32_t segment_size,
+            bool sync,
+            bool lazy_load = false);
+
+    virtual ~LogStructuredPersistenceService() override;
+
+    bool load_writer_from_storage(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            WriterHistory* history,
+            const std::shared_ptr<IChangePool>& change_pool,
+            const std::shared_ptr<IPayloadPool>& payload_pool,
+            SequenceNumber_t& next_sequence) final;
+
+    bool load_writer_payload(
+            const std::string& persistence_guid,
+            CacheChange_t& change,
+            const std::shared_ptr<IPayloadPool>& payload_pool) final;
+
+    bool add_writer_change_to_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool remove_writer_change_from_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool load_reader_from_storage(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map) final;
+
+    bool update_writer_seq_on_storage(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number) final;
+
+private:
+
+    struct Segment
+    {
+        uint32_t id = 0;
+        std::string filename;
+        boost::interprocess::mapped_region region;
+        //! Offset where the next record will be written
+        uint32_t end = 0;
+        //! Bytes used by records not removed
+        uint32_t live_bytes = 0;
+        //! Number of records not removed
+        uint32_t live_records = 0;
+
+        octet* data() const
+        {
+            return static_cast<octet*>(region.get_address());
+        }
+
+        uint32_t size() const
+        {
+            return static_cast<uint32_t>(region.get_size());
+        }
+
+    };
+
+    //! Position of a record
+    struct Location
+    {
+        Segment* segment;
+        uint32_t offset;
+    };
+
+    struct SegmentLog
+    {
+        //! Common prefix of the files of the log
+        std::string base_name;
+        //! Segments in creation order. Records are appended to the last one.
+        std::vector<std::unique_ptr<Segment>> segments;
+        uint32_t next_segment_id = 0;
+        //! Live changes of a writer
+        std::map<SequenceNumber_t, Location> changes;
+        //! Live sequence numbers of a reader
+        std::map<GUID_t, Location> readers;
+        //! Greatest sequence number ever stored on a writer
+        SequenceNumber_t last_sequence;
+    };
+
+    SegmentLog& get_log(
+            const std::string& guid,
+            bool is_reader);
+
+    void load_log(
+            SegmentLog& log);
+
+    void index_segment(
+            SegmentLog& log,
+            Segment& segment);
+
+    bool append(
+            SegmentLog& log,
+            uint32_t kind,
+            const octet* body,
+            uint32_t body_length,
+            const octet* payload,
+            uint32_t payload_length,
+            Location& location);
+
+    Segment* create_segment(
+            SegmentLog& log,
+            uint32_t size);
+
+    bool map_segment(
+            Segment& segment);
+
+    void kill_record(
+            const Location& location);
+
+    void compact(
+            SegmentLog& log,
+            Segment* segment);
+
+    void delete_segment(
+            SegmentLog& log,
+            Segment* segment);
+
+    bool write_manifest(
+            const SegmentLog& log);
+
+    //! Get the ids of the segments of a log and its greatest sequence number. Empty when nothing was stored yet.
+    void read_manifest(
+            const std::string& base_name,
+            std::vector<uint32_t>& ids,
+            SequenceNumber_t& last_sequence);
+
+    void flush_record(
+            const Location& location);
+
+    std::string directory_;
+
+    uint32_t segment_size_;
+
+    bool sync_;
+
+    bool lazy_load_;
+
+    std::mutex mutex_;
+
+    std::map<std::string, std::unique_ptr<SegmentLog>> writer_logs_;
+
+    std::map<std::string, std::unique_ptr<SegmentLog>> reader_logs_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* LOGSTRUCTUREDPERSISTENCESERVICE_H_ */
@@ -18,14 +18,18 @@
  */
 
 #include <rtps/persistence/PersistenceService.h>
+#include <rtps/persistence/LogStructuredPersistenceService.h>
 
 #if HAVE_SQLITE3
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #endif // if HAVE_SQLITE3
 
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 
+#include <cstdlib>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -51,6 +55,16 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
 
     if (plugin_property != nullptr)
     {
+        bool lazy_load = false;
+        const std::string* lazy_load_value = PropertyPolicyHelper::find_property(property_policy,
+                        "dds.persistence.lazy_load");
+        if (lazy_load_value != nullptr &&
+                ((lazy_load_value->compare("TRUE") == 0) ||
+                (lazy_load_value->compare("true") == 0)))
+        {
+            lazy_load = true;
+        }
+
 #if HAVE_SQLITE3
         if (plugin_property->compare("builtin.SQLITE3") == 0)
         {
@@ -72,9 +86,69 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
             {
                 update_schema = true;
             }
-            ret_val = create_SQLite3_persistence_service(filename, update_schema);
+            uint32_t commit_period_ms = 0;
+            const std::string* commit_period_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.sqlite3.commit_period");
+            if (commit_period_value != nullptr)
+            {
+                char* ptr = nullptr;
+                unsigned long period = strtoul(commit_period_value->c_str(), &ptr, 10);
+
+                if (commit_period_value->c_str() != ptr)     // A valid integer was read.
+                {
+                    commit_period_ms = static_cast<uint32_t>(period);
+                }
+                else
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE,
+                            "Not numerical value for dds.persistence.sqlite3.commit_period property. "
+                            "Storing changes synchronously");
+                }
+            }
+            ret_val = create_SQLite3_persistence_service(filename, update_schema, commit_period_ms, lazy_load);
         }
 #endif // if HAVE_SQLITE3
+        if (plugin_property->compare("builtin.LOG_STRUCTURED") == 0)
+        {
+            const std::string* directory_property = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.log_structured.directory");
+#ifdef ANDROID
+            const char* directory = (directory_property == nullptr) ?
+                    "/data/local/tmp" : directory_property->c_str();
+#else
+            const char* directory = (directory_property == nullptr) ?
+                    "." : directory_property->c_str();
+#endif // if ANDROID
+            uint32_t segment_size = 4 * 1024 * 1024;
+            const std::string* segment_size_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.log_structured.segment_size");
+            if (segment_size_value != nullptr)
+            {
+                char* ptr = nullptr;
+                unsigned long size = strtoul(segment_size_value->c_str(), &ptr, 10);
+
+                if (segment_size_value->c_str() != ptr)     // A valid integer was read.
+                {
+                    segment_size = static_cast<uint32_t>(size);
+                }
+                else
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE,
+                            "Not numerical value for dds.persistence.log_structured.segment_size property. "
+                            "Using default segment size");
+                }
+            }
+            bool sync = false;
+            const std::string* sync_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.log_structured.sync");
+            if (sync_value != nullptr &&
+                    ((sync_value->compare("TRUE") == 0) ||
+                    (sync_value->compare("true") == 0)))
+            {
+                sync = true;
+            }
+            ret_val = create_log_structured_persistence_service(directory, segment_size, sync, lazy_load);
+        }
     }
 
     return ret_val;
@@ -67,6 +67,20 @@ public:
             const std::shared_ptr<IPayloadPool>& payload_pool,
             SequenceNumber_t& next_sequence) = 0;
 
+    /**
+     * Get the payload of a change loaded without it.
+     * When loading lazily, load_writer_from_storage fills the length of the payload of each change without reserving
+     * it. This method reserves the payload and reads it from storage.
+     * @param persistence_guid   GUID of the writer used to store samples.
+     * @param change             The cache change to fill.
+     * @param payload_pool       Pool where the payload should be obtained from.
+     * @return True if operation was successful.
+     */
+    virtual bool load_writer_payload(
+            const std::string& persistence_guid,
+            CacheChange_t& change,
+            const std::shared_ptr<IPayloadPool>& payload_pool) = 0;
+
     /**
      * Add a change to storage.
      * @param persistence_guid   GUID of the writer used to store samples.
@@ -116,6 +130,13 @@ public:
             WriterHistory* history,
             CacheChange_t* change);
 
+    //! Whether a change was loaded lazily and its payload is still only on storage.
+    static bool is_payload_pending(
+            const CacheChange_t& change)
+    {
+        return nullptr == change.payload_owner() && 0 < change.serializedPayload.length;
+    }
+
 };
 
 /**
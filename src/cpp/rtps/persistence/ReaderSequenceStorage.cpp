@@ -0,0 +1,127 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderSequenceStorage.cpp
+ *
+ */
+
+#include <rtps/persistence/ReaderSequenceStorage.h>
+
+#include <cstdlib>
+#include <utility>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <rtps/persistence/PersistenceService.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+ReaderSequenceStorage::ReaderSequenceStorage(
+        IPersistenceService* persistence,
+        const std::string& reader_guid,
+        ResourceEvent& service,
+        uint32_t period_ms)
+    : persistence_(persistence)
+    , reader_guid_(reader_guid)
+{
+    if (0 < period_ms)
+    {
+        flush_event_ = new TimedEvent(service, [this]()
+                        {
+                            flush();
+                            return false;
+                        }, period_ms);
+    }
+}
+
+ReaderSequenceStorage::~ReaderSequenceStorage()
+{
+    // The event is destroyed first, so it cannot run while the pending updates are written
+    delete flush_event_;
+    flush();
+}
+
+uint32_t ReaderSequenceStorage::get_period(
+        const PropertyPolicy& endpoint_properties,
+        const PropertyPolicy& participant_properties)
+{
+    const std::string* period_value = PropertyPolicyHelper::find_property(endpoint_properties,
+                    "dds.persistence.reader.update_period");
+    if (period_value == nullptr)
+    {
+        period_value = PropertyPolicyHelper::find_property(participant_properties,
+                        "dds.persistence.reader.update_period");
+    }
+
+    if (period_value != nullptr)
+    {
+        char* ptr = nullptr;
+        unsigned long period = strtoul(period_value->c_str(), &ptr, 10);
+
+        if (period_value->c_str() != ptr)     // A valid integer was read.
+        {
+            return static_cast<uint32_t>(period);
+        }
+
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE,
+                "Not numerical value for dds.persistence.reader.update_period property. "
+                "Storing sequence numbers synchronously");
+    }
+
+    return 0;
+}
+
+void ReaderSequenceStorage::update(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    if (nullptr == flush_event_)
+    {
+        persistence_->update_writer_seq_on_storage(reader_guid_, writer_guid, seq_number);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        pending_[writer_guid] = seq_number;
+    }
+
+    // Does nothing when the event is already scheduled
+    flush_event_->restart_timer();
+}
+
+void ReaderSequenceStorage::flush()
+{
+    std::lock_guard<std::mutex> flush_guard(flush_mutex_);
+
+    std::map<GUID_t, SequenceNumber_t> updates;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        updates.swap(pending_);
+    }
+
+    for (const auto& update : updates)
+    {
+        persistence_->update_writer_seq_on_storage(reader_guid_, update.first, update.second);
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
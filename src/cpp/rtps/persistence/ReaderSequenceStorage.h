@@ -0,0 +1,109 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderSequenceStorage.h
+ */
+
+#ifndef READERSEQUENCESTORAGE_H_
+#define READERSEQUENCESTORAGE_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class IPersistenceService;
+class ResourceEvent;
+class TimedEvent;
+
+/**
+ * Stores the last sequence number notified by a persistent reader for each writer.
+ *
+ * When an update period is configured, updates are kept in memory and only the latest value for each writer is
+ * written to the persistence service once per period, and when the object is destroyed.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class ReaderSequenceStorage
+{
+public:
+
+    /**
+     * @param persistence Persistence service of the reader. Not owned.
+     * @param reader_guid Persistence GUID of the reader.
+     * @param service Event service where updates are written.
+     * @param period_ms Period in milliseconds between writes. Zero to write each update synchronously.
+     */
+    ReaderSequenceStorage(
+            IPersistenceService* persistence,
+            const std::string& reader_guid,
+            ResourceEvent& service,
+            uint32_t period_ms);
+
+    //! Writes the pending updates.
+    ~ReaderSequenceStorage();
+
+    /**
+     * Get the update period configured on a set of properties.
+     * @param endpoint_properties Properties of the reader, looked up first.
+     * @param participant_properties Properties of the participant.
+     * @return Period in milliseconds of the dds.persistence.reader.update_period property, zero if not found.
+     */
+    static uint32_t get_period(
+            const PropertyPolicy& endpoint_properties,
+            const PropertyPolicy& participant_properties);
+
+    /**
+     * Set the last sequence number notified for a writer.
+     * @param writer_guid GUID of the writer.
+     * @param seq_number Sequence number.
+     */
+    void update(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number);
+
+    //! Write the pending updates.
+    void flush();
+
+private:
+
+    IPersistenceService* persistence_;
+
+    std::string reader_guid_;
+
+    //! Protects pending_
+    std::mutex mutex_;
+
+    //! Latest sequence number not yet written for each writer
+    std::map<GUID_t, SequenceNumber_t> pending_;
+
+    //! Keeps writes in order, so an older value is never written after a newer one
+    std::mutex flush_mutex_;
+
+    TimedEvent* flush_event_ = nullptr;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* READERSEQUENCESTORAGE_H_ */
@@ -26,6 +26,7 @@
 #include <rtps/persistence/sqlite3.h>
 
 #include <sstream>
+#include <utility>
 
 namespace eprosima {
 namespace fastrtps {
@@ -184,22 +185,30 @@ static void finalize_statement(
 
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        uint32_t commit_period_ms,
+        bool lazy_load)
 {
     sqlite3* db = open_or_create_database(filename, update_schema);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, commit_period_ms, lazy_load);
 }
 
 SQLite3PersistenceService::SQLite3PersistenceService(
-        sqlite3* db)
+        sqlite3* db,
+        uint32_t commit_period_ms,
+        bool lazy_load)
     : db_(db)
     , load_writer_stmt_(NULL)
+    , load_writer_index_stmt_(NULL)
+    , load_writer_payload_stmt_(NULL)
     , add_writer_change_stmt_(NULL)
     , remove_writer_change_stmt_(NULL)
     , load_writer_last_seq_num_stmt_(NULL)
     , update_writer_last_seq_num_stmt_(NULL)
     , load_reader_stmt_(NULL)
     , update_reader_stmt_(NULL)
+    , commit_period_(commit_period_ms)
+    , lazy_load_(lazy_load)
 {
     // Prepare writer statements
     sqlite3_prepare_v3(db_, "SELECT seq_num, instance, payload, related_sample_guid, related_sample_seq_num, source_timestamp "
@@ -207,6 +216,12 @@ SQLite3PersistenceService::SQLite3PersistenceService(
             SQLITE_PREPARE_PERSISTENT,
             &load_writer_stmt_,
             NULL);
+    // length() of a blob does not read its content
+    sqlite3_prepare_v3(db_, "SELECT seq_num, instance, length(payload), related_sample_guid, related_sample_seq_num, "
+            "source_timestamp FROM writers_histories WHERE guid=?;", -1, SQLITE_PREPARE_PERSISTENT,
+            &load_writer_index_stmt_, NULL);
+    sqlite3_prepare_v3(db_, "SELECT payload FROM writers_histories WHERE guid=? AND seq_num=?;", -1,
+            SQLITE_PREPARE_PERSISTENT, &load_writer_payload_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT INTO writers_histories VALUES(?,?,?,?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
             &add_writer_change_stmt_, NULL);
     sqlite3_prepare_v3(db_, "DELETE FROM writers_histories WHERE guid=? AND seq_num=?;", -1, SQLITE_PREPARE_PERSISTENT,
@@ -222,12 +237,31 @@ SQLite3PersistenceService::SQLite3PersistenceService(
             SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
             &update_reader_stmt_, NULL);
+
+    if (commit_period_.count() > 0)
+    {
+        running_ = true;
+        commit_thread_ = std::thread(&SQLite3PersistenceService::run_commits, this);
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    if (commit_thread_.joinable())
+    {
+        // The thread commits the remaining operations before exiting
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            running_ = false;
+        }
+        queue_cv_.notify_one();
+        commit_thread_.join();
+    }
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
+    finalize_statement(load_writer_index_stmt_);
+    finalize_statement(load_writer_payload_stmt_);
     finalize_statement(add_writer_change_stmt_);
     finalize_statement(remove_writer_change_stmt_);
 
@@ -266,18 +300,23 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
-    if (load_writer_stmt_ != NULL)
+    flush();
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
+    // When loading lazily, the third column holds the length of the payload instead of the payload
+    sqlite3_stmt* load_stmt = lazy_load_ ? load_writer_index_stmt_ : load_writer_stmt_;
+    if (load_stmt != NULL)
     {
-        sqlite3_reset(load_writer_stmt_);
-        sqlite3_bind_text(load_writer_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
+        sqlite3_reset(load_stmt);
+        sqlite3_bind_text(load_stmt, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
 
         std::vector<CacheChange_t*>& changes = get_changes(history);
 
-        while (SQLITE_ROW == sqlite3_step(load_writer_stmt_))
+        while (SQLITE_ROW == sqlite3_step(load_stmt))
         {
-            SequenceNumber_t sn(sqlite3_column_int64(load_writer_stmt_, 0));
+            SequenceNumber_t sn(sqlite3_column_int64(load_stmt, 0));
             CacheChange_t* change = nullptr;
-            int size = sqlite3_column_bytes(load_writer_stmt_, 2);
+            int size = lazy_load_ ? sqlite3_column_int(load_stmt, 2) : sqlite3_column_bytes(load_stmt, 2);
 
             if (!change_pool->reserve_cache(change))
             {
@@ -287,20 +326,24 @@ bool SQLite3PersistenceService::load_writer_from_storage(
             SampleIdentity identity;
             identity.writer_guid(writer_guid);
             identity.sequence_number(sn);
-            if (!payload_pool->get_payload(size, *change))
+            bool load_payload = !lazy_load_ || 0 == size;
+            if (load_payload && !payload_pool->get_payload(size, *change))
             {
                 change_pool->release_cache(change);
                 continue;
             }
 
-            int instance_size = sqlite3_column_bytes(load_writer_stmt_, 1);
+            int instance_size = sqlite3_column_bytes(load_stmt, 1);
             instance_size = (instance_size > 16) ? 16 : instance_size;
             change->kind = ALIVE;
             change->writerGUID = writer_guid;
-            memcpy(change->instanceHandle.value, sqlite3_column_blob(load_writer_stmt_, 1), instance_size);
+            memcpy(change->instanceHandle.value, sqlite3_column_blob(load_stmt, 1), instance_size);
             change->sequenceNumber = identity.sequence_number();
             change->serializedPayload.length = size;
-            memcpy(change->serializedPayload.data, sqlite3_column_blob(load_writer_stmt_, 2), size);
+            if (load_payload)
+            {
+                memcpy(change->serializedPayload.data, sqlite3_column_blob(load_stmt, 2), size);
+            }
             change->writer_info.previous = nullptr;
             change->writer_info.next = nullptr;
             change->writer_info.num_sent_submessages = 0;
@@ -309,16 +352,16 @@ bool SQLite3PersistenceService::load_writer_from_storage(
             {
                 using namespace std;
                 // GUID_t
-                istringstream is(string(reinterpret_cast<const char*>(sqlite3_column_text(load_writer_stmt_, 3))));
+                istringstream is(string(reinterpret_cast<const char*>(sqlite3_column_text(load_stmt, 3))));
                 auto& si = change->write_params.related_sample_identity();
                 is >> si.writer_guid();
                 // Sequence Number
-                SequenceNumber_t rsn(sqlite3_column_int64(load_writer_stmt_, 4));
+                SequenceNumber_t rsn(sqlite3_column_int64(load_stmt, 4));
                 si.sequence_number(rsn);
             }
 
             // timestamp
-            change->sourceTimestamp.from_ns(sqlite3_column_int64(load_writer_stmt_, 5));
+            change->sourceTimestamp.from_ns(sqlite3_column_int64(load_stmt, 5));
 
             set_fragments(history, change);
 
@@ -337,6 +380,45 @@ bool SQLite3PersistenceService::load_writer_from_storage(
     return true;
 }
 
+/**
+ * Get the payload of a change loaded without it.
+ * @param change The cache change to fill.
+ * @param payload_pool Pool from which the payload is reserved.
+ * @return True if operation was successful.
+ */
+bool SQLite3PersistenceService::load_writer_payload(
+        const std::string& persistence_guid,
+        CacheChange_t& change,
+        const std::shared_ptr<IPayloadPool>& payload_pool)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " loading payload for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
+    bool ret_val = false;
+    if (load_writer_payload_stmt_ != NULL)
+    {
+        sqlite3_reset(load_writer_payload_stmt_);
+        sqlite3_bind_text(load_writer_payload_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(load_writer_payload_stmt_, 2, change.sequenceNumber.to64long());
+
+        if (SQLITE_ROW == sqlite3_step(load_writer_payload_stmt_))
+        {
+            uint32_t size = static_cast<uint32_t>(sqlite3_column_bytes(load_writer_payload_stmt_, 0));
+            if (size == change.serializedPayload.length && payload_pool->get_payload(size, change))
+            {
+                memcpy(change.serializedPayload.data, sqlite3_column_blob(load_writer_payload_stmt_, 0), size);
+                change.serializedPayload.length = size;
+                ret_val = true;
+            }
+        }
+        sqlite3_reset(load_writer_payload_stmt_);
+    }
+
+    return ret_val;
+}
+
 /**
  * Add a change to storage.
  * @param change The cache change to add.
@@ -349,33 +431,62 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
+    if (commit_thread_.joinable())
+    {
+        // The payload is copied, as the change may be released before the operation is committed
+        Operation operation;
+        operation.kind = Operation::ADD_WRITER_CHANGE;
+        operation.guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber;
+        operation.instance_handle = change.instanceHandle;
+        operation.payload.assign(change.serializedPayload.data,
+                change.serializedPayload.data + change.serializedPayload.length);
+        operation.related_sample_identity = change.write_params.related_sample_identity();
+        operation.source_timestamp = change.sourceTimestamp.to_ns();
+        enqueue(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+    return store_writer_change(persistence_guid, change.sequenceNumber, change.instanceHandle,
+                   change.serializedPayload.data, change.serializedPayload.length,
+                   change.write_params.related_sample_identity(), change.sourceTimestamp.to_ns());
+}
+
+bool SQLite3PersistenceService::store_writer_change(
+        const std::string& persistence_guid,
+        const SequenceNumber_t& sequence_number,
+        const InstanceHandle_t& instance_handle,
+        const octet* payload,
+        uint32_t payload_length,
+        const SampleIdentity& related_sample_identity,
+        int64_t source_timestamp)
+{
     if (add_writer_change_stmt_ != NULL)
     {
         //First add the last seq number, it is needed for the foreign key on writers_histories
         sqlite3_reset(update_writer_last_seq_num_stmt_);
         sqlite3_bind_text(update_writer_last_seq_num_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, sequence_number.to64long());
 
         if (sqlite3_step(update_writer_last_seq_num_stmt_) == SQLITE_DONE)
         {
             sqlite3_reset(add_writer_change_stmt_);
             sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-            if (change.instanceHandle.isDefined())
+            sqlite3_bind_int64(add_writer_change_stmt_, 2, sequence_number.to64long());
+            if (instance_handle.isDefined())
             {
-                sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
+                sqlite3_bind_blob(add_writer_change_stmt_, 3, instance_handle.value, 16, SQLITE_STATIC);
             }
             else
             {
                 sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
             }
-            sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data,
-                    change.serializedPayload.length, SQLITE_STATIC);
+            sqlite3_bind_blob(add_writer_change_stmt_, 4, payload, payload_length, SQLITE_STATIC);
 
             // related sample identity
             std::ostringstream os;
-            auto& si = change.write_params.related_sample_identity();
-            os << si.writer_guid();
+            os << related_sample_identity.writer_guid();
 
             // IMPORTANT: this element must survive until the call (sqlite3_step) has been fulfilled.
             // Another way would be to use SQLITE_TRANSIENT instead of static, forcing an internal copy,
@@ -383,10 +494,10 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
             std::string guids = os.str();
 
             sqlite3_bind_text(add_writer_change_stmt_, 5, guids.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 6, si.sequence_number().to64long());
+            sqlite3_bind_int64(add_writer_change_stmt_, 6, related_sample_identity.sequence_number().to64long());
 
             // source time stamp
-            sqlite3_bind_int64(add_writer_change_stmt_, 7, change.sourceTimestamp.to_ns());
+            sqlite3_bind_int64(add_writer_change_stmt_, 7, source_timestamp);
 
             return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
         }
@@ -407,11 +518,29 @@ bool SQLite3PersistenceService::remove_writer_change_from_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
 
+    if (commit_thread_.joinable())
+    {
+        Operation operation;
+        operation.kind = Operation::REMOVE_WRITER_CHANGE;
+        operation.guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber;
+        enqueue(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+    return delete_writer_change(persistence_guid, change.sequenceNumber);
+}
+
+bool SQLite3PersistenceService::delete_writer_change(
+        const std::string& persistence_guid,
+        const SequenceNumber_t& sequence_number)
+{
     if (remove_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(remove_writer_change_stmt_);
         sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(remove_writer_change_stmt_, 2, sequence_number.to64long());
         return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
     }
 
@@ -429,6 +558,9 @@ bool SQLite3PersistenceService::load_reader_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    flush();
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -463,6 +595,26 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    if (commit_thread_.joinable())
+    {
+        Operation operation;
+        operation.kind = Operation::UPDATE_READER;
+        operation.guid = reader_guid;
+        operation.writer_guid = writer_guid;
+        operation.sequence_number = seq_number;
+        enqueue(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+    return store_reader_seq(reader_guid, writer_guid, seq_number);
+}
+
+bool SQLite3PersistenceService::store_reader_seq(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
@@ -476,6 +628,105 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     return false;
 }
 
+void SQLite3PersistenceService::flush()
+{
+    if (!commit_thread_.joinable())
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    while (!queued_operations_.empty() || committing_)
+    {
+        flush_requested_ = true;
+        queue_cv_.notify_one();
+        committed_cv_.wait(lock);
+    }
+}
+
+void SQLite3PersistenceService::enqueue(
+        Operation&& operation)
+{
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    queued_operations_.push_back(std::move(operation));
+}
+
+void SQLite3PersistenceService::run_commits()
+{
+    std::vector<Operation> operations;
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+
+    while (running_ || !queued_operations_.empty())
+    {
+        queue_cv_.wait_for(lock, commit_period_, [this]()
+                {
+                    return !running_ || flush_requested_;
+                });
+
+        flush_requested_ = false;
+        if (queued_operations_.empty())
+        {
+            committed_cv_.notify_all();
+            continue;
+        }
+
+        operations.swap(queued_operations_);
+        committing_ = true;
+        lock.unlock();
+
+        commit(operations);
+        operations.clear();
+
+        lock.lock();
+        committing_ = false;
+        committed_cv_.notify_all();
+    }
+}
+
+void SQLite3PersistenceService::commit(
+        std::vector<Operation>& operations)
+{
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
+    // A single transaction per batch, so a crash never leaves part of it stored
+    if (sqlite3_exec(db_, "BEGIN TRANSACTION;", 0, 0, 0) != SQLITE_OK)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Cannot begin transaction: " << sqlite3_errmsg(db_));
+        return;
+    }
+
+    for (const Operation& operation : operations)
+    {
+        bool stored = false;
+        switch (operation.kind)
+        {
+            case Operation::ADD_WRITER_CHANGE:
+                stored = store_writer_change(operation.guid, operation.sequence_number, operation.instance_handle,
+                                operation.payload.data(), static_cast<uint32_t>(operation.payload.size()),
+                                operation.related_sample_identity, operation.source_timestamp);
+                break;
+            case Operation::REMOVE_WRITER_CHANGE:
+                stored = delete_writer_change(operation.guid, operation.sequence_number);
+                break;
+            case Operation::UPDATE_READER:
+                stored = store_reader_seq(operation.guid, operation.writer_guid, operation.sequence_number);
+                break;
+        }
+
+        if (!stored)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Cannot store operation for " << operation.guid << " seq "
+                                                                                 << operation.sequence_number);
+        }
+    }
+
+    if (sqlite3_exec(db_, "COMMIT TRANSACTION;", 0, 0, 0) != SQLITE_OK)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Cannot commit transaction: " << sqlite3_errmsg(db_));
+        sqlite3_exec(db_, "ROLLBACK TRANSACTION;", 0, 0, 0);
+    }
+}
+
 bool SQLite3PersistenceServiceSchemaV3::database_create_temporary_defaults_table(
         sqlite3* db)
 {
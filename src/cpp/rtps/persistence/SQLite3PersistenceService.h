@@ -19,6 +19,14 @@
 #ifndef SQLITE3PERSISTENCESERVICE_H_
 #define SQLITE3PERSISTENCESERVICE_H_
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/persistence/sqlite3.h>
 
@@ -28,11 +36,18 @@ namespace rtps {
 
 /**
  * Create a new SQLite3 implementation of persistence service
+ * @param filename Path of the database.
+ * @param update_schema Whether to upgrade databases with an older schema.
+ * @param commit_period_ms Period in milliseconds between commits of the queued changes. Zero to store every change
+ * synchronously.
+ * @param lazy_load Whether to load the payloads of the writer changes only when they are sent.
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema);
+        bool update_schema,
+        uint32_t commit_period_ms = 0,
+        bool lazy_load = false);
 
 
 /**
@@ -43,8 +58,18 @@ class SQLite3PersistenceService : public IPersistenceService
 {
 public:
 
+    /**
+     * @param db Opened database.
+     * @param commit_period_ms When not zero, changes and reader updates are queued and committed by a background
+     * thread in a single transaction every commit_period_ms milliseconds. Operations are committed in the order they
+     * were made, so after a crash the database holds a prefix of them, at most commit_period_ms old.
+     * @param lazy_load When true, loading a writer only reads the length of the payloads, which are read when
+     * load_writer_payload is called.
+     */
     SQLite3PersistenceService(
-            sqlite3* db);
+            sqlite3* db,
+            uint32_t commit_period_ms = 0,
+            bool lazy_load = false);
     virtual ~SQLite3PersistenceService() override;
 
     /**
@@ -60,10 +85,20 @@ public:
             const std::shared_ptr<IPayloadPool>& payload_pool,
             SequenceNumber_t& next_sequence) final;
 
+    /**
+     * Get the payload of a change loaded without it.
+     * @param change The cache change to fill.
+     * @return True if operation was successful.
+     */
+    bool load_writer_payload(
+            const std::string& persistence_guid,
+            CacheChange_t& change,
+            const std::shared_ptr<IPayloadPool>& payload_pool) final;
+
     /**
      * Add a change to storage.
      * @param change The cache change to add.
-     * @return True if operation was successful.
+     * @return True if operation was successful. When committing asynchronously, true if the change was queued.
      */
     virtual bool add_writer_change_to_storage(
             const std::string& persistence_guid,
@@ -99,11 +134,71 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) final;
 
+    /**
+     * Commit the queued operations and wait until they are stored.
+     * Does nothing when storing synchronously.
+     */
+    void flush();
+
 private:
 
+    //! Operation waiting to be committed
+    struct Operation
+    {
+        enum Kind
+        {
+            ADD_WRITER_CHANGE,
+            REMOVE_WRITER_CHANGE,
+            UPDATE_READER
+        };
+
+        Kind kind;
+        //! Persistence GUID of the writer, or GUID of the reader
+        std::string guid;
+        SequenceNumber_t sequence_number;
+        //! Writer of UPDATE_READER operations
+        GUID_t writer_guid;
+        InstanceHandle_t instance_handle;
+        std::vector<octet> payload;
+        SampleIdentity related_sample_identity;
+        int64_t source_timestamp;
+    };
+
+    bool store_writer_change(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number,
+            const InstanceHandle_t& instance_handle,
+            const octet* payload,
+            uint32_t payload_length,
+            const SampleIdentity& related_sample_identity,
+            int64_t source_timestamp);
+
+    bool delete_writer_change(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number);
+
+    bool store_reader_seq(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number);
+
+    void enqueue(
+            Operation&& operation);
+
+    //! Body of the thread committing the queued operations
+    void run_commits();
+
+    void commit(
+            std::vector<Operation>& operations);
+
     sqlite3* db_;
 
+    //! Protects the statements
+    std::mutex db_mutex_;
+
     sqlite3_stmt* load_writer_stmt_;
+    sqlite3_stmt* load_writer_index_stmt_;
+    sqlite3_stmt* load_writer_payload_stmt_;
     sqlite3_stmt* add_writer_change_stmt_;
     sqlite3_stmt* remove_writer_change_stmt_;
 
@@ -112,6 +207,21 @@ private:
 
     sqlite3_stmt* load_reader_stmt_;
     sqlite3_stmt* update_reader_stmt_;
+
+    std::chrono::milliseconds commit_period_;
+
+    bool lazy_load_;
+
+    //! Protects the queued operations and the state of the commit thread
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    //! Notified after each commit
+    std::condition_variable committed_cv_;
+    std::vector<Operation> queued_operations_;
+    bool committing_ = false;
+    bool flush_requested_ = false;
+    bool running_ = false;
+    std::thread commit_thread_;
 };
 
 } /* namespace rtps */
@@ -20,6 +20,8 @@
 #include <fastdds/rtps/reader/StatefulPersistentReader.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <rtps/persistence/PersistenceService.h>
+#include <rtps/persistence/ReaderSequenceStorage.h>
+#include <rtps/participant/RTPSParticipantImpl.h>
 #include <fastrtps_deprecated/participant/ParticipantImpl.h>
 #include <rtps/reader/ReaderHistoryState.hpp>
 
@@ -37,6 +39,7 @@ StatefulPersistentReader::StatefulPersistentReader(
     : StatefulReader(impl, guid, att, hist, listen)
     , persistence_(persistence)
     , persistence_guid_()
+    , sequence_storage_(nullptr)
 {
     init(guid, att);
 }
@@ -52,6 +55,7 @@ StatefulPersistentReader::StatefulPersistentReader(
     : StatefulReader(impl, guid, att, payload_pool, hist, listen)
     , persistence_(persistence)
     , persistence_guid_()
+    , sequence_storage_(nullptr)
 {
     init(guid, att);
 }
@@ -68,6 +72,7 @@ StatefulPersistentReader::StatefulPersistentReader(
     : StatefulReader(impl, guid, att, payload_pool, change_pool, hist, listen)
     , persistence_(persistence)
     , persistence_guid_()
+    , sequence_storage_(nullptr)
 {
     init(guid, att);
 }
@@ -82,10 +87,17 @@ void StatefulPersistentReader::init(
     ss << p_guid;
     persistence_guid_ = ss.str();
     persistence_->load_reader_from_storage(persistence_guid_, history_state_->history_record);
+
+    uint32_t update_period = ReaderSequenceStorage::get_period(att.endpoint.properties,
+                    mp_RTPSParticipant->getRTPSParticipantAttributes().properties);
+    sequence_storage_ = new ReaderSequenceStorage(persistence_, persistence_guid_,
+                    mp_RTPSParticipant->getEventResource(), update_period);
 }
 
 StatefulPersistentReader::~StatefulPersistentReader()
 {
+    // Pending sequence numbers are written before the persistence service is destroyed
+    delete sequence_storage_;
     delete persistence_;
 }
 
@@ -94,7 +106,7 @@ void StatefulPersistentReader::set_last_notified(
         const SequenceNumber_t& seq)
 {
     history_state_->history_record[writer_guid] = seq;
-    persistence_->update_writer_seq_on_storage(persistence_guid_, writer_guid, seq);
+    sequence_storage_->update(writer_guid, seq);
 }
 
 bool StatefulPersistentReader::may_remove_history_record(
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/reader/WriterProxy.h>
+#include <rtps/messages/ControlMessageScheduler.hpp>
 #include <fastrtps/utils/TimeConversion.h>
 #include <rtps/history/HistoryAttributesExtension.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
@@ -1493,59 +1494,88 @@ void StatefulReader::send_acknack(
         return;
     }
 
-    SequenceNumberSet_t missing_changes = writer->missing_changes();
-
     try
     {
         RTPSMessageGroup group(getRTPSParticipant(), this, sender);
-        if (!missing_changes.empty() || !heartbeat_was_final)
-        {
-            GUID_t guid = sender->remote_guids().at(0);
-            SequenceNumberSet_t sns(writer->available_changes_max() + 1);
-            History::const_iterator history_iterator = mp_history->changesBegin();
+        add_heartbeat_response_nts(writer, sender, heartbeat_was_final, group);
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_READER, "Max blocking time reached");
+    }
+}
+
+void StatefulReader::send_acknack(
+        const WriterProxy* writer,
+        RTPSMessageSenderInterface* sender,
+        bool heartbeat_was_final,
+        ControlMessageGroup& group,
+        std::vector<Locator_t>& destinations)
+{
+    // Protect reader
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    if (!writer->is_alive() || writer->is_datasharing_writer())
+    {
+        return;
+    }
+
+    const ResourceLimitedVector<Locator_t>& locators = writer->remote_locators_shrinked();
+    ControlMessageGroup::collect_destinations(locators.begin(), locators.end(), destinations);
+    add_heartbeat_response_nts(writer, sender, heartbeat_was_final, group.use(this, sender, destinations));
+}
+
+void StatefulReader::add_heartbeat_response_nts(
+        const WriterProxy* writer,
+        RTPSMessageSenderInterface* sender,
+        bool heartbeat_was_final,
+        RTPSMessageGroup& group)
+{
+    SequenceNumberSet_t missing_changes = writer->missing_changes();
+
+    if (!missing_changes.empty() || !heartbeat_was_final)
+    {
+        GUID_t guid = sender->remote_guids().at(0);
+        SequenceNumberSet_t sns(writer->available_changes_max() + 1);
+        History::const_iterator history_iterator = mp_history->changesBegin();
 
-            missing_changes.for_each(
-                [&](const SequenceNumber_t& seq)
+        missing_changes.for_each(
+            [&](const SequenceNumber_t& seq)
+            {
+                // Check if the CacheChange_t is uncompleted.
+                CacheChange_t* uncomplete_change = nullptr;
+                auto ret_iterator = findCacheInFragmentedProcess(seq, guid, &uncomplete_change, history_iterator);
+                if (ret_iterator != mp_history->changesEnd())
                 {
-                    // Check if the CacheChange_t is uncompleted.
-                    CacheChange_t* uncomplete_change = nullptr;
-                    auto ret_iterator = findCacheInFragmentedProcess(seq, guid, &uncomplete_change, history_iterator);
-                    if (ret_iterator != mp_history->changesEnd())
-                    {
-                        history_iterator = ret_iterator;
-                    }
-                    if (uncomplete_change == nullptr)
+                    history_iterator = ret_iterator;
+                }
+                if (uncomplete_change == nullptr)
+                {
+                    if (!sns.add(seq))
                     {
-                        if (!sns.add(seq))
-                        {
-                            EPROSIMA_LOG_INFO(RTPS_READER, "Sequence number " << seq
-                                                                              <<
-                                " exceeded bitmap limit of AckNack. SeqNumSet Base: "
-                                                                              << sns.base());
-                        }
+                        EPROSIMA_LOG_INFO(RTPS_READER, "Sequence number " << seq
+                                                                          <<
+                            " exceeded bitmap limit of AckNack. SeqNumSet Base: "
+                                                                          << sns.base());
                     }
-                    else
-                    {
-                        FragmentNumberSet_t frag_sns;
-                        uncomplete_change->get_missing_fragments(frag_sns);
-                        ++nackfrag_count_;
-                        EPROSIMA_LOG_INFO(RTPS_READER, "Sending NACKFRAG for sample" << seq << ": " << frag_sns; );
+                }
+                else
+                {
+                    FragmentNumberSet_t frag_sns;
+                    uncomplete_change->get_missing_fragments(frag_sns);
+                    ++nackfrag_count_;
+                    EPROSIMA_LOG_INFO(RTPS_READER, "Sending NACKFRAG for sample" << seq << ": " << frag_sns; );
 
-                        group.add_nackfrag(seq, frag_sns, nackfrag_count_);
-                    }
+                    group.add_nackfrag(seq, frag_sns, nackfrag_count_);
+                }
 
-                });
+            });
 
-            acknack_count_++;
-            EPROSIMA_LOG_INFO(RTPS_READER, "Sending ACKNACK: " << sns; );
+        acknack_count_++;
+        EPROSIMA_LOG_INFO(RTPS_READER, "Sending ACKNACK: " << sns; );
 
-            bool final = sns.empty();
-            group.add_acknack(sns, acknack_count_, final);
-        }
-    }
-    catch (const RTPSMessageGroup::timeout&)
-    {
-        EPROSIMA_LOG_ERROR(RTPS_READER, "Max blocking time reached");
+        bool final = sns.empty();
+        group.add_acknack(sns, acknack_count_, final);
     }
 }
 
@@ -28,6 +28,7 @@
 
 #include <fastrtps/utils/TimeConversion.h>
 
+#include <rtps/messages/ControlMessageScheduler.hpp>
 #include <rtps/network/ExternalLocatorsProcessor.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
@@ -64,6 +65,7 @@ WriterProxy::~WriterProxy()
 
     delete(initial_acknack_);
     delete(heartbeat_response_);
+    delete(heartbeat_response_task_);
 }
 
 using set_helper = utilities::collections::set_size_helper<SequenceNumber_t>;
@@ -74,6 +76,7 @@ WriterProxy::WriterProxy(
         const ResourceLimitedContainerConfig& changes_allocation)
     : reader_(reader)
     , heartbeat_response_(nullptr)
+    , heartbeat_response_task_(nullptr)
     , initial_acknack_(nullptr)
     , last_heartbeat_count_(0)
     , heartbeat_final_flag_(false)
@@ -104,7 +107,27 @@ WriterProxy::WriterProxy(
                 return perform_initial_ack_nack();
             };
 
-    heartbeat_response_ = new TimedEvent(event_manager, heartbeat_lambda, 0);
+    RTPSParticipantImpl* participant = reader_->getRTPSParticipant();
+    ControlMessageScheduler* control_message_scheduler =
+            nullptr != participant ? participant->control_message_scheduler() : nullptr;
+    if (nullptr != control_message_scheduler)
+    {
+        heartbeat_response_task_ = new ControlMessageTask(
+            *control_message_scheduler,
+            [this](std::vector<Locator_t>& destinations) -> bool
+            {
+                return prepare_heartbeat_response(destinations);
+            },
+            [this](ControlMessageGroup& group, std::vector<Locator_t>& destinations)
+            {
+                add_heartbeat_response(group, destinations);
+            },
+            0);
+    }
+    else
+    {
+        heartbeat_response_ = new TimedEvent(event_manager, heartbeat_lambda, 0);
+    }
     initial_acknack_ = new TimedEvent(event_manager, acknack_lambda, 0);
 
     clear();
@@ -129,7 +152,7 @@ void WriterProxy::start(
     assert(get_mutex_owner() == get_thread_id());
 #endif // SHOULD_DEBUG_LINUX
 
-    heartbeat_response_->update_interval(reader_->getTimes().heartbeatResponseDelay);
+    update_heartbeat_response_interval(reader_->getTimes().heartbeatResponseDelay);
     initial_acknack_->update_interval(reader_->getTimes().initialAcknackDelay);
 
     locators_entry_.remote_guid = attributes.guid();
@@ -182,7 +205,14 @@ void WriterProxy::stop()
     {
         initial_acknack_->cancel_timer();
     }
-    heartbeat_response_->cancel_timer();
+    if (nullptr != heartbeat_response_task_)
+    {
+        heartbeat_response_task_->cancel_timer();
+    }
+    else
+    {
+        heartbeat_response_->cancel_timer();
+    }
 
     clear();
 }
@@ -547,6 +577,37 @@ void WriterProxy::perform_heartbeat_response()
     state_.compare_exchange_strong(expected, StateCode::IDLE);
 }
 
+bool WriterProxy::prepare_heartbeat_response(
+        std::vector<Locator_t>& destinations)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(reader_->getMutex());
+
+    if (StateCode::IDLE == state_ && is_alive_ && !is_on_same_process_ && !is_datasharing_writer_)
+    {
+        const ResourceLimitedVector<Locator_t>& locators = remote_locators_shrinked();
+        ControlMessageGroup::collect_destinations(locators.begin(), locators.end(), destinations);
+    }
+
+    return false;
+}
+
+void WriterProxy::add_heartbeat_response(
+        ControlMessageGroup& group,
+        std::vector<Locator_t>& destinations)
+{
+    StateCode expected = StateCode::IDLE;
+    if (!state_.compare_exchange_strong(expected, StateCode::BUSY))
+    {
+        // Stopped from another thread -> abort
+        return;
+    }
+
+    reader_->send_acknack(this, this, heartbeat_final_flag_.load(), group, destinations);
+
+    expected = StateCode::BUSY;
+    state_.compare_exchange_strong(expected, StateCode::IDLE);
+}
+
 bool WriterProxy::process_heartbeat(
         uint32_t count,
         const SequenceNumber_t& first_seq,
@@ -582,14 +643,14 @@ bool WriterProxy::process_heartbeat(
             {
                 if (!disable_positive || are_there_missing_changes())
                 {
-                    heartbeat_response_->restart_timer();
+                    restart_heartbeat_response();
                 }
             }
             else if (final_flag && !liveliness_flag)
             {
                 if (are_there_missing_changes())
                 {
-                    heartbeat_response_->restart_timer();
+                    restart_heartbeat_response();
                 }
             }
             else
@@ -617,7 +678,26 @@ bool WriterProxy::process_heartbeat(
 void WriterProxy::update_heartbeat_response_interval(
         const Duration_t& interval)
 {
-    heartbeat_response_->update_interval(interval);
+    if (nullptr != heartbeat_response_task_)
+    {
+        heartbeat_response_task_->update_interval(interval);
+    }
+    else
+    {
+        heartbeat_response_->update_interval(interval);
+    }
+}
+
+void WriterProxy::restart_heartbeat_response()
+{
+    if (nullptr != heartbeat_response_task_)
+    {
+        heartbeat_response_task_->restart_timer();
+    }
+    else
+    {
+        heartbeat_response_->restart_timer();
+    }
 }
 
 bool WriterProxy::send(
@@ -44,6 +44,8 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ControlMessageGroup;
+class ControlMessageTask;
 class RTPSParticipantImpl;
 class StatefulReader;
 class RTPSMessageGroup_t;
@@ -241,6 +243,25 @@ public:
      */
     void perform_heartbeat_response();
 
+    /**
+     * Fills the destinations of the acknack and nackfrag messages answering the last received heartbeat, when they
+     * are sent with the control messages of the participant.
+     * @param destinations Filled with the destination locators, left empty when nothing has to be sent.
+     * @return false, as the response is only sent again after a new heartbeat.
+     */
+    bool prepare_heartbeat_response(
+            std::vector<Locator_t>& destinations);
+
+    /**
+     * Adds the acknack and nackfrag messages answering the last received heartbeat to the control messages of the
+     * participant.
+     * @param group Control messages of the participant.
+     * @param destinations Destination locators filled by prepare_heartbeat_response, updated when they changed.
+     */
+    void add_heartbeat_response(
+            ControlMessageGroup& group,
+            std::vector<Locator_t>& destinations);
+
     /**
      * Process an incoming heartbeat from the writer represented by this proxy.
      * @param count Count field of the heartbeat message.
@@ -371,10 +392,16 @@ private:
 
     void clear();
 
+    //! Schedules the heartbeat response, unless it is already scheduled.
+    void restart_heartbeat_response();
+
     //! Pointer to associated StatefulReader.
     StatefulReader* reader_;
     //!Timed event to postpone the heartbeatResponse.
     TimedEvent* heartbeat_response_;
+    //! Postpones the heartbeatResponse on the participant, instead of heartbeat_response_, when control messages are
+    //! aggregated.
+    ControlMessageTask* heartbeat_response_task_;
     //! Timed event to send initial acknack.
     TimedEvent* initial_acknack_;
     //! Last Heartbeatcount.
@@ -3890,6 +3890,8 @@ bool SecurityManager::participant_authorized(
     }
 
     EPROSIMA_LOG_INFO(SECURITY, "Authorized participant " << participant_data.m_guid);
+    participant_->on_startup_phase(fastdds::statistics::StartupPhase::SECURITY_HANDSHAKE_COMPLETED,
+            participant_->getGuid(), participant_data.m_guid);
 
     SecurityException exception;
     PermissionsHandle* remote_permissions = nullptr;
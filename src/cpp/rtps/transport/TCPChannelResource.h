@@ -15,7 +15,10 @@
 #ifndef _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 
+#include <vector>
+
 #include <asio.hpp>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastdds/rtps/transport/TransportReceiverInterface.h>
 #include <fastdds/rtps/common/Locator.h>
@@ -130,6 +133,13 @@ public:
             size_t size,
             asio::error_code& ec) = 0;
 
+    //! Send a header followed by the slices of a message, without copying them into a single buffer.
+    virtual size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const std::vector<NetworkBuffer>& buffers,
+            asio::error_code& ec) = 0;
+
     virtual asio::ip::tcp::endpoint remote_endpoint() const = 0;
 
     virtual asio::ip::tcp::endpoint local_endpoint() const = 0;
@@ -16,6 +16,7 @@
 
 #include <future>
 #include <array>
+#include <vector>
 
 #include <asio.hpp>
 #include <fastrtps/utils/IPLocator.h>
@@ -167,6 +168,34 @@ size_t TCPChannelResourceBasic::send(
     return bytes_sent;
 }
 
+size_t TCPChannelResourceBasic::send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        asio::error_code& ec)
+{
+    size_t bytes_sent = 0;
+
+    if (eConnecting < connection_status_)
+    {
+        std::vector<asio::const_buffer> asio_buffers;
+        asio_buffers.reserve(buffers.size() + 1);
+        if (header_size > 0)
+        {
+            asio_buffers.push_back(asio::buffer(header, header_size));
+        }
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            asio_buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
+
+        std::lock_guard<std::mutex> send_guard(send_mutex_);
+        bytes_sent = asio::write(*socket_.get(), asio_buffers, ec);
+    }
+
+    return bytes_sent;
+}
+
 asio::ip::tcp::endpoint TCPChannelResourceBasic::remote_endpoint() const
 {
     return socket_->remote_endpoint();
@@ -215,36 +215,68 @@ size_t TCPChannelResourceSecure::send(
             buffers.push_back(asio::buffer(header, header_size));
         }
         buffers.push_back(asio::buffer(data, size));
+        bytes_sent = write(buffers, ec);
+    }
 
-        // Work around meanwhile
-        std::promise<size_t> write_bytes_promise;
-        auto bytes_future = write_bytes_promise.get_future();
-        auto socket = secure_socket_;
+    return bytes_sent;
+}
+
+size_t TCPChannelResourceSecure::send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        asio::error_code& ec)
+{
+    size_t bytes_sent = 0;
+
+    if (eConnecting < connection_status_)
+    {
+        std::vector<asio::const_buffer> asio_buffers;
+        asio_buffers.reserve(buffers.size() + 1);
+        if (header_size > 0)
+        {
+            asio_buffers.push_back(asio::buffer(header, header_size));
+        }
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            asio_buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
+        bytes_sent = write(asio_buffers, ec);
+    }
+
+    return bytes_sent;
+}
+
+size_t TCPChannelResourceSecure::write(
+        const std::vector<asio::const_buffer>& buffers,
+        asio::error_code& ec)
+{
+    // Work around meanwhile
+    std::promise<size_t> write_bytes_promise;
+    auto bytes_future = write_bytes_promise.get_future();
+    auto socket = secure_socket_;
 
-        strand_write_.post([&, socket]()
+    strand_write_.post([&, socket]()
+            {
+                if (socket->lowest_layer().is_open())
                 {
-                    if (socket->lowest_layer().is_open())
+                    size_t bytes_transferred = asio::write(*socket, buffers, ec);
+                    if (!ec)
                     {
-                        size_t bytes_transferred = asio::write(*socket, buffers, ec);
-                        if (!ec)
-                        {
-                            write_bytes_promise.set_value(bytes_transferred);
-                        }
-                        else
-                        {
-                            write_bytes_promise.set_value(0);
-                        }
+                        write_bytes_promise.set_value(bytes_transferred);
                     }
                     else
                     {
                         write_bytes_promise.set_value(0);
                     }
+                }
+                else
+                {
+                    write_bytes_promise.set_value(0);
+                }
 
-                });
-        bytes_sent = bytes_future.get();
-    }
-
-    return bytes_sent;
+            });
+    return bytes_future.get();
 }
 
 asio::ip::tcp::endpoint TCPChannelResourceSecure::remote_endpoint() const
@@ -65,6 +65,12 @@ public:
             size_t size,
             asio::error_code& ec) override;
 
+    size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const std::vector<NetworkBuffer>& buffers,
+            asio::error_code& ec) override;
+
     asio::ip::tcp::endpoint remote_endpoint() const override;
     asio::ip::tcp::endpoint local_endpoint() const override;
 
@@ -94,6 +100,11 @@ private:
     TCPChannelResourceSecure& operator =(
             const TCPChannelResource&) = delete;
 
+    //! Write the buffers on the strand of the socket, waiting for the operation to finish.
+    size_t write(
+            const std::vector<asio::const_buffer>& buffers,
+            asio::error_code& ec);
+
     asio::io_service& service_;
     asio::ssl::context& ssl_context_;
     asio::io_service::strand strand_read_;
@@ -252,6 +252,22 @@ void TCPTransportInterface::calculate_crc(
     header.crc = crc;
 }
 
+void TCPTransportInterface::calculate_crc(
+        TCPHeader& header,
+        const std::vector<NetworkBuffer>& buffers) const
+{
+    uint32_t crc(0);
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        const octet* data = static_cast<const octet*>(buffer.buffer);
+        for (uint32_t i = 0; i < buffer.size; ++i)
+        {
+            crc = RTCPMessageManager::addToCRC(crc, data[i]);
+        }
+    }
+    header.crc = crc;
+}
+
 bool TCPTransportInterface::create_acceptor_socket(
         const Locator& locator)
 {
@@ -341,6 +357,20 @@ void TCPTransportInterface::fill_rtcp_header(
     }
 }
 
+void TCPTransportInterface::fill_rtcp_header(
+        TCPHeader& header,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint16_t logical_port) const
+{
+    header.length = total_bytes + static_cast<uint32_t>(TCPHeader::size());
+    header.logical_port = logical_port;
+    if (configuration()->calculate_crc)
+    {
+        calculate_crc(header, buffers);
+    }
+}
+
 bool TCPTransportInterface::DoInputLocatorsMatch(
         const Locator& left,
         const Locator& right) const
@@ -1151,13 +1181,36 @@ bool TCPTransportInterface::send(
 }
 
 bool TCPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::shared_ptr<TCPChannelResource>& channel,
-        const Locator& remote_locator)
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end)
 {
-    using namespace eprosima::fastdds::statistics::rtps;
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            ret &= send(buffers, total_bytes, channel, *it);
+        }
+
+        ++it;
+    }
 
+    return ret;
+}
+
+template<typename SendFunction>
+bool TCPTransportInterface::send_to_locator(
+        uint32_t send_buffer_size,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const Locator& remote_locator,
+        SendFunction send_function)
+{
     bool locator_mismatch = false;
 
     if (channel->locator() != IPLocator::toPhysicalLocator(remote_locator))
@@ -1212,18 +1265,9 @@ bool TCPTransportInterface::send(
         {
             if (channel->is_logical_port_opened(logical_port))
             {
-                TCPHeader tcp_header;
-                statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
-                fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
-
                 {
                     asio::error_code ec;
-                    size_t sent = channel->send(
-                        (octet*)&tcp_header,
-                        static_cast<uint32_t>(TCPHeader::size()),
-                        send_buffer,
-                        send_buffer_size,
-                        ec);
+                    size_t sent = send_function(logical_port, ec);
 
                     if (sent != static_cast<uint32_t>(TCPHeader::size() + send_buffer_size) || ec)
                     {
@@ -1254,6 +1298,40 @@ bool TCPTransportInterface::send(
     return success;
 }
 
+bool TCPTransportInterface::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const Locator& remote_locator)
+{
+    return send_to_locator(send_buffer_size, channel, remote_locator,
+                   [&](uint16_t logical_port, asio::error_code& ec) -> size_t
+                   {
+                       TCPHeader tcp_header;
+                       statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
+                       fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
+                       return channel->send((octet*)&tcp_header, static_cast<uint32_t>(TCPHeader::size()),
+                       send_buffer, send_buffer_size, ec);
+                   });
+}
+
+bool TCPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const Locator& remote_locator)
+{
+    return send_to_locator(total_bytes, channel, remote_locator,
+                   [&](uint16_t logical_port, asio::error_code& ec) -> size_t
+                   {
+                       TCPHeader tcp_header;
+                       statistics_info_.set_statistics_message_data(remote_locator, buffers, total_bytes);
+                       fill_rtcp_header(tcp_header, buffers, total_bytes, logical_port);
+                       return channel->send((octet*)&tcp_header, static_cast<uint32_t>(TCPHeader::size()),
+                       buffers, ec);
+                   });
+}
+
 void TCPTransportInterface::select_locators(
         LocatorSelector& selector) const
 {
@@ -125,12 +125,22 @@ protected:
             const fastrtps::rtps::octet* data,
             uint32_t size) const;
 
+    void calculate_crc(
+            TCPHeader& header,
+            const std::vector<NetworkBuffer>& buffers) const;
+
     void fill_rtcp_header(
             TCPHeader& header,
             const fastrtps::rtps::octet* send_buffer,
             uint32_t send_buffer_size,
             uint16_t logical_port) const;
 
+    void fill_rtcp_header(
+            TCPHeader& header,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint16_t logical_port) const;
+
     //! Closes the given p_channel_resource and unbind it from every resource.
     void close_tcp_socket(
             std::shared_ptr<TCPChannelResource>& channel);
@@ -195,6 +205,27 @@ protected:
             std::shared_ptr<TCPChannelResource>& channel,
             const Locator& remote_locator);
 
+    /**
+     * Send a list of buffers to a destination
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const Locator& remote_locator);
+
+    /**
+     * Common part of the sends to a destination.
+     * @param send_function Called with the logical port of the destination and an error code to perform the send.
+     * It returns the number of bytes sent, including the TCP header.
+     */
+    template<typename SendFunction>
+    bool send_to_locator(
+            uint32_t send_buffer_size,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const Locator& remote_locator,
+            SendFunction send_function);
+
 public:
 
     friend class RTCPMessageManager;
@@ -345,6 +376,23 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end);
 
+    /**
+     * Blocking Send of a message made of several slices through the specified channel.
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param channel channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::shared_ptr<TCPChannelResource>& channel,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
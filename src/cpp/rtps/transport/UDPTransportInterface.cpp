@@ -18,6 +18,7 @@
 #include <cstring>
 #include <algorithm>
 #include <chrono>
+#include <vector>
 
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
@@ -471,16 +472,59 @@ bool UDPTransportInterface::send(
 }
 
 bool UDPTransportInterface::send(
-        const octet* send_buffer,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
+        max_blocking_time_point - std::chrono::steady_clock::now());
+
+    std::vector<asio::const_buffer> asio_buffers;
+    asio_buffers.reserve(buffers.size());
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        asio_buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+    }
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            ret &= send(buffers,
+                            asio_buffers,
+                            total_bytes,
+                            socket,
+                            *it,
+                            only_multicast_purpose,
+                            whitelisted,
+                            time_out);
+        }
+
+        ++it;
+    }
+
+    return ret;
+}
+
+template<typename SendFunction>
+bool UDPTransportInterface::send_to_locator(
         uint32_t send_buffer_size,
         eProsimaUDPSocket& socket,
         const Locator& remote_locator,
         bool only_multicast_purpose,
         bool whitelisted,
-        const std::chrono::microseconds& timeout)
+        const std::chrono::microseconds& timeout,
+        SendFunction send_function)
 {
-    using namespace eprosima::fastdds::statistics::rtps;
-
     if (send_buffer_size > configuration()->sendBufferSize)
     {
         return false;
@@ -507,9 +551,7 @@ bool UDPTransportInterface::send(
 #endif // ifndef _WIN32
 
             asio::error_code ec;
-            statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
-            bytesSent = getSocketPtr(socket)->send_to(asio::buffer(send_buffer,
-                            send_buffer_size), destinationEndpoint, 0, ec);
+            bytesSent = send_function(destinationEndpoint, ec);
             if (!!ec)
             {
                 if ((ec.value() == asio::error::would_block) ||
@@ -538,6 +580,42 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+bool UDPTransportInterface::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    return send_to_locator(send_buffer_size, socket, remote_locator, only_multicast_purpose, whitelisted, timeout,
+                   [&](const asio::ip::udp::endpoint& destination, asio::error_code& ec) -> size_t
+                   {
+                       statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
+                       return getSocketPtr(socket)->send_to(asio::buffer(send_buffer, send_buffer_size),
+                       destination, 0, ec);
+                   });
+}
+
+bool UDPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        const std::vector<asio::const_buffer>& asio_buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    return send_to_locator(total_bytes, socket, remote_locator, only_multicast_purpose, whitelisted, timeout,
+                   [&](const asio::ip::udp::endpoint& destination, asio::error_code& ec) -> size_t
+                   {
+                       statistics_info_.set_statistics_message_data(remote_locator, buffers, total_bytes);
+                       return getSocketPtr(socket)->send_to(asio_buffers, destination, 0, ec);
+                   });
+}
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -18,6 +18,7 @@
 #include <asio.hpp>
 #include <thread>
 
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
@@ -130,6 +131,34 @@ public:
             bool whitelisted,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Blocking Send of a message made of several slices, which are given to the socket in a single gather
+     * operation (i.e. sendmsg), so they are not copied into a contiguous buffer.
+     *
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices. It must not exceed the send_buffer_size fed to this class
+     * during construction.
+     * @param socket channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param only_multicast_purpose multicast network interface
+     * @param whitelisted network interface included in the user whitelist
+     * @param max_blocking_time_point maximum blocking time.
+     *
+     * @pre Open the output channel of each remote locator by invoking \ref OpenOutputChannel function.
+     */
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -278,6 +307,33 @@ protected:
             bool whitelisted,
             const std::chrono::microseconds& timeout);
 
+    /**
+     * Send a list of buffers to a destination
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            const std::vector<asio::const_buffer>& asio_buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            const Locator& remote_locator,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout);
+
+    /**
+     * Common part of the sends to a destination.
+     * @param send_function Called with the destination endpoint and an error code to perform the send.
+     */
+    template<typename SendFunction>
+    bool send_to_locator(
+            uint32_t send_buffer_size,
+            eProsimaUDPSocket& socket,
+            const Locator& remote_locator,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout,
+            SendFunction send_function);
+
     /**
      * @brief Return list of not yet open network interfaces
      *
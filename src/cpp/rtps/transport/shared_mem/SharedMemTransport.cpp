@@ -426,15 +426,35 @@ std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buf
     return shared_buffer;
 }
 
-bool SharedMemTransport::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
-        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
-        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
-    using namespace eprosima::fastdds::statistics::rtps;
+    assert(shared_mem_segment_);
+
+    std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
+            shared_mem_segment_->alloc_buffer(total_bytes, max_blocking_time_point);
 
+    // The last slices may be left out when the statistics submessage was removed
+    octet* data = static_cast<octet*>(shared_buffer->data());
+    uint32_t copied = 0;
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        uint32_t size = std::min(buffer.size, total_bytes - copied);
+        memcpy(data + copied, buffer.buffer, size);
+        copied += size;
+    }
+
+    return shared_buffer;
+}
+
+template<typename CopyFunction>
+bool SharedMemTransport::send_to_locators(
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        CopyFunction copy_function)
+{
 #if !defined(_WIN32)
     cleanup_output_ports();
 #endif // if !defined(_WIN32)
@@ -454,8 +474,7 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    remove_statistics_submessage(send_buffer, send_buffer_size);
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = copy_function();
                 }
 
                 ret &= send(shared_buffer, *it);
@@ -486,7 +505,40 @@ bool SharedMemTransport::send(
     }
 
     return ret;
+}
+
+bool SharedMemTransport::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    using namespace eprosima::fastdds::statistics::rtps;
+
+    return send_to_locators(destination_locators_begin, destination_locators_end,
+                   [&]()
+                   {
+                       remove_statistics_submessage(send_buffer, send_buffer_size);
+                       return copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                   });
+}
+
+bool SharedMemTransport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    using namespace eprosima::fastdds::statistics::rtps;
 
+    return send_to_locators(destination_locators_begin, destination_locators_end,
+                   [&]()
+                   {
+                       remove_statistics_submessage(buffers, total_bytes);
+                       return copy_to_shared_buffer(buffers, total_bytes, max_blocking_time_point);
+                   });
 }
 
 void SharedMemTransport::cleanup_output_ports()
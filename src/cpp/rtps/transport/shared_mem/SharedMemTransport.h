@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_SHAREDMEM_TRANSPORT_H_
 #define _FASTDDS_SHAREDMEM_TRANSPORT_H_
 
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 
@@ -22,6 +23,7 @@
 #include <rtps/transport/shared_mem/SharedMemLog.hpp>
 
 #include <map>
+#include <vector>
 
 namespace eprosima {
 namespace fastdds {
@@ -159,6 +161,21 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Blocking Send of a message made of several slices, which are copied directly into the shared memory segment.
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of the slices.
+     * @param destination_locators_begin pointer to destination locators iterator begin.
+     * @param destination_locators_end pointer to destination locators iterator end.
+     * @param max_blocking_time_point Maximum time this function will block
+     */
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -249,6 +266,21 @@ private:
             uint32_t send_buffer_size,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    std::shared_ptr<SharedMemManager::Buffer> copy_to_shared_buffer(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    /**
+     * Send a message to several destinations.
+     * @param copy_function Called the first time a destination is supported, returns the message on the segment.
+     */
+    template<typename CopyFunction>
+    bool send_to_locators(
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            CopyFunction copy_function);
+
     bool send(
             const std::shared_ptr<SharedMemManager::Buffer>& buffer,
             const Locator& remote_locator);
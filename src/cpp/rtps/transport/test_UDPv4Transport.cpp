@@ -231,6 +231,23 @@ bool test_UDPv4Transport::send(
     return ret;
 }
 
+bool test_UDPv4Transport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    // Filters work on a contiguous message
+    std::vector<octet> send_buffer(total_bytes);
+    copy_network_buffers(buffers, send_buffer.data());
+    return send(send_buffer.data(), total_bytes, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, whitelisted, max_blocking_time_point);
+}
+
 bool test_UDPv4Transport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
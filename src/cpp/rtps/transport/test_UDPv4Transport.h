@@ -50,6 +50,16 @@ public:
             bool whitelisted,
             const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
 
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
+
     virtual LocatorList NormalizeLocator(
             const Locator& locator) override;
 
@@ -0,0 +1,212 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AdaptiveReliability.cpp
+ */
+
+#include <rtps/writer/AdaptiveReliability.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <fastdds/dds/log/Log.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+namespace {
+
+Duration_t to_time(
+        const AdaptiveReliability::Duration& duration)
+{
+    constexpr int64_t ns_per_second = 1000000000;
+    int64_t ns = duration.count();
+    if (ns / ns_per_second >= Duration_t::INFINITE_SECONDS)
+    {
+        return Duration_t(Duration_t::INFINITE_SECONDS, Duration_t::INFINITE_NANOSECONDS);
+    }
+    return Duration_t(static_cast<int32_t>(ns / ns_per_second), static_cast<uint32_t>(ns % ns_per_second));
+}
+
+} // namespace
+
+AdaptiveReliability::AdaptiveReliability(
+        const WriterTimes& times,
+        const PropertyPolicy& properties)
+{
+    min_heartbeat_period_set_ = get_bound(properties, "fastdds.adaptive_reliability.heartbeat_period.min",
+                    min_heartbeat_period_);
+    max_heartbeat_period_set_ = get_bound(properties, "fastdds.adaptive_reliability.heartbeat_period.max",
+                    max_heartbeat_period_);
+    min_nack_response_delay_set_ = get_bound(properties, "fastdds.adaptive_reliability.nack_response_delay.min",
+                    min_nack_response_delay_);
+    max_nack_response_delay_set_ = get_bound(properties, "fastdds.adaptive_reliability.nack_response_delay.max",
+                    max_nack_response_delay_);
+    update_times(times);
+}
+
+bool AdaptiveReliability::is_enabled(
+        const PropertyPolicy& properties)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(properties, "fastdds.adaptive_reliability");
+    return nullptr != value && "true" == *value;
+}
+
+void AdaptiveReliability::update_times(
+        const WriterTimes& times)
+{
+    Duration heartbeat_period = to_duration(times.heartbeatPeriod);
+    Duration nack_response_delay = to_duration(times.nackResponseDelay);
+
+    if (!min_heartbeat_period_set_)
+    {
+        min_heartbeat_period_ = heartbeat_period / 10;
+    }
+    if (!max_heartbeat_period_set_)
+    {
+        max_heartbeat_period_ = heartbeat_period * 2;
+    }
+    if (!min_nack_response_delay_set_)
+    {
+        min_nack_response_delay_ = Duration::zero();
+    }
+    if (!max_nack_response_delay_set_)
+    {
+        max_nack_response_delay_ = nack_response_delay;
+    }
+    check_bounds();
+
+    // Until readers are observed, the configured times are used
+    heartbeat_period_ = clamp(heartbeat_period, min_heartbeat_period_, max_heartbeat_period_);
+    nack_response_delay_ = clamp(nack_response_delay, min_nack_response_delay_, max_nack_response_delay_);
+}
+
+void AdaptiveReliability::begin_update()
+{
+    readers_ = 0;
+    worst_nack_rate_ = 0.0;
+    slowest_round_trip_ = Duration::zero();
+    fastest_round_trip_ = Duration::zero();
+}
+
+void AdaptiveReliability::add_reader(
+        const Duration& ack_round_trip,
+        double nack_rate)
+{
+    ++readers_;
+    worst_nack_rate_ = std::max(worst_nack_rate_, nack_rate);
+    if (Duration::zero() < ack_round_trip)
+    {
+        slowest_round_trip_ = std::max(slowest_round_trip_, ack_round_trip);
+        fastest_round_trip_ = Duration::zero() == fastest_round_trip_ ?
+                ack_round_trip : std::min(fastest_round_trip_, ack_round_trip);
+    }
+}
+
+void AdaptiveReliability::end_update()
+{
+    if (0 == readers_)
+    {
+        return;
+    }
+
+    Duration heartbeat_period = interpolate(min_heartbeat_period_, max_heartbeat_period_, worst_nack_rate_);
+    heartbeat_period = std::max(heartbeat_period, slowest_round_trip_ * 2);
+    heartbeat_period_ = clamp(heartbeat_period, min_heartbeat_period_, max_heartbeat_period_);
+
+    Duration nack_response_delay = interpolate(min_nack_response_delay_, max_nack_response_delay_, worst_nack_rate_);
+    if (Duration::zero() < fastest_round_trip_)
+    {
+        nack_response_delay = std::min(nack_response_delay, fastest_round_trip_ / 2);
+    }
+    nack_response_delay_ = clamp(nack_response_delay, min_nack_response_delay_, max_nack_response_delay_);
+}
+
+Duration_t AdaptiveReliability::heartbeat_period() const
+{
+    return to_time(heartbeat_period_);
+}
+
+Duration_t AdaptiveReliability::nack_response_delay() const
+{
+    return to_time(nack_response_delay_);
+}
+
+AdaptiveReliability::Duration AdaptiveReliability::clamp(
+        const Duration& value,
+        const Duration& min,
+        const Duration& max)
+{
+    return std::min(std::max(value, min), max);
+}
+
+AdaptiveReliability::Duration AdaptiveReliability::interpolate(
+        const Duration& min,
+        const Duration& max,
+        double nack_rate)
+{
+    nack_rate = std::min(std::max(nack_rate, 0.0), 1.0);
+    return max - std::chrono::duration_cast<Duration>((max - min) * nack_rate);
+}
+
+AdaptiveReliability::Duration AdaptiveReliability::to_duration(
+        const Duration_t& time)
+{
+    return Duration(time.to_ns());
+}
+
+bool AdaptiveReliability::get_bound(
+        const PropertyPolicy& properties,
+        const char* name,
+        Duration& value)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(properties, name);
+    if (nullptr == property)
+    {
+        return false;
+    }
+
+    char* ptr = nullptr;
+    unsigned long milliseconds = strtoul(property->c_str(), &ptr, 10);
+    if (property->c_str() == ptr)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_WRITER, "Not numerical value for " << name << " property. Using default bound");
+        return false;
+    }
+
+    value = std::chrono::milliseconds(milliseconds);
+    return true;
+}
+
+void AdaptiveReliability::check_bounds()
+{
+    if (max_heartbeat_period_ < min_heartbeat_period_)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_WRITER, "Adaptive heartbeat period upper bound below the lower bound. Using "
+                << "the lower bound for both");
+        max_heartbeat_period_ = min_heartbeat_period_;
+    }
+    if (max_nack_response_delay_ < min_nack_response_delay_)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_WRITER, "Adaptive NACK response delay upper bound below the lower bound. Using "
+                << "the lower bound for both");
+        max_nack_response_delay_ = min_nack_response_delay_;
+    }
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,171 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AdaptiveReliability.hpp
+ */
+
+#ifndef RTPS_WRITER_ADAPTIVERELIABILITY_HPP
+#define RTPS_WRITER_ADAPTIVERELIABILITY_HPP
+
+#include <chrono>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Tunes the heartbeat period and the NACK response delay of a reliable writer from the ACKNACK round trip time and
+ * the NACK rate observed on its matched readers.
+ *
+ * The NACK rate of the worst reader moves both values from the upper bound (no NACKs) to the lower bound (every
+ * ACKNACK requests changes). The heartbeat period is never shorter than twice the slowest round trip, so readers
+ * can answer a heartbeat before the next one, and the NACK response delay never exceeds half the fastest round trip.
+ *
+ * Enabled with the fastdds.adaptive_reliability endpoint property. The bounds are configured in milliseconds with
+ * the properties:
+ * - fastdds.adaptive_reliability.heartbeat_period.min, by default a tenth of WriterTimes::heartbeatPeriod.
+ * - fastdds.adaptive_reliability.heartbeat_period.max, by default twice WriterTimes::heartbeatPeriod.
+ * - fastdds.adaptive_reliability.nack_response_delay.min, by default zero.
+ * - fastdds.adaptive_reliability.nack_response_delay.max, by default WriterTimes::nackResponseDelay.
+ * @ingroup WRITER_MODULE
+ */
+class AdaptiveReliability
+{
+public:
+
+    using Duration = std::chrono::nanoseconds;
+
+    /**
+     * @param times Times configured on the writer.
+     * @param properties Properties of the writer, giving the bounds.
+     */
+    AdaptiveReliability(
+            const WriterTimes& times,
+            const PropertyPolicy& properties);
+
+    /**
+     * Check whether adaptive reliability is enabled on a set of properties.
+     * @param properties Properties of the writer.
+     * @return true when the fastdds.adaptive_reliability property is "true".
+     */
+    static bool is_enabled(
+            const PropertyPolicy& properties);
+
+    /**
+     * Update the bounds not given by properties, which follow the times configured on the writer.
+     * @param times New times of the writer.
+     */
+    void update_times(
+            const WriterTimes& times);
+
+    //! Start a new computation, before adding the readers.
+    void begin_update();
+
+    /**
+     * Add the observations of a reader to the current computation.
+     * @param ack_round_trip Smoothed ACKNACK round trip time. Zero when not measured yet.
+     * @param nack_rate Smoothed ratio of ACKNACKs requesting changes, between 0 and 1.
+     */
+    void add_reader(
+            const Duration& ack_round_trip,
+            double nack_rate);
+
+    //! Compute the new values from the readers added. Values are kept when no reader was added.
+    void end_update();
+
+    //! Heartbeat period chosen on the last computation.
+    Duration_t heartbeat_period() const;
+
+    //! NACK response delay chosen on the last computation.
+    Duration_t nack_response_delay() const;
+
+    Duration min_heartbeat_period() const
+    {
+        return min_heartbeat_period_;
+    }
+
+    Duration max_heartbeat_period() const
+    {
+        return max_heartbeat_period_;
+    }
+
+    Duration min_nack_response_delay() const
+    {
+        return min_nack_response_delay_;
+    }
+
+    Duration max_nack_response_delay() const
+    {
+        return max_nack_response_delay_;
+    }
+
+private:
+
+    static Duration clamp(
+            const Duration& value,
+            const Duration& min,
+            const Duration& max);
+
+    static Duration interpolate(
+            const Duration& min,
+            const Duration& max,
+            double nack_rate);
+
+    static Duration to_duration(
+            const Duration_t& time);
+
+    /**
+     * Read a bound from the properties.
+     * @param properties Properties of the writer.
+     * @param name Name of the property.
+     * @param [out] value Bound read.
+     * @return true when the property was found with a valid value.
+     */
+    static bool get_bound(
+            const PropertyPolicy& properties,
+            const char* name,
+            Duration& value);
+
+    void check_bounds();
+
+    Duration min_heartbeat_period_;
+    Duration max_heartbeat_period_;
+    Duration min_nack_response_delay_;
+    Duration max_nack_response_delay_;
+
+    bool min_heartbeat_period_set_ = false;
+    bool max_heartbeat_period_set_ = false;
+    bool min_nack_response_delay_set_ = false;
+    bool max_nack_response_delay_set_ = false;
+
+    Duration heartbeat_period_;
+    Duration nack_response_delay_;
+
+    //! Observations of the current computation
+    size_t readers_ = 0;
+    double worst_nack_rate_ = 0.0;
+    Duration slowest_round_trip_;
+    Duration fastest_round_trip_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_WRITER_ADAPTIVERELIABILITY_HPP
@@ -2,6 +2,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <algorithm>
+#include <iterator>
 
 using namespace std::chrono;
 
@@ -9,8 +10,6 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-using LivelinessDataIterator = ResourceLimitedVector<LivelinessData>::iterator;
-
 LivelinessManager::LivelinessManager(
         const LivelinessCallback& callback,
         ResourceEvent& service,
@@ -18,6 +17,9 @@ LivelinessManager::LivelinessManager(
     : callback_(callback)
     , manage_automatic_(manage_automatic)
     , writers_()
+    , nodes_()
+    , buckets_()
+    , index_()
     , mutex_()
     , col_mutex_()
     , timer_owner_(nullptr)
@@ -55,17 +57,25 @@ bool LivelinessManager::add_writer(
         // writers_ elements guard
         std::lock_guard<std::mutex> __(mutex_);
 
-        for (LivelinessData& writer : writers_)
+        size_t index = find_writer(guid, kind, lease_duration);
+        if (npos != index)
         {
-            if (writer.guid == guid &&
-                    writer.kind == kind &&
-                    writer.lease_duration == lease_duration)
-            {
-                writer.count++;
-                return true;
-            }
+            writers_[index].count++;
+            return true;
+        }
+
+        // Adding may reallocate the collection, so the timer owner is kept as an index
+        size_t owner = (timer_owner_ != nullptr) ? static_cast<size_t>(timer_owner_ - writers_.data()) : npos;
+        if (nullptr == writers_.emplace_back(guid, kind, lease_duration))
+        {
+            return false;
         }
-        writers_.emplace_back(guid, kind, lease_duration);
+        timer_owner_ = (npos != owner) ? &writers_[owner] : nullptr;
+
+        index = writers_.size() - 1;
+        index_.emplace(guid, index);
+        nodes_.emplace_back();
+        nodes_.back().bucket = bucket_for(lease_duration);
     }
 
     if (!calculate_next())
@@ -94,8 +104,8 @@ bool LivelinessManager::remove_writer(
         LivelinessQosPolicyKind kind,
         Duration_t lease_duration)
 {
-    bool removed = false;
     LivelinessData::WriterStatus status;
+    bool timer_running = false;
 
     {
         // collection guard
@@ -103,19 +113,17 @@ bool LivelinessManager::remove_writer(
         // writers_ elements guard
         std::lock_guard<std::mutex> __(mutex_);
 
-        removed = writers_.remove_if([guid, kind, lease_duration, &status](LivelinessData& writer)
-                        {
-                            status = writer.status;
-                            return writer.guid == guid &&
-                            writer.kind == kind &&
-                            writer.lease_duration == lease_duration &&
-                            --writer.count == 0;
-                        });
-    }
+        size_t index = find_writer(guid, kind, lease_duration);
+        if (npos == index || --writers_[index].count != 0)
+        {
+            return false;
+        }
 
-    if (!removed)
-    {
-        return false;
+        status = writers_[index].status;
+        timer_running = (timer_owner_ != nullptr);
+        timer_owner_ = nullptr;
+        writers_.erase(writers_.begin() + index);
+        rebuild_index();
     }
 
     if (callback_ != nullptr)
@@ -130,19 +138,15 @@ bool LivelinessManager::remove_writer(
         }
     }
 
-    std::unique_lock<std::mutex> lock(mutex_);
-
-    if (timer_owner_ != nullptr)
+    if (timer_running)
     {
-        lock.unlock();
-
         if (!calculate_next())
         {
             timer_.cancel_timer();
             return true;
         }
 
-        lock.lock();
+        std::lock_guard<std::mutex> lock(mutex_);
 
         if (timer_owner_ != nullptr)
         {
@@ -162,50 +166,32 @@ bool LivelinessManager::assert_liveliness(
         LivelinessQosPolicyKind kind,
         Duration_t lease_duration)
 {
-    bool found = false;
-
     {
         // collection guard
         shared_lock<shared_mutex> _(col_mutex_);
 
-        for (LivelinessData& writer : writers_)
+        size_t index = find_writer(guid, kind, lease_duration);
+        if (npos == index)
         {
-            // writers_ elements guard
-            std::unique_lock<std::mutex> lock(mutex_);
+            return false;
+        }
 
-            if (writer.guid == guid &&
-                    writer.kind == kind &&
-                    writer.lease_duration == lease_duration)
+        // Execute the callbacks
+        if (kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+                kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+        {
+            for (size_t i = 0; i < writers_.size(); ++i)
             {
-                lock.unlock();
-
-                found = true;
-
-                // Execute the callbacks
-                if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-                        writer.kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
-                {
-                    for (LivelinessData& w: writers_)
-                    {
-                        if (w.kind == writer.kind)
-                        {
-                            assert_writer_liveliness(w);
-                        }
-                    }
-                }
-                else if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+                if (writers_[i].kind == kind)
                 {
-                    assert_writer_liveliness(writer);
+                    assert_writer_liveliness(i);
                 }
-
-                break;
             }
         }
-    }
-
-    if (!found)
-    {
-        return false;
+        else if (kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+        {
+            assert_writer_liveliness(index);
+        }
     }
 
     timer_.cancel_timer();
@@ -251,11 +237,11 @@ bool LivelinessManager::assert_liveliness(
         }
 
 
-        for (LivelinessData& writer: writers_)
+        for (size_t i = 0; i < writers_.size(); ++i)
         {
-            if (writer.kind == kind)
+            if (writers_[i].kind == kind)
             {
-                assert_writer_liveliness(writer);
+                assert_writer_liveliness(i);
             }
         }
     }
@@ -296,11 +282,12 @@ bool LivelinessManager::calculate_next()
 
     timer_owner_ = nullptr;
 
-    // collection guard
-    for (LivelinessData& writer : writers_)
+    // Alive writers of a bucket are sorted by expiration time, so only the heads need to be checked
+    for (const LeaseBucket& bucket : buckets_)
     {
-        if (writer.status == LivelinessData::WriterStatus::ALIVE)
+        if (npos != bucket.head)
         {
+            LivelinessData& writer = writers_[bucket.head];
             if (writer.time < min_time)
             {
                 min_time = writer.time;
@@ -325,6 +312,7 @@ bool LivelinessManager::timer_expired()
     else
     {
         timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
+        unlink_alive(static_cast<size_t>(timer_owner_ - writers_.data()));
     }
 
     auto guid = timer_owner_->guid;
@@ -359,34 +347,31 @@ bool LivelinessManager::timer_expired()
 bool LivelinessManager::is_any_alive(
         LivelinessQosPolicyKind kind)
 {
-    // Keep this lock order to prevent ABBA deadlocks
-    shared_lock<shared_mutex> _(col_mutex_);
-    std::lock_guard<std::mutex> __(mutex_);
-
-    for (const auto& writer : writers_)
-    {
-        if (writer.kind == kind && writer.status == LivelinessData::WriterStatus::ALIVE)
-        {
-            return true;
-        }
-    }
+    std::lock_guard<std::mutex> _(mutex_);
 
-    return false;
+    return 0 < alive_count_[kind];
 }
 
 void LivelinessManager::assert_writer_liveliness(
-        LivelinessData& writer)
+        size_t index)
 {
     // The shared_mutex is taken, that is, the writer referenced will not be destroyed during this call
     std::unique_lock<std::mutex> lock(mutex_);
 
+    LivelinessData& writer = writers_[index];
     auto status = writer.status;
     auto guid = writer.guid;
     auto kind = writer.kind;
     auto lease_duration = writer.lease_duration;
 
+    // Re-asserted writers go to the tail of their bucket, as they are now the last ones to expire
+    if (status == LivelinessData::WriterStatus::ALIVE)
+    {
+        unlink_alive(index);
+    }
     writer.status = LivelinessData::WriterStatus::ALIVE;
     writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+    link_alive(index);
 
     lock.unlock();
 
@@ -403,6 +388,134 @@ void LivelinessManager::assert_writer_liveliness(
     }
 }
 
+size_t LivelinessManager::find_writer(
+        const GUID_t& guid,
+        LivelinessQosPolicyKind kind,
+        const Duration_t& lease_duration) const
+{
+    auto range = index_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const LivelinessData& writer = writers_[it->second];
+        if (writer.kind == kind && writer.lease_duration == lease_duration)
+        {
+            return it->second;
+        }
+    }
+    return npos;
+}
+
+size_t LivelinessManager::bucket_for(
+        const Duration_t& lease_duration)
+{
+    for (size_t i = 0; i < buckets_.size(); ++i)
+    {
+        if (buckets_[i].lease_duration == lease_duration)
+        {
+            return i;
+        }
+    }
+
+    buckets_.emplace_back();
+    buckets_.back().lease_duration = lease_duration;
+    return buckets_.size() - 1;
+}
+
+void LivelinessManager::link_alive(
+        size_t index)
+{
+    LeaseNode& node = nodes_[index];
+    LeaseBucket& bucket = buckets_[node.bucket];
+
+    node.prev = bucket.tail;
+    node.next = npos;
+    if (npos != bucket.tail)
+    {
+        nodes_[bucket.tail].next = index;
+    }
+    else
+    {
+        bucket.head = index;
+    }
+    bucket.tail = index;
+
+    ++alive_count_[writers_[index].kind];
+}
+
+void LivelinessManager::unlink_alive(
+        size_t index)
+{
+    LeaseNode& node = nodes_[index];
+    LeaseBucket& bucket = buckets_[node.bucket];
+
+    if (npos != node.prev)
+    {
+        nodes_[node.prev].next = node.next;
+    }
+    else
+    {
+        bucket.head = node.next;
+    }
+
+    if (npos != node.next)
+    {
+        nodes_[node.next].prev = node.prev;
+    }
+    else
+    {
+        bucket.tail = node.prev;
+    }
+
+    node.prev = npos;
+    node.next = npos;
+
+    --alive_count_[writers_[index].kind];
+}
+
+void LivelinessManager::rebuild_index()
+{
+    index_.clear();
+    buckets_.clear();
+    nodes_.assign(writers_.size(), LeaseNode());
+    std::fill(std::begin(alive_count_), std::end(alive_count_), 0u);
+
+    std::vector<size_t> alive;
+    for (size_t i = 0; i < writers_.size(); ++i)
+    {
+        index_.emplace(writers_[i].guid, i);
+        nodes_[i].bucket = bucket_for(writers_[i].lease_duration);
+        if (writers_[i].status == LivelinessData::WriterStatus::ALIVE)
+        {
+            alive.push_back(i);
+        }
+    }
+
+    std::sort(alive.begin(), alive.end(), [this](size_t a, size_t b)
+            {
+                return writers_[a].time < writers_[b].time;
+            });
+    for (size_t i : alive)
+    {
+        link_alive(i);
+    }
+}
+
+size_t LivelinessManager::GuidHash::operator ()(
+        const GUID_t& guid) const
+{
+    // FNV-1a over the GUID bytes
+    uint64_t hash = 14695981039346656037ULL;
+    for (octet value : guid.guidPrefix.value)
+    {
+        hash = (hash ^ value) * 1099511628211ULL;
+    }
+    for (octet value : guid.entityId.value)
+    {
+        hash = (hash ^ value) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
 {
     return writers_;
@@ -12,6 +12,14 @@ bool LocatorSelectorSender::send(
     return writer_.send_nts(message, *this, max_blocking_time_point);
 }
 
+bool LocatorSelectorSender::send(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    return writer_.send_nts(buffers, total_bytes, *this, max_blocking_time_point);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
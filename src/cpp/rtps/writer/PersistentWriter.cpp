@@ -18,6 +18,7 @@
  */
 
 #include <fastdds/rtps/writer/PersistentWriter.h>
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <rtps/persistence/PersistenceService.h>
 #include <fastrtps_deprecated/participant/ParticipantImpl.h>
@@ -37,6 +38,7 @@ PersistentWriter::PersistentWriter(
         IPersistenceService* persistence)
     : persistence_(persistence)
     , persistence_guid_()
+    , persistence_payload_pool_(payload_pool)
 {
     // When persistence GUID is unknown, create from rtps GUID
     GUID_t p_guid = att.endpoint.persistence_guid == c_Guid_Unknown ? guid : att.endpoint.persistence_guid;
@@ -59,7 +61,11 @@ PersistentWriter::PersistentWriter(
         assert(pool != nullptr);
         for (auto change : hist->m_changes)
         {
-            pool->add_to_shared_history(change);
+            // Datasharing readers access the payloads directly, so they cannot be loaded lazily
+            if (load_persistent_payload(change))
+            {
+                pool->add_to_shared_history(change);
+            }
         }
     }
 }
@@ -83,6 +89,39 @@ void PersistentWriter::remove_persistent_change(
         CacheChange_t* change)
 {
     persistence_->remove_writer_change_from_storage(persistence_guid_, *change);
+
+    // The change goes back to the pool without a payload to release
+    if (IPersistenceService::is_payload_pending(*change))
+    {
+        change->serializedPayload.length = 0;
+    }
+}
+
+bool PersistentWriter::load_persistent_payload(
+        CacheChange_t* change)
+{
+    if (!IPersistenceService::is_payload_pending(*change))
+    {
+        return true;
+    }
+
+    if (!persistence_->load_writer_payload(persistence_guid_, *change, persistence_payload_pool_))
+    {
+        if (!payload_error_printed_)
+        {
+            payload_error_printed_ = true;
+            EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                    "Cannot load the payload of change " << change->sequenceNumber << " from storage. " <<
+                    "Changes which cannot be loaded will not be sent.");
+        }
+        else
+        {
+            EPROSIMA_LOG_INFO(RTPS_WRITER,
+                    "Cannot load the payload of change " << change->sequenceNumber << " from storage");
+        }
+        return false;
+    }
+    return true;
 }
 
 } // namespace rtps
@@ -441,6 +441,19 @@ bool RTPSWriter::send_nts(
                    locator_selector.locator_selector.end(), max_blocking_time_point);
 }
 
+bool RTPSWriter::send_nts(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    RTPSParticipantImpl* participant = getRTPSParticipant();
+
+    return locator_selector.locator_selector.selected_size() == 0 ||
+           participant->sendSync(buffers, total_bytes, m_guid, locator_selector.locator_selector.begin(),
+                   locator_selector.locator_selector.end(), max_blocking_time_point);
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool RTPSWriter::add_statistics_listener(
@@ -53,7 +53,7 @@ ReaderProxy::ReaderProxy(
     , is_reliable_(false)
     , disable_positive_acks_(false)
     , writer_(writer)
-    , changes_for_reader_(resource_limits_from_history(writer->mp_history->m_att, 0))
+    , changes_for_reader_(resource_limits_from_history(writer->mp_history->m_att, 0).initial)
     , nack_supression_event_(nullptr)
     , initial_heartbeat_event_(nullptr)
     , timers_enabled_(false)
@@ -166,9 +166,13 @@ void ReaderProxy::stop()
     disable_timers();
 
     changes_for_reader_.clear();
+    fragmented_changes_.clear();
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
+    ack_round_trip_ = std::chrono::nanoseconds(0);
+    nack_rate_ = 0.0;
+    sampled_heartbeat_ = std::chrono::steady_clock::time_point();
 }
 
 void ReaderProxy::disable_timers()
@@ -218,8 +222,6 @@ void ReaderProxy::add_change(
         bool is_relevant)
 {
     assert(change.getSequenceNumber() > changes_low_mark_);
-    assert(changes_for_reader_.empty() ? true :
-            change.getSequenceNumber() > changes_for_reader_.back().getSequenceNumber());
 
     // Irrelevant changes are not added to the collection
     if (!is_relevant)
@@ -232,13 +234,12 @@ void ReaderProxy::add_change(
         return;
     }
 
-    if (changes_for_reader_.push_back(change) == nullptr)
+    changes_for_reader_.push_back(change.getSequenceNumber(), change.getStatus(), change.has_been_delivered());
+
+    // Only fragmented changes need more state than their status
+    if (0 != change.getChange()->getFragmentSize())
     {
-        // This should never happen
-        EPROSIMA_LOG_ERROR(RTPS_READER_PROXY, "Error adding change " << change.getSequenceNumber()
-                                                                     << " to reader proxy " << guid());
-        eprosima::fastdds::dds::Log::Flush();
-        assert(false);
+        fragmented_changes_.push_back(change);
     }
 }
 
@@ -255,15 +256,15 @@ bool ReaderProxy::change_is_acked(
         return true;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    ChangeForReaderStatus_t status = UNSENT;
+    if (!changes_for_reader_.find(seq_num, status))
     {
         // There is a hole in changes_for_reader_
         // This means a change was removed, or was not relevant.
         return true;
     }
 
-    return chit->getStatus() == ACKNOWLEDGED;
+    return status == ACKNOWLEDGED;
 }
 
 bool ReaderProxy::change_is_unsent(
@@ -278,31 +279,30 @@ bool ReaderProxy::change_is_unsent(
         return false;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    ChangeForReaderStatus_t status = UNSENT;
+    if (!changes_for_reader_.find(seq_num, status))
     {
         // There is a hole in changes_for_reader_
         // This means a change was removed.
         return false;
     }
 
-    bool returned_value = chit->getStatus() == UNSENT;
+    bool returned_value = status == UNSENT;
 
     if (returned_value)
     {
-        next_unsent_frag = chit->get_next_unsent_fragment();
+        // Changes not fragmented are sent at once, as their first fragment
+        FragmentedChangeConstIterator fragmented = find_fragmented_change(seq_num);
+        next_unsent_frag = fragmented_changes_.end() != fragmented ? fragmented->get_next_unsent_fragment() : 1u;
         gap_seq = SequenceNumber_t::unknown();
 
-        if (is_reliable_ && !chit->has_been_delivered())
+        if (is_reliable_ && !changes_for_reader_.is_delivered(seq_num))
         {
             need_reactivate_periodic_heartbeat |= true;
-            SequenceNumber_t prev =
-                    (changes_for_reader_.begin() != chit ?
-                    std::prev(chit)->getSequenceNumber() :
-                    changes_low_mark_
-                    ) + 1;
+            SequenceNumber_t prev = changes_for_reader_.previous(seq_num);
+            prev = (SequenceNumber_t::unknown() != prev ? prev : changes_low_mark_) + 1;
 
-            if (prev != chit->getSequenceNumber())
+            if (prev != seq_num)
             {
                 gap_seq = prev;
 
@@ -332,16 +332,15 @@ void ReaderProxy::acked_changes_set(
 
     if (seq_num > changes_low_mark_)
     {
-        ChangeIterator chit = find_change(seq_num, false);
+        changes_for_reader_.erase_before(seq_num);
         // continue advancing until next change is not acknowledged
-        while (chit != changes_for_reader_.end()
-                && chit->getSequenceNumber() == future_low_mark
-                && chit->getStatus() == ACKNOWLEDGED)
+        ChangeForReaderStatus_t status = UNSENT;
+        while (changes_for_reader_.find(future_low_mark, status) && status == ACKNOWLEDGED)
         {
-            ++chit;
+            changes_for_reader_.erase(future_low_mark);
             ++future_low_mark;
         }
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        fragmented_changes_.erase(fragmented_changes_.begin(), find_fragmented_change(future_low_mark, false));
     }
     else
     {
@@ -362,36 +361,27 @@ void ReaderProxy::acked_changes_set(
                 }
                 future_low_mark = current_sequence;
 
-                bool should_sort = false;
+                std::vector<CacheChange_t*>::iterator hint = writer_->mp_history->changesBegin();
                 for (; current_sequence <= changes_low_mark_; ++current_sequence)
                 {
-                    // Skip all consecutive changes already in the collection
-                    ChangeConstIterator it = find_change(current_sequence);
-                    while ( it != changes_for_reader_.end() &&
-                            current_sequence <= changes_low_mark_ &&
-                            it->getSequenceNumber() == current_sequence)
+                    // Skip changes already in the collection
+                    if (changes_for_reader_.contains(current_sequence))
                     {
-                        ++current_sequence;
-                        ++it;
+                        continue;
                     }
 
-                    if (current_sequence <= changes_low_mark_)
+                    CacheChange_t* change = find_history_change(current_sequence, hint);
+                    if (nullptr != change)
                     {
-                        CacheChange_t* change = nullptr;
-                        if (writer_->mp_history->get_change(current_sequence, writer_->getGuid(), &change))
+                        changes_for_reader_.insert(current_sequence, UNACKNOWLEDGED);
+                        if (0 != change->getFragmentSize())
                         {
-                            should_sort = true;
                             ChangeForReader_t cr(change);
                             cr.setStatus(UNACKNOWLEDGED);
-                            changes_for_reader_.push_back(cr);
+                            fragmented_changes_.insert(find_fragmented_change(current_sequence, false), cr);
                         }
                     }
                 }
-                // Keep changes sorted by sequence number
-                if (should_sort)
-                {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
-                }
             }
             else if (!is_local_reader())
             {
@@ -413,13 +403,17 @@ bool ReaderProxy::requested_changes_set(
     {
         seq_num_set.for_each([&](SequenceNumber_t sit)
                 {
-                    ChangeIterator chit = find_change(sit, true);
-                    if (chit != changes_for_reader_.end())
+                    ChangeForReaderStatus_t status = UNSENT;
+                    if (changes_for_reader_.find(sit, status))
                     {
-                        if (UNACKNOWLEDGED == chit->getStatus())
+                        if (UNACKNOWLEDGED == status)
                         {
-                            chit->setStatus(REQUESTED);
-                            chit->markAllFragmentsAsUnsent();
+                            changes_for_reader_.set_status(sit, REQUESTED);
+                            FragmentedChangeIterator fragmented = find_fragmented_change(sit, true);
+                            if (fragmented != fragmented_changes_.end())
+                            {
+                                fragmented->markAllFragmentsAsUnsent();
+                            }
                             isSomeoneWasSetRequested = true;
                         }
                     }
@@ -438,8 +432,34 @@ bool ReaderProxy::requested_changes_set(
     return isSomeoneWasSetRequested;
 }
 
+void ReaderProxy::update_acknack_statistics(
+        const std::chrono::steady_clock::time_point& last_heartbeat,
+        const std::chrono::steady_clock::time_point& now,
+        bool requested_changes)
+{
+    // Exponentially weighted moving averages, giving a weight of 1/8 to each new sample
+    constexpr int64_t weight_inverse = 8;
+
+    if (last_heartbeat != sampled_heartbeat_ && last_heartbeat <= now &&
+            std::chrono::steady_clock::time_point() != last_heartbeat)
+    {
+        sampled_heartbeat_ = last_heartbeat;
+        std::chrono::nanoseconds sample = std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_heartbeat);
+        if (std::chrono::nanoseconds(0) == ack_round_trip_)
+        {
+            ack_round_trip_ = sample;
+        }
+        else
+        {
+            ack_round_trip_ += (sample - ack_round_trip_) / weight_inverse;
+        }
+    }
+
+    nack_rate_ += ((requested_changes ? 1.0 : 0.0) - nack_rate_) / weight_inverse;
+}
+
 bool ReaderProxy::process_initial_acknack(
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     if (is_local_reader())
     {
@@ -467,24 +487,31 @@ void ReaderProxy::from_unsent_to_status(
 
     // Called when delivering an UNSENT sample, the seq_number must exists in the ReaderProxy.
     assert(seq_num > changes_low_mark_);
-    ChangeIterator it = find_change(seq_num, true);
-    assert(changes_for_reader_.end() != it);
-    assert(UNSENT == it->getStatus());
+    ChangeForReaderStatus_t current_status = UNSENT;
+    bool found = changes_for_reader_.find(seq_num, current_status);
+    (void)found;
+    assert(found);
+    assert(UNSENT == current_status);
     assert(UNSENT != status);
 
     if (ACKNOWLEDGED == status && seq_num == changes_low_mark_ + 1)
     {
-        assert(changes_for_reader_.begin() == it);
-        changes_for_reader_.erase(it);
+        assert(changes_for_reader_.first() == seq_num);
+        erase_change(seq_num);
         acked_changes_set(seq_num + 1);
         return;
     }
 
-    it->setStatus(status);
+    changes_for_reader_.set_status(seq_num, status);
 
     if (delivered)
     {
-        it->set_delivered();
+        changes_for_reader_.set_delivered(seq_num);
+        FragmentedChangeIterator fragmented = find_fragmented_change(seq_num, true);
+        if (fragmented != fragmented_changes_.end())
+        {
+            fragmented->set_delivered();
+        }
     }
 }
 
@@ -495,22 +522,24 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
 {
     was_last_fragment = false;
 
-    if (seq_num <= changes_low_mark_)
+    if (seq_num <= changes_low_mark_ || !changes_for_reader_.contains(seq_num))
     {
         return false;
     }
 
-    bool change_found = false;
-    ChangeIterator it = find_change(seq_num, true);
-
-    if (it != changes_for_reader_.end())
+    FragmentedChangeIterator it = find_fragmented_change(seq_num, true);
+    if (it != fragmented_changes_.end())
     {
-        change_found = true;
         it->markFragmentsAsSent(frag_num);
         was_last_fragment = it->getUnsentFragments().empty();
     }
+    else
+    {
+        // Changes not fragmented are sent at once
+        was_last_fragment = true;
+    }
 
-    return change_found;
+    return true;
 }
 
 bool ReaderProxy::perform_nack_supression()
@@ -519,7 +548,7 @@ bool ReaderProxy::perform_nack_supression()
 }
 
 uint32_t ReaderProxy::perform_acknack_response(
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     return convert_status_on_all_changes(REQUESTED, UNSENT, func);
 }
@@ -527,56 +556,57 @@ uint32_t ReaderProxy::perform_acknack_response(
 uint32_t ReaderProxy::convert_status_on_all_changes(
         ChangeForReaderStatus_t previous,
         ChangeForReaderStatus_t next,
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     assert(previous > next);
 
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
-    uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
+    if (!func)
     {
-        if (change.getStatus() == previous)
-        {
-            ++changed;
-            change.setStatus(next);
-
-            if (func)
-            {
-                func(change);
-            }
-        }
+        return changes_for_reader_.convert_status(previous, next, [](const SequenceNumber_t&)
+                       {
+                       });
     }
 
-    return changed;
+    // Changes are visited in order, so the history is only traversed once
+    std::vector<CacheChange_t*>::iterator hint = writer_->mp_history->changesBegin();
+    return changes_for_reader_.convert_status(previous, next, [&](const SequenceNumber_t& seq_num)
+                   {
+                       CacheChange_t* change = find_history_change(seq_num, hint);
+                       assert(nullptr != change);
+                       if (nullptr != change)
+                       {
+                           func(change);
+                       }
+                   });
 }
 
 void ReaderProxy::change_has_been_removed(
         const SequenceNumber_t& seq_num)
 {
     // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
+    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.first())
     {
         return;
     }
 
-    auto chit = find_change(seq_num);
-
-    if (chit == this->changes_for_reader_.end())
+    ChangeForReaderStatus_t status = UNSENT;
+    if (!changes_for_reader_.find(seq_num, status))
     {
         // No change for this sequence number
         return;
     }
 
     // In intraprocess, if there is an UNACKNOWLEDGED, a GAP has to be send because there is no reliable mechanism.
-    if (is_local_reader() && ACKNOWLEDGED > chit->getStatus())
+    if (is_local_reader() && ACKNOWLEDGED > status)
     {
         writer_->intraprocess_gap(this, seq_num);
     }
 
     // Element may not be in the container when marked as irrelevant.
-    changes_for_reader_.erase(chit);
+    erase_change(seq_num);
 
     // When removing the next-to-be-acknowledged, we should auto-acknowledge it.
     if ((changes_low_mark_ + 1) == seq_num)
@@ -593,15 +623,7 @@ bool ReaderProxy::has_unacknowledged(
         return true;
     }
 
-    for (const ChangeForReader_t& it : changes_for_reader_)
-    {
-        if (it.getStatus() == UNACKNOWLEDGED)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return 0 < changes_for_reader_.count(UNACKNOWLEDGED);
 }
 
 bool ReaderProxy::requested_fragment_set(
@@ -609,18 +631,22 @@ bool ReaderProxy::requested_fragment_set(
         const FragmentNumberSet_t& frag_set)
 {
     // Locate the outbound change referenced by the NACK_FRAG
-    ChangeIterator changeIter = find_change(seq_num, true);
-    if (changeIter == changes_for_reader_.end())
+    ChangeForReaderStatus_t status = UNSENT;
+    if (!changes_for_reader_.find(seq_num, status))
     {
         return false;
     }
 
-    changeIter->markFragmentsAsUnsent(frag_set);
+    FragmentedChangeIterator fragmented = find_fragmented_change(seq_num, true);
+    if (fragmented != fragmented_changes_.end())
+    {
+        fragmented->markFragmentsAsUnsent(frag_set);
+    }
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
-    if (changeIter->getStatus() != UNSENT)
+    if (status != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        changes_for_reader_.set_status(seq_num, REQUESTED);
     }
 
     return true;
@@ -654,13 +680,13 @@ static bool change_less_than_sequence(
     return change.getSequenceNumber() < seq_num;
 }
 
-ReaderProxy::ChangeIterator ReaderProxy::find_change(
+ReaderProxy::FragmentedChangeIterator ReaderProxy::find_fragmented_change(
         const SequenceNumber_t& seq_num,
         bool exact)
 {
-    ReaderProxy::ChangeIterator it;
-    ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    ReaderProxy::FragmentedChangeIterator it;
+    ReaderProxy::FragmentedChangeIterator end = fragmented_changes_.end();
+    it = std::lower_bound(fragmented_changes_.begin(), end, seq_num, change_less_than_sequence);
 
     return (!exact)
            ? it
@@ -669,18 +695,64 @@ ReaderProxy::ChangeIterator ReaderProxy::find_change(
            : it->getSequenceNumber() == seq_num ? it : end;
 }
 
-ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
+ReaderProxy::FragmentedChangeConstIterator ReaderProxy::find_fragmented_change(
         const SequenceNumber_t& seq_num) const
 {
-    ReaderProxy::ChangeConstIterator it;
-    ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    ReaderProxy::FragmentedChangeConstIterator it;
+    ReaderProxy::FragmentedChangeConstIterator end = fragmented_changes_.end();
+    it = std::lower_bound(fragmented_changes_.begin(), end, seq_num, change_less_than_sequence);
 
     return it == end
            ? it
            : it->getSequenceNumber() == seq_num ? it : end;
 }
 
+bool ReaderProxy::erase_change(
+        const SequenceNumber_t& seq_num)
+{
+    FragmentedChangeIterator fragmented = find_fragmented_change(seq_num, true);
+    if (fragmented != fragmented_changes_.end())
+    {
+        fragmented_changes_.erase(fragmented);
+    }
+
+    return changes_for_reader_.erase(seq_num);
+}
+
+CacheChange_t* ReaderProxy::find_history_change(
+        const SequenceNumber_t& seq_num,
+        std::vector<CacheChange_t*>::iterator& hint) const
+{
+    std::vector<CacheChange_t*>::iterator end = writer_->mp_history->changesEnd();
+    if (hint == end)
+    {
+        return nullptr;
+    }
+
+    // Sequence numbers on the history are increasing, so the change cannot be further than its distance to the
+    // change on the hint, where it is when the history has no holes.
+    if ((*hint)->sequenceNumber < seq_num)
+    {
+        uint64_t distance = (seq_num - (*hint)->sequenceNumber).to64long();
+        if (distance < static_cast<uint64_t>(end - hint))
+        {
+            end = hint + static_cast<std::ptrdiff_t>(distance) + 1;
+            if ((*(end - 1))->sequenceNumber == seq_num)
+            {
+                hint = end - 1;
+                return *hint;
+            }
+        }
+    }
+
+    hint = std::lower_bound(hint, end, seq_num, [](const CacheChange_t* change, const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
+
+    return (hint != end && (*hint)->sequenceNumber == seq_num) ? *hint : nullptr;
+}
+
 bool ReaderProxy::has_been_delivered(
         const SequenceNumber_t& seq_number,
         bool& found) const
@@ -691,11 +763,10 @@ bool ReaderProxy::has_been_delivered(
         return true;
     }
 
-    ChangeConstIterator it = find_change(seq_number);
-    if (it != changes_for_reader_.end())
+    if (changes_for_reader_.contains(seq_number))
     {
         found = true;
-        return it->has_been_delivered();
+        return changes_for_reader_.is_delivered(seq_number);
     }
 
     return false;
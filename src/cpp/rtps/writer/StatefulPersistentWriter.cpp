@@ -95,6 +95,21 @@ bool StatefulPersistentWriter::change_removed_by_history(
     return StatefulWriter::change_removed_by_history(change, max_blocking_time);
 }
 
+DeliveryRetCode StatefulPersistentWriter::deliver_sample_nts(
+        CacheChange_t* cache_change,
+        RTPSMessageGroup& group,
+        LocatorSelectorSender& locator_selector, // Object locked by FlowControllerImpl
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    if (!load_persistent_payload(cache_change))
+    {
+        // The sample cannot be sent, readers will receive a GAP for it.
+        discard_change_nts(cache_change);
+        return DeliveryRetCode::DELIVERED;
+    }
+    return StatefulWriter::deliver_sample_nts(cache_change, group, locator_selector, max_blocking_time);
+}
+
 void StatefulPersistentWriter::print_inconsistent_acknack(
         const GUID_t& writer_guid,
         const GUID_t& reader_guid,
@@ -47,8 +47,10 @@
 
 #include <rtps/RTPSDomainImpl.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <rtps/messages/ControlMessageScheduler.hpp>
 #include <rtps/messages/RTPSGapBuilder.hpp>
 #include <rtps/network/ExternalLocatorsProcessor.hpp>
+#include <rtps/writer/AdaptiveReliability.hpp>
 
 #include "../builtin/discovery/database/DiscoveryDataBase.hpp"
 
@@ -176,10 +178,12 @@ StatefulWriter::StatefulWriter(
         WriterListener* listener)
     : RTPSWriter(pimpl, guid, att, flow_controller, history, listener)
     , periodic_hb_event_(nullptr)
+    , periodic_hb_task_(nullptr)
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
     , m_heartbeatCount(0)
     , m_times(att.times)
+    , adaptive_reliability_(nullptr)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
@@ -211,10 +215,12 @@ StatefulWriter::StatefulWriter(
         WriterListener* listener)
     : RTPSWriter(pimpl, guid, att, payload_pool, flow_controller, history, listener)
     , periodic_hb_event_(nullptr)
+    , periodic_hb_task_(nullptr)
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
     , m_heartbeatCount(0)
     , m_times(att.times)
+    , adaptive_reliability_(nullptr)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
@@ -247,10 +253,12 @@ StatefulWriter::StatefulWriter(
         WriterListener* listen)
     : RTPSWriter(pimpl, guid, att, payload_pool, change_pool, flow_controller, hist, listen)
     , periodic_hb_event_(nullptr)
+    , periodic_hb_task_(nullptr)
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
     , m_heartbeatCount(0)
     , m_times(att.times)
+    , adaptive_reliability_(nullptr)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
@@ -281,13 +289,36 @@ void StatefulWriter::init(
     auto push_mode = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.push_mode");
     m_pushMode = !((nullptr != push_mode) && ("false" == *push_mode));
 
-    periodic_hb_event_ = new TimedEvent(
-        pimpl->getEventResource(),
-        [&]() -> bool
-        {
-            return send_periodic_heartbeat();
-        },
-        TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    if (AdaptiveReliability::is_enabled(att.endpoint.properties))
+    {
+        adaptive_reliability_ = new AdaptiveReliability(m_times, att.endpoint.properties);
+    }
+
+    ControlMessageScheduler* control_message_scheduler = pimpl->control_message_scheduler();
+    if (nullptr != control_message_scheduler)
+    {
+        periodic_hb_task_ = new ControlMessageTask(
+            *control_message_scheduler,
+            [&](std::vector<Locator_t>& destinations) -> bool
+            {
+                return prepare_periodic_heartbeat(destinations);
+            },
+            [&](ControlMessageGroup& group, std::vector<Locator_t>& destinations)
+            {
+                add_periodic_heartbeat(group, destinations);
+            },
+            TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    }
+    else
+    {
+        periodic_hb_event_ = new TimedEvent(
+            pimpl->getEventResource(),
+            [&]() -> bool
+            {
+                return send_periodic_heartbeat();
+            },
+            TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    }
 
     nack_response_event_ = new TimedEvent(
         pimpl->getEventResource(),
@@ -298,6 +329,11 @@ void StatefulWriter::init(
         },
         TimeConv::Time_t2MilliSecondsDouble(m_times.nackResponseDelay));
 
+    if (nullptr != adaptive_reliability_)
+    {
+        adapt_reliability_times_nts();
+    }
+
     if (disable_positive_acks_)
     {
         ack_event_ = new TimedEvent(
@@ -368,6 +404,14 @@ StatefulWriter::~StatefulWriter()
         delete(periodic_hb_event_);
         periodic_hb_event_ = nullptr;
     }
+    if (periodic_hb_task_ != nullptr)
+    {
+        delete(periodic_hb_task_);
+        periodic_hb_task_ = nullptr;
+    }
+
+    delete(adaptive_reliability_);
+    adaptive_reliability_ = nullptr;
 
     // Delete all proxies in the pool
     for (ReaderProxy* remote_reader : matched_readers_pool_)
@@ -454,7 +498,7 @@ void StatefulWriter::unsent_change_added_to_history(
         }
         else
         {
-            periodic_hb_event_->restart_timer(max_blocking_time);
+            restart_periodic_heartbeat(max_blocking_time);
         }
     }
     else
@@ -592,15 +636,7 @@ void StatefulWriter::send_heartbeat_to_all_readers()
     }
     else
     {
-        for (ReaderProxy* reader : matched_local_readers_)
-        {
-            intraprocess_heartbeat(reader);
-        }
-
-        for (ReaderProxy* reader : matched_datasharing_readers_)
-        {
-            reader->datasharing_notify();
-        }
+        send_heartbeat_to_local_readers();
 
         if (there_are_remote_readers_)
         {
@@ -619,6 +655,19 @@ void StatefulWriter::send_heartbeat_to_all_readers()
     }
 }
 
+void StatefulWriter::send_heartbeat_to_local_readers()
+{
+    for (ReaderProxy* reader : matched_local_readers_)
+    {
+        intraprocess_heartbeat(reader);
+    }
+
+    for (ReaderProxy* reader : matched_datasharing_readers_)
+    {
+        reader->datasharing_notify();
+    }
+}
+
 void StatefulWriter::deliver_sample_to_intraprocesses(
         CacheChange_t* change)
 {
@@ -973,7 +1022,7 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
 
     if (need_reactivate_periodic_heartbeat)
     {
-        periodic_hb_event_->restart_timer(max_blocking_time);
+        restart_periodic_heartbeat(max_blocking_time);
     }
 
     return ret_code;
@@ -1193,7 +1242,7 @@ bool StatefulWriter::matched_reader_add(
 
                 // Always activate heartbeat period. We need a confirmation of the reader.
                 // The state has to be updated.
-                periodic_hb_event_->restart_timer(std::chrono::steady_clock::now() + std::chrono::hours(24));
+                restart_periodic_heartbeat(std::chrono::steady_clock::now() + std::chrono::hours(24));
             }
             catch (const RTPSMessageGroup::timeout&)
             {
@@ -1291,7 +1340,7 @@ bool StatefulWriter::matched_reader_remove(
 
     if (getMatchedReadersSize() == 0)
     {
-        periodic_hb_event_->cancel_timer();
+        cancel_periodic_heartbeat();
     }
 
     if (rproxy != nullptr)
@@ -1649,7 +1698,14 @@ void StatefulWriter::updateTimes(
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     if (m_times.heartbeatPeriod != times.heartbeatPeriod)
     {
-        periodic_hb_event_->update_interval(times.heartbeatPeriod);
+        if (nullptr != periodic_hb_task_)
+        {
+            periodic_hb_task_->update_interval(times.heartbeatPeriod);
+        }
+        else
+        {
+            periodic_hb_event_->update_interval(times.heartbeatPeriod);
+        }
     }
     if (m_times.nackResponseDelay != times.nackResponseDelay)
     {
@@ -1658,6 +1714,12 @@ void StatefulWriter::updateTimes(
             nack_response_event_->update_interval(times.nackResponseDelay);
         }
     }
+    if (nullptr != adaptive_reliability_)
+    {
+        // The configured times only give the default bounds of the adaptive reliability mode
+        adaptive_reliability_->update_times(times);
+        adapt_reliability_times_nts();
+    }
     if (m_times.nackSupressionDuration != times.nackSupressionDuration)
     {
         for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
@@ -1676,6 +1738,81 @@ void StatefulWriter::updateTimes(
     m_times = times;
 }
 
+void StatefulWriter::get_reliability_tuning(
+        fastdds::statistics::ReliabilityTuning& tuning) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    tuning.writer_guid = m_guid;
+    tuning.adaptive = nullptr != adaptive_reliability_;
+    tuning.readers.clear();
+
+    if (nullptr == adaptive_reliability_)
+    {
+        tuning.heartbeat_period = m_times.heartbeatPeriod;
+        tuning.nack_response_delay = m_times.nackResponseDelay;
+        return;
+    }
+
+    // Intervals the events are actually scheduled with
+    double heartbeat_period = nullptr != periodic_hb_task_ ?
+            periodic_hb_task_->getIntervalMilliSec() : periodic_hb_event_->getIntervalMilliSec();
+    tuning.heartbeat_period = Duration_t(heartbeat_period * 1e-3);
+    tuning.nack_response_delay = Duration_t(nack_response_event_->getIntervalMilliSec() * 1e-3);
+    for (const ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (reader->is_remote_and_reliable())
+        {
+            fastdds::statistics::ReaderReliabilityObservation observation;
+            observation.reader_guid = reader->guid();
+            observation.ack_round_trip = reader->ack_round_trip();
+            observation.nack_rate = reader->nack_rate();
+            tuning.readers.push_back(observation);
+        }
+    }
+}
+
+void StatefulWriter::adapt_reliability_times_nts()
+{
+    if (nullptr == adaptive_reliability_)
+    {
+        return;
+    }
+
+    adaptive_reliability_->begin_update();
+    for (const ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (reader->is_remote_and_reliable())
+        {
+            adaptive_reliability_->add_reader(reader->ack_round_trip(), reader->nack_rate());
+        }
+    }
+    adaptive_reliability_->end_update();
+
+    // The new times apply from the next period, as the events are rescheduled with their interval
+    double heartbeat_period = TimeConv::Time_t2MilliSecondsDouble(adaptive_reliability_->heartbeat_period());
+    if (nullptr != periodic_hb_task_)
+    {
+        if (periodic_hb_task_->getIntervalMilliSec() != heartbeat_period)
+        {
+            periodic_hb_task_->update_interval_millisec(heartbeat_period);
+        }
+    }
+    else if (nullptr != periodic_hb_event_)
+    {
+        if (periodic_hb_event_->getIntervalMilliSec() != heartbeat_period)
+        {
+            periodic_hb_event_->update_interval_millisec(heartbeat_period);
+        }
+    }
+
+    double nack_response_delay = TimeConv::Time_t2MilliSecondsDouble(adaptive_reliability_->nack_response_delay());
+    if (nullptr != nack_response_event_ && nack_response_event_->getIntervalMilliSec() != nack_response_delay)
+    {
+        nack_response_event_->update_interval_millisec(nack_response_delay);
+    }
+}
+
 SequenceNumber_t StatefulWriter::next_sequence_number() const
 {
     return mp_history->next_sequence_number();
@@ -1691,22 +1828,12 @@ bool StatefulWriter::send_periodic_heartbeat(
     bool unacked_changes = false;
     if (!liveliness)
     {
-        SequenceNumber_t first_seq_to_check_acknowledge = get_seq_num_min();
-        if (SequenceNumber_t::unknown() == first_seq_to_check_acknowledge)
-        {
-            first_seq_to_check_acknowledge = mp_history->next_sequence_number() - 1;
-        }
-
-        unacked_changes = for_matched_readers(matched_local_readers_, matched_datasharing_readers_,
-                        matched_remote_readers_,
-                        [first_seq_to_check_acknowledge](ReaderProxy* reader)
-                        {
-                            return reader->has_unacknowledged(first_seq_to_check_acknowledge);
-                        }
-                        );
+        unacked_changes = has_unacknowledged_changes_nts();
 
         if (unacked_changes)
         {
+            adapt_reliability_times_nts();
+
             try
             {
                 //TODO if separating, here sends periodic for all readers, instead of ones needed it.
@@ -1766,6 +1893,130 @@ bool StatefulWriter::send_periodic_heartbeat(
     return unacked_changes;
 }
 
+bool StatefulWriter::has_unacknowledged_changes_nts()
+{
+    SequenceNumber_t first_seq_to_check_acknowledge = get_seq_num_min();
+    if (SequenceNumber_t::unknown() == first_seq_to_check_acknowledge)
+    {
+        first_seq_to_check_acknowledge = mp_history->next_sequence_number() - 1;
+    }
+
+    return for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
+                   [first_seq_to_check_acknowledge](ReaderProxy* reader)
+                   {
+                       return reader->has_unacknowledged(first_seq_to_check_acknowledge);
+                   }
+                   );
+}
+
+void StatefulWriter::restart_periodic_heartbeat()
+{
+    if (nullptr != periodic_hb_task_)
+    {
+        periodic_hb_task_->restart_timer();
+    }
+    else
+    {
+        periodic_hb_event_->restart_timer();
+    }
+}
+
+void StatefulWriter::restart_periodic_heartbeat(
+        const std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    if (nullptr != periodic_hb_task_)
+    {
+        periodic_hb_task_->restart_timer(max_blocking_time);
+    }
+    else
+    {
+        periodic_hb_event_->restart_timer(max_blocking_time);
+    }
+}
+
+void StatefulWriter::cancel_periodic_heartbeat()
+{
+    if (nullptr != periodic_hb_task_)
+    {
+        periodic_hb_task_->cancel_timer();
+    }
+    else
+    {
+        periodic_hb_event_->cancel_timer();
+    }
+}
+
+bool StatefulWriter::prepare_periodic_heartbeat(
+        std::vector<Locator_t>& destinations)
+{
+    std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
+    std::lock_guard<LocatorSelectorSender> guard_locator_selector_general(locator_selector_general_);
+
+    if (!has_unacknowledged_changes_nts())
+    {
+        return false;
+    }
+
+    adapt_reliability_times_nts();
+
+    if (m_separateSendingEnabled)
+    {
+        try
+        {
+            send_heartbeat_to_all_readers();
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+        }
+        return true;
+    }
+
+    send_heartbeat_to_local_readers();
+
+    if (there_are_remote_readers_)
+    {
+        // The heartbeat to the remote readers is added to the messages shared with other endpoints
+        LocatorSelector& locator_selector = locator_selector_general_.locator_selector;
+        locator_selector.reset(true);
+        if (locator_selector.state_has_changed())
+        {
+            mp_RTPSParticipant->network_factory().select_locators(locator_selector);
+            compute_selected_guids(locator_selector_general_);
+        }
+        ControlMessageGroup::collect_destinations(locator_selector.begin(), locator_selector.end(), destinations);
+    }
+
+    return true;
+}
+
+void StatefulWriter::add_periodic_heartbeat(
+        ControlMessageGroup& group,
+        std::vector<Locator_t>& destinations)
+{
+    std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
+    std::lock_guard<LocatorSelectorSender> guard_locator_selector_general(locator_selector_general_);
+
+    if (!there_are_remote_readers_ || m_separateSendingEnabled)
+    {
+        // Matched readers changed since the heartbeat was prepared
+        return;
+    }
+
+    LocatorSelector& locator_selector = locator_selector_general_.locator_selector;
+    locator_selector.reset(true);
+    if (locator_selector.state_has_changed())
+    {
+        mp_RTPSParticipant->network_factory().select_locators(locator_selector);
+        compute_selected_guids(locator_selector_general_);
+        ControlMessageGroup::collect_destinations(locator_selector.begin(), locator_selector.end(), destinations);
+    }
+
+    RTPSMessageGroup& message_group = group.use(this, &locator_selector_general_, destinations);
+    add_gaps_for_holes_in_history_(message_group);
+    send_heartbeat_nts_(locator_selector_general_.all_remote_readers.size(), message_group, disable_positive_acks_);
+}
+
 void StatefulWriter::send_heartbeat_to_nts(
         ReaderProxy& remoteReaderProxy,
         bool liveliness,
@@ -1849,6 +2100,10 @@ void StatefulWriter::send_heartbeat_nts_(
 
     incrementHBCount();
     message_group.add_heartbeat(firstSeq, lastSeq, m_heartbeatCount, final, liveliness);
+    if (nullptr != adaptive_reliability_)
+    {
+        last_heartbeat_time_ = std::chrono::steady_clock::now();
+    }
     // Update calculate of heartbeat piggyback.
     currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
 
@@ -1891,11 +2146,11 @@ void StatefulWriter::perform_nack_response()
     uint32_t changes_to_resend = 0;
     for (ReaderProxy* reader : matched_remote_readers_)
     {
-        changes_to_resend += reader->perform_acknack_response([&](ChangeForReader_t& change)
+        changes_to_resend += reader->perform_acknack_response([&](CacheChange_t* change)
                         {
-                            // This labmda is called if the ChangeForReader_t pass from REQUESTED to UNSENT.
-                            assert(nullptr != change.getChange());
-                            flow_controller_->add_old_sample(this, change.getChange());
+                            // This labmda is called if the change pass from REQUESTED to UNSENT.
+                            assert(nullptr != change);
+                            flow_controller_->add_old_sample(this, change);
                         }
                         );
     }
@@ -1917,7 +2172,7 @@ void StatefulWriter::perform_nack_supression(
                 if (reader->guid() == reader_guid)
                 {
                     reader->perform_nack_supression();
-                    periodic_hb_event_->restart_timer();
+                    restart_periodic_heartbeat();
                     return true;
                 }
                 return false;
@@ -1956,13 +2211,19 @@ bool StatefulWriter::process_acknack(
                                     RTPSMessageGroup group(mp_RTPSParticipant, this, remote_reader->message_sender());
                                     RTPSGapBuilder gap_builder(group);
 
+                                    if (nullptr != adaptive_reliability_ && remote_reader->is_remote_and_reliable())
+                                    {
+                                        remote_reader->update_acknack_statistics(last_heartbeat_time_,
+                                                std::chrono::steady_clock::now(), !sn_set.empty());
+                                    }
+
                                     if (remote_reader->requested_changes_set(sn_set, gap_builder, get_seq_num_min()))
                                     {
                                         nack_response_event_->restart_timer();
                                     }
                                     else if (!final_flag)
                                     {
-                                        periodic_hb_event_->restart_timer();
+                                        restart_periodic_heartbeat();
                                     }
 
                                     gap_builder.flush();
@@ -1970,17 +2231,17 @@ bool StatefulWriter::process_acknack(
                                 else if (sn_set.empty() && !final_flag)
                                 {
                                     // This is the preemptive acknack.
-                                    if (remote_reader->process_initial_acknack([&](ChangeForReader_t& change_reader)
+                                    if (remote_reader->process_initial_acknack([&](CacheChange_t* change)
                                     {
-                                        assert(nullptr != change_reader.getChange());
-                                        flow_controller_->add_old_sample(this, change_reader.getChange());
+                                        assert(nullptr != change);
+                                        flow_controller_->add_old_sample(this, change);
                                     }))
                                     {
                                         if (remote_reader->is_remote_and_reliable())
                                         {
                                             // Send heartbeat if requested
                                             send_heartbeat_to_nts(*remote_reader, false, true);
-                                            periodic_hb_event_->restart_timer();
+                                            restart_periodic_heartbeat();
                                         }
                                     }
 
@@ -2165,6 +2426,30 @@ DeliveryRetCode StatefulWriter::deliver_sample_nts(
     return ret_code;
 }
 
+void StatefulWriter::discard_change_nts(
+        CacheChange_t* cache_change)
+{
+    SequenceNumber_t sequence_number = cache_change->sequenceNumber;
+    EPROSIMA_LOG_INFO(RTPS_WRITER, "Change " << sequence_number << " will not be sent.");
+
+    // Take note of biggest removed sequence number to improve sending of gaps
+    if (sequence_number > biggest_removed_sequence_number_)
+    {
+        biggest_removed_sequence_number_ = sequence_number;
+    }
+
+    // Readers will receive a GAP for it, as if it was removed from the history.
+    for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
+            [sequence_number](ReaderProxy* reader)
+            {
+                reader->change_has_been_removed(sequence_number);
+                return false;
+            }
+            );
+
+    check_acked_status();
+}
+
 void StatefulWriter::add_gaps_for_holes_in_history_(
         RTPSMessageGroup& group)
 {
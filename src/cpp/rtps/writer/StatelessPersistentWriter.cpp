@@ -93,6 +93,21 @@ bool StatelessPersistentWriter::change_removed_by_history(
     return StatelessWriter::change_removed_by_history(change, max_blocking_time);
 }
 
+DeliveryRetCode StatelessPersistentWriter::deliver_sample_nts(
+        CacheChange_t* cache_change,
+        RTPSMessageGroup& group,
+        LocatorSelectorSender& locator_selector, // Object locked by FlowControllerImpl
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    if (!load_persistent_payload(cache_change))
+    {
+        // The sample cannot be sent, it is considered as sent.
+        discard_change_nts(cache_change);
+        return DeliveryRetCode::DELIVERED;
+    }
+    return StatelessWriter::deliver_sample_nts(cache_change, group, locator_selector, max_blocking_time);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -678,6 +678,20 @@ void StatelessWriter::unsent_changes_reset()
             });
 }
 
+void StatelessWriter::unsent_changes_reset(
+        const SequenceNumber_t& first_sequence)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    std::for_each(mp_history->changesBegin(), mp_history->changesEnd(), [&](CacheChange_t* change)
+            {
+                if (change->sequenceNumber >= first_sequence)
+                {
+                    flow_controller_->add_new_sample(this, change,
+                    std::chrono::steady_clock::now() + std::chrono::hours(24));
+                }
+            });
+}
+
 bool StatelessWriter::send_nts(
         CDRMessage_t* message,
         const LocatorSelectorSender& locator_selector,
@@ -694,6 +708,23 @@ bool StatelessWriter::send_nts(
                    max_blocking_time_point);
 }
 
+bool StatelessWriter::send_nts(
+        const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    if (!RTPSWriter::send_nts(buffers, total_bytes, locator_selector, max_blocking_time_point))
+    {
+        return false;
+    }
+
+    return fixed_locators_.empty() ||
+           mp_RTPSParticipant->sendSync(buffers, total_bytes, m_guid,
+                   Locators(fixed_locators_.begin()), Locators(fixed_locators_.end()),
+                   max_blocking_time_point);
+}
+
 DeliveryRetCode StatelessWriter::deliver_sample_nts(
         CacheChange_t* cache_change,
         RTPSMessageGroup& group,
@@ -882,6 +913,19 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
     return ret_code;
 }
 
+void StatelessWriter::discard_change_nts(
+        CacheChange_t* cache_change)
+{
+    uint64_t change_sequence_number = cache_change->sequenceNumber.to64long();
+    EPROSIMA_LOG_INFO(RTPS_WRITER, "Change " << cache_change->sequenceNumber << " will not be sent.");
+
+    if (change_sequence_number > last_sequence_number_sent_)
+    {
+        last_sequence_number_sent_ = change_sequence_number;
+        unsent_changes_cond_.notify_all();
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
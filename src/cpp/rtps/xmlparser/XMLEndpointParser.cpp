@@ -20,8 +20,13 @@
 #include <fastrtps/xmlparser/XMLEndpointParser.h>
 
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
 #include <string>
 
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <tinyxml2.h>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -39,6 +44,306 @@ namespace xmlparser {
 using namespace eprosima::fastrtps::rtps;
 using namespace eprosima::fastdds::xml::detail;
 
+namespace {
+
+//! Magic identifying a precompiled endpoint table
+constexpr octet endpoint_table_magic[8] = {'F', 'D', 'D', 'S', 'S', 'E', 'D', 'P'};
+//! Version of the precompiled endpoint table layout
+constexpr uint32_t endpoint_table_version = 1;
+
+/**
+ * Appends little endian encoded fields to a precompiled endpoint table.
+ */
+class EndpointTableWriter
+{
+public:
+
+    void add_uint8(
+            uint8_t value)
+    {
+        buffer_.push_back(value);
+    }
+
+    void add_uint16(
+            uint16_t value)
+    {
+        buffer_.push_back(static_cast<octet>(value));
+        buffer_.push_back(static_cast<octet>(value >> 8));
+    }
+
+    void add_uint32(
+            uint32_t value)
+    {
+        for (uint32_t shift = 0; shift < 32; shift += 8)
+        {
+            buffer_.push_back(static_cast<octet>(value >> shift));
+        }
+    }
+
+    void add_octets(
+            const octet* data,
+            size_t size)
+    {
+        buffer_.insert(buffer_.end(), data, data + size);
+    }
+
+    void add_string(
+            const char* value)
+    {
+        uint32_t size = static_cast<uint32_t>(strlen(value));
+        add_uint32(size);
+        add_octets(reinterpret_cast<const octet*>(value), size);
+    }
+
+    void add_duration(
+            const Duration_t& value)
+    {
+        add_uint32(static_cast<uint32_t>(value.seconds));
+        add_uint32(value.nanosec);
+    }
+
+    void add_locators(
+            const ResourceLimitedVector<Locator_t>& locators)
+    {
+        add_uint32(static_cast<uint32_t>(locators.size()));
+        for (const Locator_t& locator : locators)
+        {
+            add_uint32(static_cast<uint32_t>(locator.kind));
+            add_uint32(locator.port);
+            add_octets(locator.address, sizeof(locator.address));
+        }
+    }
+
+    const std::vector<octet>& buffer() const
+    {
+        return buffer_;
+    }
+
+private:
+
+    std::vector<octet> buffer_;
+};
+
+/**
+ * Decodes the fields of a precompiled endpoint table directly from the mapped file.
+ */
+class EndpointTableReader
+{
+public:
+
+    EndpointTableReader(
+            const octet* data,
+            size_t size)
+        : data_(data)
+        , size_(size)
+    {
+    }
+
+    bool read_uint8(
+            uint8_t& value)
+    {
+        if (pos_ + 1 > size_)
+        {
+            return false;
+        }
+        value = data_[pos_++];
+        return true;
+    }
+
+    bool read_uint16(
+            uint16_t& value)
+    {
+        if (pos_ + 2 > size_)
+        {
+            return false;
+        }
+        value = static_cast<uint16_t>(data_[pos_] | (data_[pos_ + 1] << 8));
+        pos_ += 2;
+        return true;
+    }
+
+    bool read_uint32(
+            uint32_t& value)
+    {
+        if (pos_ + 4 > size_)
+        {
+            return false;
+        }
+        value = 0;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            value |= static_cast<uint32_t>(data_[pos_ + i]) << (8 * i);
+        }
+        pos_ += 4;
+        return true;
+    }
+
+    bool read_octets(
+            octet* data,
+            size_t size)
+    {
+        if (pos_ + size > size_)
+        {
+            return false;
+        }
+        memcpy(data, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    bool read_string(
+            std::string& value)
+    {
+        uint32_t size = 0;
+        if (!read_uint32(size) || pos_ + size > size_)
+        {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data_ + pos_), size);
+        pos_ += size;
+        return true;
+    }
+
+    bool read_duration(
+            Duration_t& value)
+    {
+        uint32_t seconds = 0;
+        if (!read_uint32(seconds) || !read_uint32(value.nanosec))
+        {
+            return false;
+        }
+        value.seconds = static_cast<int32_t>(seconds);
+        return true;
+    }
+
+    bool read_locators(
+            LocatorList_t& locators)
+    {
+        uint32_t count = 0;
+        if (!read_uint32(count))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Locator_t locator;
+            uint32_t kind = 0;
+            if (!read_uint32(kind) || !read_uint32(locator.port) ||
+                    !read_octets(locator.address, sizeof(locator.address)))
+            {
+                return false;
+            }
+            locator.kind = static_cast<int32_t>(kind);
+            locators.push_back(locator);
+        }
+        return true;
+    }
+
+private:
+
+    const octet* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+template<typename ProxyData>
+void add_endpoint(
+        EndpointTableWriter& writer,
+        const ProxyData& data)
+{
+    // Locators go first, as they are needed to construct the proxy when loading
+    writer.add_locators(data.remote_locators().unicast);
+    writer.add_locators(data.remote_locators().multicast);
+    writer.add_uint16(data.userDefinedId());
+    writer.add_octets(data.guid().entityId.value, 4);
+    writer.add_string(data.topicName().c_str());
+    writer.add_string(data.typeName().c_str());
+    writer.add_uint8(static_cast<uint8_t>(data.topicKind()));
+    writer.add_uint8(static_cast<uint8_t>(data.m_qos.m_reliability.kind));
+    writer.add_uint8(static_cast<uint8_t>(data.m_qos.m_durability.kind));
+    writer.add_uint8(static_cast<uint8_t>(data.m_qos.m_ownership.kind));
+    writer.add_uint8(static_cast<uint8_t>(data.m_qos.m_liveliness.kind));
+    writer.add_duration(data.m_qos.m_liveliness.lease_duration);
+    writer.add_uint8(data.m_qos.m_disablePositiveACKs.enabled ? 1 : 0);
+    writer.add_duration(data.m_qos.m_disablePositiveACKs.duration);
+    writer.add_uint32(data.m_qos.m_partition.size());
+    for (auto partition = data.m_qos.m_partition.begin(); partition != data.m_qos.m_partition.end(); ++partition)
+    {
+        writer.add_string(partition->name());
+    }
+}
+
+template<typename ProxyData>
+ProxyData* read_endpoint(
+        EndpointTableReader& reader)
+{
+    LocatorList_t unicast_locators;
+    LocatorList_t multicast_locators;
+    if (!reader.read_locators(unicast_locators) || !reader.read_locators(multicast_locators))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<ProxyData> data(new ProxyData(unicast_locators.size(), multicast_locators.size()));
+    for (const Locator_t& loc : unicast_locators)
+    {
+        data->add_unicast_locator(loc);
+    }
+    for (const Locator_t& loc : multicast_locators)
+    {
+        data->add_multicast_locator(loc);
+    }
+
+    std::string topic_name;
+    std::string type_name;
+    uint8_t topic_kind = 0;
+    uint8_t reliability = 0;
+    uint8_t durability = 0;
+    uint8_t ownership = 0;
+    uint8_t liveliness = 0;
+    uint8_t disable_positive_acks = 0;
+    uint32_t partitions = 0;
+    if (!reader.read_uint16(data->userDefinedId()) ||
+            !reader.read_octets(data->guid().entityId.value, 4) ||
+            !reader.read_string(topic_name) ||
+            !reader.read_string(type_name) ||
+            !reader.read_uint8(topic_kind) ||
+            !reader.read_uint8(reliability) ||
+            !reader.read_uint8(durability) ||
+            !reader.read_uint8(ownership) ||
+            !reader.read_uint8(liveliness) ||
+            !reader.read_duration(data->m_qos.m_liveliness.lease_duration) ||
+            !reader.read_uint8(disable_positive_acks) ||
+            !reader.read_duration(data->m_qos.m_disablePositiveACKs.duration) ||
+            !reader.read_uint32(partitions))
+    {
+        return nullptr;
+    }
+
+    data->topicName(topic_name);
+    data->typeName(type_name);
+    data->topicKind(static_cast<TopicKind_t>(topic_kind));
+    data->m_qos.m_reliability.kind = static_cast<ReliabilityQosPolicyKind>(reliability);
+    data->m_qos.m_durability.kind = static_cast<DurabilityQosPolicyKind>(durability);
+    data->m_qos.m_ownership.kind = static_cast<OwnershipQosPolicyKind>(ownership);
+    data->m_qos.m_liveliness.kind = static_cast<LivelinessQosPolicyKind>(liveliness);
+    data->m_qos.m_disablePositiveACKs.enabled = (disable_positive_acks != 0);
+
+    for (uint32_t i = 0; i < partitions; ++i)
+    {
+        std::string partition;
+        if (!reader.read_string(partition))
+        {
+            return nullptr;
+        }
+        data->m_qos.m_partition.push_back(partition.c_str());
+    }
+
+    return data.release();
+}
+
+} // namespace
+
 XMLEndpointParser::XMLEndpointParser()
 {
 }
@@ -147,6 +452,161 @@ XMLP_ret XMLEndpointParser::loadXMLNode(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLEndpointParser::loadBinaryFile(
+        const std::string& filename)
+{
+    // Only files starting with the magic are mapped, the rest are left to the XML parser, which reports its errors.
+    {
+        octet magic[sizeof(endpoint_table_magic)];
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.read(reinterpret_cast<char*>(magic), sizeof(magic)) ||
+                0 != memcmp(magic, endpoint_table_magic, sizeof(magic)))
+        {
+            return XMLP_ret::XML_NOK;
+        }
+    }
+
+    EPROSIMA_LOG_INFO(RTPS_EDP, "Endpoint table: " << filename);
+
+    try
+    {
+        boost::interprocess::file_mapping file(filename.c_str(), boost::interprocess::read_only);
+        boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+        return loadBinaryTable(static_cast<const octet*>(region.get_address()), region.get_size());
+    }
+    catch (const boost::interprocess::interprocess_exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_EDP, filename << " bad file: " << e.what());
+    }
+
+    return XMLP_ret::XML_ERROR;
+}
+
+XMLP_ret XMLEndpointParser::loadBinaryTable(
+        const octet* data,
+        size_t size)
+{
+    if (size < sizeof(endpoint_table_magic) ||
+            0 != memcmp(data, endpoint_table_magic, sizeof(endpoint_table_magic)))
+    {
+        return XMLP_ret::XML_NOK;
+    }
+
+    EndpointTableReader reader(data + sizeof(endpoint_table_magic), size - sizeof(endpoint_table_magic));
+    uint32_t version = 0;
+    uint32_t num_participants = 0;
+    if (!reader.read_uint32(version) || version != endpoint_table_version ||
+            !reader.read_uint32(num_participants))
+    {
+        EPROSIMA_LOG_ERROR(RTPS_EDP, "Unsupported endpoint table version " << version);
+        return XMLP_ret::XML_ERROR;
+    }
+
+    // As when parsing XML, only the ids which were given are registered, i.e. not the ones left as 0
+    auto register_ids = [this](uint16_t user_id, const EntityId_t& entity_id) -> bool
+            {
+                uint32_t id = (static_cast<uint32_t>(entity_id.value[0]) << 16) |
+                        (static_cast<uint32_t>(entity_id.value[1]) << 8) | entity_id.value[2];
+                return (0 == user_id || m_endpointIds.insert(static_cast<int16_t>(user_id)).second) &&
+                       (0 == id || m_entityIds.insert(id).second);
+            };
+
+    for (uint32_t p = 0; p < num_participants; ++p)
+    {
+        StaticRTPSParticipantInfo* pdata = new StaticRTPSParticipantInfo();
+        m_RTPSParticipants.push_back(pdata);
+
+        uint32_t num_readers = 0;
+        uint32_t num_writers = 0;
+        if (!reader.read_string(pdata->m_RTPSParticipantName) ||
+                !reader.read_uint32(num_readers) || !reader.read_uint32(num_writers))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_EDP, "Truncated endpoint table");
+            return XMLP_ret::XML_ERROR;
+        }
+
+        for (uint32_t r = 0; r < num_readers; ++r)
+        {
+            ReaderProxyData* rdata = read_endpoint<ReaderProxyData>(reader);
+            uint8_t expects_inline_qos = 0;
+            if (nullptr == rdata || !reader.read_uint8(expects_inline_qos))
+            {
+                delete(rdata);
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Truncated endpoint table");
+                return XMLP_ret::XML_ERROR;
+            }
+            rdata->m_expectsInlineQos = (expects_inline_qos != 0);
+            pdata->m_readers.push_back(rdata);
+            if (!register_ids(rdata->userDefinedId(), rdata->guid().entityId))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Repeated ID or entityId in endpoint table");
+                return XMLP_ret::XML_ERROR;
+            }
+            m_readersById[rdata->userDefinedId()] = rdata;
+        }
+
+        for (uint32_t w = 0; w < num_writers; ++w)
+        {
+            WriterProxyData* wdata = read_endpoint<WriterProxyData>(reader);
+            if (nullptr == wdata || !reader.read_uint32(wdata->m_qos.m_ownershipStrength.value))
+            {
+                delete(wdata);
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Truncated endpoint table");
+                return XMLP_ret::XML_ERROR;
+            }
+            pdata->m_writers.push_back(wdata);
+            if (!register_ids(wdata->userDefinedId(), wdata->guid().entityId))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Repeated ID or entityId in endpoint table");
+                return XMLP_ret::XML_ERROR;
+            }
+            m_writersById[wdata->userDefinedId()] = wdata;
+        }
+    }
+
+    EPROSIMA_LOG_INFO(RTPS_EDP, "Finished loading, " << m_RTPSParticipants.size() << " participants found.");
+    return XMLP_ret::XML_OK;
+}
+
+XMLP_ret XMLEndpointParser::saveBinaryFile(
+        const std::string& filename) const
+{
+    EndpointTableWriter writer;
+    writer.add_octets(endpoint_table_magic, sizeof(endpoint_table_magic));
+    writer.add_uint32(endpoint_table_version);
+    writer.add_uint32(static_cast<uint32_t>(m_RTPSParticipants.size()));
+
+    for (const StaticRTPSParticipantInfo* pdata : m_RTPSParticipants)
+    {
+        writer.add_string(pdata->m_RTPSParticipantName.c_str());
+        writer.add_uint32(static_cast<uint32_t>(pdata->m_readers.size()));
+        writer.add_uint32(static_cast<uint32_t>(pdata->m_writers.size()));
+
+        for (const ReaderProxyData* rdata : pdata->m_readers)
+        {
+            add_endpoint(writer, *rdata);
+            writer.add_uint8(rdata->m_expectsInlineQos ? 1 : 0);
+        }
+
+        for (const WriterProxyData* wdata : pdata->m_writers)
+        {
+            add_endpoint(writer, *wdata);
+            writer.add_uint32(wdata->m_qos.m_ownershipStrength.value);
+        }
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(writer.buffer().data()),
+            static_cast<std::streamsize>(writer.buffer().size()));
+    if (!file.good())
+    {
+        EPROSIMA_LOG_ERROR(RTPS_EDP, "Error writing endpoint table " << filename);
+        return XMLP_ret::XML_ERROR;
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 void XMLEndpointParser::loadXMLParticipantEndpoint(
         tinyxml2::XMLElement* xml_endpoint,
         StaticRTPSParticipantInfo* pdata)
@@ -491,6 +951,7 @@ XMLP_ret XMLEndpointParser::loadXMLReaderEndpoint(
     }
 
     pdata->m_readers.push_back(rdata);
+    m_readersById[rdata->userDefinedId()] = rdata;
     return XMLP_ret::XML_OK;
 }
 
@@ -783,6 +1244,7 @@ XMLP_ret XMLEndpointParser::loadXMLWriterEndpoint(
     }
 
     pdata->m_writers.push_back(wdata);
+    m_writersById[wdata->userDefinedId()] = wdata;
     return XMLP_ret::XML_OK;
 }
 
@@ -791,21 +1253,14 @@ XMLP_ret XMLEndpointParser::lookforReader(
         uint16_t id,
         ReaderProxyData** rdataptr)
 {
-    for (std::vector<StaticRTPSParticipantInfo*>::iterator pit = m_RTPSParticipants.begin();
-            pit != m_RTPSParticipants.end(); ++pit)
+    // It doesn't matter the name of the RTPSParticipant, only for organizational purposes
+    static_cast<void>(partname);
+
+    auto it = m_readersById.find(id);
+    if (it != m_readersById.end())
     {
-        if ((*pit)->m_RTPSParticipantName == partname || true) //it doenst matter the name fo the RTPSParticipant, only for organizational purposes
-        {
-            for (std::vector<ReaderProxyData*>::iterator rit = (*pit)->m_readers.begin();
-                    rit != (*pit)->m_readers.end(); ++rit)
-            {
-                if ((*rit)->userDefinedId() == id)
-                {
-                    *rdataptr = *rit;
-                    return XMLP_ret::XML_OK;
-                }
-            }
-        }
+        *rdataptr = it->second;
+        return XMLP_ret::XML_OK;
     }
     return XMLP_ret::XML_ERROR;
 }
@@ -815,21 +1270,14 @@ XMLP_ret XMLEndpointParser::lookforWriter(
         uint16_t id,
         WriterProxyData** wdataptr)
 {
-    for (std::vector<StaticRTPSParticipantInfo*>::iterator pit = m_RTPSParticipants.begin();
-            pit != m_RTPSParticipants.end(); ++pit)
+    // It doesn't matter the name of the RTPSParticipant, only for organizational purposes
+    static_cast<void>(partname);
+
+    auto it = m_writersById.find(id);
+    if (it != m_writersById.end())
     {
-        if ((*pit)->m_RTPSParticipantName == partname || true) //it doenst matter the name fo the RTPSParticipant, only for organizational purposes
-        {
-            for (std::vector<WriterProxyData*>::iterator wit = (*pit)->m_writers.begin();
-                    wit != (*pit)->m_writers.end(); ++wit)
-            {
-                if ((*wit)->userDefinedId() == id)
-                {
-                    *wdataptr = *wit;
-                    return XMLP_ret::XML_OK;
-                }
-            }
-        }
+        *wdataptr = it->second;
+        return XMLP_ret::XML_OK;
     }
     return XMLP_ret::XML_ERROR;
 }
@@ -72,6 +72,32 @@ ReturnCode_t DomainParticipant::disable_statistics_datawriter(
 #endif // FASTDDS_STATISTICS
 }
 
+ReturnCode_t DomainParticipant::get_startup_profile(
+        StartupProfile& profile) const
+{
+#ifndef FASTDDS_STATISTICS
+    (void) profile;
+
+    return ReturnCode_t::RETCODE_UNSUPPORTED;
+#else
+    return static_cast<DomainParticipantImpl*>(impl_)->get_startup_profile(profile);
+#endif // FASTDDS_STATISTICS
+}
+
+ReturnCode_t DomainParticipant::get_reliability_tuning(
+        const eprosima::fastdds::dds::DataWriter* writer,
+        ReliabilityTuning& tuning) const
+{
+#ifndef FASTDDS_STATISTICS
+    (void) writer;
+    (void) tuning;
+
+    return ReturnCode_t::RETCODE_UNSUPPORTED;
+#else
+    return static_cast<DomainParticipantImpl*>(impl_)->get_reliability_tuning(writer, tuning);
+#endif // FASTDDS_STATISTICS
+}
+
 DomainParticipant* DomainParticipant::narrow(
         eprosima::fastdds::dds::DomainParticipant* domain_participant)
 {
@@ -248,6 +248,40 @@ ReturnCode_t DomainParticipantImpl::disable_statistics_datawriter(
     return ret;
 }
 
+ReturnCode_t DomainParticipantImpl::get_startup_profile(
+        StartupProfile& profile) const
+{
+    if (nullptr == rtps_participant_)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    rtps_participant_->get_startup_profile(profile);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DomainParticipantImpl::get_reliability_tuning(
+        const efd::DataWriter* writer,
+        ReliabilityTuning& tuning) const
+{
+    if (nullptr == writer)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    if (nullptr == rtps_participant_)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (!rtps_participant_->get_reliability_tuning(writer->guid(), tuning))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
 ReturnCode_t DomainParticipantImpl::enable()
 {
     ReturnCode_t ret = efd::DomainParticipantImpl::enable();
@@ -34,6 +34,8 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TopicDescription.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/statistics/rtps/ReliabilityTuning.hpp>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 #include <fastrtps/types/TypesBase.h>
 
 #include <fastdds/domain/DomainParticipantImpl.hpp>
@@ -95,6 +97,27 @@ public:
     ReturnCode_t disable_statistics_datawriter(
             const std::string& topic_name);
 
+    /**
+     * @brief This operation retrieves the discovery startup timeline recorded by the participant
+     * @param[out] profile Timeline of the participant
+     * @return RETCODE_NOT_ENABLED if the participant has not been enabled, RETCODE_OK otherwise
+     */
+    ReturnCode_t get_startup_profile(
+            StartupProfile& profile) const;
+
+    /**
+     * @brief This operation retrieves the heartbeat period and NACK response delay in use by a reliable DataWriter
+     * @param writer DataWriter created by this participant
+     * @param[out] tuning Times in use by the DataWriter
+     * @return RETCODE_BAD_PARAMETER if the DataWriter is nullptr,
+     * RETCODE_NOT_ENABLED if the participant has not been enabled,
+     * RETCODE_PRECONDITION_NOT_MET if the DataWriter is not an enabled reliable DataWriter of this participant,
+     * RETCODE_OK otherwise
+     */
+    ReturnCode_t get_reliability_tuning(
+            const efd::DataWriter* writer,
+            ReliabilityTuning& tuning) const;
+
     /**
      * @brief This operation enables the DomainParticipantImpl
      *
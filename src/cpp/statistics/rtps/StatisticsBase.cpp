@@ -644,6 +644,62 @@ void StatisticsParticipantImpl::on_edp_packet(
             });
 }
 
+void StatisticsParticipantImpl::on_startup_phase(
+        StartupPhase phase,
+        const GUID_t& local_guid,
+        const GUID_t& remote_guid)
+{
+    // Keep the timeline bounded on long running participants with many remote peers
+    constexpr size_t max_startup_events = 4096;
+
+    std::lock_guard<std::mutex> lock(startup_mutex_);
+
+    if (startup_events_.size() >= max_startup_events)
+    {
+        return;
+    }
+
+    switch (phase)
+    {
+        case StartupPhase::TRANSPORTS_INITIALIZED:
+            if (startup_transports_initialized_)
+            {
+                return;
+            }
+            startup_transports_initialized_ = true;
+            break;
+        case StartupPhase::FIRST_PDP_ANNOUNCEMENT:
+            if (startup_first_announcement_)
+            {
+                return;
+            }
+            startup_first_announcement_ = true;
+            break;
+        case StartupPhase::ENDPOINT_MATCHED:
+            if (!startup_matched_endpoints_.insert(local_guid).second)
+            {
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+
+    // Taken with the lock held so the timeline is kept ordered
+    std::chrono::nanoseconds elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startup_time_);
+    startup_events_.push_back({phase, local_guid, remote_guid, elapsed});
+}
+
+void StatisticsParticipantImpl::get_startup_profile(
+        StartupProfile& profile) const
+{
+    profile.participant_guid = get_guid();
+
+    std::lock_guard<std::mutex> lock(startup_mutex_);
+    profile.events = startup_events_;
+}
+
 } // statistics
 } // fastdds
 } // eprosima
@@ -20,15 +20,18 @@
 #define _STATISTICS_RTPS_STATISTICSBASE_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include <fastrtps/config.h>
 
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/SampleIdentity.h>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 #include <fastdds/statistics/rtps/StatisticsCommon.hpp>
 #include <fastrtps/qos/ParameterTypes.h>
 #include <statistics/rtps/GuidUtils.hpp>
@@ -135,6 +138,14 @@ private:
     // Mask of enabled statistics writers
     std::atomic<uint32_t> enabled_writers_mask_{0};
 
+    // Startup profiler ancillary
+    const std::chrono::steady_clock::time_point startup_time_ = std::chrono::steady_clock::now();
+    mutable std::mutex startup_mutex_;
+    std::vector<StartupEvent> startup_events_;
+    std::set<GUID_t> startup_matched_endpoints_;
+    bool startup_transports_initialized_ = false;
+    bool startup_first_announcement_ = false;
+
     /*
      * Retrieve the GUID_t from derived class
      * @return endpoint GUID_t
@@ -457,6 +468,28 @@ public:
      * @return The mask of enabled writers
      */
     virtual uint32_t get_enabled_statistics_writers_mask();
+
+    /**
+     * @brief Timestamp a discovery phase on the startup timeline of the participant.
+     * Phases that only happen once per participant, and endpoint matches beyond the first one of each local
+     * endpoint, are ignored when repeated.
+     *
+     * @param phase Phase reached
+     * @param local_guid Local entity involved
+     * @param remote_guid Remote entity involved, unknown when the phase is local
+     */
+    void on_startup_phase(
+            StartupPhase phase,
+            const GUID_t& local_guid,
+            const GUID_t& remote_guid = GUID_t::unknown());
+
+    /**
+     * @brief Retrieve the startup timeline recorded so far
+     *
+     * @param [out] profile Timeline of the participant
+     */
+    void get_startup_profile(
+            StartupProfile& profile) const;
 };
 
 // auxiliary conversion functions
@@ -536,6 +569,21 @@ protected:
     {
     }
 
+public:
+
+    /*
+     * Timestamp a discovery phase on the startup timeline of the participant
+     * @param phase reached
+     * @param local entity involved
+     * @param remote entity involved
+     */
+    inline void on_startup_phase(
+            StartupPhase,
+            const fastrtps::rtps::GUID_t&,
+            const fastrtps::rtps::GUID_t& = fastrtps::rtps::GUID_t::unknown())
+    {
+    }
+
 };
 
 #endif // FASTDDS_STATISTICS
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <list>
 #include <utility>
+#include <vector>
 
 #include <fastdds/rtps/common/Locator.h>
 
@@ -89,6 +90,29 @@ public:
 #endif // FASTDDS_STATISTICS
     }
 
+    /**
+     * Same as above, for a message made of several slices.
+     */
+    inline void set_statistics_message_data(
+            const eprosima::fastrtps::rtps::Locator_t& locator,
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes)
+    {
+        static_cast<void>(locator);
+        static_cast<void>(buffers);
+        static_cast<void>(total_bytes);
+
+#ifdef FASTDDS_STATISTICS
+        auto search = [locator](const entry_type& entry) -> bool
+                {
+                    return locator == entry.first;
+                };
+        auto it = std::find_if(collection_.begin(), collection_.end(), search);
+        assert(it != collection_.end());
+        set_statistics_submessage_from_transport(locator, buffers, total_bytes, it->second);
+#endif // FASTDDS_STATISTICS
+    }
+
 #ifdef FASTDDS_STATISTICS
 
 private:
@@ -167,23 +167,9 @@ namespace eprosima {
                     // Object that serializes the data.
                     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                     eprosima::fastcdr::serialize_key(ser, *p_type);
-                    if (force_md5 || eprosima_fastdds_statistics_detail_EntityId_s_max_key_cdr_typesize > 16)
-                    {
-                        m_md5.init();
-                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                        m_md5.finalize();
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_md5.digest[i];
-                        }
-                    }
-                    else
-                    {
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_keyBuffer[i];
-                        }
-                    }
+                    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                            eprosima_fastdds_statistics_detail_EntityId_s_max_key_cdr_typesize,
+                            force_md5, m_md5, handle);
                     return true;
                 }
 
@@ -319,23 +305,9 @@ namespace eprosima {
                     // Object that serializes the data.
                     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                     eprosima::fastcdr::serialize_key(ser, *p_type);
-                    if (force_md5 || eprosima_fastdds_statistics_detail_GuidPrefix_s_max_key_cdr_typesize > 16)
-                    {
-                        m_md5.init();
-                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                        m_md5.finalize();
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_md5.digest[i];
-                        }
-                    }
-                    else
-                    {
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_keyBuffer[i];
-                        }
-                    }
+                    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                            eprosima_fastdds_statistics_detail_GuidPrefix_s_max_key_cdr_typesize,
+                            force_md5, m_md5, handle);
                     return true;
                 }
 
@@ -471,23 +443,9 @@ namespace eprosima {
                     // Object that serializes the data.
                     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                     eprosima::fastcdr::serialize_key(ser, *p_type);
-                    if (force_md5 || eprosima_fastdds_statistics_detail_GUID_s_max_key_cdr_typesize > 16)
-                    {
-                        m_md5.init();
-                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                        m_md5.finalize();
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_md5.digest[i];
-                        }
-                    }
-                    else
-                    {
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_keyBuffer[i];
-                        }
-                    }
+                    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                            eprosima_fastdds_statistics_detail_GUID_s_max_key_cdr_typesize,
+                            force_md5, m_md5, handle);
                     return true;
                 }
 
@@ -623,23 +581,9 @@ namespace eprosima {
                     // Object that serializes the data.
                     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                     eprosima::fastcdr::serialize_key(ser, *p_type);
-                    if (force_md5 || eprosima_fastdds_statistics_detail_SequenceNumber_s_max_key_cdr_typesize > 16)
-                    {
-                        m_md5.init();
-                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                        m_md5.finalize();
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_md5.digest[i];
-                        }
-                    }
-                    else
-                    {
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_keyBuffer[i];
-                        }
-                    }
+                    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                            eprosima_fastdds_statistics_detail_SequenceNumber_s_max_key_cdr_typesize,
+                            force_md5, m_md5, handle);
                     return true;
                 }
 
@@ -775,23 +719,9 @@ namespace eprosima {
                     // Object that serializes the data.
                     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                     eprosima::fastcdr::serialize_key(ser, *p_type);
-                    if (force_md5 || eprosima_fastdds_statistics_detail_SampleIdentity_s_max_key_cdr_typesize > 16)
-                    {
-                        m_md5.init();
-                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                        m_md5.finalize();
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_md5.digest[i];
-                        }
-                    }
-                    else
-                    {
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_keyBuffer[i];
-                        }
-                    }
+                    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                            eprosima_fastdds_statistics_detail_SampleIdentity_s_max_key_cdr_typesize,
+                            force_md5, m_md5, handle);
                     return true;
                 }
 
@@ -927,23 +857,9 @@ namespace eprosima {
                     // Object that serializes the data.
                     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                     eprosima::fastcdr::serialize_key(ser, *p_type);
-                    if (force_md5 || eprosima_fastdds_statistics_detail_Locator_s_max_key_cdr_typesize > 16)
-                    {
-                        m_md5.init();
-                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                        m_md5.finalize();
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_md5.digest[i];
-                        }
-                    }
-                    else
-                    {
-                        for (uint8_t i = 0; i < 16; ++i)
-                        {
-                            handle->value[i] = m_keyBuffer[i];
-                        }
-                    }
+                    compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                            eprosima_fastdds_statistics_detail_Locator_s_max_key_cdr_typesize,
+                            force_md5, m_md5, handle);
                     return true;
                 }
 
@@ -1082,23 +998,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_DiscoveryTime_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_DiscoveryTime_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -1234,23 +1136,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_EntityCount_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_EntityCount_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -1386,23 +1274,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_SampleIdentityCount_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_SampleIdentityCount_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -1538,23 +1412,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_Entity2LocatorTraffic_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_Entity2LocatorTraffic_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -1690,23 +1550,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_WriterReaderData_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_WriterReaderData_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -1842,23 +1688,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_Locator2LocatorData_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_Locator2LocatorData_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -1994,23 +1826,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_EntityData_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_EntityData_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
@@ -2146,23 +1964,9 @@ namespace eprosima {
                 // Object that serializes the data.
                 eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
                 eprosima::fastcdr::serialize_key(ser, *p_type);
-                if (force_md5 || eprosima_fastdds_statistics_PhysicalData_max_key_cdr_typesize > 16)
-                {
-                    m_md5.init();
-                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
-                    m_md5.finalize();
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_md5.digest[i];
-                    }
-                }
-                else
-                {
-                    for (uint8_t i = 0; i < 16; ++i)
-                    {
-                        handle->value[i] = m_keyBuffer[i];
-                    }
-                }
+                compute_key_hash(m_keyBuffer, ser.get_serialized_data_length(),
+                        eprosima_fastdds_statistics_PhysicalData_max_key_cdr_typesize,
+                        force_md5, m_md5, handle);
                 return true;
             }
 
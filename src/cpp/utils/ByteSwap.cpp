@@ -0,0 +1,313 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ByteSwap.cpp
+ */
+
+#include <utils/ByteSwap.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FASTDDS_BYTESWAP_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // if defined(_MSC_VER)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define FASTDDS_BYTESWAP_NEON
+#include <arm_neon.h>
+#endif // if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#if defined(_MSC_VER)
+#include <cstdlib>
+#endif // if defined(_MSC_VER)
+
+// GCC and Clang only let functions use the instruction sets they are compiled for, or the ones enabled for them
+#if defined(__GNUC__) || defined(__clang__)
+#define FASTDDS_TARGET(isa) __attribute__((target(isa)))
+#else
+#define FASTDDS_TARGET(isa)
+#endif // if defined(__GNUC__) || defined(__clang__)
+
+namespace eprosima {
+namespace fastrtps {
+
+namespace {
+
+/**
+ * Swaps the bytes of the elements of the first bytes of an array, in blocks of the vector size.
+ * Returns the number of bytes processed, always a multiple of the element size. The rest are left to the caller.
+ */
+using Kernel = size_t (*)(
+    const uint8_t* src,
+    uint8_t* dst,
+    size_t bytes,
+    size_t element_size);
+
+struct Implementation
+{
+    Kernel kernel;
+    const char* name;
+};
+
+inline uint16_t swap_value(
+        uint16_t value)
+{
+    return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+inline uint32_t swap_value(
+        uint32_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#else
+    return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) |
+           ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
+#endif // if defined(_MSC_VER)
+}
+
+inline uint64_t swap_value(
+        uint64_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+    return (static_cast<uint64_t>(swap_value(static_cast<uint32_t>(value))) << 32) |
+           swap_value(static_cast<uint32_t>(value >> 32));
+#endif // if defined(_MSC_VER)
+}
+
+template<typename T>
+void swap_scalar(
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        T value;
+        memcpy(&value, src + i * sizeof(T), sizeof(T));
+        value = swap_value(value);
+        memcpy(dst + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+#if defined(FASTDDS_BYTESWAP_X86)
+
+//! pshufb masks reversing each element of 2, 4 and 8 bytes of a 16 bytes vector
+alignas(16) const uint8_t shuffle_masks[3][16] = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}
+};
+
+inline const uint8_t* shuffle_mask(
+        size_t element_size)
+{
+    return shuffle_masks[2 == element_size ? 0 : (4 == element_size ? 1 : 2)];
+}
+
+FASTDDS_TARGET("ssse3")
+size_t swap_ssse3(
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t bytes,
+        size_t element_size)
+{
+    const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle_mask(element_size)));
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 16)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(value, mask));
+    }
+    return i;
+}
+
+FASTDDS_TARGET("avx2")
+size_t swap_avx2(
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t bytes,
+        size_t element_size)
+{
+    const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle_mask(element_size)));
+    const __m256i wide_mask = _mm256_broadcastsi128_si256(mask);
+    size_t i = 0;
+    for (; i + 64 <= bytes; i += 64)
+    {
+        __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(first, wide_mask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 32), _mm256_shuffle_epi8(second, wide_mask));
+    }
+    for (; i + 16 <= bytes; i += 16)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(value, mask));
+    }
+    return i;
+}
+
+Implementation select_implementation()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    bool ssse3 = 0 != (info[2] & (1 << 9));
+    // AVX registers must be enabled by the OS
+    bool avx = 0 != (info[2] & (1 << 27)) && 0 != (info[2] & (1 << 28)) && 6 == (_xgetbv(0) & 6);
+    bool avx2 = false;
+    if (avx && 7 <= max_leaf)
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = 0 != (info[1] & (1 << 5));
+    }
+#else
+    __builtin_cpu_init();
+    bool ssse3 = 0 != __builtin_cpu_supports("ssse3");
+    bool avx2 = 0 != __builtin_cpu_supports("avx2");
+#endif // if defined(_MSC_VER)
+
+    if (avx2)
+    {
+        return {swap_avx2, "avx2"};
+    }
+    if (ssse3)
+    {
+        return {swap_ssse3, "ssse3"};
+    }
+    return {nullptr, "scalar"};
+}
+
+#elif defined(FASTDDS_BYTESWAP_NEON)
+
+size_t swap_neon(
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t bytes,
+        size_t element_size)
+{
+    size_t i = 0;
+    switch (element_size)
+    {
+        case 2:
+            for (; i + 16 <= bytes; i += 16)
+            {
+                vst1q_u8(dst + i, vrev16q_u8(vld1q_u8(src + i)));
+            }
+            break;
+        case 4:
+            for (; i + 16 <= bytes; i += 16)
+            {
+                vst1q_u8(dst + i, vrev32q_u8(vld1q_u8(src + i)));
+            }
+            break;
+        default:
+            for (; i + 16 <= bytes; i += 16)
+            {
+                vst1q_u8(dst + i, vrev64q_u8(vld1q_u8(src + i)));
+            }
+            break;
+    }
+    return i;
+}
+
+Implementation select_implementation()
+{
+    // NEON is mandatory on the targets this is compiled for
+    return {swap_neon, "neon"};
+}
+
+#else
+
+Implementation select_implementation()
+{
+    return {nullptr, "scalar"};
+}
+
+#endif // if defined(FASTDDS_BYTESWAP_X86)
+
+const Implementation& implementation()
+{
+    static const Implementation selected = select_implementation();
+    return selected;
+}
+
+} // namespace
+
+void swap_bytes(
+        const void* src,
+        void* dst,
+        size_t element_size,
+        size_t count)
+{
+    const uint8_t* from = static_cast<const uint8_t*>(src);
+    uint8_t* to = static_cast<uint8_t*>(dst);
+
+    if (1 == element_size)
+    {
+        if (from != to)
+        {
+            memcpy(to, from, count);
+        }
+        return;
+    }
+
+    assert(2 == element_size || 4 == element_size || 8 == element_size);
+    if (2 != element_size && 4 != element_size && 8 != element_size)
+    {
+        return;
+    }
+
+    size_t done = 0;
+    Kernel kernel = implementation().kernel;
+    if (nullptr != kernel)
+    {
+        done = kernel(from, to, count * element_size, element_size);
+    }
+
+    size_t pending = count - done / element_size;
+    switch (element_size)
+    {
+        case 2:
+            swap_scalar<uint16_t>(from + done, to + done, pending);
+            break;
+        case 4:
+            swap_scalar<uint32_t>(from + done, to + done, pending);
+            break;
+        default:
+            swap_scalar<uint64_t>(from + done, to + done, pending);
+            break;
+    }
+}
+
+const char* swap_bytes_implementation()
+{
+    return implementation().name;
+}
+
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,54 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ByteSwap.hpp
+ */
+
+#ifndef _FASTDDS_UTILS_BYTESWAP_HPP_
+#define _FASTDDS_UTILS_BYTESWAP_HPP_
+
+#include <cstddef>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Copy an array of elements of 2, 4 or 8 bytes, reversing the order of the bytes of each element.
+ *
+ * The kernel is chosen on first use, depending on the instruction sets supported by the CPU (AVX2 or SSSE3 on x86,
+ * NEON on ARM), falling back to a scalar loop.
+ * Neither buffer needs to be aligned. Both may be the same buffer, but they must not partially overlap.
+ *
+ * @param src Elements to copy
+ * @param dst Buffer receiving the swapped elements
+ * @param element_size Size in bytes of each element. Elements of 1 byte are just copied
+ * @param count Number of elements
+ */
+void swap_bytes(
+        const void* src,
+        void* dst,
+        size_t element_size,
+        size_t count);
+
+/**
+ * Name of the kernels selected for this CPU.
+ * @return One of "avx2", "ssse3", "neon" or "scalar"
+ */
+const char* swap_bytes_implementation();
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_UTILS_BYTESWAP_HPP_
@@ -193,11 +193,16 @@ void MD5::decode(
         const uint1 input[],
         size_type len)
 {
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
     for (unsigned int i = 0, j = 0; j < len; i++, j += 4)
     {
         output[i] = ((uint4)input[j]) | (((uint4)input[j + 1]) << 8) |
                 (((uint4)input[j + 2]) << 16) | (((uint4)input[j + 3]) << 24);
     }
+#else
+    // Words are little endian, as the host
+    memcpy(output, input, len);
+#endif // if FASTDDS_IS_BIG_ENDIAN_TARGET
 }
 
 //////////////////////////////
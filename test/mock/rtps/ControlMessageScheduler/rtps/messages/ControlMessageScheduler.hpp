@@ -0,0 +1,101 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessageScheduler.hpp
+ */
+
+#ifndef RTPS_MESSAGES_CONTROLMESSAGESCHEDULER_HPP
+#define RTPS_MESSAGES_CONTROLMESSAGESCHEDULER_HPP
+
+#include <functional>
+#include <vector>
+
+#include <fastdds/rtps/common/Locator.h>
+#include <fastrtps/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ControlMessageScheduler
+{
+};
+
+class ControlMessageGroup
+{
+public:
+
+    template<class LocatorIteratorT>
+    static void collect_destinations(
+            const LocatorIteratorT& begin,
+            const LocatorIteratorT& end,
+            std::vector<Locator_t>& destinations)
+    {
+        destinations.assign(begin, end);
+    }
+
+};
+
+class ControlMessageTask
+{
+public:
+
+    using PrepareCallback = std::function<bool (std::vector<Locator_t>&)>;
+
+    using AddCallback = std::function<void (ControlMessageGroup&, std::vector<Locator_t>&)>;
+
+    ControlMessageTask(
+            ControlMessageScheduler&,
+            PrepareCallback,
+            AddCallback,
+            double)
+    {
+    }
+
+    void restart_timer()
+    {
+    }
+
+    void restart_timer(
+            const std::chrono::steady_clock::time_point&)
+    {
+    }
+
+    void cancel_timer()
+    {
+    }
+
+    void update_interval(
+            const Duration_t&)
+    {
+    }
+
+    void update_interval_millisec(
+            double)
+    {
+    }
+
+    double getIntervalMilliSec() const
+    {
+        return 0;
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_MESSAGES_CONTROLMESSAGESCHEDULER_HPP
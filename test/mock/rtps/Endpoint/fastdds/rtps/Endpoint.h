@@ -21,6 +21,7 @@
 
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastdds/rtps/attributes/EndpointAttributes.h>
+#include <fastdds/rtps/common/Guid.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -44,10 +45,21 @@ public:
         return m_att;
     }
 
+    const GUID_t& getGuid() const
+    {
+        return m_guid;
+    }
+
 #if HAVE_SECURITY
+    bool supports_rtps_protection()
+    {
+        return supports_rtps_protection_;
+    }
+
     bool supports_rtps_protection_;
 #endif // HAVE_SECURITY
 
+    GUID_t m_guid;
     mutable RecursiveTimedMutex mp_mutex;
     EndpointAttributes m_att;
     RTPSParticipantImpl* mp_RTPSParticipant;
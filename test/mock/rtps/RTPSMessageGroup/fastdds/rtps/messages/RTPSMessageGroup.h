@@ -22,6 +22,10 @@
 
 #include <chrono>
 
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+
 #include <gmock/gmock.h>
 
 namespace eprosima {
@@ -48,10 +52,12 @@ public:
         virtual ~timeout() = default;
     };
 
-    RTPSMessageGroup(
+    explicit RTPSMessageGroup(
             RTPSParticipantImpl*,
-            bool)
+            bool = false)
     {
+        // Submessages added are sent as one message, whose length is the number of submessages
+        ON_CALL(*this, flush_and_reset()).WillByDefault(testing::Invoke(this, &RTPSMessageGroup::send_submessages));
     }
 
     RTPSMessageGroup(
@@ -68,10 +74,34 @@ public:
 
     MOCK_METHOD0(reset_current_bytes_processed, void());
 
+    MOCK_METHOD0(get_pending_bytes, uint32_t());
+
+    ~RTPSMessageGroup()
+    {
+        send_submessages();
+    }
+
     void sender(
             Endpoint*,
-            const RTPSMessageSenderInterface*) const
+            const RTPSMessageSenderInterface* msg_sender) const
+    {
+        sender_ = msg_sender;
+    }
+
+    void endpoint(
+            Endpoint*)
+    {
+    }
+
+    bool add_heartbeat(
+            const SequenceNumber_t&,
+            const SequenceNumber_t&,
+            Count_t,
+            bool,
+            bool)
     {
+        ++submessages_;
+        return true;
     }
 
     void set_sent_bytes_limitation(
@@ -79,6 +109,23 @@ public:
     {
     }
 
+private:
+
+    void send_submessages()
+    {
+        if (0 < submessages_ && nullptr != sender_)
+        {
+            CDRMessage_t msg(0);
+            msg.length = submessages_;
+            sender_->send(&msg, std::chrono::steady_clock::time_point::max());
+        }
+        submessages_ = 0;
+    }
+
+    mutable const RTPSMessageSenderInterface* sender_ = nullptr;
+
+    uint32_t submessages_ = 0;
+
 };
 
 } // namespace rtps
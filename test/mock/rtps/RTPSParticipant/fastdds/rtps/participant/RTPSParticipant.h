@@ -23,6 +23,8 @@
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/statistics/rtps/ReliabilityTuning.hpp>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastrtps/qos/WriterQos.h>
 
@@ -109,6 +111,18 @@ public:
     {
     }
 
+    void get_startup_profile(
+            fastdds::statistics::StartupProfile& /*profile*/) const
+    {
+    }
+
+    bool get_reliability_tuning(
+            const GUID_t& /*writer_guid*/,
+            fastdds::statistics::ReliabilityTuning& /*tuning*/) const
+    {
+        return false;
+    }
+
 #endif // FASTDDS_STATISTICS
 
 
@@ -21,11 +21,16 @@
 
 // Include first possible mocks (depending on include on CMakeLists.txt)
 #include <fastrtps/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/transport/NetworkBuffer.hpp>
+#include <rtps/messages/RTPSMessageGroup_t.hpp>
 #include <rtps/network/NetworkFactory.h>
 #include <fastrtps/rtps/participant/RTPSParticipantListener.h>
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 
 #if HAVE_SECURITY
 #include <rtps/security/SecurityManager.h>
@@ -34,13 +39,16 @@
 #include <gmock/gmock.h>
 
 #include <atomic>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <sstream>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ControlMessageScheduler;
 class Endpoint;
 class RTPSParticipant;
 class WriterHistory;
@@ -117,6 +125,13 @@ public:
 
     MOCK_METHOD1(setGuid, void(GUID_t &));
 
+    void on_startup_phase(
+            fastdds::statistics::StartupPhase,
+            const GUID_t&,
+            const GUID_t& = GUID_t::unknown())
+    {
+    }
+
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD6(createWriter_mock,
             bool (RTPSWriter** writer, WriterAttributes& param, WriterHistory* hist,
@@ -250,6 +265,46 @@ public:
         return events_;
     }
 
+    template<class LocatorIteratorT>
+    bool sendSync(
+            CDRMessage_t* msg,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point&)
+    {
+        LocatorList_t destinations;
+        for (LocatorIteratorT it = destination_locators_begin; it != destination_locators_end; ++it)
+        {
+            destinations.push_back(*it);
+        }
+        return send_sync_mock(msg->length, sender_guid, destinations);
+    }
+
+    template<class LocatorIteratorT>
+    bool sendSync(
+            const std::vector<fastdds::rtps::NetworkBuffer>&,
+            uint32_t total_bytes,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point&)
+    {
+        LocatorList_t destinations;
+        for (LocatorIteratorT it = destination_locators_begin; it != destination_locators_end; ++it)
+        {
+            destinations.push_back(*it);
+        }
+        return send_sync_mock(total_bytes, sender_guid, destinations);
+    }
+
+    MOCK_METHOD3(send_sync_mock, bool(uint32_t, const GUID_t&, const LocatorList_t&));
+
+    ControlMessageScheduler* control_message_scheduler() const
+    {
+        return nullptr;
+    }
+
     void set_endpoint_rtps_protection_supports(
             Endpoint* /*endpoint*/,
             bool /*support*/)
@@ -269,6 +324,21 @@ public:
         return 65536;
     }
 
+    std::unique_ptr<RTPSMessageGroup_t> get_send_buffer(
+            const std::chrono::steady_clock::time_point& /*max_blocking_time*/)
+    {
+        return std::unique_ptr<RTPSMessageGroup_t>(new RTPSMessageGroup_t(
+#if HAVE_SECURITY
+                           false,
+#endif // if HAVE_SECURITY
+                           getMaxMessageSize(), c_GuidPrefix_Unknown));
+    }
+
+    void return_send_buffer(
+            std::unique_ptr<RTPSMessageGroup_t>&& /*buffer*/)
+    {
+    }
+
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
     {
         return attr_;
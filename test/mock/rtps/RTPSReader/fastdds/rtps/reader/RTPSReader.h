@@ -70,6 +70,16 @@ public:
         return m_guid;
     }
 
+    void on_acknack(
+            int32_t /*count*/)
+    {
+    }
+
+    void on_nackfrag(
+            int32_t /*count*/)
+    {
+    }
+
     ReaderListener* getListener() const
     {
         return listener_;
@@ -148,11 +148,20 @@ public:
             LocatorSelectorSender&,
             const std::chrono::time_point<std::chrono::steady_clock>&));
 
+    MOCK_METHOD1(discard_change_nts, void(
+            CacheChange_t*));
+
     MOCK_METHOD3(send_nts, bool(
             CDRMessage_t*,
             const LocatorSelectorSender&,
             std::chrono::steady_clock::time_point&));
 
+    MOCK_METHOD4(send_nts, bool(
+            const std::vector<fastdds::rtps::NetworkBuffer>&,
+            uint32_t,
+            const LocatorSelectorSender&,
+            std::chrono::steady_clock::time_point&));
+
     MOCK_CONST_METHOD0(is_datasharing_compatible, bool());
 
     MOCK_CONST_METHOD1(is_datasharing_compatible_with, bool(
@@ -168,6 +177,10 @@ public:
         return m_guid;
     }
 
+    void on_gap()
+    {
+    }
+
     EndpointAttributes& getAttributes()
     {
         return m_att.endpoint;
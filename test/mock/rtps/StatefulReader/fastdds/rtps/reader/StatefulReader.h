@@ -24,6 +24,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ControlMessageGroup;
 class RTPSMessageGroup_t;
 class WriterProxy;
 class RTPSMessageSenderInterface;
@@ -88,6 +89,15 @@ public:
     {
     }
 
+    void send_acknack(
+            const WriterProxy* /*writer*/,
+            RTPSMessageSenderInterface* /*sender*/,
+            bool /*heartbeat_was_final*/,
+            ControlMessageGroup& /*group*/,
+            std::vector<Locator_t>& /*destinations*/)
+    {
+    }
+
     RTPSParticipantImpl* getRTPSParticipant() const
     {
         return nullptr;
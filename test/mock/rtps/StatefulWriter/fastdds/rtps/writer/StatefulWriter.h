@@ -113,6 +113,11 @@ public:
         return false;
     }
 
+    WriterHistory* history()
+    {
+        return mp_history;
+    }
+
 private:
 
     friend class ReaderProxy;
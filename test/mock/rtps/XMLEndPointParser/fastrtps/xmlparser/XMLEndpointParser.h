@@ -56,6 +56,17 @@ public:
         return XMLP_ret::XML_OK;
     }
 
+    /**
+     * Load a precompiled endpoint table
+     * @param filename Name of the file to load.
+     * @return XML_NOK, so the file is always parsed as XML.
+     */
+    XMLP_ret loadBinaryFile(
+            const std::string&)
+    {
+        return XMLP_ret::XML_NOK;
+    }
+
 private:
 
 };
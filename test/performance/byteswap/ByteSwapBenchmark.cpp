@@ -0,0 +1,161 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ByteSwapBenchmark.cpp
+ *
+ * Compares swapping the bytes of arrays of primitives one byte at a time, as done when serializing them in the
+ * non native endianness, with the vectorized kernels. Also compares reading the 32 bits words of a CDR message one
+ * by one with reading them at once.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <fastdds/rtps/messages/CDRMessage.h>
+
+#include <utils/ByteSwap.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Keeps the compiler from dropping the results
+volatile uint8_t sink;
+
+void swap_bytewise(
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t element_size,
+        size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < element_size; ++j)
+        {
+            dst[i * element_size + j] = src[i * element_size + element_size - 1 - j];
+        }
+    }
+}
+
+template<typename Function>
+double gigabytes_per_second(
+        size_t bytes,
+        uint32_t iterations,
+        Function function)
+{
+    Clock::time_point begin = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        function();
+    }
+    double elapsed_s = std::chrono::duration<double>(Clock::now() - begin).count();
+    return static_cast<double>(bytes) * iterations / elapsed_s / 1e9;
+}
+
+void print(
+        const char* operation,
+        size_t element_size,
+        double before,
+        double after)
+{
+    std::cout << std::left << std::setw(24) << operation << std::right << std::setw(6) << element_size
+              << std::fixed << std::setprecision(2) << std::setw(14) << before << std::setw(14) << after
+              << std::setw(10) << std::setprecision(1) << after / before << "x" << std::endl;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t elements = 1 << 20;
+    uint32_t iterations = 100;
+    if (argc > 1)
+    {
+        elements = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == elements || 0 == iterations)
+    {
+        std::cout << "Usage: ByteSwapBenchmark [elements] [iterations]" << std::endl;
+        return 1;
+    }
+
+    std::cout << elements << " elements, " << iterations << " iterations, " << swap_bytes_implementation()
+              << " kernels" << std::endl;
+    std::cout << std::left << std::setw(24) << "Operation" << std::right << std::setw(6) << "size"
+              << std::setw(14) << "before (GB/s)" << std::setw(14) << "after (GB/s)" << std::endl;
+
+    for (size_t element_size : {2u, 4u, 8u})
+    {
+        size_t bytes = elements * element_size;
+        std::vector<uint8_t> src(bytes);
+        std::vector<uint8_t> dst(bytes);
+        for (size_t i = 0; i < bytes; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i);
+        }
+
+        double before = gigabytes_per_second(bytes, iterations, [&]()
+                        {
+                            swap_bytewise(src.data(), dst.data(), element_size, elements);
+                            sink = dst[bytes / 2];
+                        });
+        double after = gigabytes_per_second(bytes, iterations, [&]()
+                        {
+                            swap_bytes(src.data(), dst.data(), element_size, elements);
+                            sink = dst[bytes / 2];
+                        });
+        print("swap array", element_size, before, after);
+    }
+
+    // Words read from a message, as the bitmaps of submessages
+    std::vector<uint32_t> words(elements);
+    CDRMessage_t msg(elements * 4);
+    msg.length = elements * 4;
+    for (Endianness_t endian : {DEFAULT_ENDIAN, BIGEND == DEFAULT_ENDIAN ? LITTLEEND : BIGEND})
+    {
+        msg.msg_endian = endian;
+        double before = gigabytes_per_second(msg.length, iterations, [&]()
+                        {
+                            msg.pos = 0;
+                            for (uint32_t& word : words)
+                            {
+                                CDRMessage::readUInt32(&msg, &word);
+                            }
+                            sink = static_cast<uint8_t>(words[elements / 2]);
+                        });
+        double after = gigabytes_per_second(msg.length, iterations, [&]()
+                        {
+                            msg.pos = 0;
+                            CDRMessage::readUInt32Array(&msg, words.data(), elements);
+                            sink = static_cast<uint8_t>(words[elements / 2]);
+                        });
+        print(DEFAULT_ENDIAN == endian ? "read words (native)" : "read words (swapped)", 4, before, after);
+    }
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicDataBenchmark.cpp
+ *
+ * Compares the cost of creating, copying and accessing samples of a wide structure when stored as DynamicData and
+ * as FlatDynamicData.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+using namespace eprosima::fastrtps::types;
+
+namespace {
+
+constexpr uint32_t NUM_FIELDS = 200;
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_us(
+        const Clock::time_point& start,
+        uint32_t iterations)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / iterations;
+}
+
+void print(
+        const char* operation,
+        double dynamic_us,
+        double flat_us)
+{
+    std::cout << std::left << std::setw(12) << operation << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << dynamic_us << std::setw(14) << flat_us
+              << std::setw(10) << std::setprecision(1) << dynamic_us / flat_us << "x" << std::endl;
+}
+
+// Structure of NUM_FIELDS members, cycling through int32, float64 and a bounded string
+DynamicType_ptr create_type()
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr int32_builder = factory->create_int32_builder();
+    DynamicTypeBuilder_ptr float64_builder = factory->create_float64_builder();
+    DynamicTypeBuilder_ptr string_builder = factory->create_string_builder(64);
+    DynamicType_ptr member_types[] = { int32_builder->build(), float64_builder->build(), string_builder->build() };
+
+    DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+    struct_builder->set_name("WideStruct");
+    for (uint32_t i = 0; i < NUM_FIELDS; ++i)
+    {
+        struct_builder->add_member(i, "field_" + std::to_string(i), member_types[i % 3]);
+    }
+    return struct_builder->build();
+}
+
+template<typename Data>
+void set_values(
+        Data* data,
+        uint32_t seed)
+{
+    for (MemberId id = 0; id < NUM_FIELDS; ++id)
+    {
+        switch (id % 3)
+        {
+            case 0:
+                data->set_int32_value(static_cast<int32_t>(seed + id), id);
+                break;
+            case 1:
+                data->set_float64_value(static_cast<double>(seed) * id, id);
+                break;
+            default:
+                data->set_string_value("value", id);
+                break;
+        }
+    }
+}
+
+template<typename Data>
+double get_values(
+        const Data* data)
+{
+    double sum = 0;
+    std::string text;
+    for (MemberId id = 0; id < NUM_FIELDS; ++id)
+    {
+        switch (id % 3)
+        {
+            case 0:
+                sum += data->get_int32_value(id);
+                break;
+            case 1:
+                sum += data->get_float64_value(id);
+                break;
+            default:
+                data->get_string_value(text, id);
+                sum += static_cast<double>(text.size());
+                break;
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 1000;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == iterations)
+    {
+        std::cout << "Usage: DynamicDataBenchmark [iterations]" << std::endl;
+        return 1;
+    }
+
+    DynamicDataFactory* data_factory = DynamicDataFactory::get_instance();
+    DynamicType_ptr type = create_type();
+    double checksum = 0;
+
+    std::cout << "Structure of " << NUM_FIELDS << " members, " << iterations << " iterations" << std::endl;
+    std::cout << std::left << std::setw(12) << "Operation" << std::right << std::setw(14) << "DynamicData"
+              << std::setw(14) << "Flat" << std::setw(11) << "Speedup" << std::endl;
+
+    // Create and delete
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        data_factory->delete_data(data_factory->create_data(type));
+    }
+    double dynamic_us = elapsed_us(start, iterations);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        data_factory->delete_flat_data(data_factory->create_flat_data(type));
+    }
+    print("create", dynamic_us, elapsed_us(start, iterations));
+
+    DynamicData* dynamic = data_factory->create_data(type);
+    FlatDynamicData* flat = data_factory->create_flat_data(type);
+    set_values(dynamic, 1);
+    set_values(flat, 1);
+
+    // Copy
+    start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        data_factory->delete_data(data_factory->create_copy(dynamic));
+    }
+    dynamic_us = elapsed_us(start, iterations);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        data_factory->delete_flat_data(data_factory->create_flat_copy(flat));
+    }
+    print("copy", dynamic_us, elapsed_us(start, iterations));
+
+    // Set and get every member
+    start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        set_values(dynamic, i);
+        checksum += get_values(dynamic);
+    }
+    dynamic_us = elapsed_us(start, iterations);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        set_values(flat, i);
+        checksum -= get_values(flat);
+    }
+    print("set/get", dynamic_us, elapsed_us(start, iterations));
+
+    data_factory->delete_data(dynamic);
+    data_factory->delete_flat_data(flat);
+
+    // Both representations must have read the same values
+    if (0 != checksum)
+    {
+        std::cout << "Checksum mismatch between representations" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,261 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CoalescingBenchmark.cpp
+ *
+ * Measures the trade-off between latency and datagrams sent of an asynchronous writer sending small samples at a
+ * fixed rate, for several coalescing windows of its flow controller. Samples are received on a plain UDP socket.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <asio.hpp>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/writer/StatelessWriter.h>
+#include <fastrtps/utils/IPLocator.h>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::FlowControllerDescriptor;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr const char* flow_controller_name = "coalescing_flow_controller";
+constexpr uint16_t port = 7398;
+// Written at the beginning of each sample, followed by the time it was written.
+constexpr char marker[8] = {'C', 'O', 'A', 'L', 'E', 'S', 'C', 'E'};
+constexpr uint32_t min_payload_size = sizeof(marker) + sizeof(int64_t);
+
+struct Window
+{
+    uint32_t delay_us;
+    uint32_t max_bytes;
+};
+
+struct Result
+{
+    uint64_t datagrams = 0;
+    std::vector<int64_t> latencies_ns;
+};
+
+int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// Receives datagrams until an empty one arrives, extracting the latency of each sample
+void receive(
+        asio::ip::udp::socket& socket,
+        Result& result)
+{
+    std::vector<char> buffer(65536);
+    asio::ip::udp::endpoint sender;
+    while (true)
+    {
+        size_t length = socket.receive_from(asio::buffer(buffer), sender);
+        int64_t received_ns = now_ns();
+        if (0 == length)
+        {
+            break;
+        }
+
+        ++result.datagrams;
+        auto end = buffer.begin() + static_cast<std::ptrdiff_t>(length);
+        auto it = std::search(buffer.begin(), end, std::begin(marker), std::end(marker));
+        while (end != it && static_cast<size_t>(end - it) >= min_payload_size)
+        {
+            int64_t written_ns = 0;
+            memcpy(&written_ns, &*(it + sizeof(marker)), sizeof(written_ns));
+            result.latencies_ns.push_back(received_ns - written_ns);
+            it = std::search(it + min_payload_size, end, std::begin(marker), std::end(marker));
+        }
+    }
+}
+
+bool run(
+        const Window& window,
+        uint32_t samples,
+        uint32_t payload_size,
+        uint32_t rate,
+        Result& result)
+{
+    auto descriptor = std::make_shared<FlowControllerDescriptor>();
+    descriptor->name = flow_controller_name;
+    descriptor->max_coalescing_delay_us = window.delay_us;
+    descriptor->max_coalescing_bytes = window.max_bytes;
+
+    RTPSParticipantAttributes participant_attributes;
+    participant_attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::NONE;
+    participant_attributes.flow_controllers.push_back(descriptor);
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, participant_attributes);
+    if (nullptr == participant)
+    {
+        return false;
+    }
+
+    HistoryAttributes history_attributes;
+    history_attributes.payloadMaxSize = payload_size;
+    history_attributes.initialReservedCaches = 1000;
+    history_attributes.maximumReservedCaches = 1000;
+    WriterHistory history(history_attributes);
+
+    WriterAttributes writer_attributes;
+    writer_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+    writer_attributes.endpoint.durabilityKind = VOLATILE;
+    writer_attributes.mode = ASYNCHRONOUS_WRITER;
+    writer_attributes.flow_controller_name = flow_controller_name;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attributes, &history);
+    if (nullptr == writer)
+    {
+        RTPSDomain::removeRTPSParticipant(participant);
+        return false;
+    }
+
+    Locator_t locator;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    locator.port = port;
+    LocatorList_t locators;
+    locators.push_back(locator);
+    static_cast<StatelessWriter*>(writer)->set_fixed_locators(locators);
+
+    asio::io_service io_service;
+    asio::ip::udp::endpoint endpoint(asio::ip::address_v4::loopback(), port);
+    asio::ip::udp::socket socket(io_service, endpoint);
+    socket.set_option(asio::socket_base::receive_buffer_size(8 * 1024 * 1024));
+    std::thread receiver(receive, std::ref(socket), std::ref(result));
+
+    std::chrono::nanoseconds interval(1000000000 / rate);
+    Clock::time_point next = Clock::now();
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        while (Clock::now() < next)
+        {
+        }
+        next += interval;
+
+        if (history.isFull())
+        {
+            history.remove_min_change();
+        }
+        CacheChange_t* change = writer->new_change([payload_size]() -> uint32_t
+                        {
+                            return payload_size;
+                        }, ALIVE);
+        int64_t written_ns = now_ns();
+        memset(change->serializedPayload.data, 0, payload_size);
+        memcpy(change->serializedPayload.data, marker, sizeof(marker));
+        memcpy(change->serializedPayload.data + sizeof(marker), &written_ns, sizeof(written_ns));
+        change->serializedPayload.length = payload_size;
+        history.add_change(change);
+    }
+
+    // Let the last samples arrive and stop the receiver.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100) + std::chrono::microseconds(window.delay_us));
+    asio::ip::udp::socket stopper(io_service, asio::ip::udp::v4());
+    stopper.send_to(asio::buffer(marker, 0), endpoint);
+    receiver.join();
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    return true;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t samples = 100000;
+    uint32_t payload_size = 64;
+    uint32_t rate = 100000;
+    if (argc > 1)
+    {
+        samples = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        rate = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (0 == samples || min_payload_size > payload_size || 0 == rate)
+    {
+        std::cout << "Usage: CoalescingBenchmark [samples] [payload_size >= " << min_payload_size
+                  << "] [samples_per_second]" << std::endl;
+        return 1;
+    }
+
+    const std::vector<Window> windows = {
+        {0, 0}, {50, 0}, {200, 0}, {1000, 0}, {1000, 8192}
+    };
+
+    std::cout << samples << " samples of " << payload_size << " bytes at " << rate << " samples/s" << std::endl;
+    std::cout << std::right << std::setw(12) << "delay (us)" << std::setw(12) << "max bytes" << std::setw(12)
+              << "received" << std::setw(12) << "datagrams" << std::setw(16) << "samples/dgram"
+              << std::setw(14) << "avg lat (us)" << std::setw(14) << "p99 lat (us)" << std::endl;
+
+    for (const Window& window : windows)
+    {
+        Result result;
+        if (!run(window, samples, payload_size, rate, result))
+        {
+            std::cout << "Cannot create the writer" << std::endl;
+            return 1;
+        }
+
+        double average_us = 0;
+        double p99_us = 0;
+        if (!result.latencies_ns.empty())
+        {
+            for (int64_t latency : result.latencies_ns)
+            {
+                average_us += latency / 1000.0;
+            }
+            average_us /= result.latencies_ns.size();
+            std::sort(result.latencies_ns.begin(), result.latencies_ns.end());
+            p99_us = result.latencies_ns[result.latencies_ns.size() * 99 / 100] / 1000.0;
+        }
+
+        std::cout << std::right << std::setw(12) << window.delay_us << std::setw(12) << window.max_bytes
+                  << std::setw(12) << result.latencies_ns.size() << std::setw(12) << result.datagrams
+                  << std::fixed << std::setprecision(2) << std::setw(16)
+                  << (0 == result.datagrams ? 0.0 :
+                static_cast<double>(result.latencies_ns.size()) / result.datagrams)
+                  << std::setw(14) << average_us << std::setw(14) << p99_us << std::endl;
+    }
+
+    return 0;
+}
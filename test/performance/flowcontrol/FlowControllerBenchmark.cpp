@@ -0,0 +1,214 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlowControllerBenchmark.cpp
+ *
+ * Measures the contention of many writers, each one written from its own thread, sharing an asynchronous flow
+ * controller, for several numbers of sender threads.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/writer/StatelessWriter.h>
+#include <fastrtps/utils/IPLocator.h>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::FlowControllerDescriptor;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr const char* flow_controller_name = "benchmark_flow_controller";
+
+struct Writer
+{
+    std::unique_ptr<WriterHistory> history;
+    RTPSWriter* writer = nullptr;
+    double write_us = 0;
+};
+
+void write_samples(
+        Writer& writer,
+        uint32_t samples,
+        uint32_t payload_size,
+        const std::atomic<bool>& start)
+{
+    while (!start.load())
+    {
+        std::this_thread::yield();
+    }
+
+    Clock::time_point begin = Clock::now();
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        if (writer.history->isFull())
+        {
+            writer.history->remove_min_change();
+        }
+        CacheChange_t* change = writer.writer->new_change([payload_size]() -> uint32_t
+                        {
+                            return payload_size;
+                        }, ALIVE);
+        memset(change->serializedPayload.data, static_cast<int>(i & 0xFF), payload_size);
+        change->serializedPayload.length = payload_size;
+        writer.history->add_change(change);
+    }
+    writer.write_us = std::chrono::duration<double, std::micro>(Clock::now() - begin).count() / samples;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t writers = 32;
+    uint32_t samples = 10000;
+    uint32_t payload_size = 64;
+    if (argc > 1)
+    {
+        writers = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        samples = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (0 == writers || 0 == samples || 0 == payload_size)
+    {
+        std::cout << "Usage: FlowControllerBenchmark [writers] [samples_per_writer] [payload_size]" << std::endl;
+        return 1;
+    }
+
+    // Samples are sent to a port nobody listens to.
+    Locator_t locator;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    locator.port = 7399;
+    LocatorList_t locators;
+    locators.push_back(locator);
+
+    HistoryAttributes history_attributes;
+    history_attributes.payloadMaxSize = payload_size;
+    history_attributes.initialReservedCaches = 100;
+    history_attributes.maximumReservedCaches = 100;
+
+    std::cout << writers << " writers writing " << samples << " samples of " << payload_size << " bytes each"
+              << std::endl;
+    std::cout << std::left << std::setw(16) << "Sender threads" << std::right << std::setw(14) << "write (us)"
+              << std::setw(14) << "samples/s" << std::endl;
+
+    int ret = 0;
+    for (uint32_t sender_threads : {1u, 2u, 4u})
+    {
+        auto descriptor = std::make_shared<FlowControllerDescriptor>();
+        descriptor->name = flow_controller_name;
+        descriptor->sender_threads = sender_threads;
+
+        RTPSParticipantAttributes participant_attributes;
+        participant_attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::NONE;
+        participant_attributes.flow_controllers.push_back(descriptor);
+        RTPSParticipant* participant = RTPSDomain::createParticipant(0, participant_attributes);
+        if (nullptr == participant)
+        {
+            std::cout << "Cannot create participant" << std::endl;
+            return 1;
+        }
+
+        WriterAttributes writer_attributes;
+        writer_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+        writer_attributes.endpoint.durabilityKind = VOLATILE;
+        writer_attributes.mode = ASYNCHRONOUS_WRITER;
+        writer_attributes.flow_controller_name = flow_controller_name;
+
+        std::vector<Writer> entities(writers);
+        for (Writer& writer : entities)
+        {
+            writer.history.reset(new WriterHistory(history_attributes));
+            writer.writer = RTPSDomain::createRTPSWriter(participant, writer_attributes, writer.history.get());
+            if (nullptr == writer.writer)
+            {
+                std::cout << "Cannot create writer" << std::endl;
+                ret = 1;
+                break;
+            }
+            static_cast<StatelessWriter*>(writer.writer)->set_fixed_locators(locators);
+        }
+
+        if (0 == ret)
+        {
+            std::atomic<bool> start {false};
+            std::vector<std::thread> threads;
+            for (Writer& writer : entities)
+            {
+                threads.emplace_back(write_samples, std::ref(writer), samples, payload_size, std::cref(start));
+            }
+
+            Clock::time_point begin = Clock::now();
+            start.store(true);
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            double elapsed_s = std::chrono::duration<double>(Clock::now() - begin).count();
+
+            double write_us = 0;
+            for (const Writer& writer : entities)
+            {
+                write_us += writer.write_us;
+            }
+            write_us /= writers;
+
+            std::cout << std::left << std::setw(16) << sender_threads << std::right << std::fixed
+                      << std::setprecision(3) << std::setw(14) << write_us << std::setw(14) << std::setprecision(0)
+                      << static_cast<double>(writers) * samples / elapsed_s << std::endl;
+        }
+
+        for (Writer& writer : entities)
+        {
+            if (nullptr != writer.writer)
+            {
+                RTPSDomain::removeRTPSWriter(writer.writer);
+            }
+        }
+        RTPSDomain::removeRTPSParticipant(participant);
+
+        if (0 != ret)
+        {
+            break;
+        }
+    }
+
+    return ret;
+}
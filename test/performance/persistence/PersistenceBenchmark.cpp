@@ -0,0 +1,244 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PersistenceBenchmark.cpp
+ *
+ * Measures the cost of writing samples on a TRANSIENT writer, keeping the last samples of a bounded history, and of
+ * loading them back until the writer can write again, with each of the builtin persistence plugins.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/config.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Plugin
+{
+    const char* name;
+    std::vector<std::pair<std::string, std::string>> properties;
+};
+
+// Remove the files written by the log structured plugin for a writer
+void remove_log_files(
+        const GUID_t& persistence_guid)
+{
+    std::ostringstream guid;
+    guid << persistence_guid;
+
+    std::ostringstream ss;
+    ss << "./writer_" << std::hex << std::setfill('0');
+    for (char c : guid.str())
+    {
+        ss << std::setw(2) << static_cast<unsigned>(static_cast<unsigned char>(c));
+    }
+    std::string base_name = ss.str();
+
+    std::remove((base_name + ".manifest").c_str());
+    std::remove((base_name + ".manifest.tmp").c_str());
+    for (uint32_t id = 0; id < 4096; ++id)
+    {
+        std::remove((base_name + "." + std::to_string(id) + ".seg").c_str());
+    }
+}
+
+void write_sample(
+        RTPSWriter* writer,
+        WriterHistory* history,
+        uint32_t payload_size,
+        uint32_t index)
+{
+    if (history->isFull())
+    {
+        history->remove_min_change();
+    }
+    CacheChange_t* change = writer->new_change([payload_size]() -> uint32_t
+                    {
+                        return payload_size;
+                    }, ALIVE);
+    memset(change->serializedPayload.data, static_cast<int>(index & 0xFF), payload_size);
+    change->serializedPayload.length = payload_size;
+    history->add_change(change);
+}
+
+RTPSWriter* create_writer(
+        RTPSParticipant* participant,
+        WriterHistory* history,
+        const Plugin& plugin,
+        const GUID_t& persistence_guid)
+{
+    WriterAttributes watt;
+    watt.endpoint.reliabilityKind = BEST_EFFORT;
+    watt.endpoint.durabilityKind = TRANSIENT;
+    watt.endpoint.persistence_guid = persistence_guid;
+    for (const auto& property : plugin.properties)
+    {
+        watt.endpoint.properties.properties().emplace_back(property.first, property.second);
+    }
+    return RTPSDomain::createRTPSWriter(participant, watt, history);
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t samples = 10000;
+    uint32_t payload_size = 256;
+    uint32_t depth = 100;
+    if (argc > 1)
+    {
+        samples = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        depth = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (0 == samples || 0 == payload_size || 0 == depth)
+    {
+        std::cout << "Usage: PersistenceBenchmark [samples] [payload_size] [history_depth]" << std::endl;
+        return 1;
+    }
+
+    std::vector<Plugin> plugins;
+#if HAVE_SQLITE3
+    plugins.push_back({"SQLITE3", {
+                           {"dds.persistence.plugin", "builtin.SQLITE3"},
+                           {"dds.persistence.sqlite3.filename", "persistence_benchmark.db"}}});
+    plugins.push_back({"SQLITE3 50ms", {
+                           {"dds.persistence.plugin", "builtin.SQLITE3"},
+                           {"dds.persistence.sqlite3.filename", "persistence_benchmark.db"},
+                           {"dds.persistence.sqlite3.commit_period", "50"}}});
+    plugins.push_back({"SQLITE3 50ms lazy", {
+                           {"dds.persistence.plugin", "builtin.SQLITE3"},
+                           {"dds.persistence.sqlite3.filename", "persistence_benchmark.db"},
+                           {"dds.persistence.sqlite3.commit_period", "50"},
+                           {"dds.persistence.lazy_load", "true"}}});
+#endif // if HAVE_SQLITE3
+    plugins.push_back({"LOG_STRUCTURED", {
+                           {"dds.persistence.plugin", "builtin.LOG_STRUCTURED"}}});
+    plugins.push_back({"LOG_STRUCTURED sync", {
+                           {"dds.persistence.plugin", "builtin.LOG_STRUCTURED"},
+                           {"dds.persistence.log_structured.sync", "true"}}});
+    plugins.push_back({"LOG_STRUCTURED lazy", {
+                           {"dds.persistence.plugin", "builtin.LOG_STRUCTURED"},
+                           {"dds.persistence.lazy_load", "true"}}});
+
+    RTPSParticipantAttributes participant_attributes;
+    participant_attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::NONE;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, participant_attributes);
+    if (nullptr == participant)
+    {
+        std::cout << "Cannot create participant" << std::endl;
+        return 1;
+    }
+
+    HistoryAttributes history_attributes;
+    history_attributes.payloadMaxSize = payload_size;
+    history_attributes.initialReservedCaches = static_cast<int32_t>(depth);
+    history_attributes.maximumReservedCaches = static_cast<int32_t>(depth);
+
+    std::cout << samples << " samples of " << payload_size << " bytes, history of " << depth << std::endl;
+    std::cout << std::left << std::setw(22) << "Plugin" << std::right << std::setw(14) << "write (us)"
+              << std::setw(14) << "samples/s" << std::setw(14) << "load (ms)" << std::setw(18) << "first write (ms)"
+              << std::endl;
+
+    int ret = 0;
+    for (const Plugin& plugin : plugins)
+    {
+        GUID_t persistence_guid;
+        persistence_guid.guidPrefix.value[11] = 1;
+        persistence_guid.entityId.value[3] = static_cast<octet>(&plugin - plugins.data() + 1);
+        std::remove("persistence_benchmark.db");
+        remove_log_files(persistence_guid);
+
+        WriterHistory* history = new WriterHistory(history_attributes);
+        RTPSWriter* writer = create_writer(participant, history, plugin, persistence_guid);
+        if (nullptr == writer)
+        {
+            std::cout << "Cannot create writer with plugin " << plugin.name << std::endl;
+            delete history;
+            ret = 1;
+            continue;
+        }
+
+        Clock::time_point start = Clock::now();
+        for (uint32_t i = 0; i < samples; ++i)
+        {
+            write_sample(writer, history, payload_size, i);
+        }
+        double write_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / samples;
+
+        RTPSDomain::removeRTPSWriter(writer);
+        delete history;
+
+        // Creating the writer again loads the history from storage
+        history = new WriterHistory(history_attributes);
+        start = Clock::now();
+        writer = create_writer(participant, history, plugin, persistence_guid);
+        double load_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        double first_write_ms = 0;
+        if (nullptr == writer || history->getHistorySize() != std::min(samples, depth))
+        {
+            std::cout << "Plugin " << plugin.name << " did not load the history" << std::endl;
+            ret = 1;
+        }
+        else
+        {
+            write_sample(writer, history, payload_size, samples);
+            first_write_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        std::cout << std::left << std::setw(22) << plugin.name << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << write_us << std::setw(14) << std::setprecision(0) << 1e6 / write_us
+                  << std::setw(14) << std::setprecision(3) << load_ms << std::setw(18) << first_write_ms
+                  << std::endl;
+
+        if (nullptr != writer)
+        {
+            RTPSDomain::removeRTPSWriter(writer);
+        }
+        delete history;
+        std::remove("persistence_benchmark.db");
+        remove_log_files(persistence_guid);
+    }
+
+    RTPSDomain::removeRTPSParticipant(participant);
+    return ret;
+}
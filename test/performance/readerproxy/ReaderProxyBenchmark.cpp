@@ -0,0 +1,338 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderProxyBenchmark.cpp
+ *
+ * Compares keeping the state of the outstanding changes of a reliable writer towards each reader as a vector with a
+ * ChangeForReader_t per change, as ReaderProxy used to do, with keeping it on a ReaderChangeStates. Every reader is
+ * given all the changes as unacknowledged, is asked whether each change is acknowledged, requests a part of them,
+ * has them resent and finally acknowledges all of them.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/writer/ChangeForReader.h>
+#include <fastdds/rtps/writer/ReaderChangeStates.h>
+#include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using ChangeVector = ResourceLimitedVector<ChangeForReader_t, std::true_type>;
+
+// Each reader requests one every REQUEST_STRIDE changes
+constexpr uint32_t REQUEST_STRIDE = 16;
+// Each acknowledgement moves the low mark of a reader this number of changes
+constexpr uint32_t ACK_STEP = 1000;
+
+// Keeps the compiler from dropping the results
+volatile size_t sink;
+
+template<typename Function>
+double milliseconds(
+        Function function)
+{
+    Clock::time_point begin = Clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+}
+
+void print(
+        const char* operation,
+        double before,
+        double after)
+{
+    std::cout << std::left << std::setw(24) << operation << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << before << std::setw(14) << after << std::setw(10) << before / after << "x"
+              << std::endl;
+}
+
+SequenceNumberSet_t requested_set(
+        uint64_t base,
+        uint64_t last)
+{
+    SequenceNumber_t first(base);
+    SequenceNumberSet_t set(first);
+    for (uint64_t seq = base; seq <= last && seq < base + 256; seq += REQUEST_STRIDE)
+    {
+        set.add(SequenceNumber_t(seq));
+    }
+    return set;
+}
+
+ChangeVector::iterator find_change(
+        ChangeVector& changes,
+        const SequenceNumber_t& seq_num)
+{
+    return std::lower_bound(changes.begin(), changes.end(), seq_num,
+                   [](const ChangeForReader_t& change, const SequenceNumber_t& seq)
+                   {
+                       return change.getSequenceNumber() < seq;
+                   });
+}
+
+// Same search done by ReaderProxy on the writer history
+CacheChange_t* find_history_change(
+        std::vector<CacheChange_t*>& history,
+        const SequenceNumber_t& seq_num,
+        std::vector<CacheChange_t*>::iterator& hint)
+{
+    std::vector<CacheChange_t*>::iterator end = history.end();
+    if (hint == end)
+    {
+        return nullptr;
+    }
+
+    if ((*hint)->sequenceNumber < seq_num)
+    {
+        uint64_t distance = (seq_num - (*hint)->sequenceNumber).to64long();
+        if (distance < static_cast<uint64_t>(end - hint))
+        {
+            end = hint + static_cast<std::ptrdiff_t>(distance) + 1;
+            if ((*(end - 1))->sequenceNumber == seq_num)
+            {
+                hint = end - 1;
+                return *hint;
+            }
+        }
+    }
+
+    hint = std::lower_bound(hint, end, seq_num, [](const CacheChange_t* change, const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
+    return (hint != end && (*hint)->sequenceNumber == seq_num) ? *hint : nullptr;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t readers = 100;
+    uint32_t changes = 100000;
+    if (argc > 1)
+    {
+        readers = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        changes = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == readers || 0 == changes)
+    {
+        std::cout << "Usage: ReaderProxyBenchmark [readers] [outstanding changes]" << std::endl;
+        return 1;
+    }
+
+    std::vector<CacheChange_t> history_changes(changes);
+    std::vector<CacheChange_t*> history;
+    for (uint32_t i = 0; i < changes; ++i)
+    {
+        history_changes[i].sequenceNumber = SequenceNumber_t(static_cast<uint64_t>(i) + 1);
+        history.push_back(&history_changes[i]);
+    }
+    uint64_t last = changes;
+
+    std::cout << readers << " readers, " << changes << " outstanding changes" << std::endl;
+    std::cout << std::left << std::setw(24) << "Operation" << std::right << std::setw(14) << "before (ms)"
+              << std::setw(14) << "after (ms)" << std::endl;
+
+    // Vectors are preallocated, as the capacity of the one on ReaderProxy was increased one element at a time
+    ResourceLimitedContainerConfig config(changes, changes, 1u);
+    std::vector<ChangeVector> vectors;
+    vectors.reserve(readers);
+    for (uint32_t i = 0; i < readers; ++i)
+    {
+        vectors.emplace_back(config);
+    }
+    std::vector<ReaderChangeStates> states(readers);
+
+    // Changes are added to all the readers as they are written
+    double before = milliseconds([&]()
+                    {
+                        for (CacheChange_t* change : history)
+                        {
+                            for (ChangeVector& reader : vectors)
+                            {
+                                ChangeForReader_t change_for_reader(change);
+                                change_for_reader.setStatus(UNACKNOWLEDGED);
+                                reader.push_back(change_for_reader);
+                            }
+                        }
+                    });
+    double after = milliseconds([&]()
+                    {
+                        for (CacheChange_t* change : history)
+                        {
+                            for (ReaderChangeStates& reader : states)
+                            {
+                                reader.push_back(change->sequenceNumber, UNACKNOWLEDGED);
+                            }
+                        }
+                    });
+    print("add_change", before, after);
+
+    size_t before_bytes = 0;
+    size_t after_bytes = 0;
+    for (uint32_t i = 0; i < readers; ++i)
+    {
+        before_bytes += vectors[i].capacity() * sizeof(ChangeForReader_t);
+        after_bytes += states[i].capacity();
+    }
+
+    // Checking whether a change is acknowledged by all readers
+    before = milliseconds([&]()
+                    {
+                        size_t acked = 0;
+                        for (CacheChange_t* change : history)
+                        {
+                            for (ChangeVector& reader : vectors)
+                            {
+                                auto it = find_change(reader, change->sequenceNumber);
+                                acked += (reader.end() == it || ACKNOWLEDGED == it->getStatus()) ? 1 : 0;
+                            }
+                        }
+                        sink = acked;
+                    });
+    after = milliseconds([&]()
+                    {
+                        size_t acked = 0;
+                        for (CacheChange_t* change : history)
+                        {
+                            for (ReaderChangeStates& reader : states)
+                            {
+                                ChangeForReaderStatus_t status = UNSENT;
+                                acked += (!reader.find(change->sequenceNumber, status) || ACKNOWLEDGED == status) ?
+                                        1 : 0;
+                            }
+                        }
+                        sink = acked;
+                    });
+    print("change_is_acked", before, after);
+
+    // Each reader requests a part of the changes
+    before = milliseconds([&]()
+                    {
+                        for (ChangeVector& reader : vectors)
+                        {
+                            for (uint64_t base = 1; base <= last; base += 256)
+                            {
+                                requested_set(base, last).for_each([&reader](SequenceNumber_t seq)
+                                {
+                                    auto it = find_change(reader, seq);
+                                    if (reader.end() != it && UNACKNOWLEDGED == it->getStatus())
+                                    {
+                                        it->setStatus(REQUESTED);
+                                        it->markAllFragmentsAsUnsent();
+                                    }
+                                });
+                            }
+                        }
+                    });
+    after = milliseconds([&]()
+                    {
+                        for (ReaderChangeStates& reader : states)
+                        {
+                            for (uint64_t base = 1; base <= last; base += 256)
+                            {
+                                requested_set(base, last).for_each([&reader](SequenceNumber_t seq)
+                                {
+                                    ChangeForReaderStatus_t status = UNSENT;
+                                    if (reader.find(seq, status) && UNACKNOWLEDGED == status)
+                                    {
+                                        reader.set_status(seq, REQUESTED);
+                                    }
+                                });
+                            }
+                        }
+                    });
+    print("requested_changes_set", before, after);
+
+    // Requested changes are resent
+    before = milliseconds([&]()
+                    {
+                        size_t resent = 0;
+                        for (ChangeVector& reader : vectors)
+                        {
+                            for (ChangeForReader_t& change : reader)
+                            {
+                                if (REQUESTED == change.getStatus())
+                                {
+                                    change.setStatus(UNSENT);
+                                    resent += change.getChange()->serializedPayload.length + 1;
+                                }
+                            }
+                        }
+                        sink = resent;
+                    });
+    after = milliseconds([&]()
+                    {
+                        size_t resent = 0;
+                        for (ReaderChangeStates& reader : states)
+                        {
+                            std::vector<CacheChange_t*>::iterator hint = history.begin();
+                            reader.convert_status(REQUESTED, UNSENT, [&](const SequenceNumber_t& seq)
+                            {
+                                resent += find_history_change(history, seq, hint)->serializedPayload.length + 1;
+                            });
+                        }
+                        sink = resent;
+                    });
+    print("perform_acknack_response", before, after);
+
+    // Readers acknowledge all the changes, a part at a time
+    before = milliseconds([&]()
+                    {
+                        for (ChangeVector& reader : vectors)
+                        {
+                            for (uint64_t seq = 1; seq <= last + 1; seq += ACK_STEP)
+                            {
+                                reader.erase(reader.begin(), find_change(reader, SequenceNumber_t(seq)));
+                            }
+                            reader.erase(reader.begin(), reader.end());
+                        }
+                    });
+    after = milliseconds([&]()
+                    {
+                        for (ReaderChangeStates& reader : states)
+                        {
+                            for (uint64_t seq = 1; seq <= last + 1; seq += ACK_STEP)
+                            {
+                                reader.erase_before(SequenceNumber_t(seq));
+                            }
+                            reader.erase_before(SequenceNumber_t(last + 1));
+                        }
+                    });
+    print("acked_changes_set", before, after);
+
+    std::cout << std::left << std::setw(24) << "memory (MB)" << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << before_bytes / 1e6 << std::setw(14) << after_bytes / 1e6 << std::setw(10)
+              << static_cast<double>(before_bytes) / after_bytes << "x" << std::endl;
+
+    return 0;
+}
@@ -124,6 +124,8 @@ public:
         return true;
     }
 
+    using TopicDataType::compute_key_hash;
+
 };
 
 TEST(TopicTests, ChangeTopicQos)
@@ -465,6 +467,50 @@ TEST(TopicTests, InstancePolicyAllocationConsistencyKeyed)
     ASSERT_EQ(ReturnCode_t::RETCODE_OK, default_topic1->set_qos(qos2));
 }
 
+/*
+ * This test checks the instance handles computed from serialized keys.
+ * 1. Keys bounded to 16 bytes are copied into the handle and zero padded.
+ * 2. Forcing MD5 uses the MD5 digest of the key.
+ * 3. Keys bounded over 16 bytes use the MD5 digest of the key.
+ */
+TEST(TopicTests, ComputeKeyHash)
+{
+    // Reference digest of the RFC 1321 test suite
+    MD5 md5;
+    ASSERT_EQ("900150983cd24fb0d6963f7d28e17f72", MD5("abc").hexdigest());
+
+    const unsigned char key[20] = {0, 0, 0, 5, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    fastrtps::rtps::InstanceHandle_t handle;
+    fastrtps::rtps::InstanceHandle_t expected;
+
+    // 1. Bounded key shorter than the handle, on a handle with previous contents
+    for (uint8_t i = 0; i < 16; ++i)
+    {
+        handle.value[i] = 0xFF;
+    }
+    TopicDataTypeMock::compute_key_hash(key, 4, 8, false, md5, &handle);
+    for (uint8_t i = 0; i < 16; ++i)
+    {
+        expected.value[i] = i < 4 ? key[i] : 0;
+    }
+    ASSERT_EQ(expected, handle);
+
+    // 2. Forced MD5
+    MD5 reference;
+    reference.init();
+    reference.update(key, 4);
+    reference.finalize();
+    TopicDataTypeMock::compute_key_hash(key, 4, 8, true, md5, &handle);
+    ASSERT_EQ(0, memcmp(reference.digest, static_cast<const fastrtps::rtps::octet*>(handle.value), 16));
+
+    // 3. Key bounded over 16 bytes
+    reference.init();
+    reference.update(key, 20);
+    reference.finalize();
+    TopicDataTypeMock::compute_key_hash(key, 20, 20, false, md5, &handle);
+    ASSERT_EQ(0, memcmp(reference.digest, static_cast<const fastrtps::rtps::octet*>(handle.value), 16));
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
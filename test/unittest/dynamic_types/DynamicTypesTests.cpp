@@ -14,6 +14,7 @@
 
 #include <fastrtps/types/TypesBase.h>
 #include <gtest/gtest.h>
+#include <fastcdr/Cdr.h>
 #include <fastrtps/types/DynamicTypeBuilderFactory.h>
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
@@ -22,12 +23,14 @@
 #include <fastrtps/types/MemberDescriptor.h>
 #include <fastrtps/types/DynamicType.h>
 #include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/FlatDynamicPubSubType.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/types/TypeObjectFactory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <dynamic-types/DynamicDataSerializationPlan.hpp>
 #include "idl/BasicPubSubTypes.h"
 #include "idl/BasicTypeObject.h"
 #include <tinyxml2.h>
@@ -5072,6 +5075,497 @@ TEST(TypeIdentifierTests, MinimalTypeIdentifierComparision)
     ASSERT_FALSE(unionUnionStruct1 == unionUnion1);
 }
 
+TEST_F(DynamicTypesTests, FlatDynamicData_unit_tests)
+{
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr int32_builder = factory->create_int32_builder();
+        DynamicTypeBuilder_ptr int64_builder = factory->create_int64_builder();
+        DynamicTypeBuilder_ptr string_builder = factory->create_string_builder(10);
+
+        // Child structure with an int32 and a bounded string
+        DynamicTypeBuilder_ptr child_builder = factory->create_struct_builder();
+        ASSERT_TRUE(child_builder->add_member(0, "int32", int32_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(child_builder->add_member(1, "string", string_builder->build()) == ReturnCode_t::RETCODE_OK);
+        auto child_type = child_builder->build();
+
+        std::vector<uint32_t> lengths = { 4 };
+        DynamicTypeBuilder_ptr array_builder = factory->create_array_builder(int32_builder.get(), lengths);
+
+        DynamicTypeBuilder_ptr parent_builder = factory->create_struct_builder();
+        ASSERT_TRUE(parent_builder->add_member(0, "child", child_type) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(parent_builder->add_member(1, "int64", int64_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(parent_builder->add_member(2, "array", array_builder->build()) == ReturnCode_t::RETCODE_OK);
+        auto parent_type = parent_builder->build();
+
+        FlatDynamicData* data = DynamicDataFactory::get_instance()->create_flat_data(parent_type);
+        ASSERT_TRUE(data != nullptr);
+        ASSERT_EQ(data->get_item_count(), 3u);
+        ASSERT_EQ(data->get_member_id_by_name("int64"), 1u);
+
+        // Type checking follows DynamicData
+        ASSERT_FALSE(data->set_int32_value(10, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(data->set_int64_value(10, 5) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->set_int64_value(234, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(data->get_int64_value(1), 234);
+
+        FlatDynamicData* child = data->loan_value(0);
+        ASSERT_TRUE(child != nullptr);
+        ASSERT_TRUE(data->loan_value(0) == nullptr);
+        ASSERT_TRUE(child->set_int32_value(-5, 0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(child->set_string_value("longer than the bound", 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(child->set_string_value("flat", 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(child->get_string_value(1), "flat");
+        ASSERT_TRUE(data->return_loaned_value(child) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(data->return_loaned_value(child) == ReturnCode_t::RETCODE_OK);
+
+        FlatDynamicData* array = data->loan_value(2);
+        ASSERT_TRUE(array != nullptr);
+        ASSERT_EQ(array->get_item_count(), 4u);
+        ASSERT_TRUE(array->set_int32_value(7, 3) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(array->set_int32_value(7, 4) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->return_loaned_value(array) == ReturnCode_t::RETCODE_OK);
+
+        // Copies
+        FlatDynamicData* copy = DynamicDataFactory::get_instance()->create_flat_copy(data);
+        ASSERT_TRUE(copy != nullptr);
+        ASSERT_TRUE(copy->equals(data));
+        child = copy->loan_value(0);
+        ASSERT_TRUE(child->set_string_value("other", 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->return_loaned_value(child) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(copy->equals(data));
+        ASSERT_TRUE(copy->copy_from(data) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->equals(data));
+
+        // Round trip through DynamicData
+        DynamicData* dynamic = DynamicDataFactory::get_instance()->create_data(parent_type);
+        ASSERT_TRUE(data->copy_to(dynamic) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(dynamic->get_int64_value(1), 234);
+        ASSERT_TRUE(copy->clear_all_values() == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(copy->equals(data));
+        ASSERT_TRUE(copy->copy_from(dynamic) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->equals(data));
+
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(dynamic) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(copy) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(data) == ReturnCode_t::RETCODE_OK);
+
+        // Default values
+        DynamicTypeBuilder_ptr bool_builder = factory->create_bool_builder();
+        DynamicTypeBuilder_ptr default_builder = factory->create_struct_builder();
+        ASSERT_TRUE(default_builder->add_member(0, "false", bool_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(default_builder->add_member(1, "true", bool_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(default_builder->add_member(2, "one", bool_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(default_builder->add_member(3, "int32", int32_builder->build()) == ReturnCode_t::RETCODE_OK);
+        default_builder->apply_annotation_to_member(0, ANNOTATION_DEFAULT_ID, "value", "false");
+        default_builder->apply_annotation_to_member(1, ANNOTATION_DEFAULT_ID, "value", "true");
+        default_builder->apply_annotation_to_member(2, ANNOTATION_DEFAULT_ID, "value", "1");
+        default_builder->apply_annotation_to_member(3, ANNOTATION_DEFAULT_ID, "value", "-3");
+        data = DynamicDataFactory::get_instance()->create_flat_data(default_builder->build());
+        ASSERT_TRUE(data != nullptr);
+        bool bool_value = true;
+        ASSERT_TRUE(data->get_bool_value(bool_value, 0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(bool_value);
+        ASSERT_TRUE(data->get_bool_value(bool_value, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(bool_value);
+        bool_value = false;
+        ASSERT_TRUE(data->get_bool_value(bool_value, 2) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(bool_value);
+        ASSERT_EQ(data->get_int32_value(3), -3);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(data) == ReturnCode_t::RETCODE_OK);
+
+        // Maps cannot be stored flat
+        DynamicTypeBuilder_ptr map_builder = factory->create_map_builder(int32_builder.get(), int32_builder.get(), 2);
+        DynamicTypeBuilder_ptr map_struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(map_struct_builder->add_member(0, "map", map_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->create_flat_data(map_struct_builder->build()) == nullptr);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::get_instance()->is_empty());
+    ASSERT_TRUE(DynamicDataFactory::get_instance()->is_empty());
+}
+
+TEST_F(DynamicTypesTests, FlatDynamicData_sequences)
+{
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr int32_builder = factory->create_int32_builder();
+        DynamicTypeBuilder_ptr string_builder = factory->create_string_builder();
+
+        // Bounded sequences are stored inline, unbounded ones out of line
+        DynamicTypeBuilder_ptr bounded_builder = factory->create_sequence_builder(int32_builder.get(), 2);
+        DynamicTypeBuilder_ptr unbounded_builder = factory->create_sequence_builder(string_builder.get(),
+                        BOUND_UNLIMITED);
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "bounded", bounded_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(1, "unbounded",
+                unbounded_builder->build()) == ReturnCode_t::RETCODE_OK);
+        auto struct_type = struct_builder->build();
+
+        FlatDynamicData* data = DynamicDataFactory::get_instance()->create_flat_data(struct_type);
+        ASSERT_TRUE(data != nullptr);
+
+        MemberId id = MEMBER_ID_INVALID;
+        FlatDynamicData* bounded = data->loan_value(0);
+        ASSERT_TRUE(bounded != nullptr);
+        ASSERT_EQ(bounded->get_item_count(), 0u);
+        ASSERT_FALSE(bounded->set_int32_value(1, 0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(bounded->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(id, 0u);
+        ASSERT_TRUE(bounded->set_int32_value(1, id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(bounded->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(bounded->set_int32_value(2, id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(bounded->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(bounded->get_item_count(), 2u);
+        ASSERT_TRUE(bounded->remove_sequence_data(0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(bounded->get_item_count(), 1u);
+        ASSERT_EQ(bounded->get_int32_value(0), 2);
+        ASSERT_TRUE(data->return_loaned_value(bounded) == ReturnCode_t::RETCODE_OK);
+
+        // Growing past the capacity keeps the elements
+        FlatDynamicData* unbounded = data->loan_value(1);
+        ASSERT_TRUE(unbounded != nullptr);
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            ASSERT_TRUE(unbounded->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+            ASSERT_EQ(id, i);
+            ASSERT_TRUE(unbounded->set_string_value(std::to_string(i), id) == ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_EQ(unbounded->get_item_count(), 20u);
+        ASSERT_EQ(unbounded->get_string_value(19), "19");
+        ASSERT_TRUE(unbounded->remove_sequence_data(0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(unbounded->get_string_value(0), "1");
+        ASSERT_EQ(unbounded->get_item_count(), 19u);
+        ASSERT_TRUE(data->return_loaned_value(unbounded) == ReturnCode_t::RETCODE_OK);
+
+        // Copies
+        FlatDynamicData* copy = DynamicDataFactory::get_instance()->create_flat_copy(data);
+        ASSERT_TRUE(copy != nullptr);
+        ASSERT_TRUE(copy->equals(data));
+        unbounded = copy->loan_value(1);
+        ASSERT_TRUE(unbounded->set_string_value("other", 18) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->return_loaned_value(unbounded) == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(copy->equals(data));
+        ASSERT_TRUE(copy->copy_from(data) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->equals(data));
+
+        // Round trip through DynamicData
+        DynamicData* dynamic = DynamicDataFactory::get_instance()->create_data(struct_type);
+        ASSERT_TRUE(data->copy_to(dynamic) == ReturnCode_t::RETCODE_OK);
+        DynamicData* dynamic_unbounded = dynamic->loan_value(1);
+        ASSERT_EQ(dynamic_unbounded->get_item_count(), 19u);
+        ASSERT_EQ(dynamic_unbounded->get_string_value(18), "19");
+        ASSERT_TRUE(dynamic->return_loaned_value(dynamic_unbounded) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->clear_all_values() == ReturnCode_t::RETCODE_OK);
+        ASSERT_FALSE(copy->equals(data));
+        ASSERT_TRUE(copy->copy_from(dynamic) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(copy->equals(data));
+
+        // Elements cannot be added or removed while one of them is loaned
+        unbounded = copy->loan_value(1);
+        FlatDynamicData* element = unbounded->loan_value(0);
+        ASSERT_TRUE(element != nullptr);
+        ASSERT_EQ(element->get_string_value(MEMBER_ID_INVALID), "1");
+        ASSERT_TRUE(unbounded->clear_data() == ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+        ASSERT_TRUE(unbounded->return_loaned_value(element) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(unbounded->clear_data() == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(unbounded->get_item_count(), 0u);
+        ASSERT_TRUE(unbounded->loan_value(0) == nullptr);
+        ASSERT_TRUE(copy->return_loaned_value(unbounded) == ReturnCode_t::RETCODE_OK);
+
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(dynamic) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(copy) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(data) == ReturnCode_t::RETCODE_OK);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::get_instance()->is_empty());
+    ASSERT_TRUE(DynamicDataFactory::get_instance()->is_empty());
+}
+
+TEST_F(DynamicTypesTests, FlatDynamicData_serialization)
+{
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr int16_builder = factory->create_int16_builder();
+        DynamicTypeBuilder_ptr int32_builder = factory->create_int32_builder();
+        DynamicTypeBuilder_ptr string_builder = factory->create_string_builder();
+
+        DynamicTypeBuilder_ptr child_builder = factory->create_struct_builder();
+        ASSERT_TRUE(child_builder->add_member(0, "int32", int32_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(child_builder->add_member(1, "string", string_builder->build()) == ReturnCode_t::RETCODE_OK);
+
+        std::vector<uint32_t> lengths = { 3 };
+        DynamicTypeBuilder_ptr array_builder = factory->create_array_builder(int16_builder.get(), lengths);
+        DynamicTypeBuilder_ptr bounded_builder = factory->create_sequence_builder(int32_builder.get(), 4);
+        DynamicTypeBuilder_ptr unbounded_builder = factory->create_sequence_builder(child_builder.get(),
+                        BOUND_UNLIMITED);
+
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "string", string_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(1, "array", array_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(2, "bounded", bounded_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(3, "unbounded",
+                unbounded_builder->build()) == ReturnCode_t::RETCODE_OK);
+        auto struct_type = struct_builder->build();
+
+        FlatDynamicPubSubType flat_pubsub(struct_type);
+        DynamicPubSubType pubsub(struct_type);
+
+        FlatDynamicData* data = static_cast<FlatDynamicData*>(flat_pubsub.createData());
+        ASSERT_TRUE(data != nullptr);
+        ASSERT_TRUE(data->set_string_value("flat", 0) == ReturnCode_t::RETCODE_OK);
+        FlatDynamicData* array = data->loan_value(1);
+        ASSERT_TRUE(array->set_int16_value(-2, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->return_loaned_value(array) == ReturnCode_t::RETCODE_OK);
+        MemberId id = MEMBER_ID_INVALID;
+        FlatDynamicData* bounded = data->loan_value(2);
+        for (int32_t i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(bounded->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(bounded->set_int32_value(i * 10, id) == ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_TRUE(data->return_loaned_value(bounded) == ReturnCode_t::RETCODE_OK);
+        FlatDynamicData* unbounded = data->loan_value(3);
+        for (int32_t i = 0; i < 5; ++i)
+        {
+            ASSERT_TRUE(unbounded->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+            FlatDynamicData* child = unbounded->loan_value(id);
+            ASSERT_TRUE(child->set_int32_value(i, 0) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(child->set_string_value(std::to_string(i), 1) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(unbounded->return_loaned_value(child) == ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_TRUE(data->return_loaned_value(unbounded) == ReturnCode_t::RETCODE_OK);
+
+        // Flat round trip
+        uint32_t payloadSize = static_cast<uint32_t>(flat_pubsub.getSerializedSizeProvider(data)());
+        SerializedPayload_t payload(payloadSize);
+        ASSERT_TRUE(flat_pubsub.serialize(data, &payload));
+        ASSERT_TRUE(payload.length == payloadSize);
+        FlatDynamicData* data2 = static_cast<FlatDynamicData*>(flat_pubsub.createData());
+        ASSERT_TRUE(flat_pubsub.deserialize(&payload, data2));
+        ASSERT_TRUE(data2->equals(data));
+
+        // The wire format is the one of DynamicData
+        DynamicData* dynamic = DynamicDataFactory::get_instance()->create_data(struct_type);
+        ASSERT_TRUE(pubsub.deserialize(&payload, dynamic));
+        FlatDynamicData* data3 = static_cast<FlatDynamicData*>(flat_pubsub.createData());
+        ASSERT_TRUE(data3->copy_from(dynamic) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data3->equals(data));
+
+        SerializedPayload_t dynamic_payload(static_cast<uint32_t>(pubsub.getSerializedSizeProvider(dynamic)()));
+        ASSERT_TRUE(pubsub.serialize(dynamic, &dynamic_payload));
+        ASSERT_EQ(dynamic_payload.length, payload.length);
+        ASSERT_EQ(0, memcmp(dynamic_payload.data, payload.data, payload.length));
+        ASSERT_TRUE(data2->clear_all_values() == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(flat_pubsub.deserialize(&dynamic_payload, data2));
+        ASSERT_TRUE(data2->equals(data));
+
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(dynamic) == ReturnCode_t::RETCODE_OK);
+        flat_pubsub.deleteData(data3);
+        flat_pubsub.deleteData(data2);
+        flat_pubsub.deleteData(data);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::get_instance()->is_empty());
+    ASSERT_TRUE(DynamicDataFactory::get_instance()->is_empty());
+}
+
+TEST_F(DynamicTypesTests, FlatDynamicData_layout_lifetime)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr int32_builder = factory->create_int32_builder();
+    std::weak_ptr<types::DynamicType> released_type;
+    std::weak_ptr<types::DynamicType> cached_type;
+
+    {
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "int32", int32_builder->build()) == ReturnCode_t::RETCODE_OK);
+        DynamicType_ptr type = struct_builder->build();
+        released_type = type;
+
+        FlatDynamicData* data = DynamicDataFactory::get_instance()->create_flat_data(type);
+        ASSERT_TRUE(data != nullptr);
+        type.reset();
+
+        // Samples keep the layout, and so the type
+        ASSERT_FALSE(released_type.expired());
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(data) == ReturnCode_t::RETCODE_OK);
+    }
+
+    {
+        // Caching a new layout releases the ones of the types no longer used
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "int32", int32_builder->build()) == ReturnCode_t::RETCODE_OK);
+        DynamicType_ptr type = struct_builder->build();
+        cached_type = type;
+
+        FlatDynamicData* data = DynamicDataFactory::get_instance()->create_flat_data(type);
+        ASSERT_TRUE(data != nullptr);
+        ASSERT_TRUE(released_type.expired());
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_flat_data(data) == ReturnCode_t::RETCODE_OK);
+    }
+
+    // The remaining layouts are released along with the factory
+    ASSERT_FALSE(cached_type.expired());
+    int32_builder.reset();
+    DynamicTypeBuilderFactory::delete_instance();
+    ASSERT_TRUE(cached_type.expired());
+}
+
+TEST_F(DynamicTypesTests, DynamicPubSubType_serialization_plan_unit_tests)
+{
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr byte_builder = factory->create_byte_builder();
+        DynamicTypeBuilder_ptr int64_builder = factory->create_int64_builder();
+        DynamicTypeBuilder_ptr int32_builder = factory->create_int32_builder();
+        DynamicTypeBuilder_ptr string_builder = factory->create_string_builder(20);
+        DynamicTypeBuilder_ptr seq_builder = factory->create_sequence_builder(int32_builder.get(), 10);
+        std::vector<uint32_t> lengths = { 3 };
+        DynamicTypeBuilder_ptr array_builder = factory->create_array_builder(string_builder.get(), lengths);
+
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "byte", byte_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(1, "int64", int64_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(2, "string", string_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(3, "sequence", seq_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(4, "array", array_builder->build()) == ReturnCode_t::RETCODE_OK);
+
+        // Samples of the registered type are processed with its compiled plan, samples of an equal type are not
+        DynamicType_ptr plan_type = struct_builder->build();
+        DynamicType_ptr other_type = struct_builder->build();
+        DynamicPubSubType pubsubType(plan_type);
+
+        DynamicData* plan_data = DynamicDataFactory::get_instance()->create_data(plan_type);
+        DynamicData* other_data = DynamicDataFactory::get_instance()->create_data(other_type);
+        for (DynamicData* data : { plan_data, other_data })
+        {
+            ASSERT_TRUE(data->set_byte_value(7, 0) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(data->set_int64_value(-3, 1) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(data->set_string_value("plan", 2) == ReturnCode_t::RETCODE_OK);
+
+            MemberId id;
+            DynamicData* seq_data = data->loan_value(3);
+            ASSERT_TRUE(seq_data->insert_int32_value(5, id) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(seq_data->insert_int32_value(6, id) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(data->return_loaned_value(seq_data) == ReturnCode_t::RETCODE_OK);
+
+            // Only one of the elements of the array is set
+            DynamicData* array_data = data->loan_value(4);
+            ASSERT_TRUE(array_data->set_string_value("second", 1) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(data->return_loaned_value(array_data) == ReturnCode_t::RETCODE_OK);
+        }
+
+        uint32_t plan_size = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(plan_data)());
+        SerializedPayload_t plan_payload(plan_size);
+        ASSERT_TRUE(pubsubType.serialize(plan_data, &plan_payload));
+        ASSERT_LE(plan_payload.length, plan_size);
+
+        uint32_t other_size = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(other_data)());
+        SerializedPayload_t other_payload(other_size);
+        ASSERT_TRUE(pubsubType.serialize(other_data, &other_payload));
+
+        // Both paths produce the same stream
+        ASSERT_EQ(plan_payload.length, other_payload.length);
+        ASSERT_EQ(0, memcmp(plan_payload.data, other_payload.data, plan_payload.length));
+
+        DynamicData* result = DynamicDataFactory::get_instance()->create_data(plan_type);
+        ASSERT_TRUE(pubsubType.deserialize(&plan_payload, result));
+        ASSERT_TRUE(result->equals(plan_data));
+
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(result) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(other_data) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(plan_data) == ReturnCode_t::RETCODE_OK);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::get_instance()->is_empty());
+    ASSERT_TRUE(DynamicDataFactory::get_instance()->is_empty());
+}
+
+/*
+ * Arrays and sequences of primitives are processed at once by the plan, swapping their bytes when the stream is not in
+ * native endianness. The plan writes the same stream as DynamicData, and reads it back.
+ */
+TEST_F(DynamicTypesTests, DynamicDataSerializationPlan_non_native_endianness_unit_tests)
+{
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr byte_builder = factory->create_byte_builder();
+        DynamicTypeBuilder_ptr uint16_builder = factory->create_uint16_builder();
+        DynamicTypeBuilder_ptr int64_builder = factory->create_int64_builder();
+        DynamicTypeBuilder_ptr float32_builder = factory->create_float32_builder();
+        // Longer than the chunks in which sequences are read
+        DynamicTypeBuilder_ptr short_seq_builder = factory->create_sequence_builder(uint16_builder.get(), 3000);
+        DynamicTypeBuilder_ptr long_seq_builder = factory->create_sequence_builder(int64_builder.get(), 10);
+        std::vector<uint32_t> lengths = { 4 };
+        DynamicTypeBuilder_ptr array_builder = factory->create_array_builder(float32_builder.get(), lengths);
+
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "byte", byte_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(1, "short_sequence",
+                short_seq_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(2, "long_sequence",
+                long_seq_builder->build()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(3, "array", array_builder->build()) == ReturnCode_t::RETCODE_OK);
+        DynamicType_ptr type = struct_builder->build();
+
+        std::shared_ptr<const DynamicDataSerializationPlan> plan = DynamicDataSerializationPlan::compile(type);
+        if (!plan)
+        {
+            GTEST_SKIP() << "Plans are not compiled when DynamicData checks its types";
+        }
+
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(type);
+        ASSERT_TRUE(data->set_byte_value(7, 0) == ReturnCode_t::RETCODE_OK);
+
+        MemberId id;
+        DynamicData* short_seq_data = data->loan_value(1);
+        for (uint16_t i = 0; i < 2500; ++i)
+        {
+            ASSERT_TRUE(short_seq_data->insert_uint16_value(static_cast<uint16_t>(i * 257u), id) ==
+                    ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_TRUE(data->return_loaned_value(short_seq_data) == ReturnCode_t::RETCODE_OK);
+
+        DynamicData* long_seq_data = data->loan_value(2);
+        ASSERT_TRUE(long_seq_data->insert_int64_value(-0x0102030405060708, id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(long_seq_data->insert_int64_value(0x1122334455667788, id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->return_loaned_value(long_seq_data) == ReturnCode_t::RETCODE_OK);
+
+        DynamicData* array_data = data->loan_value(3);
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(array_data->set_float32_value(1.5f * i, i) == ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_TRUE(data->return_loaned_value(array_data) == ReturnCode_t::RETCODE_OK);
+
+        // Write the sample with the plan in the endianness which is not the native one
+        eprosima::fastcdr::Cdr::Endianness swapped =
+                eprosima::fastcdr::Cdr::BIG_ENDIANNESS == eprosima::fastcdr::Cdr::DEFAULT_ENDIAN ?
+                eprosima::fastcdr::Cdr::LITTLE_ENDIANNESS : eprosima::fastcdr::Cdr::BIG_ENDIANNESS;
+        SerializedPayload_t payload(static_cast<uint32_t>(plan->serialized_size(data) + 4));
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.max_size);
+        eprosima::fastcdr::Cdr ser(fastbuffer, swapped, eprosima::fastcdr::CdrVersion::XCDRv1);
+        ser.set_encoding_flag(eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR);
+        ser.serialize_encapsulation();
+        plan->serialize(data, ser);
+        payload.length = static_cast<uint32_t>(ser.get_serialized_data_length());
+
+        // DynamicData reads the same sample from the stream, as the plan does
+        DynamicPubSubType pubsubType(type);
+        DynamicType_ptr other_type = struct_builder->build();
+        DynamicData* other_result = DynamicDataFactory::get_instance()->create_data(other_type);
+        ASSERT_TRUE(pubsubType.deserialize(&payload, other_result));
+        ASSERT_TRUE(other_result->equals(data));
+
+        DynamicData* result = DynamicDataFactory::get_instance()->create_data(type);
+        ASSERT_TRUE(pubsubType.deserialize(&payload, result));
+        ASSERT_TRUE(result->equals(data));
+
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(other_result) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(result) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(data) == ReturnCode_t::RETCODE_OK);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::get_instance()->is_empty());
+    ASSERT_TRUE(DynamicDataFactory::get_instance()->is_empty());
+}
+
 int main(
         int argc,
         char** argv)
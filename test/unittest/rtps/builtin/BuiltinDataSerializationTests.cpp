@@ -20,6 +20,7 @@
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
 #include <fastrtps/rtps/builtin/data/WriterProxyData.h>
 
+#include <fastdds/core/policy/ParameterList.hpp>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
 #include <rtps/network/NetworkFactory.h>
 
@@ -1302,6 +1303,119 @@ TEST(BuiltinDataSerializationTests, contentfilterproperty_max_parameter_check)
     }
 }
 
+/*!
+ * This test checks that the hash computed by the parameter list pre-scan only depends on the contents of the
+ * announcement, and that it is kept by the proxy data it is stored on.
+ */
+TEST(BuiltinDataSerializationTests, announcement_hash)
+{
+    WriterProxyData in(max_unicast_locators, max_multicast_locators);
+    in.topicName("TEST");
+    in.typeName("TestType");
+
+    uint32_t msg_size = in.get_serialized_size(true);
+    CDRMessage_t msg_1(msg_size);
+    CDRMessage_t msg_2(msg_size);
+    ASSERT_TRUE(in.writeToCDRMessage(&msg_1, true));
+    ASSERT_TRUE(in.writeToCDRMessage(&msg_2, true));
+    msg_1.pos = 0;
+    msg_2.pos = 0;
+
+    // Same contents should give the same hash, and the pre-scan should not modify the message
+    uint64_t hash_1 = 0;
+    uint64_t hash_2 = 0;
+    ASSERT_TRUE(fastdds::dds::ParameterList::hash_parameter_list(msg_1, true, hash_1));
+    ASSERT_TRUE(fastdds::dds::ParameterList::hash_parameter_list(msg_2, true, hash_2));
+    EXPECT_EQ(hash_1, hash_2);
+    EXPECT_EQ(0u, msg_1.pos);
+
+    // Reading the announcement does not hash it again, the hash of the pre-scan is kept on the proxy data
+    WriterProxyData out(max_unicast_locators, max_multicast_locators);
+    ASSERT_TRUE(out.readFromCDRMessage(&msg_1, network, true));
+    EXPECT_EQ(0u, out.announcement_hash());
+    out.announcement_hash(hash_1);
+    EXPECT_EQ(hash_1, out.announcement_hash());
+    WriterProxyData copy(out);
+    EXPECT_EQ(hash_1, copy.announcement_hash());
+    out.clear();
+    EXPECT_EQ(0u, out.announcement_hash());
+
+    // Any change on the contents should change the hash
+    in.topicName("TEST2");
+    CDRMessage_t msg_3(in.get_serialized_size(true));
+    ASSERT_TRUE(in.writeToCDRMessage(&msg_3, true));
+    msg_3.pos = 0;
+    uint64_t hash_3 = 0;
+    ASSERT_TRUE(fastdds::dds::ParameterList::hash_parameter_list(msg_3, true, hash_3));
+    EXPECT_NE(hash_1, hash_3);
+
+    // A list without PID_SENTINEL is not well formed
+    msg_3.length -= 4;
+    EXPECT_FALSE(fastdds::dds::ParameterList::hash_parameter_list(msg_3, true, hash_3));
+}
+
+/*!
+ * This test checks that compact announcements carry the hash of the full announcement, and that they are not
+ * accepted as full participant data.
+ */
+TEST(BuiltinDataSerializationTests, compact_announcement)
+{
+    ParticipantProxyData in(RTPSParticipantAllocationAttributes{});
+    in.m_guid = GUID_t(GuidPrefix_t(), c_EntityId_RTPSParticipant);
+    in.m_guid.guidPrefix.value[0] = 1;
+    in.m_VendorId = c_VendorId_eProsima;
+    in.m_participantName = "compact_test";
+
+    // Full announcement
+    CDRMessage_t full_msg(in.get_serialized_size(true));
+    ASSERT_TRUE(in.writeToCDRMessage(&full_msg, true));
+    full_msg.pos = 0;
+    uint64_t full_hash = 0;
+    ASSERT_TRUE(fastdds::dds::ParameterList::hash_parameter_list(full_msg, true, full_hash));
+    uint64_t compact_hash = 0;
+    EXPECT_FALSE(ParticipantProxyData::readCompactAnnouncementHash(full_msg, true, compact_hash));
+
+    // Compact announcement
+    uint32_t compact_size = in.get_compact_serialized_size(true);
+    EXPECT_LT(compact_size, in.get_serialized_size(true));
+    CDRMessage_t compact_msg(compact_size);
+    ASSERT_TRUE(in.writeCompactToCDRMessage(&compact_msg, true, full_hash));
+    EXPECT_EQ(compact_size, compact_msg.length);
+    compact_msg.pos = 0;
+    ASSERT_TRUE(ParticipantProxyData::readCompactAnnouncementHash(compact_msg, true, compact_hash));
+    EXPECT_EQ(full_hash, compact_hash);
+
+    // Compact announcements cannot be read as full participant data
+    ParticipantProxyData out(RTPSParticipantAllocationAttributes{});
+    EXPECT_FALSE(out.readFromCDRMessage(&compact_msg, true, network, true));
+
+    // Full announcements are read as participant data
+    full_msg.pos = 0;
+    ASSERT_TRUE(out.readFromCDRMessage(&full_msg, true, network, true));
+    EXPECT_FALSE(out.supports_compact_announcements());
+
+    // Support for compact announcements is announced on the full announcement
+    in.set_compact_announcements_support();
+    in.set_compact_announcements_support();
+    EXPECT_EQ(1u, in.m_properties.size());
+    CDRMessage_t support_msg(in.get_serialized_size(true));
+    ASSERT_TRUE(in.writeToCDRMessage(&support_msg, true));
+    support_msg.pos = 0;
+    ASSERT_TRUE(out.readFromCDRMessage(&support_msg, true, network, true));
+    EXPECT_TRUE(out.supports_compact_announcements());
+
+    // PID_ANNOUNCEMENT_HASH is vendor specific, so it is not taken into account on other vendors
+    in.m_VendorId = c_VendorId_Unknown;
+    in.m_VendorId[0] = 0x01;
+    CDRMessage_t other_vendor_msg(compact_size);
+    ASSERT_TRUE(in.writeCompactToCDRMessage(&other_vendor_msg, true, full_hash));
+    other_vendor_msg.pos = 0;
+    EXPECT_FALSE(ParticipantProxyData::readCompactAnnouncementHash(other_vendor_msg, true, compact_hash));
+    other_vendor_msg.pos = 0;
+    EXPECT_TRUE(out.readFromCDRMessage(&other_vendor_msg, true, network, true));
+    EXPECT_FALSE(out.supports_compact_announcements());
+}
+
 TEST(BuiltinDataSerializationTests, null_checks)
 {
     {
@@ -101,6 +101,17 @@ TEST(FlowControllerFactory, register_flow_controllers)
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_reserv_flow);
 
+    // AsyncFlowController with earliest deadline first scheduler
+    const char* async_edf = "AsyncFlowControllerEdf";
+    flow_controller_descr.name = async_edf;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_edf, writer_attributes);
+    FlowControllerImpl<FlowControllerAsyncPublishMode,
+            FlowControllerEarliestDeadlineFirstSchedule>* async_edf_flow = dynamic_cast<FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerEarliestDeadlineFirstSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_edf_flow);
+
     flow_controller_descr.max_bytes_per_period = 1;
     flow_controller_descr.period_ms = 1;
 
@@ -144,6 +155,16 @@ TEST(FlowControllerFactory, register_flow_controllers)
             FlowControllerPriorityWithReservationSchedule>* async_limited_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_limited_reserv_flow);
+
+    const char* async_limited_edf = "AsyncLimitedFlowControllerEdf";
+    flow_controller_descr.name = async_limited_edf;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_limited_edf, writer_attributes);
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+            FlowControllerEarliestDeadlineFirstSchedule>* async_limited_edf_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerEarliestDeadlineFirstSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_limited_edf_flow);
 }
 
 int main(
@@ -403,3 +403,397 @@ TYPED_TEST(FlowControllerPublishModes, async_publish_mode)
 
     async.unregister_writer(&writer1);
 }
+
+TYPED_TEST(FlowControllerPublishModes, async_publish_mode_several_sender_threads)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.sender_threads = 2;
+    FlowControllerImpl<FlowControllerAsyncPublishMode, TypeParam> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    eprosima::fastrtps::rtps::RTPSWriter writer3;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Delivery of the first sample of writer1 blocks until released.
+    std::mutex blocked_mutex;
+    std::condition_variable blocked_cv;
+    bool blocked = false;
+    bool released = false;
+    auto blocking_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup& group,
+        eprosima::fastrtps::rtps::LocatorSelectorSender& locator_selector,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(blocked_mutex);
+                    blocked = true;
+                    blocked_cv.notify_one();
+                    blocked_cv.wait(lock, [&]()
+                            {
+                                return released;
+                            });
+                }
+                send_functor(change, group, locator_selector, max_blocking_time);
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_1;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_1;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+
+    auto& call_change_writer1_1 = EXPECT_CALL(writer1,
+                    deliver_sample_nts(&change_writer1_1, _, Ref(writer1.async_locator_selector_), _)).
+                    WillOnce(DoAll(blocking_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1_2, _, Ref(writer1.async_locator_selector_), _)).
+            After(call_change_writer1_1).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    auto& call_change_writer2_1 = EXPECT_CALL(writer2,
+                    deliver_sample_nts(&change_writer2_1, _, Ref(writer2.async_locator_selector_), _)).
+                    WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2,
+            deliver_sample_nts(&change_writer2_2, _, Ref(writer2.async_locator_selector_), _)).
+            After(call_change_writer2_1).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer3,
+            deliver_sample_nts(&change_writer3_1, _, Ref(writer3.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    {
+        std::unique_lock<std::mutex> lock(blocked_mutex);
+        blocked_cv.wait(lock, [&]()
+                {
+                    return blocked;
+                });
+    }
+
+    // The other thread sends the samples of the rest of writers meanwhile, but not the ones of writer1.
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer2.getMutex().unlock();
+    writer3.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer3.getMutex().unlock();
+    this->wait_changes_was_delivered(3);
+    EXPECT_TRUE(change_writer1_2.writer_info.is_linked.load());
+
+    {
+        std::unique_lock<std::mutex> lock(blocked_mutex);
+        released = true;
+        blocked_cv.notify_one();
+    }
+    this->wait_changes_was_delivered(5);
+    EXPECT_EQ(&change_writer1_1, this->changes_delivered[3]);
+    EXPECT_EQ(&change_writer1_2, this->changes_delivered[4]);
+    this->changes_delivered.clear();
+
+    // Changes are removed from the queue before their writer is released.
+    writer1.getMutex().lock();
+    EXPECT_FALSE(change_writer1_2.writer_info.is_linked.load());
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    EXPECT_FALSE(change_writer2_2.writer_info.is_linked.load());
+    writer2.getMutex().unlock();
+    writer3.getMutex().lock();
+    EXPECT_FALSE(change_writer3_1.writer_info.is_linked.load());
+    writer3.getMutex().unlock();
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+}
+
+TYPED_TEST(FlowControllerPublishModes, async_publish_mode_concurrent_writers)
+{
+    constexpr size_t num_writers = 4;
+    constexpr size_t num_changes = 50;
+
+    FlowControllerDescriptor flow_controller_descr;
+    FlowControllerImpl<FlowControllerAsyncPublishMode, TypeParam> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    eprosima::fastrtps::rtps::RTPSWriter writers[num_writers];
+    std::vector<eprosima::fastrtps::rtps::CacheChange_t> changes[num_writers];
+    for (size_t w = 0; w < num_writers; ++w)
+    {
+        async.register_writer(&writers[w]);
+        EXPECT_CALL(writers[w], deliver_sample_nts(_, _, Ref(writers[w].async_locator_selector_), _)).
+                Times(num_changes).
+                WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+        changes[w] = std::vector<eprosima::fastrtps::rtps::CacheChange_t>(num_changes);
+        for (size_t c = 0; c < num_changes; ++c)
+        {
+            INIT_CACHE_CHANGE(changes[w][c], writers[w], c + 1);
+        }
+    }
+
+    // All writers add their samples at the same time.
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < num_writers; ++w)
+    {
+        threads.emplace_back([&, w]()
+                {
+                    for (auto& change : changes[w])
+                    {
+                        std::lock_guard<eprosima::fastrtps::RecursiveTimedMutex> lock(writers[w].getMutex());
+                        EXPECT_TRUE(async.add_new_sample(&writers[w], &change,
+                        std::chrono::steady_clock::now() + std::chrono::hours(24)));
+                    }
+                });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    this->wait_changes_was_delivered(num_writers * num_changes);
+
+    // The samples of each writer are sent in order.
+    eprosima::fastrtps::rtps::SequenceNumber_t last_sent[num_writers];
+    for (auto change : this->changes_delivered)
+    {
+        size_t w = 0;
+        while (writers[w].getGuid() != change->writerGUID)
+        {
+            ++w;
+        }
+        EXPECT_LT(last_sent[w], change->sequenceNumber);
+        last_sent[w] = change->sequenceNumber;
+    }
+    this->changes_delivered.clear();
+
+    for (size_t w = 0; w < num_writers; ++w)
+    {
+        writers[w].getMutex().lock();
+        writers[w].getMutex().unlock();
+        async.unregister_writer(&writers[w]);
+    }
+}
+
+struct FlowControllerAsyncPublishModeMock : FlowControllerAsyncPublishMode
+{
+    FlowControllerAsyncPublishModeMock(
+            eprosima::fastrtps::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerAsyncPublishMode(participant, descriptor)
+    {
+        group_mock = &group;
+    }
+
+    static eprosima::fastrtps::rtps::RTPSMessageGroup* group_mock;
+};
+eprosima::fastrtps::rtps::RTPSMessageGroup* FlowControllerAsyncPublishModeMock::group_mock = nullptr;
+
+TYPED_TEST(FlowControllerPublishModes, async_publish_mode_coalescing)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_coalescing_delay_us = 200000;
+    flow_controller_descr.max_coalescing_bytes = 250;
+    FlowControllerImpl<FlowControllerAsyncPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+
+    // Each delivery adds 100 bytes to the message.
+    uint32_t pending_bytes = 0;
+    uint32_t sent_bytes = 0;
+    size_t number_of_flushes = 0;
+    // The message is full when delivering this change, so the group sends it before adding the change.
+    eprosima::fastrtps::rtps::CacheChange_t* change_flushing_group = nullptr;
+    EXPECT_CALL(*FlowControllerAsyncPublishModeMock::group_mock, get_pending_bytes()).WillRepeatedly(
+        ReturnPointee(&pending_bytes));
+    EXPECT_CALL(*FlowControllerAsyncPublishModeMock::group_mock, get_current_bytes_processed()).WillRepeatedly(
+        [&]()
+        {
+            return sent_bytes + pending_bytes;
+        });
+    EXPECT_CALL(*FlowControllerAsyncPublishModeMock::group_mock, flush_and_reset()).WillRepeatedly([&]()
+            {
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    sent_bytes += pending_bytes;
+                    pending_bytes = 0;
+                    ++number_of_flushes;
+                }
+                this->number_changes_delivered_cv.notify_one();
+            });
+
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                    if (change == change_flushing_group)
+                    {
+                        sent_bytes += pending_bytes;
+                        pending_bytes = 0;
+                        ++number_of_flushes;
+                    }
+                    pending_bytes += 100;
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    auto wait_flushes = [&](
+        size_t flushes)
+            {
+                std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                this->number_changes_delivered_cv.wait(lock, [&]()
+                        {
+                            return flushes == number_of_flushes;
+                        });
+            };
+
+    auto number_of_flushes_now = [&]()
+            {
+                std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                return number_of_flushes;
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_3;
+    INIT_CACHE_CHANGE(change_writer1_3, writer1, 3);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_4;
+    INIT_CACHE_CHANGE(change_writer1_4, writer1, 4);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_5;
+    INIT_CACHE_CHANGE(change_writer1_5, writer1, 5);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_6;
+    INIT_CACHE_CHANGE(change_writer1_6, writer1, 6);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_7;
+    INIT_CACHE_CHANGE(change_writer1_7, writer1, 7);
+    change_flushing_group = &change_writer1_6;
+
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).Times(7).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    // Samples wait for later ones until the maximum number of bytes is reached.
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(1);
+    EXPECT_EQ(0u, number_of_flushes_now());
+
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(2);
+    EXPECT_EQ(0u, number_of_flushes_now());
+
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    wait_flushes(1);
+    EXPECT_EQ(3u, this->changes_delivered.size());
+
+    // A sample waits for later ones up to the maximum delay.
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(4);
+    wait_flushes(2);
+    EXPECT_LE(std::chrono::microseconds(flow_controller_descr.max_coalescing_delay_us),
+            std::chrono::steady_clock::now() - start);
+
+    // A message sent by the group itself restarts the delay for the next one.
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_5,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(5);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_6,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(6);
+    start = std::chrono::steady_clock::now();
+    wait_flushes(4);
+    EXPECT_LE(std::chrono::microseconds(flow_controller_descr.max_coalescing_delay_us) -
+            std::chrono::milliseconds(10), std::chrono::steady_clock::now() - start);
+
+    // Unregistering the writer of a waiting message sends it without waiting for the delay.
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_7,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(7);
+    start = std::chrono::steady_clock::now();
+    async.unregister_writer(&writer1);
+    EXPECT_EQ(5u, number_of_flushes_now());
+    EXPECT_GT(std::chrono::microseconds(flow_controller_descr.max_coalescing_delay_us),
+            std::chrono::steady_clock::now() - start);
+    this->changes_delivered.clear();
+}
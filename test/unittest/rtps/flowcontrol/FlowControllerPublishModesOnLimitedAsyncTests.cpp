@@ -624,3 +624,105 @@ TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode)
 
     async.unregister_writer(&writer1);
 }
+
+TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode_paced_per_destination)
+{
+    // Each destination may receive 10000 bytes every 100ms, at most 10000 bytes at once.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10000;
+    flow_controller_descr.period_ms = 100;
+    flow_controller_descr.max_burst_bytes = 10000;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    // Instantiate writers, each one sending to its own destination.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    eprosima::fastrtps::rtps::LocatorSelectorEntry entry1(1, 0);
+    eprosima::fastrtps::rtps::LocatorSelectorEntry entry2(1, 0);
+    eprosima::fastrtps::rtps::Locator_t locator;
+    locator.port = 7400;
+    entry1.unicast.push_back(locator);
+    locator.port = 7401;
+    entry2.unicast.push_back(locator);
+    for (auto selected : {std::make_pair(&writer1, &entry1), std::make_pair(&writer2, &entry2)})
+    {
+        eprosima::fastrtps::rtps::LocatorSelector& selector =
+                selected.first->async_locator_selector_.locator_selector;
+        selector.add_entry(selected.second);
+        selector.selection_start();
+        selected.second->state.unicast.push_back(0);
+        selector.select(0);
+    }
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+
+    // writer1 uses all the tokens of its destination on its first sample.
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_1;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    change_writer2_1.serializedPayload.length = 1000;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    change_writer2_2.serializedPayload.length = 1000;
+
+    EXPECT_CALL(writer1, deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2, deliver_sample_nts(_, _, Ref(writer2.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer2.getMutex().unlock();
+
+    // writer2 is not delayed by the destination of writer1.
+    this->wait_changes_was_delivered(4);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(4u, this->changes_delivered.size());
+    EXPECT_EQ(&change_writer1_1, this->changes_delivered[0]);
+    EXPECT_EQ(&change_writer1_2, this->changes_delivered[3]);
+    // Second sample of writer1 waits for its destination to be refilled.
+    EXPECT_LE(std::chrono::milliseconds(50), elapsed);
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+}
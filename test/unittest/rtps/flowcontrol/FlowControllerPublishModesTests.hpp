@@ -56,7 +56,8 @@ protected:
 using Schedulers = ::testing::Types<eprosima::fastdds::rtps::FlowControllerFifoSchedule,
                 eprosima::fastdds::rtps::FlowControllerRoundRobinSchedule,
                 eprosima::fastdds::rtps::FlowControllerHighPrioritySchedule,
-                eprosima::fastdds::rtps::FlowControllerPriorityWithReservationSchedule>;
+                eprosima::fastdds::rtps::FlowControllerPriorityWithReservationSchedule,
+                eprosima::fastdds::rtps::FlowControllerEarliestDeadlineFirstSchedule>;
 
 TYPED_TEST_SUITE(FlowControllerPublishModes, Schedulers, );
 
@@ -2543,6 +2543,203 @@ TEST_F(FlowControllerSchedulers, PriorityWithReservation)
     async.unregister_writer(&writer10);
 }
 
+TEST_F(FlowControllerSchedulers, EarliestDeadlineFirst)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 102000;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock,
+            FlowControllerEarliestDeadlineFirstSchedule> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::Property deadline_property;
+    deadline_property.name("fastdds.sfc.deadline");
+    eprosima::fastrtps::rtps::Property lifespan_property;
+    lifespan_property.name("fastdds.sfc.lifespan");
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    deadline_property.value("3000000");
+    writer1.m_att.endpoint.properties.properties().push_back(deadline_property);
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    deadline_property.value("1000000");
+    writer2.m_att.endpoint.properties.properties().push_back(deadline_property);
+    lifespan_property.value("5000000");
+    writer2.m_att.endpoint.properties.properties().push_back(lifespan_property);
+    // Without deadline.
+    eprosima::fastrtps::rtps::RTPSWriter writer3;
+    // Its samples expire before being sent.
+    eprosima::fastrtps::rtps::RTPSWriter writer4;
+    lifespan_property.value("1");
+    writer4.m_att.endpoint.properties.properties().push_back(lifespan_property);
+    // Its lifespan is shorter than its deadline.
+    eprosima::fastrtps::rtps::RTPSWriter writer5;
+    deadline_property.value("4000000");
+    writer5.m_att.endpoint.properties.properties().push_back(deadline_property);
+    lifespan_property.value("2000000");
+    writer5.m_att.endpoint.properties.properties().push_back(lifespan_property);
+    // Its samples miss their deadline.
+    eprosima::fastrtps::rtps::RTPSWriter writer6;
+    deadline_property.value("1");
+    writer6.m_att.endpoint.properties.properties().push_back(deadline_property);
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+    async.register_writer(&writer4);
+    async.register_writer(&writer5);
+    async.register_writer(&writer6);
+
+    eprosima::fastrtps::rtps::Time_t source_timestamp;
+    eprosima::fastrtps::rtps::Time_t::now(source_timestamp);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_2;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+    INIT_CACHE_CHANGE(change_writer3_2, writer3, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer4_1;
+    INIT_CACHE_CHANGE(change_writer4_1, writer4, 1);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer5_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer5_2;
+    INIT_CACHE_CHANGE(change_writer5_1, writer5, 1);
+    INIT_CACHE_CHANGE(change_writer5_2, writer5, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer6_1;
+    INIT_CACHE_CHANGE(change_writer6_1, writer6, 1);
+    for (eprosima::fastrtps::rtps::CacheChange_t* change : {&change_writer1_1, &change_writer1_2, &change_writer2_1,
+                                                            &change_writer2_2, &change_writer3_1, &change_writer3_2,
+                                                            &change_writer4_1, &change_writer5_1, &change_writer5_2,
+                                                            &change_writer6_1})
+    {
+        change->sourceTimestamp = source_timestamp;
+    }
+
+    // Samples are sent in order of deadline. Expired samples are discarded by their writer instead of sent.
+    {
+        this->current_bytes_processed = 100000;
+        this->allow_resetting = false;
+        EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+                get_current_bytes_processed()).WillRepeatedly(
+            ReturnPointee(&this->current_bytes_processed));
+        EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+                reset_current_bytes_processed()).WillRepeatedly([&]()
+                {
+                    if (this->allow_resetting)
+                    {
+                        this->current_bytes_processed = 0;
+                    }
+                });
+        auto& call_change_writer6_1 = EXPECT_CALL(writer6,
+                        deliver_sample_nts(&change_writer6_1, _, Ref(writer6.async_locator_selector_), _)).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer2_1 = EXPECT_CALL(writer2,
+                        deliver_sample_nts(&change_writer2_1, _, Ref(writer2.async_locator_selector_), _)).
+                        After(call_change_writer6_1).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer2_2 = EXPECT_CALL(writer2,
+                        deliver_sample_nts(&change_writer2_2, _, Ref(writer2.async_locator_selector_), _)).
+                        After(call_change_writer2_1).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer5_1 = EXPECT_CALL(writer5,
+                        deliver_sample_nts(&change_writer5_1, _, Ref(writer5.async_locator_selector_), _)).
+                        After(call_change_writer2_2).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer5_2 = EXPECT_CALL(writer5,
+                        deliver_sample_nts(&change_writer5_2, _, Ref(writer5.async_locator_selector_), _)).
+                        After(call_change_writer5_1).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer1_1 = EXPECT_CALL(writer1,
+                        deliver_sample_nts(&change_writer1_1, _, Ref(writer1.async_locator_selector_), _)).
+                        After(call_change_writer5_2).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer1_2 = EXPECT_CALL(writer1,
+                        deliver_sample_nts(&change_writer1_2, _, Ref(writer1.async_locator_selector_), _)).
+                        After(call_change_writer1_1).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        auto& call_change_writer3_1 = EXPECT_CALL(writer3,
+                        deliver_sample_nts(&change_writer3_1, _, Ref(writer3.async_locator_selector_), _)).
+                        After(call_change_writer1_2).
+                        WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        EXPECT_CALL(writer3,
+                deliver_sample_nts(&change_writer3_2, _, Ref(writer3.async_locator_selector_), _)).
+                After(call_change_writer3_1).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+        EXPECT_CALL(writer4, deliver_sample_nts(_, _, _, _)).Times(0);
+        EXPECT_CALL(writer4, discard_change_nts(&change_writer4_1)).Times(1);
+
+        writer1.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer1.getMutex().unlock();
+        writer3.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer3.getMutex().unlock();
+        writer4.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer4, &change_writer4_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer4.getMutex().unlock();
+        writer5.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer5, &change_writer5_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer5, &change_writer5_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer5.getMutex().unlock();
+        writer2.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer2.getMutex().unlock();
+        writer6.getMutex().lock();
+        ASSERT_TRUE(async.add_new_sample(&writer6, &change_writer6_1,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        writer6.getMutex().unlock();
+        this->allow_resetting = true;
+        this->wait_changes_was_delivered(9);
+        this->changes_delivered.clear();
+        this->current_bytes_processed = 0;
+    }
+
+    EXPECT_FALSE(change_writer4_1.writer_info.is_linked.load());
+    EXPECT_EQ(1u, async.get_scheduler().get_expired_samples());
+    EXPECT_EQ(1u, async.get_scheduler().get_missed_deadlines());
+
+    // Unregister writers.
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+    async.unregister_writer(&writer4);
+    async.unregister_writer(&writer5);
+    async.unregister_writer(&writer6);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,319 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/Endpoint.h>
+#include <rtps/messages/ControlMessageScheduler.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace testing;
+
+namespace {
+
+//! Sender of an endpoint, which only gives the destination GUIDs of its submessages.
+class EndpointSender : public RTPSMessageSenderInterface
+{
+public:
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return c_GuidPrefix_Unknown;
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return participants_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return guids_;
+    }
+
+    bool send(
+            CDRMessage_t*,
+            std::chrono::steady_clock::time_point) const override
+    {
+        return true;
+    }
+
+    void lock() override
+    {
+    }
+
+    void unlock() override
+    {
+    }
+
+private:
+
+    std::vector<GuidPrefix_t> participants_;
+
+    std::vector<GUID_t> guids_;
+};
+
+//! Message sent by the participant, whose length is the number of submessages on the mock of RTPSMessageGroup.
+struct Datagram
+{
+    uint32_t submessages;
+
+    GUID_t sender;
+
+    std::vector<Locator_t> destinations;
+};
+
+Locator_t locator(
+        uint32_t port)
+{
+    Locator_t locator;
+    locator.kind = LOCATOR_KIND_UDPv4;
+    locator.port = port;
+    return locator;
+}
+
+} // namespace
+
+class ControlMessageSchedulerTests : public Test
+{
+protected:
+
+    void SetUp() override
+    {
+        guid_.guidPrefix.value[0] = 1;
+        guid_.entityId = c_EntityId_RTPSParticipant;
+        ON_CALL(participant_, getGuid()).WillByDefault(ReturnRef(guid_));
+        ON_CALL(participant_, send_sync_mock(_, _, _)).WillByDefault(Invoke([this](
+                    uint32_t length,
+                    const GUID_t& sender,
+                    const LocatorList_t& destinations)
+                {
+                    std::lock_guard<std::mutex> guard(mutex_);
+                    datagrams_.push_back({length, sender, {destinations.begin(), destinations.end()}});
+                    cv_.notify_all();
+                    return true;
+                }));
+    }
+
+    //! Task adding one submessage to the given destinations each time it is triggered.
+    ControlMessageTask* create_task(
+            ControlMessageScheduler& scheduler,
+            Endpoint& endpoint,
+            const std::vector<Locator_t>& destinations,
+            double milliseconds)
+    {
+        return new ControlMessageTask(scheduler,
+                       [destinations](std::vector<Locator_t>& task_destinations)
+                       {
+                           task_destinations = destinations;
+                           return false;
+                       },
+                       [this, &endpoint](ControlMessageGroup& group, std::vector<Locator_t>& task_destinations)
+                       {
+                           group.use(&endpoint, &sender_, task_destinations).add_heartbeat(
+                               SequenceNumber_t(), SequenceNumber_t(), 1, false, false);
+                       },
+                       milliseconds);
+    }
+
+    bool wait_datagrams(
+            size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(5), [this, count]()
+                       {
+                           return datagrams_.size() >= count;
+                       });
+    }
+
+    NiceMock<RTPSParticipantImpl> participant_;
+
+    GUID_t guid_;
+
+    EndpointSender sender_;
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    std::vector<Datagram> datagrams_;
+};
+
+/*!
+ * Tasks due within the aggregation window of the earliest one are triggered with it, sending their submessages on
+ * the same message, while those due later are triggered on their own.
+ */
+TEST_F(ControlMessageSchedulerTests, tasks_within_window_are_batched)
+{
+    ControlMessageScheduler scheduler(&participant_, 50);
+    Endpoint endpoint_a;
+    Endpoint endpoint_b;
+    Endpoint endpoint_c;
+    std::vector<Locator_t> destinations = {locator(7400)};
+    std::unique_ptr<ControlMessageTask> task_a(create_task(scheduler, endpoint_a, destinations, 100));
+    std::unique_ptr<ControlMessageTask> task_b(create_task(scheduler, endpoint_b, destinations, 120));
+    std::unique_ptr<ControlMessageTask> task_c(create_task(scheduler, endpoint_c, destinations, 400));
+
+    task_a->restart_timer();
+    task_b->restart_timer();
+    task_c->restart_timer();
+
+    ASSERT_TRUE(wait_datagrams(2u));
+    std::lock_guard<std::mutex> guard(mutex_);
+    ASSERT_EQ(2u, datagrams_.size());
+    EXPECT_EQ(2u, datagrams_[0].submessages);
+    EXPECT_EQ(1u, datagrams_[1].submessages);
+
+    // Messages gathering several endpoints are reported as sent by the participant
+    for (const Datagram& datagram : datagrams_)
+    {
+        EXPECT_EQ(guid_, datagram.sender);
+    }
+}
+
+/*!
+ * Tasks of different endpoints triggered on the same batch share the message when their destination locators are
+ * the same, and use different messages otherwise.
+ */
+TEST_F(ControlMessageSchedulerTests, messages_per_destinations)
+{
+    ControlMessageScheduler scheduler(&participant_, 50);
+    Endpoint endpoint_a;
+    Endpoint endpoint_b;
+    Endpoint endpoint_c;
+    std::vector<Locator_t> first_destinations = {locator(7400)};
+    std::vector<Locator_t> second_destinations = {locator(7410)};
+    std::unique_ptr<ControlMessageTask> task_a(create_task(scheduler, endpoint_a, first_destinations, 50));
+    std::unique_ptr<ControlMessageTask> task_b(create_task(scheduler, endpoint_b, second_destinations, 50));
+    std::unique_ptr<ControlMessageTask> task_c(create_task(scheduler, endpoint_c, first_destinations, 50));
+
+    task_a->restart_timer();
+    task_b->restart_timer();
+    task_c->restart_timer();
+
+    ASSERT_TRUE(wait_datagrams(2u));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::lock_guard<std::mutex> guard(mutex_);
+    ASSERT_EQ(2u, datagrams_.size());
+    EXPECT_EQ(2u, datagrams_[0].submessages);
+    EXPECT_EQ(first_destinations, datagrams_[0].destinations);
+    EXPECT_EQ(1u, datagrams_[1].submessages);
+    EXPECT_EQ(second_destinations, datagrams_[1].destinations);
+}
+
+/*!
+ * A task cancelled while it is pending on the batch being triggered is not called, and a task restarted while it is
+ * pending is scheduled again when the batch finishes, although its callback did not ask for it.
+ */
+TEST_F(ControlMessageSchedulerTests, cancel_and_restart_while_pending)
+{
+    ControlMessageScheduler scheduler(&participant_, 50);
+    std::promise<void> entered;
+    std::promise<void> go;
+    std::shared_future<void> go_future = go.get_future().share();
+    std::atomic<uint32_t> calls_a{0};
+    std::atomic<uint32_t> calls_b{0};
+
+    ControlMessageTask task_a(scheduler,
+            [&](std::vector<Locator_t>&)
+            {
+                if (1u == ++calls_a)
+                {
+                    entered.set_value();
+                    go_future.wait();
+                }
+                return false;
+            },
+            [](ControlMessageGroup&, std::vector<Locator_t>&)
+            {
+            }, 50);
+    ControlMessageTask task_b(scheduler,
+            [&](std::vector<Locator_t>&)
+            {
+                ++calls_b;
+                return false;
+            },
+            [](ControlMessageGroup&, std::vector<Locator_t>&)
+            {
+            }, 50);
+
+    task_a.restart_timer();
+    task_b.restart_timer();
+    entered.get_future().wait();
+
+    // Both tasks are on the batch, which is preparing the first one
+    task_b.cancel_timer();
+    task_a.restart_timer();
+    go.set_value();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(2u, calls_a.load());
+    EXPECT_EQ(0u, calls_b.load());
+
+    // The cancelled task can be scheduled again
+    task_b.restart_timer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(2u, calls_a.load());
+    EXPECT_EQ(1u, calls_b.load());
+}
+
+/*!
+ * Destroying a task waits for its callback to finish when it is running.
+ */
+TEST_F(ControlMessageSchedulerTests, destructor_waits_for_running_callback)
+{
+    ControlMessageScheduler scheduler(&participant_, 50);
+    std::promise<void> entered;
+    std::atomic<bool> finished{false};
+
+    ControlMessageTask* task = new ControlMessageTask(scheduler,
+                    [&](std::vector<Locator_t>&)
+                    {
+                        entered.set_value();
+                        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                        finished = true;
+                        return false;
+                    },
+                    [](ControlMessageGroup&, std::vector<Locator_t>&)
+                    {
+                    }, 10);
+
+    task->restart_timer();
+    entered.get_future().wait();
+    delete task;
+    EXPECT_TRUE(finished.load());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
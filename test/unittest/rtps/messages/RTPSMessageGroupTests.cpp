@@ -0,0 +1,382 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/Endpoint.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <rtps/history/ITopicPayloadPool.h>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+using namespace testing;
+
+namespace {
+
+//! Sender keeping the bytes of the messages sent, and their slices when they are sent as several ones.
+class MessageSender : public RTPSMessageSenderInterface
+{
+public:
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return c_GuidPrefix_Unknown;
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return participants_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return guids_;
+    }
+
+    bool send(
+            CDRMessage_t* message,
+            std::chrono::steady_clock::time_point) const override
+    {
+        messages.emplace_back(message->buffer, message->buffer + message->length);
+        slices.emplace_back();
+        return true;
+    }
+
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point) const override
+    {
+        std::vector<octet> message(total_bytes);
+        EXPECT_EQ(total_bytes, copy_network_buffers(buffers, message.data()));
+        messages.push_back(message);
+        slices.push_back(buffers);
+        return true;
+    }
+
+    void lock() override
+    {
+    }
+
+    void unlock() override
+    {
+    }
+
+    mutable std::vector<std::vector<octet>> messages;
+
+    mutable std::vector<std::vector<NetworkBuffer>> slices;
+
+private:
+
+    std::vector<GuidPrefix_t> participants_;
+
+    std::vector<GUID_t> guids_;
+};
+
+//! Pool lending the payloads of the changes, which only counts the references taken on them.
+class ReferenceCountingPool : public ITopicPayloadPool
+{
+public:
+
+    bool get_payload(
+            uint32_t,
+            CacheChange_t&) override
+    {
+        return false;
+    }
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*&,
+            CacheChange_t& cache_change) override
+    {
+        cache_change.serializedPayload.data = data.data;
+        cache_change.serializedPayload.length = data.length;
+        cache_change.payload_owner(this);
+        ++references;
+        return true;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.payload_owner(nullptr);
+        --references;
+        return true;
+    }
+
+    bool reserve_history(
+            const PoolConfig&,
+            bool) override
+    {
+        return true;
+    }
+
+    bool release_history(
+            const PoolConfig&,
+            bool) override
+    {
+        return true;
+    }
+
+    size_t payload_pool_allocated_size() const override
+    {
+        return 0;
+    }
+
+    size_t payload_pool_available_size() const override
+    {
+        return 0;
+    }
+
+    int32_t references = 0;
+};
+
+//! Position of each slice of a message, counted from its beginning.
+std::vector<uint32_t> slice_positions(
+        const std::vector<NetworkBuffer>& slices)
+{
+    std::vector<uint32_t> positions;
+    uint32_t position = 0;
+    for (const NetworkBuffer& slice : slices)
+    {
+        positions.push_back(position);
+        position += slice.size;
+    }
+    return positions;
+}
+
+//! Walk the submessages of a message through their octetsToNextHeader, returning their ids.
+std::vector<octet> submessage_ids(
+        const std::vector<octet>& message)
+{
+    std::vector<octet> ids;
+    size_t position = RTPSMESSAGE_HEADER_SIZE;
+    while (position + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= message.size())
+    {
+        octet id = message[position];
+        bool little_endian = 0 != (message[position + 1] & BIT(0));
+        uint16_t octets_to_next_header = little_endian ?
+                static_cast<uint16_t>(message[position + 2] | (message[position + 3] << 8)) :
+                static_cast<uint16_t>((message[position + 2] << 8) | message[position + 3]);
+        ids.push_back(id);
+        EXPECT_EQ(0u, octets_to_next_header % 4u);
+        position += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + octets_to_next_header;
+    }
+    EXPECT_EQ(message.size(), position);
+    return ids;
+}
+
+} // namespace
+
+class RTPSMessageGroupTests : public Test
+{
+protected:
+
+    void SetUp() override
+    {
+        participant_guid_.guidPrefix.value[0] = 1;
+        participant_guid_.entityId = c_EntityId_RTPSParticipant;
+        ON_CALL(participant_, getGuid()).WillByDefault(ReturnRef(participant_guid_));
+        endpoint_.m_guid = GUID_t(participant_guid_.guidPrefix, 0x100u);
+#if HAVE_SECURITY
+        ON_CALL(participant_, security_attributes()).WillByDefault(ReturnRef(security_attributes_));
+        endpoint_.supports_rtps_protection_ = false;
+#endif // if HAVE_SECURITY
+    }
+
+    void TearDown() override
+    {
+        for (CacheChange_t& change : changes_)
+        {
+            change.serializedPayload.data = nullptr;
+        }
+    }
+
+    //! Add a change with a payload of the given length, filled with a pattern depending on its sequence number.
+    CacheChange_t& add_change(
+            uint32_t length)
+    {
+        changes_.emplace_back();
+        payloads_.emplace_back(length);
+        CacheChange_t& change = changes_.back();
+        std::vector<octet>& payload = payloads_.back();
+        change.sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(changes_.size()));
+        change.writerGUID = endpoint_.m_guid;
+        change.sourceTimestamp = Time_t(10, 20);
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            payload[i] = static_cast<octet>(i * 7u + changes_.size());
+        }
+        change.serializedPayload.data = payload.data();
+        change.serializedPayload.length = length;
+        change.serializedPayload.max_size = length;
+        return change;
+    }
+
+    /*!
+     * Send the submessages added by the given function twice, first copying the payloads into the message and then
+     * letting the group gather the ones owned by a pool with reference counting.
+     */
+    void send_copied_and_gathered(
+            const std::function<void(RTPSMessageGroup&)>& add_submessages)
+    {
+        {
+            RTPSMessageGroup group(&participant_, &endpoint_, &copied_);
+            add_submessages(group);
+        }
+
+        ReferenceCountingPool pool;
+        for (CacheChange_t& change : changes_)
+        {
+            change.payload_owner(&pool);
+        }
+        {
+            RTPSMessageGroup group(&participant_, &endpoint_, &gathered_);
+            add_submessages(group);
+        }
+        for (CacheChange_t& change : changes_)
+        {
+            change.payload_owner(nullptr);
+        }
+
+        // The references on the payloads are released once the message is sent
+        EXPECT_EQ(0, pool.references);
+
+        ASSERT_EQ(1u, copied_.messages.size());
+        ASSERT_EQ(1u, gathered_.messages.size());
+        EXPECT_TRUE(copied_.slices[0].empty());
+        EXPECT_EQ(copied_.messages[0], gathered_.messages[0]);
+    }
+
+    //! Check that the gathered message has a slice with the given data, at the same position as on the copied one.
+    void expect_gathered_slice(
+            const octet* data,
+            uint32_t length)
+    {
+        const std::vector<NetworkBuffer>& slices = gathered_.slices[0];
+        std::vector<uint32_t> positions = slice_positions(slices);
+        for (size_t i = 0; i < slices.size(); ++i)
+        {
+            if (data == slices[i].buffer)
+            {
+                EXPECT_EQ(length, slices[i].size);
+                ASSERT_LE(positions[i] + length, copied_.messages[0].size());
+                EXPECT_EQ(0, memcmp(data, &copied_.messages[0][positions[i]], length));
+                return;
+            }
+        }
+        ADD_FAILURE() << "No slice points to the payload";
+    }
+
+    NiceMock<RTPSParticipantImpl> participant_;
+
+    GUID_t participant_guid_;
+
+#if HAVE_SECURITY
+    security::ParticipantSecurityAttributes security_attributes_;
+#endif // if HAVE_SECURITY
+
+    Endpoint endpoint_;
+
+    MessageSender copied_;
+
+    MessageSender gathered_;
+
+    std::list<CacheChange_t> changes_;
+
+    std::list<std::vector<octet>> payloads_;
+};
+
+/*!
+ * A message with DATA submessages whose payloads are sent from their own buffers is the same as the one where they are
+ * copied, including the padding after payloads whose length is not a multiple of 4 and the octetsToNextHeader of the
+ * submessages. Small payloads are still copied.
+ */
+TEST_F(RTPSMessageGroupTests, gathered_data_is_identical_to_copied)
+{
+    CacheChange_t& first = add_change(1027);
+    CacheChange_t& small = add_change(10);
+    CacheChange_t& last = add_change(2001);
+
+    send_copied_and_gathered([&](RTPSMessageGroup& group)
+            {
+                EXPECT_TRUE(group.add_data(first, false));
+                EXPECT_TRUE(group.add_data(small, false));
+                EXPECT_TRUE(group.add_data(last, false));
+            });
+
+    // Message header up to the first payload, first payload, padding and submessages up to the last payload, last
+    // payload, padding
+    ASSERT_EQ(5u, gathered_.slices[0].size());
+    expect_gathered_slice(first.serializedPayload.data, first.serializedPayload.length);
+    expect_gathered_slice(last.serializedPayload.data, last.serializedPayload.length);
+    EXPECT_EQ(1u, gathered_.slices[0][2].size % 4u);
+    EXPECT_EQ(3u, gathered_.slices[0][4].size);
+
+    std::vector<octet> ids = submessage_ids(gathered_.messages[0]);
+    EXPECT_EQ(3, std::count(ids.begin(), ids.end(), DATA));
+}
+
+/*!
+ * A message with DATA_FRAG submessages whose fragments are sent from the payload of the change is the same as the one
+ * where they are copied, and each slice starts at the fragment it sends.
+ */
+TEST_F(RTPSMessageGroupTests, gathered_data_frag_is_identical_to_copied)
+{
+    CacheChange_t& change = add_change(4499);
+    change.setFragmentSize(1500);
+    ASSERT_EQ(3u, change.getFragmentCount());
+
+    send_copied_and_gathered([&](RTPSMessageGroup& group)
+            {
+                for (FragmentNumber_t fragment = 1; fragment <= 3; ++fragment)
+                {
+                    EXPECT_TRUE(group.add_data_frag(change, fragment, false));
+                }
+            });
+
+    ASSERT_EQ(7u, gathered_.slices[0].size());
+    expect_gathered_slice(change.serializedPayload.data, 1500);
+    expect_gathered_slice(change.serializedPayload.data + 1500, 1500);
+    expect_gathered_slice(change.serializedPayload.data + 3000, 1499);
+    EXPECT_EQ(1u, gathered_.slices[0][6].size);
+
+    std::vector<octet> ids = submessage_ids(gathered_.messages[0]);
+    EXPECT_EQ(3, std::count(ids.begin(), ids.end(), DATA_FRAG));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
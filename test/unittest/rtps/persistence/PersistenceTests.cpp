@@ -14,18 +14,25 @@
 
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
 
+#include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/persistence/PersistenceService.h>
+#include <rtps/persistence/ReaderSequenceStorage.h>
 #include <rtps/persistence/sqlite3.h>
 #include <rtps/persistence/SQLite3PersistenceServiceStatements.h>
 
 #include <rtps/common/GuidUtils.hpp>
 #include <fastrtps/utils/TimeConversion.h>
 #include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
 
 #include <utils/SystemInfo.hpp>
 
 #include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <gtest/gtest.h>
 
@@ -250,6 +257,31 @@ protected:
         }
     }
 
+    /**
+     * Remove the files written by the log structured plugin on the current directory.
+     * @param guid Persistence GUID of a writer, or GUID of a reader.
+     * @param is_reader Whether the GUID is the one of a reader.
+     */
+    void remove_log_files(
+            const std::string& guid,
+            bool is_reader)
+    {
+        std::ostringstream ss;
+        ss << "./" << (is_reader ? "reader_" : "writer_") << std::hex << std::setfill('0');
+        for (char c : guid)
+        {
+            ss << std::setw(2) << static_cast<unsigned>(static_cast<unsigned char>(c));
+        }
+        std::string base_name = ss.str();
+
+        std::remove((base_name + ".manifest").c_str());
+        std::remove((base_name + ".manifest.tmp").c_str());
+        for (uint32_t id = 0; id < 256; ++id)
+        {
+            std::remove((base_name + "." + std::to_string(id) + ".seg").c_str());
+        }
+    }
+
     std::string dbfile = "text.db";
 };
 
@@ -334,6 +366,397 @@ TEST_F(PersistenceTest, Writer)
 }
 
 
+/*!
+ * @fn TEST_F(PersistenceTest, AsyncWriter)
+ * @brief This test checks that changes queued with a commit period are stored when loading or destroying the service.
+ */
+TEST_F(PersistenceTest, AsyncWriter)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.commit_period", "1000");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Add three changes and remove the first one. Loading commits them before the period elapses.
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 2u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 3u));
+
+    // Operations still queued are committed when the service is destroyed
+    change.sequenceNumber.low = 4;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 3u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 4u));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogStructuredWriter)
+ * @brief This test checks the writer persistence interface of the log structured persistence service.
+ */
+TEST_F(PersistenceTest, LogStructuredWriter)
+{
+    const std::string persist_guid(dbfile);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG_STRUCTURED");
+    policy.properties().emplace_back("dds.persistence.log_structured.segment_size", "4096");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 200, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.reserve(128);
+    change.serializedPayload.length = 128;
+
+    // Initial load should return empty vector
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+
+    // Keep the last 5 changes of 1000, so many segments are filled, compacted and deleted
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        change.sequenceNumber.low = i;
+        memset(change.serializedPayload.data, static_cast<int>(i & 0xFF), 128);
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+        if (i > 5 && (i - 5) % 7 != 0)
+        {
+            change.sequenceNumber.low = i - 5;
+            ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+        }
+    }
+
+    // Should not be able to add same sequence again
+    change.sequenceNumber.low = 1000;
+    ASSERT_FALSE(service->add_writer_change_to_storage(persist_guid, change));
+
+    // Changes are kept when the service is created again
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    // Loading should return the multiples of 7 and the last 5 changes
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 7; i <= 995; i += 7)
+    {
+        expected.push_back(i);
+    }
+    for (uint32_t i = 996; i <= 1000; ++i)
+    {
+        expected.push_back(i);
+    }
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 1000u));
+    ASSERT_EQ(history.m_changes.size(), expected.size());
+    for (size_t n = 0; n < expected.size(); ++n)
+    {
+        CacheChange_t* loaded = history.m_changes[n];
+        ASSERT_EQ(loaded->sequenceNumber, SequenceNumber_t(0, expected[n]));
+        ASSERT_EQ(loaded->serializedPayload.length, 128u);
+        ASSERT_EQ(loaded->serializedPayload.data[127], static_cast<octet>(expected[n] & 0xFF));
+        pool->release_cache(loaded);
+    }
+
+    // Remove every change, the last sequence number is kept
+    for (uint32_t seq : expected)
+    {
+        change.sequenceNumber.low = seq;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    max_seq = SequenceNumber_t();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 1000u));
+
+    delete service;
+    service = nullptr;
+    remove_log_files(persist_guid, false);
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogStructuredLastSequenceAfterCompaction)
+ * @brief This test checks that the log structured persistence service keeps the last sequence number of a writer
+ * when the segment holding it is deleted after compacting it.
+ */
+TEST_F(PersistenceTest, LogStructuredLastSequenceAfterCompaction)
+{
+    const std::string persist_guid(dbfile);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG_STRUCTURED");
+    policy.properties().emplace_back("dds.persistence.log_structured.segment_size", "4096");
+
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 50, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.reserve(128);
+    change.serializedPayload.length = 128;
+
+    // Each record takes 200 bytes, so the first segment keeps changes 1 to 20 and the second one 21 to 40
+    for (uint32_t i = 1; i <= 40; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+
+    // Compacting the first segment moves changes 17 to 20 to a third segment
+    for (uint32_t i = 1; i <= 16; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+
+    // Compacting the second segment moves changes 21 to 24 to the third one, and deletes the records of 25 to 40
+    for (uint32_t i = 40; i >= 25; --i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 40u));
+    ASSERT_EQ(history.m_changes.size(), 8u);
+    for (size_t n = 0; n < history.m_changes.size(); ++n)
+    {
+        ASSERT_EQ(history.m_changes[n]->sequenceNumber, SequenceNumber_t(0, static_cast<uint32_t>(17 + n)));
+        pool->release_cache(history.m_changes[n]);
+    }
+
+    delete service;
+    service = nullptr;
+    remove_log_files(persist_guid, false);
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LogStructuredCorruptRecord)
+ * @brief This test checks that the log structured persistence service discards a record with a wrong CRC.
+ */
+TEST_F(PersistenceTest, LogStructuredCorruptRecord)
+{
+    const std::string persist_guid(dbfile);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG_STRUCTURED");
+
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    delete service;
+    service = nullptr;
+
+    // Overwrite the sequence number of the third record. Each one takes 72 bytes after the 16 bytes of the segment
+    // header, and its body starts after a header of 16 bytes.
+    {
+        std::ostringstream ss;
+        ss << "./writer_" << std::hex << std::setfill('0');
+        for (char c : persist_guid)
+        {
+            ss << std::setw(2) << static_cast<unsigned>(static_cast<unsigned char>(c));
+        }
+        ss << ".0.seg";
+        std::fstream segment(ss.str(), std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(segment.is_open());
+        segment.seekp(16 + 2 * 72 + 16);
+        segment.put(0x55);
+    }
+
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 2u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+
+    // New changes are appended in place of the discarded record
+    change.sequenceNumber.low = 3;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, pool, payload_pool_, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 3u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 3u));
+
+    delete service;
+    service = nullptr;
+    remove_log_files(persist_guid, false);
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, LazyLoad)
+ * @brief This test checks that the persistence services only read the payloads of the changes of a writer when asked
+ * to, when the dds.persistence.lazy_load property is set.
+ */
+TEST_F(PersistenceTest, LazyLoad)
+{
+    const std::string persist_guid(dbfile);
+
+    std::vector<PropertyPolicy> policies(2);
+    policies[0].properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policies[0].properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policies[1].properties().emplace_back("dds.persistence.plugin", "builtin.LOG_STRUCTURED");
+
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 64, 20, 20 };
+    std::shared_ptr<IChangePool> change_pool;
+    std::shared_ptr<IPayloadPool> payload_pool = BasicPayloadPool::get(cfg, change_pool);
+    ASSERT_NE(payload_pool, nullptr);
+
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    CacheChange_t change;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.reserve(64);
+    change.serializedPayload.length = 64;
+
+    for (PropertyPolicy& policy : policies)
+    {
+        service = PersistenceFactory::create_persistence_service(policy);
+        ASSERT_NE(service, nullptr);
+        for (uint32_t i = 1; i <= 10; ++i)
+        {
+            change.sequenceNumber.low = i;
+            memset(change.serializedPayload.data, static_cast<int>(i), 64);
+            ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+        }
+        delete service;
+
+        policy.properties().emplace_back("dds.persistence.lazy_load", "true");
+        service = PersistenceFactory::create_persistence_service(policy);
+        ASSERT_NE(service, nullptr);
+
+        // Changes are loaded without their payloads
+        SequenceNumber_t max_seq;
+        WriterHistory history;
+        ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, change_pool, payload_pool,
+                max_seq));
+        ASSERT_EQ(history.m_changes.size(), 10u);
+        ASSERT_EQ(max_seq, SequenceNumber_t(0, 10u));
+        for (CacheChange_t* loaded : history.m_changes)
+        {
+            ASSERT_TRUE(IPersistenceService::is_payload_pending(*loaded));
+            ASSERT_EQ(loaded->serializedPayload.length, 64u);
+        }
+
+        // Payloads are read on demand
+        for (CacheChange_t* loaded : history.m_changes)
+        {
+            if (loaded->sequenceNumber == SequenceNumber_t(0, 6u))
+            {
+                // A change removed from storage cannot be loaded
+                ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, *loaded));
+                ASSERT_FALSE(service->load_writer_payload(persist_guid, *loaded, payload_pool));
+                ASSERT_TRUE(IPersistenceService::is_payload_pending(*loaded));
+                loaded->serializedPayload.length = 0;
+            }
+            else
+            {
+                ASSERT_TRUE(service->load_writer_payload(persist_guid, *loaded, payload_pool));
+                ASSERT_FALSE(IPersistenceService::is_payload_pending(*loaded));
+                ASSERT_EQ(loaded->serializedPayload.length, 64u);
+                ASSERT_EQ(loaded->serializedPayload.data[0], static_cast<octet>(loaded->sequenceNumber.low));
+                ASSERT_EQ(loaded->serializedPayload.data[63], static_cast<octet>(loaded->sequenceNumber.low));
+                payload_pool->release_payload(*loaded);
+            }
+            change_pool->release_cache(loaded);
+        }
+
+        delete service;
+        service = nullptr;
+    }
+
+    remove_log_files(persist_guid, false);
+}
+
 /*!
  * @fn TEST_F(PersistenceTest, SchemaVersionMismatch)
  * @brief This test checks that an error is issued if the database has an old schema.
@@ -463,6 +886,124 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+ * @fn TEST_F(PersistenceTest, LogStructuredReader)
+ * @brief This test checks the reader persistence interface of the log structured persistence service.
+ */
+TEST_F(PersistenceTest, LogStructuredReader)
+{
+    const std::string persist_guid(dbfile);
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOG_STRUCTURED");
+    policy.properties().emplace_back("dds.persistence.log_structured.segment_size", "4096");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Initial load should return empty map
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 0u);
+
+    // Update both writers many times, so old records are compacted
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        seq_map[guid_1] = SequenceNumber_t(0, i);
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, i)));
+        if (i % 3 == 0)
+        {
+            seq_map[guid_2] = SequenceNumber_t(0, i);
+            ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_2, SequenceNumber_t(0, i)));
+        }
+    }
+
+    // Loading should return local map
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+
+    // Also when the service is created again
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+
+    delete service;
+    service = nullptr;
+    remove_log_files(persist_guid, true);
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, ReaderSequenceStorage)
+ * @brief This test checks that the sequence numbers of a reader are only written on flush when an update period is
+ * configured, keeping the latest one of each writer.
+ */
+TEST_F(PersistenceTest, ReaderSequenceStorage)
+{
+    const std::string persist_guid("TEST_READER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+
+    PropertyPolicy reader_policy;
+    reader_policy.properties().emplace_back("dds.persistence.reader.update_period", "100000");
+    uint32_t period = ReaderSequenceStorage::get_period(reader_policy, policy);
+    ASSERT_EQ(period, 100000u);
+    ASSERT_EQ(ReaderSequenceStorage::get_period(policy, PropertyPolicy()), 0u);
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    ResourceEvent event_service;
+    event_service.init_thread();
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    ReaderSequenceStorage* storage = new ReaderSequenceStorage(service, persist_guid, event_service, period);
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        seq_map[guid_1] = SequenceNumber_t(0, i);
+        storage->update(guid_1, SequenceNumber_t(0, i));
+        seq_map[guid_2] = SequenceNumber_t(0, 2 * i);
+        storage->update(guid_2, SequenceNumber_t(0, 2 * i));
+    }
+
+    // Nothing is written before the period expires
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 0u);
+
+    // Flushing writes the latest sequence number of each writer
+    storage->flush();
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+
+    // Destroying the storage writes the pending updates
+    seq_map[guid_1] = SequenceNumber_t(0, 1000);
+    storage->update(guid_1, SequenceNumber_t(0, 1000));
+    delete storage;
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,166 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <rtps/writer/AdaptiveReliability.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using std::chrono::milliseconds;
+
+namespace {
+
+WriterTimes writer_times()
+{
+    WriterTimes times;
+    times.heartbeatPeriod = Duration_t(1, 0);
+    times.nackResponseDelay = Duration_t(0, 10 * 1000 * 1000);
+    return times;
+}
+
+PropertyPolicy bounds(
+        const char* min_heartbeat_period,
+        const char* max_heartbeat_period,
+        const char* min_nack_response_delay,
+        const char* max_nack_response_delay)
+{
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.adaptive_reliability", "true");
+    properties.properties().emplace_back("fastdds.adaptive_reliability.heartbeat_period.min", min_heartbeat_period);
+    properties.properties().emplace_back("fastdds.adaptive_reliability.heartbeat_period.max", max_heartbeat_period);
+    properties.properties().emplace_back("fastdds.adaptive_reliability.nack_response_delay.min",
+            min_nack_response_delay);
+    properties.properties().emplace_back("fastdds.adaptive_reliability.nack_response_delay.max",
+            max_nack_response_delay);
+    return properties;
+}
+
+} // namespace
+
+TEST(AdaptiveReliabilityTests, enabled_by_property)
+{
+    PropertyPolicy properties;
+    EXPECT_FALSE(AdaptiveReliability::is_enabled(properties));
+    properties.properties().emplace_back("fastdds.adaptive_reliability", "false");
+    EXPECT_FALSE(AdaptiveReliability::is_enabled(properties));
+    properties.properties()[0].value("true");
+    EXPECT_TRUE(AdaptiveReliability::is_enabled(properties));
+}
+
+/*!
+ * Without bound properties the bounds follow the configured times, which are used until readers are observed.
+ */
+TEST(AdaptiveReliabilityTests, default_bounds)
+{
+    PropertyPolicy properties;
+    AdaptiveReliability adaptive(writer_times(), properties);
+
+    EXPECT_EQ(milliseconds(100), adaptive.min_heartbeat_period());
+    EXPECT_EQ(milliseconds(2000), adaptive.max_heartbeat_period());
+    EXPECT_EQ(milliseconds(0), adaptive.min_nack_response_delay());
+    EXPECT_EQ(milliseconds(10), adaptive.max_nack_response_delay());
+    EXPECT_EQ(Duration_t(1, 0), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 10 * 1000 * 1000), adaptive.nack_response_delay());
+
+    // No readers keeps the current values
+    adaptive.begin_update();
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(1, 0), adaptive.heartbeat_period());
+
+    WriterTimes times = writer_times();
+    times.heartbeatPeriod = Duration_t(2, 0);
+    adaptive.update_times(times);
+    EXPECT_EQ(milliseconds(200), adaptive.min_heartbeat_period());
+    EXPECT_EQ(milliseconds(4000), adaptive.max_heartbeat_period());
+    EXPECT_EQ(Duration_t(2, 0), adaptive.heartbeat_period());
+}
+
+/*!
+ * Clean links use the upper bounds, and the worst NACK rate moves both times towards the lower bounds.
+ */
+TEST(AdaptiveReliabilityTests, nack_rate_shortens_times)
+{
+    AdaptiveReliability adaptive(writer_times(), bounds("100", "1100", "0", "20"));
+
+    adaptive.begin_update();
+    adaptive.add_reader(milliseconds(0), 0.0);
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(1, 100 * 1000 * 1000), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 20 * 1000 * 1000), adaptive.nack_response_delay());
+
+    adaptive.begin_update();
+    adaptive.add_reader(milliseconds(0), 0.0);
+    adaptive.add_reader(milliseconds(0), 0.5);
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(0, 600 * 1000 * 1000), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 10 * 1000 * 1000), adaptive.nack_response_delay());
+
+    adaptive.begin_update();
+    adaptive.add_reader(milliseconds(0), 1.0);
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(0, 100 * 1000 * 1000), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 0), adaptive.nack_response_delay());
+}
+
+/*!
+ * The heartbeat period covers twice the slowest round trip and the NACK response delay stays under half the
+ * fastest one, always within the bounds.
+ */
+TEST(AdaptiveReliabilityTests, round_trip_limits_times)
+{
+    AdaptiveReliability adaptive(writer_times(), bounds("100", "1100", "5", "20"));
+
+    adaptive.begin_update();
+    adaptive.add_reader(milliseconds(400), 1.0);
+    adaptive.add_reader(milliseconds(16), 0.0);
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(0, 800 * 1000 * 1000), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 5 * 1000 * 1000), adaptive.nack_response_delay());
+
+    adaptive.begin_update();
+    adaptive.add_reader(milliseconds(900), 0.0);
+    adaptive.add_reader(milliseconds(16), 0.0);
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(1, 100 * 1000 * 1000), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 8 * 1000 * 1000), adaptive.nack_response_delay());
+
+    adaptive.begin_update();
+    adaptive.add_reader(milliseconds(2), 0.0);
+    adaptive.end_update();
+    EXPECT_EQ(Duration_t(0, 5 * 1000 * 1000), adaptive.nack_response_delay());
+}
+
+TEST(AdaptiveReliabilityTests, invalid_bounds)
+{
+    AdaptiveReliability adaptive(writer_times(), bounds("500", "200", "wrong", "4"));
+
+    EXPECT_EQ(milliseconds(500), adaptive.min_heartbeat_period());
+    EXPECT_EQ(milliseconds(500), adaptive.max_heartbeat_period());
+    EXPECT_EQ(milliseconds(0), adaptive.min_nack_response_delay());
+    EXPECT_EQ(milliseconds(4), adaptive.max_nack_response_delay());
+    EXPECT_EQ(Duration_t(0, 500 * 1000 * 1000), adaptive.heartbeat_period());
+    EXPECT_EQ(Duration_t(0, 4 * 1000 * 1000), adaptive.nack_response_delay());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
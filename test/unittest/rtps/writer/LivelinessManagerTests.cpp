@@ -449,6 +449,46 @@ TEST_F(LivelinessManagerTests, TimerOwnerCalculation)
     EXPECT_EQ(num_writers_lost, 3u);
 }
 
+//! Tests that writers sharing a lease duration expire in the order they were last asserted
+TEST_F(LivelinessManagerTests, TimerOwnerSameLeaseDuration)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    liveliness_manager.add_writer(GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.5));
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 2));
+
+    wait_liveliness_lost(2u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 3));
+
+    wait_liveliness_lost(3u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 1));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+}
+
 //! Tests that the writer that is the current timer owner can be removed, and that the timer is restarted
 //! for the next writer
 TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
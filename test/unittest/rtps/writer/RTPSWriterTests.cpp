@@ -18,6 +18,7 @@
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 
@@ -164,6 +165,69 @@ TEST(RTPSWriterTests, WriterWithCustomPayloadPool_DoesNotInitializePool_WhenDyna
     pool_initialization_test(DYNAMIC_REUSABLE_MEMORY_MODE);
 }
 
+void expect_duration(
+        const Duration_t& expected,
+        const Duration_t& actual)
+{
+    // Intervals are kept by the events in milliseconds
+    EXPECT_NEAR(static_cast<double>(expected.to_ns()), static_cast<double>(actual.to_ns()), 1000.0);
+}
+
+/**
+ * The adaptive reliability mode programs the heartbeat and NACK response events of the writer with the tuned times,
+ * which are the configured times until readers are observed, kept within the bounds of the mode.
+ */
+TEST(RTPSWriterTests, StatefulWriter_AdaptiveReliability_AppliesTunedTimes)
+{
+    RTPSParticipantAttributes p_attr;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, true, p_attr);
+    ASSERT_NE(participant, nullptr);
+
+    HistoryAttributes h_attr;
+    WriterHistory* history = new WriterHistory(h_attr);
+
+    WriterAttributes w_attr;
+    w_attr.endpoint.reliabilityKind = RELIABLE;
+    w_attr.times.heartbeatPeriod = Duration_t(3, 0);
+    w_attr.times.nackResponseDelay = Duration_t(0, 5000000);
+
+    // Without the adaptive mode the configured times are used
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, w_attr, history);
+    StatefulWriter* stateful_writer = dynamic_cast<StatefulWriter*>(writer);
+    ASSERT_NE(stateful_writer, nullptr);
+
+    fastdds::statistics::ReliabilityTuning tuning;
+    stateful_writer->get_reliability_tuning(tuning);
+    EXPECT_FALSE(tuning.adaptive);
+    EXPECT_EQ(writer->getGuid(), tuning.writer_guid);
+    expect_duration(Duration_t(3, 0), tuning.heartbeat_period);
+    RTPSDomain::removeRTPSWriter(writer);
+
+    // The adaptive mode keeps the heartbeat period below its upper bound
+    w_attr.endpoint.properties.properties().emplace_back("fastdds.adaptive_reliability", "true");
+    w_attr.endpoint.properties.properties().emplace_back("fastdds.adaptive_reliability.heartbeat_period.max", "500");
+    writer = RTPSDomain::createRTPSWriter(participant, w_attr, history);
+    stateful_writer = dynamic_cast<StatefulWriter*>(writer);
+    ASSERT_NE(stateful_writer, nullptr);
+
+    stateful_writer->get_reliability_tuning(tuning);
+    EXPECT_TRUE(tuning.adaptive);
+    EXPECT_TRUE(tuning.readers.empty());
+    expect_duration(Duration_t(0, 500000000), tuning.heartbeat_period);
+    expect_duration(Duration_t(0, 5000000), tuning.nack_response_delay);
+
+    // Updating the times moves the period the heartbeat is scheduled with
+    WriterTimes times = w_attr.times;
+    times.heartbeatPeriod = Duration_t(0, 200000000);
+    stateful_writer->updateTimes(times);
+    stateful_writer->get_reliability_tuning(tuning);
+    expect_duration(Duration_t(0, 200000000), tuning.heartbeat_period);
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    delete(history);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,155 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/writer/ReaderChangeStates.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+ChangeForReaderStatus_t status_of(
+        const ReaderChangeStates& states,
+        const SequenceNumber_t& seq_num)
+{
+    ChangeForReaderStatus_t status = UNSENT;
+    EXPECT_TRUE(states.find(seq_num, status));
+    return status;
+}
+
+} // namespace
+
+TEST(ReaderChangeStatesTests, holes_are_not_tracked)
+{
+    ReaderChangeStates states;
+    EXPECT_TRUE(states.empty());
+    EXPECT_EQ(SequenceNumber_t::unknown(), states.first());
+
+    states.push_back({0, 3}, UNSENT);
+    states.push_back({0, 4}, UNACKNOWLEDGED, true);
+    states.push_back({0, 7}, UNACKNOWLEDGED);
+
+    EXPECT_EQ(3u, states.size());
+    EXPECT_EQ(SequenceNumber_t(0, 3), states.first());
+    EXPECT_FALSE(states.contains({0, 2}));
+    EXPECT_TRUE(states.contains({0, 3}));
+    EXPECT_FALSE(states.contains({0, 5}));
+    EXPECT_FALSE(states.contains({0, 6}));
+    EXPECT_FALSE(states.contains({0, 8}));
+    EXPECT_EQ(UNSENT, status_of(states, {0, 3}));
+    EXPECT_EQ(UNACKNOWLEDGED, status_of(states, {0, 7}));
+    EXPECT_FALSE(states.is_delivered({0, 3}));
+    EXPECT_TRUE(states.is_delivered({0, 4}));
+    EXPECT_EQ(1u, states.count(UNSENT));
+    EXPECT_EQ(2u, states.count(UNACKNOWLEDGED));
+
+    EXPECT_EQ(SequenceNumber_t(0, 4), states.previous({0, 7}));
+    EXPECT_EQ(SequenceNumber_t(0, 7), states.previous({0, 10}));
+    EXPECT_EQ(SequenceNumber_t::unknown(), states.previous({0, 3}));
+}
+
+TEST(ReaderChangeStatesTests, erase)
+{
+    ReaderChangeStates states;
+    for (uint32_t seq = 1; seq <= 10; ++seq)
+    {
+        states.push_back({0, seq}, UNACKNOWLEDGED);
+    }
+
+    // Erasing the first change moves the front to the next tracked one
+    EXPECT_TRUE(states.erase({0, 2}));
+    EXPECT_FALSE(states.erase({0, 2}));
+    EXPECT_TRUE(states.erase({0, 1}));
+    EXPECT_EQ(SequenceNumber_t(0, 3), states.first());
+    EXPECT_EQ(8u, states.size());
+
+    states.erase_before({0, 6});
+    EXPECT_EQ(SequenceNumber_t(0, 6), states.first());
+    EXPECT_EQ(5u, states.size());
+    EXPECT_EQ(5u, states.count(UNACKNOWLEDGED));
+
+    states.erase_before({0, 20});
+    EXPECT_TRUE(states.empty());
+    EXPECT_EQ(0u, states.count(UNACKNOWLEDGED));
+
+    // Tracking starts again from any sequence number
+    states.push_back({0, 100}, UNSENT);
+    EXPECT_EQ(SequenceNumber_t(0, 100), states.first());
+}
+
+TEST(ReaderChangeStatesTests, insert_before_first)
+{
+    ReaderChangeStates states;
+    for (uint32_t seq = 1; seq <= 200; ++seq)
+    {
+        states.push_back({0, seq}, UNSENT);
+    }
+    states.erase_before({0, 150});
+
+    // Inserted changes reuse the released front, which should not keep the previous states
+    states.insert({0, 100}, UNACKNOWLEDGED);
+    EXPECT_EQ(SequenceNumber_t(0, 100), states.first());
+    EXPECT_FALSE(states.contains({0, 101}));
+    EXPECT_FALSE(states.contains({0, 149}));
+    states.insert({0, 120}, UNACKNOWLEDGED);
+    EXPECT_EQ(SequenceNumber_t(0, 100), states.previous({0, 120}));
+    EXPECT_EQ(SequenceNumber_t(0, 120), states.previous({0, 150}));
+
+    // And before the start of the storage
+    states.insert({0, 1}, UNACKNOWLEDGED);
+    EXPECT_EQ(SequenceNumber_t(0, 1), states.first());
+    EXPECT_FALSE(states.contains({0, 2}));
+    EXPECT_EQ(54u, states.size());
+    EXPECT_EQ(3u, states.count(UNACKNOWLEDGED));
+}
+
+TEST(ReaderChangeStatesTests, convert_status)
+{
+    ReaderChangeStates states;
+    for (uint32_t seq = 1; seq <= 10; ++seq)
+    {
+        states.push_back({0, seq}, UNACKNOWLEDGED);
+    }
+    states.set_status({0, 3}, REQUESTED);
+    states.set_status({0, 8}, REQUESTED);
+    states.set_delivered({0, 8});
+
+    std::vector<SequenceNumber_t> converted;
+    EXPECT_EQ(2u, states.convert_status(REQUESTED, UNSENT, [&converted](const SequenceNumber_t& seq_num)
+            {
+                converted.push_back(seq_num);
+            }));
+    EXPECT_EQ(std::vector<SequenceNumber_t>({{0, 3}, {0, 8}}), converted);
+    EXPECT_EQ(UNSENT, status_of(states, {0, 3}));
+    EXPECT_EQ(UNSENT, status_of(states, {0, 8}));
+    EXPECT_TRUE(states.is_delivered({0, 8}));
+    EXPECT_EQ(0u, states.count(REQUESTED));
+    EXPECT_EQ(2u, states.count(UNSENT));
+
+    EXPECT_EQ(0u, states.convert_status(REQUESTED, UNSENT, [](const SequenceNumber_t&)
+            {
+                FAIL();
+            }));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -382,6 +382,101 @@ TEST(ReaderProxyTests, has_been_delivered_test)
     expect_result({0, 3}, false, false);
 }
 
+TEST(ReaderProxyTests, perform_acknack_response_test)
+{
+    StatefulWriter writer_mock;
+    WriterTimes w_times;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(w_times, alloc, &writer_mock);
+
+    // Change 3 is not relevant for the reader, and was already removed from the history
+    std::vector<CacheChange_t> changes(6);
+    for (uint32_t i = 0; i < changes.size(); ++i)
+    {
+        changes[i].sequenceNumber = {0, i + 1};
+        if (3 != i + 1)
+        {
+            writer_mock.history()->m_changes.push_back(&changes[i]);
+        }
+    }
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    for (CacheChange_t& change : changes)
+    {
+        ChangeForReader_t change_for_reader(&change);
+        change_for_reader.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change_for_reader, 3 != change.sequenceNumber.low, false);
+    }
+    EXPECT_TRUE(rproxy.has_unacknowledged({0, 1}));
+
+    RTPSMessageGroup message_group(nullptr, false);
+    RTPSGapBuilder gap_builder(message_group);
+    SequenceNumberSet_t set({0, 2});
+    set.add({0, 2});
+    set.add({0, 3});
+    set.add({0, 5});
+
+    EXPECT_CALL(gap_builder, add(SequenceNumber_t(0, 3))).Times(1).WillOnce(testing::Return(true));
+    EXPECT_TRUE(rproxy.requested_changes_set(set, gap_builder, {0, 1}));
+
+    // Requested changes are resolved from the writer history
+    std::vector<CacheChange_t*> resent;
+    EXPECT_EQ(2u, rproxy.perform_acknack_response([&resent](CacheChange_t* change)
+            {
+                resent.push_back(change);
+            }));
+    EXPECT_EQ(std::vector<CacheChange_t*>({&changes[1], &changes[4]}), resent);
+    EXPECT_EQ(0u, rproxy.perform_acknack_response(nullptr));
+
+    // Acknowledging all but the last change leaves it unacknowledged
+    rproxy.acked_changes_set({0, 6});
+    EXPECT_EQ(SequenceNumber_t(0, 5), rproxy.changes_low_mark());
+    EXPECT_TRUE(rproxy.has_changes());
+    EXPECT_TRUE(rproxy.has_unacknowledged({0, 1}));
+    rproxy.acked_changes_set({0, 7});
+    EXPECT_FALSE(rproxy.has_changes());
+    EXPECT_FALSE(rproxy.has_unacknowledged({0, 1}));
+}
+
+TEST(ReaderProxyTests, update_acknack_statistics_test)
+{
+    using std::chrono::milliseconds;
+
+    StatefulWriter writer_mock;
+    WriterTimes w_times;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(w_times, alloc, &writer_mock);
+
+    EXPECT_EQ(milliseconds(0), rproxy.ack_round_trip());
+    EXPECT_EQ(0.0, rproxy.nack_rate());
+
+    auto heartbeat = std::chrono::steady_clock::now();
+
+    // First sample is taken as is
+    rproxy.update_acknack_statistics(heartbeat, heartbeat + milliseconds(80), false);
+    EXPECT_EQ(milliseconds(80), rproxy.ack_round_trip());
+    EXPECT_EQ(0.0, rproxy.nack_rate());
+
+    // Another ACKNACK for the same heartbeat does not give a round trip sample
+    rproxy.update_acknack_statistics(heartbeat, heartbeat + milliseconds(500), true);
+    EXPECT_EQ(milliseconds(80), rproxy.ack_round_trip());
+    EXPECT_DOUBLE_EQ(1.0 / 8, rproxy.nack_rate());
+
+    // Next samples are smoothed
+    heartbeat += milliseconds(1000);
+    rproxy.update_acknack_statistics(heartbeat, heartbeat + milliseconds(160), true);
+    EXPECT_EQ(milliseconds(90), rproxy.ack_round_trip());
+    EXPECT_DOUBLE_EQ(1.0 / 8 + (1.0 - 1.0 / 8) / 8, rproxy.nack_rate());
+
+    // Stopping the proxy clears the observations
+    rproxy.stop();
+    EXPECT_EQ(milliseconds(0), rproxy.ack_round_trip());
+    EXPECT_EQ(0.0, rproxy.nack_rate());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
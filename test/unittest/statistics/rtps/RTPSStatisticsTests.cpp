@@ -37,6 +37,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/statistics/IListeners.hpp>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
 #include <fastrtps/attributes/LibrarySettingsAttributes.h>
 #include <fastrtps/attributes/LibrarySettingsAttributes.h>
 #include <fastrtps/attributes/TopicAttributes.h>
@@ -1382,6 +1383,61 @@ TEST_F(RTPSStatisticsTests, statistics_rpts_unordered_datagrams)
     EXPECT_EQ(0, last_lost_data.byte_magnitude_order());
 }
 
+/*
+ * This test checks the startup profiler records the discovery phases once, in order and relative to the
+ * participant creation
+ */
+TEST_F(RTPSStatisticsTests, statistics_rpts_startup_profile)
+{
+    using namespace std;
+
+    auto count_phase = [](const StartupProfile& profile, StartupPhase phase) -> size_t
+            {
+                return static_cast<size_t>(count_if(profile.events.begin(), profile.events.end(),
+                       [phase](const StartupEvent& event)
+                       {
+                           return event.phase == phase;
+                       }));
+            };
+
+    // create local endpoints
+    uint16_t length = 255;
+    create_endpoints(length);
+    match_endpoints(false, "string", "statisticsSmallTopic");
+
+    StartupProfile profile;
+    {
+        RTPSStatisticsTestsImpl remote;
+        remote.create_participant();
+        remote.create_endpoints(length);
+        remote.match_endpoints(false, "string", "statisticsSmallTopic");
+
+        int loop = 0;
+        do
+        {
+            this_thread::sleep_for(chrono::milliseconds(100));
+            participant_->get_startup_profile(profile);
+        }
+        while (count_phase(profile, StartupPhase::REMOTE_PARTICIPANT_DISCOVERED) < 1 && ++loop < 30);
+
+        remote.remove_participant();
+    }
+
+    EXPECT_EQ(participant_->getGuid(), profile.participant_guid);
+    EXPECT_EQ(1u, count_phase(profile, StartupPhase::TRANSPORTS_INITIALIZED));
+    EXPECT_EQ(1u, count_phase(profile, StartupPhase::FIRST_PDP_ANNOUNCEMENT));
+    EXPECT_LE(1u, count_phase(profile, StartupPhase::REMOTE_PARTICIPANT_DISCOVERED));
+    // Only the first match of the local writer and the local reader is recorded, whichever the remote
+    EXPECT_EQ(2u, count_phase(profile, StartupPhase::ENDPOINT_MATCHED));
+
+    ASSERT_FALSE(profile.events.empty());
+    EXPECT_EQ(StartupPhase::TRANSPORTS_INITIALIZED, profile.events.front().phase);
+    for (size_t i = 1; i < profile.events.size(); ++i)
+    {
+        EXPECT_LE(profile.events[i - 1].elapsed, profile.events[i].elapsed);
+    }
+}
+
 } // namespace rtps
 } // namespace statistics
 } // namespace fastdds
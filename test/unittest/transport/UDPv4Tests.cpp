@@ -29,6 +29,7 @@
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using UDPv4Transport = eprosima::fastdds::rtps::UDPv4Transport;
+using NetworkBuffer = eprosima::fastdds::rtps::NetworkBuffer;
 
 #ifndef __APPLE__
 const uint32_t ReceiveBufferCapacity = 65536;
@@ -230,6 +231,71 @@ TEST_F(UDPv4Tests, send_to_loopback)
     senderThread->join();
     sem.wait();
 }
+
+TEST_F(UDPv4Tests, send_buffers_to_loopback)
+{
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, 127, 0, 0, 1); // Loopback
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, multicastLocator));
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator)); // Includes loopback
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(multicastLocator));
+    octet header[3] = { 'H', 'e', 'l' };
+    octet payload[2] = { 'l', 'o' };
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffers;
+    buffers.emplace_back(header, 3);
+    buffers.emplace_back(payload, 2);
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    auto sendThreadFunction = [&]()
+            {
+                LocatorList_t locator_list;
+                locator_list.push_back(multicastLocator);
+
+                bool sent = false;
+                for (auto& send_resource : send_resource_list)
+                {
+                    Locators locators_begin(locator_list.begin());
+                    Locators locators_end(locator_list.end());
+                    sent |= send_resource->send(buffers, 5, &locators_begin, &locators_end,
+                                    (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
+                    if (sent)
+                    {
+                        break;
+                    }
+                }
+                EXPECT_TRUE(sent);
+            };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    senderThread->join();
+    sem.wait();
+}
 #endif // ifndef __APPLE__
 
 TEST_F(UDPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
@@ -55,6 +55,15 @@ size_t MockTCPChannelResource::send(
     return 0;
 }
 
+size_t MockTCPChannelResource::send(
+        const octet*,
+        size_t,
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>&,
+        asio::error_code&)
+{
+    return 0;
+}
+
 asio::ip::tcp::endpoint MockTCPChannelResource::remote_endpoint() const
 {
     asio::ip::tcp::endpoint ep;
@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <utils/ByteSwap.hpp>
+
+using namespace eprosima::fastrtps;
+
+namespace {
+
+std::vector<uint8_t> pattern(
+        size_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return data;
+}
+
+std::vector<uint8_t> reversed(
+        const uint8_t* data,
+        size_t element_size,
+        size_t count)
+{
+    std::vector<uint8_t> result(element_size * count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < element_size; ++j)
+        {
+            result[i * element_size + j] = data[i * element_size + element_size - 1 - j];
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+/*!
+ * Elements of any size are swapped whatever their number and the alignment of the buffers, so the vectorized blocks
+ * and the remaining elements are covered.
+ */
+TEST(ByteSwapTests, swaps_each_element)
+{
+    for (size_t element_size : {1u, 2u, 4u, 8u})
+    {
+        for (size_t count = 0; count < 80; ++count)
+        {
+            for (size_t offset = 0; offset < 8; ++offset)
+            {
+                std::vector<uint8_t> source = pattern(offset + element_size * count);
+                std::vector<uint8_t> destination(offset + element_size * count + 1, 0xAA);
+                swap_bytes(source.data() + offset, destination.data() + offset, element_size, count);
+
+                std::vector<uint8_t> expected = reversed(source.data() + offset, element_size, count);
+                ASSERT_TRUE(std::equal(expected.begin(), expected.end(), destination.begin() + offset))
+                    << "element_size " << element_size << ", count " << count << ", offset " << offset;
+                // Nothing is written outside the destination
+                ASSERT_EQ(0xAA, destination.back());
+                for (size_t i = 0; i < offset; ++i)
+                {
+                    ASSERT_EQ(0xAA, destination[i]);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * Swapping a buffer in place gives the same result as swapping it into another one, and swapping it twice restores it.
+ */
+TEST(ByteSwapTests, swaps_in_place)
+{
+    constexpr size_t count = 1001;
+    for (size_t element_size : {2u, 4u, 8u})
+    {
+        std::vector<uint8_t> original = pattern(element_size * count);
+        std::vector<uint8_t> data = original;
+        swap_bytes(data.data(), data.data(), element_size, count);
+        EXPECT_EQ(reversed(original.data(), element_size, count), data);
+        swap_bytes(data.data(), data.data(), element_size, count);
+        EXPECT_EQ(original, data);
+    }
+}
+
+TEST(ByteSwapTests, implementation)
+{
+    std::string name = swap_bytes_implementation();
+    EXPECT_TRUE("avx2" == name || "ssse3" == name || "neon" == name || "scalar" == name);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -25,6 +25,7 @@
 #include <tinyxml2.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -874,6 +875,164 @@ TEST_F(XMLEndpointParserTests, lookforWriter)
     ASSERT_EQ(XMLP_ret::XML_ERROR, mp_edpXML->lookforWriter("WrongName", 15, &wdataptr));
 }
 
+/*
+ * This test checks the XMLEndpointParser::saveBinaryFile and XMLEndpointParser::loadBinaryFile methods.
+ * 1. Save the endpoints loaded from XML as a precompiled table and load it in a new parser.
+ * 2. Check the loaded endpoints are equal to the ones parsed from XML.
+ * 3. Check that files which are not endpoint tables are reported as XML_NOK, and are then parsed as XML.
+ */
+TEST_F(XMLEndpointParserTests, binaryTable)
+{
+    tinyxml2::XMLDocument xml_doc;
+    const std::string filename = "XMLEndpointParserTests_binaryTable.bin";
+    const std::string xml_filename = "XMLEndpointParserTests_binaryTable.xml";
+
+    const char* xml =
+            "\
+            <staticdiscovery>\
+                <participant>\
+                    <name>HelloWorldPublisher</name>\
+                    <reader>\
+                        <userId>3</userId>\
+                        <entityID>4</entityID>\
+                        <expectsInlineQos>true</expectsInlineQos>\
+                        <topicName>HelloWorldTopic</topicName>\
+                        <topicDataType>HelloWorld</topicDataType>\
+                        <topicKind>WITH_KEY</topicKind>\
+                        <partitionQos>HelloPartition</partitionQos>\
+                        <reliabilityQos>RELIABLE_RELIABILITY_QOS</reliabilityQos>\
+                        <durabilityQos>TRANSIENT_LOCAL_DURABILITY_QOS</durabilityQos>\
+                        <livelinessQos kind=\"MANUAL_BY_PARTICIPANT_LIVELINESS_QOS\" leaseDuration_ms=\"1000\"/>\
+                        <unicastLocator address=\"192.168.0.128\" port=\"5000\"/>\
+                        <multicastLocator address=\"239.255.1.1\" port=\"7000\"/>\
+                    </reader>\
+                    <writer>\
+                        <userId>5</userId>\
+                        <entityID>6</entityID>\
+                        <topicName>HelloWorldTopic</topicName>\
+                        <topicDataType>HelloWorld</topicDataType>\
+                        <topicKind>NO_KEY</topicKind>\
+                        <ownershipQos kind=\"EXCLUSIVE_OWNERSHIP_QOS\" strength=\"50\"/>\
+                        <unicastLocator address=\"192.168.0.128\" port=\"5001\"/>\
+                    </writer>\
+                </participant>\
+            </staticdiscovery>\
+            ";
+
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    ASSERT_EQ(XMLP_ret::XML_OK, mp_edpXML->loadXMLNode(xml_doc));
+    ASSERT_EQ(XMLP_ret::XML_OK, mp_edpXML->saveBinaryFile(filename));
+
+    XMLEndpointParser table_parser;
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.loadBinaryFile(filename));
+
+    ReaderProxyData* xml_rdata = nullptr;
+    ReaderProxyData* table_rdata = nullptr;
+    ASSERT_EQ(XMLP_ret::XML_OK, mp_edpXML->lookforReader("HelloWorldPublisher", 3, &xml_rdata));
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.lookforReader("HelloWorldPublisher", 3, &table_rdata));
+    EXPECT_EQ(xml_rdata->guid().entityId, table_rdata->guid().entityId);
+    EXPECT_EQ(xml_rdata->topicName(), table_rdata->topicName());
+    EXPECT_EQ(xml_rdata->typeName(), table_rdata->typeName());
+    EXPECT_EQ(xml_rdata->topicKind(), table_rdata->topicKind());
+    EXPECT_EQ(xml_rdata->m_expectsInlineQos, table_rdata->m_expectsInlineQos);
+    EXPECT_EQ(xml_rdata->m_qos.m_reliability.kind, table_rdata->m_qos.m_reliability.kind);
+    EXPECT_EQ(xml_rdata->m_qos.m_durability.kind, table_rdata->m_qos.m_durability.kind);
+    EXPECT_EQ(xml_rdata->m_qos.m_liveliness.kind, table_rdata->m_qos.m_liveliness.kind);
+    EXPECT_EQ(xml_rdata->m_qos.m_liveliness.lease_duration, table_rdata->m_qos.m_liveliness.lease_duration);
+    EXPECT_EQ(xml_rdata->m_qos.m_partition, table_rdata->m_qos.m_partition);
+    ASSERT_EQ(1u, table_rdata->remote_locators().unicast.size());
+    ASSERT_EQ(1u, table_rdata->remote_locators().multicast.size());
+    EXPECT_EQ(xml_rdata->remote_locators().unicast[0], table_rdata->remote_locators().unicast[0]);
+    EXPECT_EQ(xml_rdata->remote_locators().multicast[0], table_rdata->remote_locators().multicast[0]);
+
+    WriterProxyData* xml_wdata = nullptr;
+    WriterProxyData* table_wdata = nullptr;
+    ASSERT_EQ(XMLP_ret::XML_OK, mp_edpXML->lookforWriter("HelloWorldPublisher", 5, &xml_wdata));
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.lookforWriter("HelloWorldPublisher", 5, &table_wdata));
+    EXPECT_EQ(xml_wdata->guid().entityId, table_wdata->guid().entityId);
+    EXPECT_EQ(xml_wdata->topicKind(), table_wdata->topicKind());
+    EXPECT_EQ(xml_wdata->m_qos.m_ownership.kind, table_wdata->m_qos.m_ownership.kind);
+    EXPECT_EQ(xml_wdata->m_qos.m_ownershipStrength.value, table_wdata->m_qos.m_ownershipStrength.value);
+    ASSERT_EQ(1u, table_wdata->remote_locators().unicast.size());
+    EXPECT_TRUE(table_wdata->remote_locators().multicast.empty());
+    EXPECT_EQ(xml_wdata->remote_locators().unicast[0], table_wdata->remote_locators().unicast[0]);
+
+    ASSERT_EQ(XMLP_ret::XML_ERROR, table_parser.lookforWriter("HelloWorldPublisher", 3, &table_wdata));
+
+    // A regular XML file is not an endpoint table
+    {
+        std::ofstream xml_file(xml_filename);
+        xml_file << xml;
+    }
+    XMLEndpointParser xml_parser;
+    EXPECT_EQ(XMLP_ret::XML_NOK, xml_parser.loadBinaryFile(xml_filename));
+    std::string xml_file_name = xml_filename;
+    EXPECT_EQ(XMLP_ret::XML_OK, xml_parser.loadXMLFile(xml_file_name));
+    ASSERT_EQ(XMLP_ret::XML_OK, xml_parser.lookforWriter("HelloWorldPublisher", 5, &xml_wdata));
+
+    // Files shorter than the magic, or which do not exist, are not endpoint tables either
+    {
+        std::ofstream empty_file(filename, std::ios::trunc);
+    }
+    EXPECT_EQ(XMLP_ret::XML_NOK, xml_parser.loadBinaryFile(filename));
+    EXPECT_EQ(XMLP_ret::XML_NOK, xml_parser.loadBinaryFile("XMLEndpointParserTests_missing.bin"));
+
+    std::remove(filename.c_str());
+    std::remove(xml_filename.c_str());
+}
+
+/*
+ * This test checks that endpoints without entityID, which are several in many configurations, round-trip through
+ * a precompiled endpoint table, as their entity ids are left unset instead of being repeated.
+ */
+TEST_F(XMLEndpointParserTests, binaryTableWithoutEntityIds)
+{
+    tinyxml2::XMLDocument xml_doc;
+    const std::string filename = "XMLEndpointParserTests_binaryTableWithoutEntityIds.bin";
+
+    const char* xml =
+            "\
+            <staticdiscovery>\
+                <participant>\
+                    <name>HelloWorldPublisher</name>\
+                    <reader>\
+                        <userId>3</userId>\
+                        <topicName>HelloWorldTopic</topicName>\
+                        <topicDataType>HelloWorld</topicDataType>\
+                    </reader>\
+                    <writer>\
+                        <userId>5</userId>\
+                        <topicName>HelloWorldTopic</topicName>\
+                        <topicDataType>HelloWorld</topicDataType>\
+                    </writer>\
+                    <writer>\
+                        <userId>7</userId>\
+                        <topicName>OtherTopic</topicName>\
+                        <topicDataType>HelloWorld</topicDataType>\
+                    </writer>\
+                </participant>\
+            </staticdiscovery>\
+            ";
+
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    ASSERT_EQ(XMLP_ret::XML_OK, mp_edpXML->loadXMLNode(xml_doc));
+    ASSERT_EQ(XMLP_ret::XML_OK, mp_edpXML->saveBinaryFile(filename));
+
+    XMLEndpointParser table_parser;
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.loadBinaryFile(filename));
+
+    ReaderProxyData* rdata = nullptr;
+    WriterProxyData* wdata = nullptr;
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.lookforReader("HelloWorldPublisher", 3, &rdata));
+    EXPECT_EQ(c_EntityId_Unknown, rdata->guid().entityId);
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.lookforWriter("HelloWorldPublisher", 5, &wdata));
+    EXPECT_EQ("HelloWorldTopic", wdata->topicName());
+    ASSERT_EQ(XMLP_ret::XML_OK, table_parser.lookforWriter("HelloWorldPublisher", 7, &wdata));
+    EXPECT_EQ("OtherTopic", wdata->topicName());
+
+    std::remove(filename.c_str());
+}
+
 
 int main(
         int argc,
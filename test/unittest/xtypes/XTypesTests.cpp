@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdio>
+
 #include <fastrtps/types/TypeObjectFactory.h>
+#include <fastdds/builtin/typelookup/TypeLookupCache.hpp>
 #include <fastrtps/qos/QosPolicies.h>
 #include <fastdds/dds/log/Log.hpp>
 #include "idl/TypesTypeObject.h"
@@ -833,6 +836,139 @@ TEST_F(XTypesTests, MemberDescriptorFullyQualifiedName)
     EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, my_builder->add_member(member_id++, "tJ", my_builder->build()));
 }
 
+TEST_F(XTypesTests, TypeIdentifierLookupByValue)
+{
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+    auto make_identifier = [](uint32_t index)
+            {
+                TypeIdentifier identifier;
+                identifier._d(EK_MINIMAL);
+                memset(identifier.equivalence_hash(), 0, 14);
+                memcpy(identifier.equivalence_hash(), &index, sizeof(index));
+                return identifier;
+            };
+
+    const uint32_t num_types = 1000;
+    for (uint32_t i = 0; i < num_types; ++i)
+    {
+        TypeIdentifier identifier = make_identifier(i);
+        factory->add_type_identifier("LookupType" + std::to_string(i), &identifier);
+    }
+
+    // Identifiers are found by value, not by address
+    for (uint32_t i = 0; i < num_types; ++i)
+    {
+        TypeIdentifier identifier = make_identifier(i);
+        std::string name = "LookupType" + std::to_string(i);
+        EXPECT_EQ(name, factory->get_type_name(&identifier));
+        ASSERT_NE(nullptr, factory->get_type_identifier(name));
+        EXPECT_EQ(identifier, *factory->get_type_identifier(name));
+    }
+
+    // An equal identifier registered with another name shares the stored one, and the first name in alphabetical
+    // order is returned
+    TypeIdentifier identifier = make_identifier(7);
+    factory->add_type_identifier("AliasLookupType", &identifier);
+    EXPECT_EQ(factory->get_type_identifier("LookupType7"), factory->get_type_identifier("AliasLookupType"));
+    EXPECT_EQ("AliasLookupType", factory->get_type_name(&identifier));
+
+    TypeIdentifier unknown = make_identifier(num_types);
+    EXPECT_EQ("UNDEF", factory->get_type_name(&unknown));
+}
+
+TEST_F(XTypesTests, TypeObjectProviders)
+{
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+
+    // Builtin annotations are built the first time they are looked up
+    const TypeIdentifier* key_identifier = factory->get_type_identifier("key", true);
+    ASSERT_NE(nullptr, key_identifier);
+    EXPECT_NE(nullptr, factory->get_type_object(key_identifier));
+
+    // A provider only runs, once, when its type is looked up by name
+    TypeIdentifier identifier;
+    identifier._d(EK_MINIMAL);
+    memset(identifier.equivalence_hash(), 0x42, 14);
+    uint32_t runs = 0;
+    factory->add_type_object_provider("LazyType", [&]()
+            {
+                ++runs;
+                factory->add_type_identifier("LazyType", &identifier);
+            });
+    EXPECT_EQ(nullptr, factory->get_type_identifier("OtherType"));
+    EXPECT_EQ(0u, runs);
+    ASSERT_NE(nullptr, factory->get_type_identifier("LazyType"));
+    EXPECT_EQ(identifier, *factory->get_type_identifier("LazyType"));
+    EXPECT_EQ(1u, runs);
+
+    // Hashed identifiers not known by the factory run the pending providers
+    TypeIdentifier other_identifier;
+    other_identifier._d(EK_MINIMAL);
+    memset(other_identifier.equivalence_hash(), 0x24, 14);
+    factory->add_type_object_provider("OtherLazyType", [&]()
+            {
+                ++runs;
+                factory->add_type_identifier("OtherLazyType", &other_identifier);
+            });
+    EXPECT_EQ("OtherLazyType", factory->get_type_name(&other_identifier));
+    EXPECT_EQ(2u, runs);
+}
+
+TEST_F(XTypesTests, TypeLookupCache)
+{
+    using eprosima::fastdds::dds::builtin::TypeLookupCache;
+
+    TypeLookupCache& cache = TypeLookupCache::get_instance();
+    cache.clear();
+
+    const TypeIdentifier* identifier = GetBasicStructIdentifier(true);
+    const TypeObject* object = GetBasicStructObject(true);
+    ASSERT_NE(nullptr, identifier);
+    ASSERT_NE(nullptr, object);
+
+    TypeObject found;
+    EXPECT_FALSE(cache.get_type(*identifier, found));
+    cache.add_type(*identifier, *object);
+    ASSERT_TRUE(cache.get_type(*identifier, found));
+    EXPECT_EQ(*object, found);
+    EXPECT_EQ(1u, cache.hits());
+    EXPECT_EQ(1u, cache.misses());
+
+    // TypeObjects received are only cached when they are the ones hashed on their identifier
+    EXPECT_TRUE(TypeLookupCache::matches_hash(*identifier, *object));
+    EXPECT_TRUE(TypeLookupCache::matches_hash(*GetBasicStructIdentifier(false), *GetBasicStructObject(false)));
+    EXPECT_FALSE(TypeLookupCache::matches_hash(*identifier, *GetBasicStructObject(false)));
+    EXPECT_FALSE(TypeLookupCache::matches_hash(*identifier, *GetMinimalMyEnumStructObject()));
+    EXPECT_FALSE(TypeLookupCache::matches_hash(*GetBasicStructIdentifier(false), *GetMinimalMyEnumStructObject()));
+
+    // Only hashed identifiers have TypeObjects to cache
+    cache.add_type(*TypeObjectFactory::get_instance()->get_type_identifier("int32_t"), *object);
+    EXPECT_EQ(1u, cache.size());
+
+    // Types survive a save and load
+    const std::string filename = "TypeLookupCache.cdr";
+    ASSERT_TRUE(cache.save(filename));
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    ASSERT_TRUE(cache.load(filename));
+    ASSERT_TRUE(cache.get_type(*identifier, found));
+    EXPECT_EQ(*object, found);
+
+    // Entries of the file not matching their identifier are skipped when loading it
+    cache.add_type(*GetBasicStructIdentifier(false), *GetMinimalMyEnumStructObject());
+    EXPECT_EQ(2u, cache.size());
+    ASSERT_TRUE(cache.save(filename));
+    cache.clear();
+    ASSERT_TRUE(cache.load(filename));
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_FALSE(cache.get_type(*GetBasicStructIdentifier(false), found));
+    ASSERT_TRUE(cache.get_type(*identifier, found));
+    EXPECT_EQ(*object, found);
+
+    std::remove(filename.c_str());
+    cache.clear();
+}
+
 int main(
         int argc,
         char** argv)
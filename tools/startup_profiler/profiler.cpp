@@ -0,0 +1,92 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file profiler.cpp
+ *
+ * Creates a participant, lets discovery run for a while and prints the startup timeline it recorded:
+ * transports initialization, first announcement, remote participants discovered, endpoint matches,
+ * TypeLookup replies and security handshakes.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/statistics/dds/domain/DomainParticipant.hpp>
+#include <fastdds/statistics/rtps/StartupProfile.hpp>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastdds::statistics::StartupProfile;
+
+int main(
+        int argc,
+        char** argv)
+{
+    if (argc != 3 && argc != 5)
+    {
+        std::cout << "Usage: " << argv[0] << " <domain_id> <seconds> [<xml_profiles_file> <participant_profile>]"
+                  << std::endl;
+        return 1;
+    }
+
+    DomainId_t domain_id = static_cast<DomainId_t>(std::strtoul(argv[1], nullptr, 10));
+    unsigned long seconds = std::strtoul(argv[2], nullptr, 10);
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipant* participant = nullptr;
+    if (argc == 5)
+    {
+        if (ReturnCode_t::RETCODE_OK != factory->load_XML_profiles_file(argv[3]))
+        {
+            std::cerr << "Error loading " << argv[3] << std::endl;
+            return 1;
+        }
+        participant = factory->create_participant_with_profile(domain_id, argv[4]);
+    }
+    else
+    {
+        participant = factory->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    }
+
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+
+    int ret = 0;
+    StartupProfile profile;
+    eprosima::fastdds::statistics::dds::DomainParticipant* statistics_participant =
+            eprosima::fastdds::statistics::dds::DomainParticipant::narrow(participant);
+    if (nullptr == statistics_participant ||
+            ReturnCode_t::RETCODE_OK != statistics_participant->get_startup_profile(profile))
+    {
+        std::cerr << "Startup profile not available, Fast DDS must be built with FASTDDS_STATISTICS" << std::endl;
+        ret = 1;
+    }
+    else
+    {
+        std::cout << profile;
+    }
+
+    factory->delete_participant(participant);
+    return ret;
+}
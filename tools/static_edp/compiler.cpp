@@ -0,0 +1,78 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file compiler.cpp
+ *
+ * Precompiles a static EDP XML file into an endpoint table that participants load without any XML parsing.
+ * The generated file is used exactly as the XML one, i.e. setting "file://<table>" as static EDP configuration.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <fastrtps/xmlparser/XMLEndpointParser.h>
+
+using eprosima::fastrtps::xmlparser::XMLEndpointParser;
+using eprosima::fastrtps::xmlparser::XMLP_ret;
+
+int main(
+        int argc,
+        char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout << "Usage: " << argv[0] << " <static_edp.xml> <output_table>" << std::endl;
+        return 1;
+    }
+
+    std::string xml_file(argv[1]);
+    std::string table_file(argv[2]);
+
+    XMLEndpointParser xml_parser;
+    auto xml_start = std::chrono::steady_clock::now();
+    if (XMLP_ret::XML_OK != xml_parser.loadXMLFile(xml_file))
+    {
+        std::cerr << "Error parsing " << xml_file << std::endl;
+        return 1;
+    }
+    auto xml_end = std::chrono::steady_clock::now();
+
+    if (XMLP_ret::XML_OK != xml_parser.saveBinaryFile(table_file))
+    {
+        std::cerr << "Error writing " << table_file << std::endl;
+        return 1;
+    }
+
+    // Load the generated table back, both to validate it and to report the startup gain
+    XMLEndpointParser table_parser;
+    auto table_start = std::chrono::steady_clock::now();
+    if (XMLP_ret::XML_OK != table_parser.loadBinaryFile(table_file))
+    {
+        std::cerr << "Error loading generated table " << table_file << std::endl;
+        return 1;
+    }
+    auto table_end = std::chrono::steady_clock::now();
+
+    std::cout << "Generated " << table_file << std::endl;
+    std::cout << "XML load time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(xml_end - xml_start).count() << " us"
+              << std::endl;
+    std::cout << "Table load time: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(table_end - table_start).count() << " us"
+              << std::endl;
+
+    return 0;
+}